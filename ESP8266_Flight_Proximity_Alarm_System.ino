@@ -5,8 +5,19 @@
 #include "settings_manager.h"
 #include "wifi_manager.h"
 #include "alarm_manager.h"
+#include "led_patterns.h"
+#include "clock.h"
+#include "power_manager.h"
+#include "audio_engine.h"
 #include "flight_scanner.h"
 #include "web_server_handlers.h"
+#include "response_cache.h"
+#include "event_stream.h"
+#include "static_assets.h"
+#include "metrics.h"
+#include "scan_geometry.h"
+#include "geofence.h"
+#include "scan_trace.h"
 #include <FS.h>                  // For SPIFFS
 
 // Existing listLittleFSContents function (already using SPIFFS)
@@ -36,73 +47,100 @@ void setup() {
     Serial.println(F("\nFlight Proximity Alarm System Starting..."));
 
     // Initialize hardware pins
-    pinMode(LED_BUILTIN_PIN, OUTPUT);
-    digitalWrite(LED_BUILTIN_PIN, LOW); // Turn off LED initially (active LOW)
+    ledBegin();                         // LEDs off; patterns are stepped by ledTicker
     pinMode(SPEAKER_PIN, OUTPUT);
-    analogWriteFreq(8000);              // Set PWM frequency for audio (e.g., 8kHz)
-    analogWriteRange(1023);             // Set PWM range to 10-bit
+    audioEngineBegin();                 // Sigma-delta output on SPEAKER_PIN, timer1 at AUDIO_SAMPLE_RATE
 
     // --- File System Initialization (Using SPIFFS) ---
+    // The web UI is compiled into flash (web_assets.h), so the file system is only
+    // needed for settings; without it the device still runs on default settings.
     Serial.println(F("Initializing File System (SPIFFS)..."));
-    if (!SPIFFS.begin()) {
-        Serial.println(F("❌ An Error has occurred while mounting SPIFFS. Check wiring or ESP8266 board settings (Flash Size > FS size)."));
-        return;
+    if (SPIFFS.begin()) {
+        Serial.println(F("✅ SPIFFS mounted successfully."));
+        listLittleFSContents(); // This function now uses SPIFFS internally
+    } else {
+        Serial.println(F("❌ An Error has occurred while mounting SPIFFS. Check ESP8266 board settings (Flash Size > FS size). Continuing without it."));
     }
-    Serial.println(F("✅ SPIFFS mounted successfully."));
+    loadSettings(); // Load settings from the flash record (settings_manager.cpp will handle this)
+    loadGeofences(); // Polygon zones from /zones.bin, if any
+    rebuildScanGeometry(currentSettings); // Derived values used by every scan
 
-    listLittleFSContents(); // This function now uses SPIFFS internally
-    loadSettings(); // Load settings from file system (settings_manager.cpp will handle this)
+    clockBegin(); // SNTP syncs in the background once WiFi is up
 
-    // Connect to WiFi or start AP
+    // Start connecting to WiFi (or open the setup AP); handleWifiConnection() follows it up
     connectWiFi();
 
     // --- Web Server Setup ---
-    // IMPORTANT: Explicitly handle the root path ("/") to serve index.html
-    server.on("/", HTTP_GET, []() {
-        if (SPIFFS.exists("/index.html")) {
-            server.send(200, "text/html", SPIFFS.open("/index.html", "r").readString());
-        } else {
-            Serial.println(F("Error: /index.html not found on SPIFFS for root request!"));
-            server.send(404, "text/plain", "404: index.html not found for root path");
-        }
-    });
-
-    // Handle requests for other static files (like /style.css, /script.js)
-    server.serveStatic("/", SPIFFS, "/");
+    // The server is event-driven: requests are parsed and answered from network
+    // callbacks, several connections at a time, independently of loop().
+    // The root path serves index.html; other static files (/style.css, /script.js)
+    // are picked up by the not-found handler.
+    server.on("/", HTTP_GET, handleStaticAsset);
 
     // --- API ENDPOINT REGISTRATIONS
     server.on("/getSettings", HTTP_GET, handleGetSettings);
-    server.on("/saveSettings", HTTP_POST, handleSaveSettings);
+    server.on("/saveSettings", HTTP_POST, handleSaveSettings, nullptr, handleSaveSettingsBody);
     server.on("/restoreDefaults", HTTP_GET, handleRestoreDefaults);
     server.on("/rebootESP", HTTP_GET, handleRebootESP);
+    server.on("/uploadZones", HTTP_POST, handleUploadZones, nullptr, handleUploadZonesBody);
+    server.on("/getZones", HTTP_GET, handleGetZones);
+    server.on("/uploadClip", HTTP_POST, handleUploadClip, nullptr, handleUploadClipBody);
+    server.on("/deleteClip", HTTP_POST, handleDeleteClip);
+    server.on("/playClip", HTTP_POST, handlePlayClip);
+    server.on("/getClips", HTTP_GET, handleGetClips);
+    server.on("/getVoiceUnits", HTTP_GET, handleGetVoiceUnits);
 
-    // You would add handlers for livedat_2.html here later:
     server.on("/getLiveData", HTTP_GET, handleGetLiveData); // For live data updates
     server.on("/getScanHistory", HTTP_GET, handleGetScanHistory); // For scan history
+    setupEventStream(); // Server-Sent Events push channel (/events)
+    server.on("/metrics", HTTP_GET, handleMetrics); // Prometheus scrape endpoint
+#if SCAN_TRACE_ENABLED
+    server.on("/trace", HTTP_GET, handleTrace); // Scan stage spans, Chrome trace-event JSON
+#endif
 
     // --- 404 Not Found Handler ---
-    server.onNotFound([]() {
-        Serial.print(F("404 Not Found: "));
-        Serial.println(server.uri());
-        server.send(404, "text/plain", "404: Not Found on Server. (General fallback)");
-    });
+    server.onNotFound(handleNotFound);
 
     // Start HTTP server
     server.begin();
-    Serial.println(F("✅ HTTP server started."));
+    Serial.printf("✅ HTTP server started %lu ms after boot.\n", millis());
 
     // Initial LED state based on loaded settings (if any alarm was active from previous run)
     updateLED(currentOverallAlarmLevel);
 
-    // Start the first flight scan after a short delay
-    startFlightScanTimer();
+    // Serve empty (but valid) live data until the first scan completes
+    rebuildResponseCaches();
+
+    // Run the first flight scan on the first loop() pass
+    requestFlightScan();
 }
 
 void loop() {
-  
-    performFlightScan();
-    server.handleClient();
+    uint32_t passStartUs = micros();
+    bool scanned = false;
+
+    if (settingsChangePending) {
+        settingsChangePending = false;
+        applySettingsChange(); // Flags an immediate scan, picked up just below
+    }
+    if (flightScanDue) {
+        flightScanDue = false;
+        powerWake(); // Radio fully on for the scan's request
+        performFlightScan();
+        startFlightScanTimer();
+        scanned = true;
+    }
+    serviceEventStreams();
+    serviceClipUpload(); // Flash writes of a sound upload, kept out of the network callbacks
     handleWifiConnection();
-    timeClient.update();
+
+    if (rebootRequested) {
+        delay(100); // Give the /rebootESP reply time to go out
+        ESP.restart();
+    }
+    metricsRecordLoopPass(micros() - passStartUs, scanned);
+
+    // Sleep until the next scan when nothing else needs the device (power_manager.cpp)
+    powerIdle();
 
 }
@@ -0,0 +1,783 @@
+// alarm_clips.h
+// GENERATED by tools/encode_alarm_clips.py from audio/ -- do not edit by hand.
+#ifndef ALARM_CLIPS_H
+#define ALARM_CLIPS_H
+
+#include <Arduino.h>
+
+struct AlarmClip {
+    const char* name;
+    const uint8_t* data;   // IMA-ADPCM in PROGMEM, two samples per byte, low nibble first
+    uint32_t sampleCount;  // At AUDIO_SAMPLE_RATE
+};
+
+enum AlarmClipId {
+    ALARM_CLIP_LEVEL1BREACH,
+    ALARM_CLIP_LEVEL2BREACH,
+    ALARM_CLIP_LEVEL3BREACH,
+    ALARM_CLIP_COUNT
+};
+
+static const uint8_t alarmClip_level1breach[] PROGMEM = {
+0x00, 0xf0, 0xff, 0x6f, 0x3b, 0x0c, 0x08, 0x6d, 0x89, 0xa0, 0x82, 0x3a, 0x3c, 0x4b, 0x3b, 0x08,
+0xc8, 0xc3, 0xb4, 0x48, 0xc0, 0xb3, 0xb3, 0x48, 0x4b, 0x3b, 0x7c, 0x19, 0x19, 0x3a, 0x3b, 0x3b,
+0xd0, 0xb3, 0xb3, 0x88, 0x4d, 0x3b, 0x3c, 0xc0, 0xb3, 0xb3, 0xc4, 0x30, 0x3c, 0x3b, 0x4b, 0x3c,
+0xc0, 0x83, 0x4b, 0x3b, 0xb4, 0xb4, 0x83, 0xc0, 0xc3, 0x03, 0x08, 0x08, 0x3e, 0x7c, 0x2b, 0x9a,
+0x01, 0x3b, 0x1e, 0x1b, 0x0a, 0xf0, 0x01, 0x2a, 0xa8, 0x83, 0x33, 0x70, 0x20, 0x82, 0x86, 0x94,
+0xa3, 0x20, 0x78, 0x08, 0x00, 0xc8, 0xa0, 0x8b, 0x0a, 0x0b, 0xed, 0xc9, 0xaa, 0x8b, 0xa0, 0x9c,
+0x9c, 0x8b, 0x12, 0x27, 0x73, 0x11, 0x13, 0x42, 0x40, 0x01, 0x80, 0x9a, 0xdb, 0xc8, 0xb0, 0xc8,
+0xc0, 0x90, 0x19, 0x31, 0x52, 0x41, 0x41, 0x31, 0x11, 0xa3, 0x82, 0xac, 0xf9, 0xab, 0x9f, 0x9a,
+0x9b, 0x8a, 0x8b, 0xcb, 0x99, 0x01, 0x05, 0x15, 0x15, 0x23, 0x24, 0x14, 0x32, 0x30, 0x19, 0x8a,
+0x9d, 0x8d, 0xbb, 0xca, 0xb9, 0x99, 0x91, 0x26, 0x40, 0x32, 0x14, 0x03, 0x32, 0x19, 0x89, 0x9d,
+0x9e, 0x9e, 0xba, 0x9b, 0x0c, 0x0b, 0x8c, 0xaa, 0x98, 0x41, 0x61, 0x22, 0x53, 0x41, 0x31, 0x43,
+0x22, 0x81, 0x90, 0x9c, 0xbb, 0xfb, 0xb9, 0xc9, 0x8a, 0x09, 0x40, 0x42, 0x32, 0x61, 0x11, 0x22,
+0x10, 0x89, 0xab, 0xae, 0xac, 0xbc, 0xac, 0x9b, 0x8a, 0x9c, 0x9b, 0x0a, 0x08, 0x44, 0x26, 0x33,
+0x26, 0x51, 0x21, 0x02, 0x03, 0x0a, 0x9d, 0xbb, 0xd9, 0xb9, 0xa9, 0xa9, 0x3b, 0x50, 0x71, 0x12,
+0x12, 0x12, 0x12, 0x83, 0xa2, 0x9e, 0x9d, 0xbb, 0x9d, 0x8c, 0x9b, 0xa8, 0xb0, 0x99, 0x8d, 0x18,
+0x51, 0x53, 0x33, 0x34, 0x24, 0x33, 0x34, 0x91, 0xd0, 0xb9, 0x9e, 0x9a, 0xca, 0xa8, 0x09, 0x49,
+0x51, 0x34, 0x11, 0x82, 0x92, 0x02, 0xd0, 0xc9, 0xbb, 0xcb, 0x8b, 0x9b, 0xad, 0x1b, 0xfa, 0x99,
+0xb8, 0x41, 0x51, 0x43, 0x32, 0x43, 0x43, 0x32, 0x20, 0xe9, 0xba, 0xba, 0xab, 0xab, 0x9d, 0x19,
+0x58, 0x34, 0x34, 0x02, 0x28, 0x29, 0x01, 0xea, 0xdb, 0x9b, 0x89, 0xa8, 0xcb, 0x9d, 0x8a, 0xaa,
+0xcd, 0xbc, 0x30, 0x66, 0x42, 0x01, 0x01, 0x21, 0x11, 0xc9, 0xae, 0x9b, 0x88, 0x80, 0x19, 0x40,
+0x73, 0x12, 0x88, 0x0b, 0x89, 0x03, 0xb0, 0xcb, 0x9a, 0x23, 0x58, 0xb9, 0xbe, 0xcb, 0xba, 0xbe,
+0xbc, 0x19, 0x57, 0x33, 0x12, 0x18, 0x80, 0x90, 0xcd, 0xba, 0x8a, 0x81, 0x12, 0x41, 0x25, 0x12,
+0xa9, 0x9b, 0x8a, 0x02, 0x3c, 0x80, 0x15, 0x19, 0xb9, 0x9b, 0xd8, 0xbe, 0xcd, 0x99, 0xa9, 0x9d,
+0x69, 0x27, 0x13, 0x90, 0x88, 0x99, 0xb9, 0x9e, 0x10, 0x22, 0x82, 0x00, 0x21, 0xb2, 0xbf, 0x8a,
+0x52, 0x00, 0x00, 0x30, 0x81, 0x9a, 0xaa, 0xa4, 0xae, 0xcc, 0x19, 0x9b, 0xa9, 0x8a, 0x70, 0x57,
+0x01, 0x90, 0x89, 0xb0, 0x99, 0x0a, 0x25, 0x10, 0x98, 0x20, 0x90, 0xd8, 0x9b, 0x93, 0x33, 0x82,
+0x33, 0x9b, 0xe3, 0x08, 0xb8, 0xf1, 0xbb, 0xec, 0x9a, 0x8a, 0x98, 0x4b, 0x77, 0x22, 0x90, 0x9a,
+0x90, 0x9b, 0x0b, 0x73, 0x01, 0x88, 0x28, 0x81, 0xca, 0x9a, 0x62, 0x80, 0x81, 0x28, 0xa8, 0x8a,
+0x39, 0xa2, 0xdf, 0xba, 0xa8, 0xc9, 0x89, 0xa0, 0x77, 0x14, 0x91, 0x99, 0x88, 0x9b, 0x8a, 0x41,
+0x13, 0x00, 0x19, 0x02, 0x8b, 0x9c, 0x48, 0x00, 0x03, 0x91, 0xb1, 0x08, 0xf1, 0xc9, 0xca, 0xfa,
+0xba, 0x9a, 0xc8, 0x18, 0x77, 0x13, 0x81, 0x9a, 0xa0, 0xbb, 0x89, 0x53, 0x02, 0x80, 0x30, 0x82,
+0xbb, 0xdb, 0x23, 0x01, 0x92, 0x19, 0xa1, 0x9c, 0x9b, 0xf9, 0xbf, 0xba, 0xa8, 0xab, 0x0a, 0x77,
+0x15, 0x02, 0x99, 0x09, 0x9b, 0x9a, 0x38, 0x23, 0x30, 0x11, 0x23, 0xf8, 0x88, 0x2b, 0x88, 0x31,
+0xb1, 0xa3, 0x9f, 0x89, 0xac, 0xcd, 0x8c, 0xba, 0xb9, 0x8a, 0x77, 0x24, 0x01, 0x89, 0xa0, 0xaa,
+0xab, 0x31, 0x32, 0x20, 0x50, 0x23, 0xa8, 0xac, 0x08, 0x8a, 0x19, 0x69, 0x09, 0x8d, 0x9c, 0x99,
+0xac, 0xbc, 0xbb, 0x8b, 0x75, 0x33, 0x33, 0x11, 0x00, 0xc9, 0xb9, 0x89, 0x08, 0x3a, 0x38, 0x74,
+0x00, 0x93, 0xa0, 0xc9, 0x19, 0x39, 0x0a, 0xcc, 0x9d, 0xaa, 0x90, 0xd8, 0xb9, 0xbb, 0xc9, 0x36,
+0x42, 0x22, 0x50, 0x28, 0x29, 0x09, 0x38, 0x39, 0xd0, 0xa0, 0xa2, 0x94, 0xa2, 0x82, 0x3a, 0x1f,
+0x2a, 0x1c, 0xa9, 0xd8, 0xa8, 0x2c, 0x0d, 0x89, 0x0a, 0x2a, 0x2a, 0x6a, 0x80, 0x23, 0x6a, 0x10,
+0x32, 0x3b, 0xb3, 0x84, 0x34, 0x7b, 0x19, 0x20, 0x3d, 0x0a, 0x2a, 0x8a, 0x0b, 0xf9, 0x88, 0x2d,
+0xaa, 0x80, 0x8a, 0x4b, 0x8b, 0x80, 0x3c, 0xb5, 0xb3, 0x03, 0x08, 0x05, 0x58, 0x78, 0x19, 0x10,
+0xb3, 0x83, 0x30, 0x4b, 0x3c, 0xb3, 0xf4, 0x91, 0x2a, 0x0a, 0x3b, 0x1f, 0x8b, 0xa2, 0xb3, 0x3b,
+0x4b, 0x4b, 0x3f, 0x1b, 0x2a, 0x3a, 0x3b, 0x08, 0x08, 0xb5, 0x97, 0x28, 0x38, 0x0b, 0x7b, 0x39,
+0xa0, 0xb2, 0x97, 0x98, 0x82, 0xa8, 0xb6, 0x21, 0x8c, 0xc0, 0x93, 0x4a, 0xa0, 0xa8, 0x83, 0x3f,
+0x19, 0xa0, 0xa2, 0xb2, 0xc0, 0x43, 0x8b, 0x40, 0x1f, 0x80, 0x82, 0x60, 0x1b, 0x1b, 0x3a, 0x6b,
+0x39, 0x2c, 0x0a, 0x28, 0x80, 0x80, 0xe4, 0x08, 0x28, 0xe0, 0x03, 0xc1, 0x08, 0xd2, 0x08, 0x38,
+0x3b, 0x8b, 0xc0, 0x3f, 0x10, 0x5a, 0x39, 0xaa, 0xd3, 0x01, 0x01, 0x95, 0xc5, 0x11, 0x2b, 0x18,
+0x49, 0x2a, 0x1c, 0xe2, 0x98, 0x03, 0x2e, 0x0a, 0x19, 0x9a, 0xa2, 0xd2, 0x91, 0xa1, 0xb3, 0xb3,
+0x6c, 0x89, 0x24, 0x4a, 0x10, 0x24, 0xa1, 0x50, 0x89, 0x08, 0x3d, 0xc9, 0x21, 0x08, 0xb2, 0xfa,
+0x89, 0x4e, 0x80, 0x90, 0x9a, 0x0f, 0x88, 0x21, 0x1a, 0xc8, 0xa2, 0x14, 0x68, 0x30, 0x18, 0xa0,
+0x82, 0x40, 0x0a, 0x5a, 0x1d, 0x08, 0x38, 0x8b, 0x02, 0x08, 0x78, 0x8f, 0xc8, 0x90, 0xa1, 0xa2,
+0xca, 0xbc, 0xa8, 0x59, 0x34, 0x26, 0x13, 0x91, 0x8b, 0xb8, 0x11, 0x01, 0xf8, 0x9b, 0x9b, 0x70,
+0x31, 0x24, 0x88, 0xd8, 0x88, 0x99, 0xb1, 0xb1, 0xca, 0xae, 0xaa, 0xbb, 0x08, 0x7e, 0x22, 0x34,
+0x30, 0x90, 0xa9, 0xaa, 0x08, 0x98, 0xe1, 0xa9, 0x9a, 0x32, 0x27, 0x15, 0x01, 0xa9, 0xa9, 0x8a,
+0xa8, 0xd1, 0xca, 0xfb, 0xa9, 0x99, 0x09, 0x79, 0x32, 0x45, 0x21, 0x81, 0x9a, 0xca, 0x98, 0x98,
+0xa1, 0x8a, 0x9c, 0x40, 0x71, 0x23, 0x13, 0xa0, 0xb9, 0x0e, 0x99, 0x88, 0xca, 0xca, 0xcb, 0xb9,
+0x99, 0x82, 0x75, 0x41, 0x14, 0x11, 0x90, 0x9a, 0x9c, 0xa8, 0x80, 0xb9, 0xd0, 0x80, 0x33, 0x37,
+0x32, 0x02, 0x8a, 0xbc, 0xc8, 0x98, 0xc8, 0xaa, 0x9f, 0x9a, 0x8b, 0x09, 0x42, 0x26, 0x35, 0x22,
+0x02, 0xb9, 0xd8, 0x8a, 0x9a, 0xb0, 0xa9, 0x9b, 0x6a, 0x60, 0x24, 0x32, 0x81, 0xa9, 0xba, 0xdb,
+0x90, 0x9b, 0xad, 0xeb, 0xa9, 0x9a, 0x10, 0x70, 0x23, 0x27, 0x12, 0x01, 0x8a, 0xbb, 0xb8, 0x9a,
+0xc8, 0x9a, 0x9b, 0x40, 0x73, 0x24, 0x24, 0x00, 0xa8, 0x9b, 0xab, 0xb9, 0xcb, 0xfa, 0xba, 0xbb,
+0xc9, 0x20, 0x60, 0x25, 0x25, 0x12, 0x02, 0x99, 0xba, 0xbb, 0xba, 0xc9, 0xa9, 0x9b, 0x7a, 0x50,
+0x33, 0x63, 0x01, 0x80, 0x8c, 0xaa, 0xa9, 0xb9, 0xc9, 0xcc, 0xba, 0x9b, 0x29, 0x70, 0x24, 0x16,
+0x23, 0x01, 0x88, 0xba, 0xaa, 0xcb, 0xc0, 0x99, 0xaa, 0x08, 0x42, 0x55, 0x33, 0x23, 0x00, 0x9b,
+0xac, 0xac, 0xa9, 0xda, 0xbc, 0xac, 0x9b, 0x0a, 0x48, 0x35, 0x45, 0x33, 0x13, 0x81, 0xa9, 0x9c,
+0x9c, 0xaa, 0xca, 0xa9, 0x0a, 0x08, 0x27, 0x34, 0x34, 0x21, 0x88, 0xa8, 0xac, 0xbb, 0xdb, 0xdb,
+0xba, 0x9c, 0x8b, 0x19, 0x31, 0x37, 0x54, 0x32, 0x22, 0x80, 0xb8, 0xab, 0xad, 0x9a, 0xac, 0xb9,
+0x80, 0x11, 0x36, 0x63, 0x23, 0x22, 0x08, 0xaa, 0x9d, 0xab, 0xac, 0xac, 0xac, 0x8c, 0xaa, 0x08,
+0x00, 0x35, 0x46, 0x33, 0x33, 0x11, 0x99, 0xbb, 0xbc, 0xab, 0x9d, 0xc9, 0x99, 0x80, 0x32, 0x26,
+0x26, 0x12, 0x83, 0x91, 0xaa, 0xe9, 0xb8, 0xab, 0xcc, 0xca, 0x99, 0x99, 0x90, 0x1a, 0x69, 0x43,
+0x26, 0x34, 0x20, 0x80, 0xb0, 0x99, 0xba, 0xc8, 0x9b, 0x9d, 0x0b, 0x1a, 0x62, 0x33, 0x25, 0x32,
+0x28, 0x89, 0x9a, 0x8d, 0x9c, 0xad, 0xbb, 0xbc, 0xa8, 0xa1, 0xc8, 0xb8, 0x08, 0x27, 0x45, 0x33,
+0x32, 0x10, 0x80, 0x89, 0x9a, 0xab, 0x9d, 0xeb, 0x99, 0x09, 0x18, 0x50, 0x31, 0x53, 0x40, 0x01,
+0x00, 0x8a, 0x8b, 0x9f, 0xbc, 0x9b, 0xcb, 0xb8, 0xb1, 0x9b, 0x8d, 0x2b, 0x61, 0x63, 0x42, 0x31,
+0x31, 0x20, 0x29, 0x88, 0x0b, 0x8c, 0xdb, 0xb9, 0xa9, 0xa9, 0xb0, 0x63, 0x50, 0x22, 0x14, 0x11,
+0xa2, 0x0a, 0x9d, 0x9e, 0xab, 0xdb, 0x8a, 0x8c, 0x9b, 0x9b, 0xc9, 0x39, 0x42, 0x35, 0x27, 0x22,
+0x13, 0x31, 0x18, 0x19, 0x89, 0x0c, 0xcc, 0xc8, 0xa8, 0xb0, 0x01, 0x4a, 0x40, 0x01, 0x14, 0x84,
+0x82, 0xa0, 0xf9, 0xc8, 0xa9, 0x9c, 0x9a, 0xba, 0xc9, 0xb8, 0xda, 0x99, 0x01, 0x24, 0x27, 0x15,
+0x23, 0x04, 0x12, 0x10, 0x19, 0xb8, 0xc8, 0xa9, 0xfa, 0xa1, 0x08, 0x1b, 0x80, 0x32, 0x38, 0x06,
+0x82, 0x02, 0x08, 0x8f, 0x8b, 0xec, 0xa9, 0xa9, 0xd8, 0x90, 0x0d, 0x9a, 0x09, 0x4a, 0x38, 0x17,
+0x33, 0x04, 0x14, 0x11, 0x20, 0x08, 0x98, 0xa9, 0x9d, 0x8b, 0x0c, 0xc8, 0x98, 0xa2, 0xa5, 0x14,
+0x82, 0x82, 0x83, 0x0b, 0x0c, 0xdc, 0xca, 0xe9, 0xb0, 0x88, 0x9b, 0xca, 0x8b, 0x89, 0x5a, 0x42,
+0x43, 0x36, 0x32, 0x04, 0x03, 0x02, 0x98, 0xa1, 0xaa, 0xec, 0xb0, 0xc0, 0xa0, 0xa0, 0xa2, 0x53,
+0x12, 0x20, 0x30, 0x3c, 0x8b, 0xf8, 0x9c, 0xe9, 0xb8, 0xb0, 0xb8, 0xe0, 0x98, 0x0c, 0x89, 0x30,
+0x33, 0x37, 0x34, 0x53, 0x20, 0x21, 0x19, 0x09, 0x0c, 0x8b, 0x8d, 0x8a, 0x8d, 0xb0, 0xa2, 0x84,
+0x24, 0x50, 0x81, 0x01, 0x0a, 0x8c, 0xeb, 0xc9, 0xb9, 0xc9, 0x90, 0xaa, 0xac, 0xcb, 0xaa, 0x60,
+0x62, 0x53, 0x32, 0x23, 0x82, 0xb1, 0xb0, 0xbb, 0xd9, 0xc9, 0xc0, 0xa0, 0x08, 0x08, 0x43, 0x16,
+0x23, 0x21, 0x80, 0x0b, 0xac, 0xab, 0xaf, 0xad, 0xab, 0x9b, 0x1a, 0x9b, 0xbe, 0x8e, 0x88, 0x53,
+0x36, 0x34, 0x32, 0x81, 0xb8, 0xbb, 0xac, 0xaa, 0xb0, 0xb0, 0xa9, 0x08, 0x34, 0x47, 0x43, 0x21,
+0x09, 0x9b, 0x9b, 0x0c, 0x19, 0x0b, 0xcd, 0xac, 0x9b, 0xc9, 0xb1, 0xcc, 0xbd, 0x8b, 0x58, 0x37,
+0x35, 0x22, 0x91, 0xb9, 0xbc, 0x9a, 0x09, 0x18, 0x98, 0x98, 0x31, 0x64, 0x43, 0x10, 0xb8, 0xab,
+0xab, 0x01, 0x25, 0x93, 0xc9, 0xdb, 0xbb, 0xb8, 0xd1, 0xd9, 0xda, 0xaa, 0x9a, 0x72, 0x54, 0x24,
+0x12, 0xa8, 0xca, 0x9b, 0x89, 0x01, 0x82, 0x98, 0x0a, 0x62, 0x53, 0x02, 0xd9, 0xca, 0x89, 0x32,
+0x25, 0x81, 0xca, 0xaa, 0x00, 0x21, 0x98, 0xde, 0xaa, 0x89, 0x10, 0x08, 0x38, 0x47, 0x44, 0x02,
+0xa0, 0xad, 0x9a, 0x11, 0x11, 0xa1, 0xaa, 0x18, 0x55, 0x13, 0xc0, 0xbc, 0x9a, 0x41, 0x24, 0x82,
+0xb9, 0xab, 0x10, 0x31, 0xb0, 0xbf, 0xac, 0x88, 0x01, 0x81, 0xb9, 0x41, 0x47, 0x25, 0x00, 0xca,
+0xba, 0x08, 0x32, 0x13, 0xa9, 0xcb, 0x89, 0x02, 0x81, 0xa9, 0x83, 0x47, 0x22, 0xa9, 0xae, 0x1a,
+0x22, 0x13, 0xaa, 0xac, 0x42, 0x33, 0xa8, 0x9e, 0x48, 0x44, 0x00, 0xab, 0x0c, 0x22, 0x21, 0x9c,
+0x9b, 0x0c, 0x99, 0xbf, 0xba, 0x9b, 0xaf, 0xab, 0x62, 0x47, 0x22, 0xa8, 0xab, 0x1a, 0x22, 0x02,
+0xbb, 0x9a, 0x22, 0xa4, 0x80, 0x2b, 0x43, 0x31, 0xcc, 0x91, 0x32, 0x06, 0x90, 0xc9, 0x91, 0xac,
+0xe8, 0x98, 0xab, 0xbc, 0xac, 0xbb, 0x1c, 0x77, 0x33, 0x81, 0xaa, 0x0a, 0x30, 0x90, 0xa8, 0x19,
+0x93, 0xb0, 0x8e, 0x41, 0x11, 0xe1, 0x08, 0x31, 0x02, 0x9b, 0x81, 0x25, 0x98, 0xed, 0x99, 0xb8,
+0xca, 0xab, 0xa1, 0x9d, 0x9b, 0x76, 0x24, 0x01, 0x9a, 0x80, 0x10, 0xa8, 0x19, 0x28, 0xb2, 0x8f,
+0x09, 0x32, 0x00, 0x98, 0x40, 0x84, 0xb1, 0x9a, 0x85, 0x04, 0xba, 0xf9, 0x99, 0xca, 0x8b, 0x9a,
+0xba, 0xdb, 0x08, 0x77, 0x23, 0x80, 0x88, 0x81, 0x90, 0xab, 0x13, 0xa1, 0xea, 0x18, 0x01, 0x02,
+0x4a, 0x11, 0x81, 0x80, 0x95, 0x88, 0x99, 0x41, 0xfb, 0xda, 0x89, 0xbc, 0xab, 0x0b, 0xb9, 0x9d,
+0x79, 0x36, 0x12, 0x00, 0x22, 0xa0, 0xb9, 0x18, 0xc1, 0x8d, 0x2b, 0x92, 0x88, 0x31, 0x16, 0xa0,
+0x22, 0x48, 0x89, 0x29, 0x0b, 0xfb, 0x0c, 0x9c, 0xab, 0x8e, 0xa9, 0xb8, 0x8a, 0x88, 0x46, 0x05,
+0x22, 0x32, 0x02, 0x80, 0x81, 0x82, 0xfa, 0x98, 0x80, 0xb8, 0xa1, 0x23, 0x08, 0x1d, 0x40, 0x38,
+0x20, 0x08, 0xb5, 0xe8, 0xc8, 0xd9, 0xbb, 0xba, 0x9e, 0xac, 0x99, 0x00, 0x02, 0x35, 0x36, 0x32,
+0x23, 0x15, 0x22, 0x08, 0x88, 0xa8, 0xab, 0x9d, 0x0b, 0xdb, 0x88, 0x2a, 0x4a, 0x48, 0x38, 0xc2,
+0x80, 0x9c, 0xec, 0xba, 0xea, 0xb9, 0xca, 0x08, 0x10, 0x41, 0x44, 0x33, 0x42, 0x32, 0x23, 0x04,
+0x19, 0x98, 0xda, 0xa8, 0xa8, 0x9b, 0x8d, 0x98, 0x2a, 0x4a, 0x41, 0x10, 0x2a, 0x8c, 0x9e, 0xdb,
+0x9b, 0xdd, 0xa9, 0xba, 0x80, 0x82, 0x35, 0x35, 0x52, 0x12, 0x23, 0x13, 0x82, 0x82, 0x9a, 0x8f,
+0xa9, 0xa0, 0xca, 0x88, 0x1b, 0x09, 0x03, 0x04, 0xa4, 0xc2, 0xb1, 0xfb, 0xbb, 0xfa, 0xba, 0xab,
+0x9d, 0x81, 0x10, 0x35, 0x15, 0x14, 0x23, 0x33, 0x22, 0x01, 0x90, 0xb9, 0x0d, 0x8c, 0xab, 0xbb,
+0xc9, 0x80, 0x49, 0x48, 0x01, 0x01, 0xd2, 0xe1, 0xc0, 0x9a, 0xae, 0x9b, 0xcc, 0xa9, 0x81, 0x00,
+0x26, 0x33, 0x24, 0x24, 0x24, 0x21, 0x81, 0x92, 0xa9, 0x9a, 0x9b, 0x9e, 0x9c, 0x0b, 0xb9, 0x01,
+0x01, 0x15, 0x28, 0x38, 0xd8, 0xc8, 0x8d, 0xbd, 0x9d, 0xbb, 0x9c, 0x98, 0x00, 0x71, 0x31, 0x53,
+0x32, 0x42, 0x12, 0x03, 0x01, 0xa0, 0x9a, 0xab, 0xeb, 0xca, 0xa9, 0x8a, 0x2b, 0x08, 0x22, 0x60,
+0x28, 0x38, 0x1d, 0xcc, 0xd8, 0xcb, 0x9c, 0xcb, 0xaa, 0x09, 0x29, 0x73, 0x13, 0x25, 0x33, 0x53,
+0x31, 0x10, 0x28, 0x8a, 0x8b, 0xca, 0xd8, 0xaa, 0xaa, 0x99, 0x0a, 0x2a, 0x02, 0x96, 0x03, 0x38,
+0x8b, 0xce, 0xf0, 0xba, 0xda, 0xba, 0xab, 0x1b, 0x3a, 0x34, 0x27, 0x24, 0x24, 0x32, 0x14, 0x02,
+0x81, 0x80, 0x0c, 0x8b, 0x8c, 0xea, 0x98, 0x0a, 0x8a, 0x29, 0x4a, 0x08, 0xa3, 0x94, 0x82, 0xda,
+0xd8, 0xfa, 0xa8, 0xab, 0xac, 0x9b, 0x1a, 0x49, 0x33, 0x27, 0x25, 0x22, 0x14, 0x13, 0x02, 0x18,
+0x8a, 0x99, 0xb9, 0x9c, 0x9d, 0x8c, 0x0b, 0x99, 0x2a, 0x3c, 0x0a, 0x94, 0x94, 0xc3, 0x91, 0x8e,
+0xea, 0xc8, 0xb8, 0xb9, 0xac, 0xa8, 0x81, 0x44, 0x41, 0x63, 0x22, 0x33, 0x23, 0x14, 0x80, 0xa1,
+0xb8, 0xb0, 0x9c, 0xcc, 0xa9, 0xb9, 0xa0, 0xb0, 0x80, 0x30, 0xc0, 0x96, 0xa4, 0xa2, 0x0a, 0x9e,
+0xab, 0x9e, 0xba, 0x0d, 0x0c, 0x8b, 0x91, 0x03, 0x35, 0x32, 0x17, 0x23, 0x52, 0x11, 0x02, 0x02,
+0x2a, 0x0c, 0x8b, 0xcb, 0xd8, 0x98, 0x2b, 0xaa, 0xb0, 0x03, 0xc3, 0x06, 0x28, 0x08, 0x3b, 0xc0,
+0xc0, 0xad, 0x0c, 0x9c, 0x8b, 0x8c, 0x8b, 0x0a, 0x3b, 0x00, 0x07, 0x84, 0x26, 0x31, 0x50, 0x20,
+0x30, 0x28, 0xa8, 0xa2, 0x08, 0x1f, 0x2b, 0x1c, 0x0a, 0xa8, 0xb3, 0xb8, 0x84, 0xc0, 0xb3, 0xc8,
+0x48, 0x8b, 0x4b, 0x8f, 0xc2, 0x01, 0xaa, 0xb2, 0xb0, 0xc8, 0x4b, 0x1e, 0x1b, 0xb0, 0x83, 0xb4,
+0x17, 0x11, 0x40, 0x48, 0x80, 0x94, 0xa3, 0x22, 0x2a, 0x4b, 0xbb, 0xb4, 0xb3, 0xc3, 0xc0, 0xb3,
+0x3c, 0x8b, 0x0c, 0xb3, 0xf4, 0x01, 0x08, 0x3b, 0x3b, 0x1f, 0xa0, 0xa8, 0x80, 0x8b, 0x0c, 0x3c,
+0x1f, 0x29, 0x2a, 0x3b, 0x48, 0x08, 0x83, 0x04, 0x03, 0x44, 0x7b, 0x39, 0x2a, 0x80, 0xb3, 0xb3,
+0xc3, 0x84, 0x4b, 0x3b, 0xb8, 0xc4, 0xb3, 0x3c, 0xc0, 0xc0, 0x83, 0x1e, 0x29, 0xab, 0xc3, 0xb3,
+0xb3, 0x3c, 0xc8, 0x03, 0x6c, 0x10, 0x27, 0xaa, 0xbb, 0x80, 0x02, 0x1d, 0x99, 0x0f, 0x53, 0x08,
+0x29, 0x12, 0x1d, 0x09, 0x39, 0x61, 0x09, 0xa8, 0x2a, 0x5c, 0x09, 0x9b, 0x0b, 0x9c, 0x98, 0x1c,
+0x19, 0x8c, 0xa0, 0xa2, 0x86, 0x22, 0x97, 0x01, 0x18, 0x23, 0x82, 0x25, 0x28, 0xd2, 0x03, 0x8e,
+0x1a, 0x28, 0x1c, 0xa9, 0xa9, 0x75, 0x93, 0x38, 0x91, 0x9f, 0x28, 0xa9, 0x22, 0xf0, 0xc9, 0x08,
+0x80, 0x88, 0xc8, 0xb9, 0xbe, 0x8a, 0x51, 0x52, 0x02, 0x31, 0x62, 0x33, 0x01, 0xaa, 0x9d, 0x89,
+0xab, 0xae, 0x8c, 0x18, 0x32, 0x13, 0x33, 0x54, 0x43, 0x02, 0x9a, 0xba, 0xb8, 0xe9, 0xda, 0xa9,
+0x80, 0x00, 0x98, 0xaa, 0x98, 0xe8, 0xce, 0xab, 0x1b, 0x62, 0x34, 0x33, 0x22, 0x32, 0x34, 0x80,
+0xc9, 0xcc, 0xba, 0xbb, 0xdb, 0x99, 0x00, 0x24, 0x24, 0x24, 0x25, 0x03, 0x02, 0x99, 0xaa, 0x9c,
+0x9d, 0x9c, 0xaa, 0x00, 0x81, 0xa1, 0xc9, 0x99, 0xb9, 0xfd, 0xda, 0xaa, 0x31, 0x37, 0x23, 0x01,
+0x21, 0x43, 0x04, 0xaa, 0xad, 0x99, 0xaa, 0xad, 0x9b, 0x20, 0x23, 0x03, 0x43, 0x47, 0x23, 0x81,
+0x99, 0x80, 0xb1, 0xfb, 0xab, 0x99, 0x80, 0xb9, 0xaa, 0x28, 0x89, 0xaf, 0xbc, 0xac, 0x9c, 0x41,
+0x37, 0x22, 0x10, 0x33, 0x34, 0x81, 0xba, 0xab, 0xdb, 0xec, 0xaa, 0x88, 0x80, 0x80, 0x30, 0x45,
+0x53, 0x21, 0x21, 0x11, 0xa1, 0xda, 0xab, 0x9a, 0x9c, 0xbd, 0xa9, 0x11, 0x90, 0x9c, 0x89, 0x9a,
+0xae, 0xad, 0x59, 0x55, 0x01, 0x08, 0x42, 0x23, 0x90, 0xab, 0x08, 0xc8, 0xbe, 0x9c, 0x00, 0xa0,
+0xa9, 0x62, 0x33, 0x11, 0x50, 0x43, 0x01, 0x9a, 0x09, 0xa1, 0xec, 0xab, 0x88, 0xb8, 0xb9, 0x08,
+0x81, 0xe0, 0xba, 0x80, 0xc9, 0x2c, 0x57, 0x02, 0x18, 0x72, 0x11, 0x98, 0x00, 0x00, 0xdb, 0xab,
+0x99, 0xaa, 0x9c, 0x20, 0x31, 0x40, 0x54, 0x23, 0x32, 0x22, 0x00, 0xa0, 0xeb, 0xbc, 0xca, 0xb9,
+0xab, 0x0a, 0x8b, 0x0a, 0xa1, 0xd9, 0x19, 0xbb, 0x8f, 0x57, 0x83, 0x28, 0x54, 0x81, 0x19, 0x12,
+0xc9, 0xab, 0xa8, 0xcc, 0x8b, 0x88, 0x8b, 0x42, 0x13, 0x26, 0x33, 0x53, 0x11, 0x11, 0xa0, 0xac,
+0xab, 0xcd, 0xab, 0x0a, 0xaa, 0x0c, 0x18, 0xaa, 0x80, 0xc3, 0x8e, 0xa0, 0x68, 0x16, 0x08, 0x54,
+0x01, 0x29, 0x04, 0xa9, 0x09, 0xa9, 0xaf, 0x89, 0xb8, 0x8b, 0x22, 0x80, 0x44, 0x15, 0x12, 0x24,
+0x02, 0x81, 0x98, 0xc9, 0xad, 0xca, 0xc9, 0x99, 0xa8, 0xa8, 0x10, 0xb0, 0x98, 0x11, 0xbb, 0xae,
+0x75, 0x02, 0x4a, 0x27, 0x89, 0x41, 0xa1, 0x09, 0x92, 0xbc, 0x89, 0xba, 0x8d, 0x08, 0xa9, 0x61,
+0x01, 0x40, 0x14, 0x20, 0x33, 0x88, 0x81, 0xd9, 0xb9, 0xda, 0xba, 0xc9, 0xa9, 0xa9, 0x90, 0x8a,
+0x81, 0x89, 0xc9, 0xd8, 0x8d, 0x66, 0x99, 0x73, 0xa1, 0x40, 0xa3, 0x19, 0x84, 0x9b, 0x81, 0xbc,
+0x89, 0xa9, 0x9b, 0x40, 0xb9, 0x73, 0x82, 0x50, 0x12, 0x20, 0x12, 0x08, 0x99, 0xd9, 0xc9, 0xc9,
+0xba, 0xa8, 0x8d, 0x98, 0xb9, 0x84, 0x0b, 0x11, 0xac, 0x09, 0x70, 0xa2, 0x72, 0x84, 0x48, 0x03,
+0x18, 0x04, 0x9a, 0x91, 0xac, 0x9a, 0xab, 0xbc, 0x80, 0xb9, 0x62, 0x10, 0x33, 0x16, 0x21, 0x16,
+0x18, 0x22, 0x9b, 0x80, 0xcd, 0xa9, 0xcb, 0xba, 0xb9, 0x9c, 0x19, 0x1c, 0x00, 0x19, 0x10, 0x0b,
+0x4f, 0xa7, 0x2b, 0x96, 0x29, 0x85, 0x29, 0x03, 0x18, 0x22, 0x9b, 0x00, 0xda, 0x0a, 0xf8, 0x88,
+0x98, 0x0a, 0x00, 0x29, 0x23, 0x02, 0x37, 0x02, 0x26, 0x18, 0x11, 0xa8, 0xb8, 0xf9, 0x9b, 0xcb,
+0x8c, 0xaa, 0x9b, 0xb1, 0x39, 0x81, 0x5b, 0xc3, 0x98, 0xb1, 0x7b, 0xe3, 0x58, 0x90, 0x51, 0x00,
+0x22, 0x02, 0x12, 0x81, 0xa0, 0xb2, 0xbc, 0xa8, 0xbd, 0xaa, 0xca, 0x98, 0xb0, 0x91, 0x16, 0x10,
+0x07, 0x12, 0x05, 0x21, 0x01, 0xb1, 0xb3, 0xcb, 0x9c, 0xae, 0x8b, 0x9d, 0x0b, 0x0c, 0x09, 0xa0,
+0x13, 0x92, 0x27, 0x19, 0x38, 0x99, 0xc8, 0xd0, 0xa7, 0x29, 0xa2, 0x7a, 0x01, 0x01, 0x15, 0x08,
+0x03, 0x1a, 0x92, 0x9a, 0x99, 0xdc, 0x18, 0xbc, 0x18, 0xdb, 0x00, 0x89, 0x4b, 0x01, 0x69, 0x82,
+0x70, 0x10, 0x28, 0x20, 0x1a, 0xb1, 0xba, 0xca, 0xae, 0xb9, 0xcb, 0xb0, 0xb0, 0x12, 0x4a, 0x62,
+0x59, 0x38, 0x98, 0x93, 0xe1, 0xa0, 0xb2, 0x8a, 0x93, 0x7c, 0x00, 0x02, 0x85, 0x02, 0x94, 0x20,
+0xa0, 0x80, 0xb1, 0x9c, 0xc0, 0x1d, 0xd9, 0x88, 0xa1, 0x00, 0x83, 0x22, 0x52, 0x4a, 0x10, 0x1c,
+0x99, 0x9d, 0xd9, 0x1a, 0x8e, 0x98, 0x88, 0x30, 0x5a, 0x12, 0x04, 0x24, 0x18, 0x38, 0x2b, 0xa2,
+0x1d, 0x0a, 0x1c, 0x1c, 0x2b, 0x2a, 0x6b, 0x80, 0x82, 0x05, 0x01, 0x04, 0x28, 0x3a, 0x1e, 0xc9,
+0x0a, 0x8c, 0x8b, 0x8c, 0xd0, 0x91, 0x91, 0xb2, 0x06, 0x4a, 0x3b, 0x80, 0x2a, 0x30, 0x3b, 0x40,
+0x3f, 0x08, 0x7a, 0x90, 0x91, 0x83, 0x29, 0x6b, 0x89, 0xa2, 0x02, 0x3b, 0x8b, 0x40, 0xcb, 0xb8,
+0xc3, 0x80, 0xe0, 0x3a, 0x3c, 0x08, 0x08, 0x08, 0x68, 0x80, 0x80, 0xb5, 0x84, 0x4b, 0x3b, 0x0c,
+0x48, 0x3e, 0x3c, 0xa0, 0x02, 0x3b, 0x3b, 0x3b, 0xd0, 0xb7, 0x01, 0x2a, 0x2a, 0x3a, 0x3c, 0xc0,
+0xb3, 0x03, 0x3d, 0x3b, 0x4b, 0x3c, 0x4b, 0x3b, 0x3c, 0x4b, 0x3b, 0x3c, 0x8b, 0xc0, 0xc3, 0x30,
+0x3c, 0xc0, 0xb3, 0xb4, 0xc3, 0xb3, 0xb4, 0x48, 0x3b, 0x3c, 0x8b, 0x4c, 0xb8, 0x84, 0xb3, 0xb4,
+0x03, 0x3d, 0x3b, 0x4b, 0x3c, 0x3b, 0x4b, 0x03, 0x80, 0x08, 0xf8, 0xb3, 0xc3, 0x84, 0x4b, 0x3b,
+0xc0, 0xc3, 0xb3, 0x84, 0x3b, 0x4b, 0x3c, 0x4b, 0x3b, 0x3c, 0x4b, 0x3b, 0x3c, 0xc0, 0x83, 0x4b,
+0x8b, 0xb4, 0xb3, 0x58, 0x4b, 0x1f, 0x19, 0x80, 0xa0, 0x02, 0x3c, 0x3b, 0x4b, 0xb8, 0xc3, 0xb4,
+0xc3, 0x03, 0x3c, 0xc0, 0xb3, 0x03, 0xd8, 0xb3, 0x84, 0x4b, 0x3b, 0xd0, 0xb3, 0xb3, 0xc4, 0xb3,
+0x03, 0x3c, 0x3c, 0x80, 0x4c, 0x3b, 0x3c, 0x4b, 0x3b, 0xb8, 0xc4, 0x03, 0x3c, 0xb8, 0xb4, 0x03,
+0x08, 0xb5, 0xc3, 0xb4, 0xc3, 0xb3, 0x84, 0x80, 0x80, 0x3d, 0xc0, 0xb3, 0xc3, 0xb4, 0xb3, 0xc3,
+0x84, 0x4b, 0xb8, 0xb4, 0x48, 0x3b, 0x3b, 0x4c, 0x3b, 0x4b, 0x08, 0xc8, 0xc3, 0xc0, 0xb3, 0xb3,
+0xc4, 0xb3, 0xb4, 0x83, 0x4b, 0x3c, 0x3b, 0x4b, 0x3c, 0x4b, 0x3b, 0x3c, 0xc0, 0xb3, 0x03, 0x3d,
+0x4b, 0x56, 0x0f, 0x88, 0x81, 0x98, 0x82, 0x80, 0x80, 0x80, 0xd3, 0x01, 0xc1, 0x03, 0x3c, 0x89,
+0x08, 0x3b, 0x80, 0x7c, 0xc0, 0xb3, 0x17, 0x0d, 0x80, 0x10, 0x2b, 0xb0, 0x03, 0x0a, 0x08, 0xe5,
+0x02, 0x98, 0x01, 0xc8, 0x93, 0x28, 0x2d, 0x4a, 0x1b, 0x80, 0x20, 0xfa, 0x13, 0x3e, 0x89, 0x81,
+0xa9, 0xb6, 0x12, 0x2b, 0x7a, 0x2d, 0xe2, 0x31, 0x0d, 0xc4, 0x01, 0x19, 0x89, 0xa2, 0x01, 0x2a,
+0x19, 0xd2, 0x83, 0x2a, 0xc8, 0xa3, 0x83, 0x5c, 0x1b, 0xe2, 0x51, 0x2d, 0xb0, 0x02, 0x3b, 0xd1,
+0x12, 0x1b, 0x90, 0xa1, 0x12, 0x3f, 0x88, 0x29, 0x39, 0x0e, 0xd4, 0x21, 0x8b, 0xc5, 0x02, 0x3c,
+0x98, 0xd2, 0x03, 0x8a, 0x83, 0x4f, 0x99, 0x82, 0x3a, 0x98, 0x18, 0x91, 0x4b, 0xf0, 0x94, 0x88,
+0x01, 0x4b, 0x2a, 0x09, 0x99, 0xb7, 0x11, 0x4d, 0xc0, 0x02, 0x1a, 0x08, 0x18, 0x88, 0x1a, 0xe3,
+0x81, 0xf4, 0x83, 0x5c, 0x99, 0xb3, 0x58, 0x0b, 0x91, 0x18, 0xd1, 0x13, 0x1d, 0xb1, 0x94, 0x6a,
+0x1b, 0xb1, 0x11, 0x89, 0x00, 0xf2, 0x94, 0x4a, 0x0a, 0x80, 0x18, 0x2a, 0x19, 0xa8, 0x13, 0x2f,
+0xe2, 0x21, 0x2c, 0xe1, 0x12, 0x9a, 0xa4, 0x20, 0x1c, 0x80, 0x18, 0x88, 0x18, 0xa8, 0xa4, 0x20,
+0x9b, 0xb7, 0x40, 0x0c, 0x92, 0x49, 0x2d, 0xd1, 0x83, 0x2a, 0x98, 0x82, 0x2b, 0xe5, 0x21, 0x2c,
+0x98, 0x01, 0x98, 0x91, 0x20, 0x0c, 0xa3, 0x00, 0x1a, 0x59, 0xa9, 0xe4, 0x13, 0x2f, 0xa0, 0x82,
+0x29, 0x0a, 0xb2, 0x01, 0xd1, 0x03, 0x0b, 0x01, 0x5c, 0xf0, 0x22, 0x8b, 0x82, 0x5c, 0xf0, 0x22,
+0x2d, 0xb0, 0x83, 0x89, 0xa2, 0x20, 0x9a, 0x04, 0x2e, 0x18, 0x99, 0x50, 0x8b, 0xb4, 0x48, 0xca,
+0xa7, 0x10, 0x09, 0x08, 0xb1, 0x40, 0x8a, 0x28, 0xa8, 0x30, 0x2c, 0xa8, 0xa5, 0x49, 0xb9, 0x23,
+0x0d, 0xa2, 0xd7, 0x40, 0x0b, 0x80, 0x91, 0x38, 0x8b, 0xb7, 0x59, 0x99, 0x10, 0x89, 0xb2, 0x84,
+0x4c, 0xb8, 0x83, 0x2a, 0x39, 0x1d, 0xe3, 0x11, 0x1a, 0x80, 0x29, 0xa8, 0xa3, 0x78, 0x9b, 0xb7,
+0x38, 0xd8, 0x13, 0x3d, 0x99, 0x21, 0x0c, 0x92, 0x88, 0xc3, 0x30, 0x9a, 0xb2, 0x95, 0x7c, 0x9a,
+0xa5, 0x18, 0x3a, 0xa9, 0x03, 0x2b, 0xa1, 0x09, 0xb4, 0xa2, 0x21, 0xca, 0x04, 0x1b, 0x20, 0x2d,
+0x49, 0x2e, 0xb1, 0x38, 0x89, 0x11, 0x8e, 0x96, 0x89, 0xd3, 0x83, 0xa8, 0x50, 0x0a, 0x89, 0x22,
+0xdb, 0x97, 0x49, 0x0c, 0xb3, 0x28, 0x19, 0x1a, 0xa1, 0x11, 0xaa, 0x86, 0x9a, 0x97, 0x2a, 0x39,
+0x9b, 0xa7, 0x6a, 0x8a, 0xa2, 0x10, 0xb0, 0x41, 0xaa, 0x01, 0x81, 0x7c, 0x9a, 0x94, 0x1a, 0xb2,
+0x01, 0xc1, 0x50, 0x0b, 0x81, 0x3a, 0x1a, 0xa0, 0x48, 0xa9, 0x12, 0xc9, 0x95, 0x18, 0x4b, 0xb0,
+0x79, 0xd0, 0x21, 0x8a, 0xd3, 0x02, 0x1a, 0x4a, 0x99, 0x38, 0xf0, 0x32, 0x8e, 0xa4, 0x00, 0x09,
+0xc3, 0x20, 0x0b, 0xb4, 0x5a, 0x98, 0x00, 0x08, 0x00, 0x09, 0x5d, 0xf2, 0x01, 0x98, 0x02, 0xa9,
+0x13, 0x9a, 0x02, 0x4d, 0x4b, 0xb9, 0x23, 0xb9, 0x00, 0xb7, 0x18, 0xa0, 0x93, 0x09, 0x81, 0x18,
+0x4c, 0x99, 0xc7, 0x59, 0xa8, 0x82, 0x1a, 0xc4, 0x7a, 0x0a, 0x00, 0x2a, 0xb0, 0x84, 0x0a, 0x81,
+0x91, 0x2a, 0xd7, 0x01, 0x3a, 0x99, 0x31, 0x0e, 0xa3, 0x4c, 0xa0, 0x91, 0x02, 0x1b, 0x90, 0xe6,
+0x12, 0x8a, 0x30, 0x1d, 0x80, 0x2a, 0xb2, 0x81, 0x6c, 0x89, 0x28, 0x9a, 0xa5, 0xc2, 0x31, 0x0c,
+0x10, 0x8a, 0xb4, 0xc3, 0x02, 0x3f, 0xb1, 0x81, 0x28, 0x2b, 0xd0, 0x95, 0x4b, 0xa0, 0x00, 0x18,
+0x98, 0x79, 0x0b, 0xb3, 0x38, 0x8a, 0xd3, 0x02, 0x1a, 0x29, 0x99, 0x10, 0xd3, 0x10, 0xc9, 0x55,
+0x1f, 0x80, 0x08, 0xa1, 0x39, 0xa0, 0x90, 0xb3, 0xc6, 0x82, 0x09, 0x30, 0x9c, 0x51, 0xaa, 0x11,
+0x29, 0xb9, 0x94, 0x00, 0xb0, 0x12, 0x5d, 0xb9, 0x14, 0x3d, 0x09, 0x6b, 0xaa, 0x96, 0x89, 0xb3,
+0x31, 0xd9, 0x30, 0x1a, 0xe3, 0x7a, 0x09, 0x98, 0x81, 0xb3, 0x19, 0x80, 0x11, 0x2f, 0xa0, 0x03,
+0xbb, 0x16, 0x0b, 0x28, 0xe0, 0x94, 0x4b, 0xa0, 0x02, 0x3e, 0xc1, 0x38, 0x89, 0x08, 0xa2, 0x5a,
+0x1a, 0xf1, 0x03, 0x9a, 0x84, 0x3b, 0x88, 0x3b, 0x81, 0xf1, 0x31, 0x9b, 0x04, 0x2e, 0x90, 0xb1,
+0x13, 0x0b, 0x10, 0x3c, 0xd1, 0x91, 0xa7, 0x5d, 0x98, 0x91, 0x00, 0x18, 0x0a, 0xc3, 0x48, 0x99,
+0x80, 0x82, 0xb8, 0x71, 0x0c, 0xb3, 0x80, 0x30, 0xab, 0x84, 0x08, 0xb0, 0xc4, 0x31, 0xca, 0x32,
+0x2d, 0x98, 0x01, 0x08, 0x3a, 0xe8, 0x03, 0x2b, 0x2a, 0x48, 0xcb, 0x61, 0xc8, 0x11, 0xb8, 0x05,
+0x0c, 0x93, 0x88, 0x80, 0xc0, 0x87, 0x1b, 0x11, 0xc8, 0x78, 0x8a, 0x92, 0x19, 0x08, 0xa0, 0x01,
+0x28, 0xaa, 0x02, 0xe2, 0x01, 0x80, 0x62, 0x1f, 0x80, 0x98, 0x12, 0x1d, 0xa2, 0x19, 0xe2, 0x22,
+0xc9, 0x82, 0x91, 0x19, 0x20, 0xd8, 0xa2, 0xa2, 0xb2, 0x03, 0xf4, 0x93, 0x08, 0xa1, 0xb0, 0x96,
+0x4a, 0x2b, 0x08, 0x08, 0xe2, 0x01, 0x08, 0xa2, 0x6c, 0xb8, 0x94, 0x4a, 0x19, 0x0a, 0x20, 0x08,
+0x3f, 0x9a, 0x94, 0xa8, 0xa2, 0x95, 0xd2, 0x01, 0x98, 0xa4, 0x80, 0x00, 0xb2, 0xc0, 0xb7, 0x21,
+0xc8, 0x12, 0x3a, 0xb8, 0x30, 0xd0, 0xb3, 0x08, 0x58, 0x1e, 0x2a, 0x30, 0xf8, 0x91, 0x12, 0x0a,
+0x3b, 0x7b, 0x89, 0x49, 0x1b,
+};
+
+static const uint8_t alarmClip_level2breach[] PROGMEM = {
+0xff, 0xff, 0xb6, 0xc3, 0xf3, 0xb3, 0xc3, 0x94, 0xa1, 0xc2, 0xc3, 0x93, 0x38, 0x1d, 0xd2, 0xb3,
+0x93, 0x28, 0x8a, 0x80, 0x4b, 0x3b, 0xd0, 0x03, 0x3c, 0x3b, 0x3c, 0x4b, 0x3b, 0x3c, 0xc0, 0xb3,
+0x84, 0x30, 0x0c, 0x08, 0x85, 0x3b, 0x4c, 0x3b, 0xc0, 0x83, 0x4b, 0x3c, 0x4b, 0xb8, 0x03, 0x3c,
+0xd0, 0xb3, 0xb3, 0x84, 0x4b, 0x88, 0x3f, 0x2c, 0x2a, 0x3b, 0x08, 0x3c, 0x4b, 0x3b, 0x3c, 0x4b,
+0x08, 0xc8, 0xb3, 0xb4, 0xc3, 0x03, 0x3c, 0x3b, 0x4c, 0x3b, 0x3b, 0xd0, 0xb3, 0xb4, 0x43, 0x3f,
+0x3b, 0xa0, 0x02, 0x3b, 0x3c, 0xc0, 0xb3, 0xb3, 0xc4, 0xb3, 0xb3, 0xc4, 0xb3, 0x03, 0x80, 0xd8,
+0x48, 0x4b, 0x3b, 0x3c, 0x4b, 0x1f, 0x19, 0xa0, 0xd2, 0x91, 0xa8, 0xb2, 0x00, 0x3c, 0x3c, 0x3b,
+0x71, 0x22, 0x23, 0x03, 0x07, 0x23, 0x02, 0x8b, 0xfb, 0x93, 0x21, 0x0d, 0xae, 0x9a, 0x8a, 0x89,
+0xb0, 0x9f, 0x9a, 0xab, 0xc0, 0x01, 0x82, 0x17, 0x53, 0x22, 0x22, 0x23, 0x24, 0x50, 0x19, 0x8a,
+0x8d, 0x8b, 0x8c, 0x8a, 0x8d, 0x0a, 0x1b, 0x4a, 0x32, 0x72, 0x11, 0x03, 0x34, 0x58, 0x19, 0x91,
+0x8b, 0xad, 0x9d, 0x9d, 0xba, 0xba, 0xa9, 0x9b, 0x8d, 0xb8, 0x01, 0x35, 0x52, 0x42, 0x43, 0x42,
+0x22, 0x04, 0x12, 0x80, 0x8a, 0x9c, 0xcb, 0xcb, 0xca, 0x8a, 0x1c, 0x3b, 0x31, 0x71, 0x31, 0x41,
+0x21, 0x21, 0xa2, 0xe2, 0x88, 0x9c, 0xac, 0xeb, 0x9a, 0x9b, 0xb9, 0xd0, 0xa8, 0x98, 0x31, 0x51,
+0x72, 0x30, 0x31, 0x33, 0x25, 0x13, 0x92, 0xd2, 0xb0, 0xb9, 0x9c, 0xab, 0xac, 0xcb, 0xb0, 0x83,
+0x17, 0x13, 0x04, 0x23, 0x12, 0x84, 0x91, 0x9b, 0xbc, 0xbd, 0xcb, 0xbc, 0xbb, 0x9b, 0xb9, 0x9e,
+0x0a, 0x3b, 0x41, 0x53, 0x05, 0x24, 0x33, 0x34, 0x43, 0x21, 0x88, 0xab, 0xcc, 0xaa, 0x8d, 0xcb,
+0xa8, 0xa8, 0x02, 0x24, 0x25, 0x13, 0x33, 0x41, 0x11, 0x82, 0x9c, 0x9d, 0xdc, 0xb9, 0xaa, 0x9c,
+0x8a, 0x8a, 0x0c, 0x8c, 0x98, 0x22, 0x35, 0x53, 0x32, 0x53, 0x52, 0x32, 0x02, 0x82, 0x9a, 0xad,
+0xcb, 0xba, 0xcb, 0xba, 0x0b, 0x59, 0x22, 0x27, 0x13, 0x12, 0x13, 0x38, 0x98, 0xea, 0xfa, 0xb9,
+0xb8, 0x9a, 0xaa, 0x9a, 0x8d, 0xdb, 0x99, 0x88, 0x26, 0x62, 0x22, 0x13, 0x24, 0x24, 0x82, 0xb1,
+0xda, 0x9c, 0x9a, 0xba, 0xb9, 0x9b, 0x11, 0x47, 0x43, 0x21, 0x08, 0x11, 0x38, 0x98, 0xce, 0x8c,
+0x8b, 0x90, 0xaa, 0x9d, 0x8b, 0x99, 0xad, 0xbb, 0x2c, 0x17, 0x26, 0x22, 0x31, 0x12, 0x23, 0x98,
+0xfb, 0xcb, 0xab, 0x98, 0x98, 0x80, 0x51, 0x63, 0x23, 0x00, 0x89, 0x18, 0x91, 0xc8, 0xae, 0x89,
+0x11, 0x00, 0xa9, 0xaf, 0xc9, 0xb9, 0xdc, 0xcb, 0x89, 0x75, 0x32, 0x12, 0x18, 0x80, 0x08, 0xbd,
+0xca, 0x8a, 0x80, 0x11, 0x21, 0x27, 0x12, 0xa8, 0x8a, 0x8a, 0x80, 0x1b, 0x20, 0x34, 0x88, 0xaa,
+0x1d, 0xd0, 0xbd, 0xae, 0x99, 0xaa, 0x9f, 0x49, 0x37, 0x22, 0x90, 0x00, 0x98, 0xd9, 0xac, 0x00,
+0x30, 0x08, 0x30, 0x63, 0x91, 0xba, 0x9c, 0x20, 0x00, 0x08, 0x53, 0x13, 0xb8, 0xbb, 0x91, 0xfb,
+0xcb, 0x9a, 0xa9, 0xca, 0xaa, 0x40, 0x77, 0x03, 0x81, 0x89, 0x90, 0x8c, 0x9a, 0x31, 0x02, 0x81,
+0x49, 0x83, 0x99, 0xae, 0x08, 0x29, 0x12, 0x43, 0xa2, 0xa2, 0x99, 0xa8, 0x8d, 0xec, 0xb9, 0x9f,
+0xaa, 0x80, 0x9a, 0x74, 0x17, 0x01, 0x99, 0x08, 0x9a, 0xaa, 0x58, 0x12, 0x80, 0x19, 0x33, 0xba,
+0xbd, 0x49, 0x11, 0x08, 0x20, 0x03, 0x9b, 0x0c, 0x41, 0xcb, 0xce, 0xa9, 0xb8, 0xab, 0xa9, 0x38,
+0x77, 0x16, 0x81, 0x8a, 0x90, 0x9b, 0x8a, 0x41, 0x02, 0x00, 0x11, 0x92, 0xa9, 0xb9, 0x82, 0x80,
+0x07, 0x00, 0xb0, 0x21, 0x0b, 0xe9, 0xaf, 0xca, 0xba, 0xb9, 0xc8, 0x10, 0x77, 0x14, 0x80, 0x98,
+0x98, 0xab, 0x99, 0x53, 0x81, 0x00, 0x31, 0x92, 0xab, 0x8d, 0x12, 0x08, 0x01, 0x48, 0xa8, 0x0a,
+0x8a, 0xf0, 0xaf, 0x9a, 0x8a, 0x9d, 0x0a, 0x61, 0x27, 0x12, 0x90, 0x98, 0xb9, 0xaa, 0x09, 0x22,
+0x20, 0x23, 0x35, 0x92, 0x98, 0xab, 0xd9, 0x10, 0x93, 0x82, 0x8d, 0x9a, 0x9c, 0xde, 0x99, 0xea,
+0xa9, 0xaa, 0x78, 0x35, 0x32, 0x80, 0x08, 0xb9, 0xcb, 0x9b, 0x22, 0x11, 0x02, 0x74, 0x11, 0x98,
+0xaa, 0x90, 0x90, 0x90, 0x11, 0x99, 0xdc, 0xb9, 0xb9, 0xdc, 0xc9, 0xba, 0xa9, 0x73, 0x53, 0x13,
+0x11, 0x81, 0x91, 0xc9, 0x90, 0xa2, 0x91, 0x08, 0x21, 0x58, 0x19, 0x80, 0x1c, 0x40, 0x40, 0x0a,
+0xae, 0x8e, 0x08, 0xa1, 0xc8, 0xc8, 0x99, 0x19, 0x89, 0x84, 0x50, 0x80, 0x14, 0x24, 0x28, 0x10,
+0x10, 0x22, 0xa2, 0xb8, 0x08, 0x4c, 0x1f, 0x19, 0xa0, 0x94, 0x82, 0x1d, 0x8b, 0x8c, 0x89, 0x0d,
+0x8a, 0xaa, 0xb0, 0x8b, 0x7c, 0x19, 0x5a, 0x08, 0x21, 0x28, 0x23, 0x30, 0x48, 0x30, 0x7c, 0x19,
+0x10, 0x3a, 0xb8, 0xb4, 0xe3, 0x28, 0x8a, 0x3a, 0x1f, 0xa0, 0xca, 0x01, 0x3d, 0x89, 0xa0, 0xb2,
+0xe3, 0x91, 0xb2, 0xb3, 0x03, 0x3c, 0x6c, 0x39, 0x20, 0x80, 0x30, 0x03, 0x7c, 0x80, 0x5a, 0x3b,
+0xc2, 0x01, 0x08, 0x0b, 0x3b, 0xcb, 0xb8, 0xc8, 0xc3, 0x03, 0x3c, 0x8b, 0x3c, 0xf8, 0xa1, 0xa2,
+0x83, 0x3b, 0x4c, 0x3e, 0x19, 0x20, 0x78, 0x99, 0xa3, 0xa2, 0x95, 0x01, 0x82, 0xb3, 0xb3, 0x0d,
+0x08, 0x08, 0xf4, 0xb1, 0xa1, 0xb0, 0xb3, 0xb4, 0xc3, 0x80, 0x8b, 0xd0, 0xc3, 0x80, 0xe4, 0x03,
+0x2a, 0x5a, 0x10, 0x3a, 0x6b, 0x19, 0x20, 0x02, 0x3f, 0xa9, 0x84, 0x49, 0x98, 0xa8, 0xf2, 0x11,
+0x89, 0x19, 0x0c, 0xa1, 0xa0, 0x02, 0x0c, 0xb8, 0x7c, 0x1b, 0x29, 0x28, 0x3d, 0x49, 0x28, 0x40,
+0x4a, 0xa2, 0xa2, 0x5a, 0x89, 0xa2, 0xa2, 0xc8, 0xb3, 0xb4, 0x83, 0xdb, 0x8b, 0x5f, 0x99, 0xb0,
+0xc2, 0x19, 0x9a, 0x82, 0x79, 0x1c, 0x39, 0x6a, 0x4a, 0x02, 0x21, 0x8a, 0xb1, 0x20, 0x3d, 0x28,
+0xca, 0xc3, 0x7b, 0x20, 0xb1, 0x99, 0xbc, 0x10, 0x4a, 0x0b, 0xe1, 0xe0, 0xa0, 0x90, 0x08, 0x43,
+0x78, 0x10, 0x81, 0x00, 0x01, 0x11, 0xc2, 0xc1, 0xbb, 0xda, 0x02, 0x32, 0x15, 0x12, 0x99, 0x2a,
+0x2f, 0x1a, 0xa9, 0xe9, 0xc9, 0xbb, 0xbb, 0x9d, 0xb1, 0x65, 0x50, 0x12, 0x02, 0x90, 0xa0, 0x88,
+0x81, 0x89, 0x9f, 0xab, 0x1a, 0x50, 0x24, 0x04, 0x92, 0x98, 0xa9, 0xb2, 0xa2, 0xf1, 0xd9, 0xab,
+0xac, 0x9b, 0x3b, 0x7b, 0x23, 0x27, 0x22, 0x10, 0x8a, 0xa9, 0x89, 0xa8, 0xe8, 0xb9, 0x8d, 0x18,
+0x62, 0x32, 0x33, 0x18, 0xa9, 0xaa, 0xb0, 0xb9, 0xcd, 0xcc, 0xdb, 0xb9, 0xa9, 0x80, 0x64, 0x41,
+0x15, 0x12, 0x91, 0x08, 0xab, 0xa8, 0x9a, 0xfb, 0x99, 0x0b, 0x10, 0x55, 0x32, 0x12, 0x00, 0xa9,
+0x98, 0x8a, 0xe9, 0xca, 0xbc, 0xbb, 0xaa, 0x9b, 0x81, 0x57, 0x52, 0x23, 0x22, 0x80, 0xa8, 0xab,
+0xd9, 0x99, 0xbc, 0xca, 0x89, 0x32, 0x37, 0x43, 0x12, 0x80, 0x99, 0xa9, 0x89, 0xeb, 0xca, 0xac,
+0xab, 0x9a, 0x8a, 0x18, 0x74, 0x52, 0x14, 0x22, 0x00, 0x98, 0x8b, 0xaa, 0x8c, 0xbd, 0xba, 0x1b,
+0x31, 0x47, 0x32, 0x13, 0x10, 0x9a, 0x89, 0x8c, 0xba, 0xbe, 0xbc, 0xbb, 0xb9, 0xb8, 0x82, 0x74,
+0x43, 0x15, 0x14, 0x00, 0x88, 0x9a, 0xa8, 0x9b, 0xae, 0xca, 0x89, 0x21, 0x54, 0x41, 0x21, 0x28,
+0x0a, 0x88, 0x99, 0xfa, 0xc9, 0xaa, 0xb9, 0x89, 0x8a, 0x09, 0x78, 0x51, 0x15, 0x13, 0x02, 0x19,
+0x99, 0xa0, 0x9c, 0xdc, 0xc9, 0x99, 0x10, 0x43, 0x24, 0x23, 0x10, 0x91, 0x81, 0xa0, 0xdb, 0x9e,
+0xad, 0xa9, 0x09, 0x8a, 0x8a, 0xc0, 0x25, 0x72, 0x22, 0x12, 0x82, 0x00, 0x18, 0xb9, 0xdb, 0xae,
+0x9b, 0x1a, 0x21, 0x34, 0x41, 0x01, 0x04, 0x03, 0x01, 0xda, 0xda, 0xba, 0xa9, 0x89, 0x0c, 0x9b,
+0x0a, 0x1b, 0x23, 0x54, 0x33, 0x72, 0x20, 0x13, 0x24, 0x00, 0x09, 0x8e, 0x9b, 0x8b, 0x0c, 0x18,
+0x19, 0x94, 0x13, 0x84, 0x03, 0xa2, 0xe2, 0x0b, 0x9e, 0x0a, 0x1b, 0x29, 0x1c, 0x89, 0xa8, 0xb3,
+0x3b, 0x3c, 0xf8, 0x01, 0x22, 0x33, 0x33, 0x25, 0x33, 0x6c, 0x10, 0x20, 0x80, 0x80, 0x0c, 0x3b,
+0x0c, 0x0c, 0x3c, 0x1e, 0x89, 0xb0, 0x83, 0x4b, 0xb8, 0xb4, 0xb8, 0xb4, 0x98, 0x2f, 0x0b, 0x3b,
+0x4b, 0x08, 0x08, 0x04, 0xc3, 0x07, 0x28, 0x5a, 0x19, 0xa0, 0x02, 0xb2, 0x4b, 0x3b, 0x3c, 0x4b,
+0x3b, 0xbc, 0x03, 0x3c, 0xd0, 0xb3, 0xb8, 0xc4, 0xb3, 0xb3, 0xc4, 0x03, 0xc8, 0xb3, 0xc8, 0xb4,
+0x83, 0xb4, 0xb4, 0x48, 0x6b, 0x00, 0x3b, 0x3b, 0x4b, 0x3b, 0x3c, 0xc0, 0x83, 0x4b, 0x3b, 0xd0,
+0xc0, 0xb3, 0x30, 0x3c, 0x4b, 0x3b, 0x3c, 0x80, 0x4c, 0x3b, 0xb8, 0xc4, 0x03, 0x3c, 0x3b, 0x3c,
+0xc0, 0xb3, 0x84, 0x80, 0x50, 0x3b, 0xd0, 0x83, 0x4b, 0x3b, 0x3c, 0x4b, 0x3b, 0x3c, 0xc0, 0x03,
+0x3c, 0x3c, 0x4b, 0x3b, 0x3c, 0x4b, 0xb8, 0xb4, 0xf3, 0xa1, 0xa2, 0x83, 0x3b, 0xc0, 0xb3, 0x84,
+0x3b, 0x4c, 0x3b, 0x4b, 0x08, 0x08, 0x3d, 0x08, 0xb4, 0x08, 0x85, 0x4b, 0xb8, 0xc3, 0xb4, 0xb3,
+0x03, 0x80, 0x3e, 0x3b, 0x4c, 0xb8, 0x84, 0x4b, 0x3b, 0x80, 0xc8, 0xc3, 0x80, 0x3c, 0x4b, 0x3c,
+0x80, 0x3c, 0x80, 0xd0, 0x03, 0xc8, 0xb3, 0xc4, 0x03, 0x3c, 0x3b, 0x3c, 0x4b, 0x3b, 0x3c, 0x4b,
+0x3b, 0x3c, 0x4b, 0x3b, 0x3c, 0x4b, 0x3b, 0x80, 0x50, 0x3c, 0x4b, 0xb8, 0x84, 0x4b, 0x3b, 0xb8,
+0xc4, 0xb3, 0xb4, 0xc3, 0xf3, 0xb3, 0x91, 0xb2, 0x30, 0x3c, 0xb8, 0x84, 0x4b, 0x3b, 0x3b, 0x4c,
+0x08, 0x08, 0x08, 0x08, 0x08, 0x07, 0xc8, 0xe4, 0x91, 0xa1, 0x83, 0x80, 0x6c, 0x59, 0x0d, 0x81,
+0x08, 0xa1, 0xa2, 0x80, 0x2a, 0xca, 0xb3, 0x03, 0xc8, 0x97, 0x28, 0x20, 0x7d, 0x1a, 0x98, 0xd5,
+0xa3, 0x10, 0x1a, 0x19, 0x3c, 0x3b, 0x0c, 0xb1, 0xb3, 0xa5, 0x02, 0x80, 0x38, 0xf1, 0xa3, 0xa3,
+0x6b, 0x3b, 0x4c, 0x4d, 0x0a, 0x90, 0x91, 0xf4, 0xb4, 0x93, 0x28, 0x3c, 0x89, 0x08, 0x08, 0x88,
+0xa1, 0x58, 0x2b, 0x3a, 0x18, 0xc0, 0x59, 0x99, 0xe3, 0x83, 0xb0, 0xa2, 0xc2, 0x02, 0xf2, 0xa3,
+0x58, 0x3f, 0x1a, 0x80, 0x6a, 0x2c, 0x88, 0xa1, 0x10, 0x08, 0x2b, 0xd3, 0xb2, 0xb4, 0xa2, 0xa3,
+0x5a, 0x49, 0x1d, 0x39, 0x5b, 0x8b, 0xa3, 0xc3, 0x08, 0xb2, 0xa5, 0x10, 0x5b, 0x2d, 0x88, 0x01,
+0xa8, 0x81, 0xa3, 0x3c, 0x5b, 0x1a, 0xd1, 0x31, 0x0b, 0xe1, 0xb7, 0x01, 0x29, 0x1a, 0xb1, 0x11,
+0x3f, 0x88, 0xb0, 0xb6, 0x82, 0x3a, 0x2a, 0x09, 0x5b, 0x09, 0x80, 0x7b, 0x5b, 0x9a, 0xa2, 0xb3,
+0x92, 0x00, 0x10, 0x8c, 0xa6, 0xb2, 0x11, 0x4a, 0x3f, 0x1b, 0x49, 0x2b, 0x3c, 0xc1, 0xb2, 0xb6,
+0x92, 0xb2, 0x02, 0x4c, 0x1b, 0x48, 0x2d, 0x0a, 0xb3, 0xd3, 0x82, 0x10, 0x8b, 0xa6, 0x00, 0x29,
+0x3c, 0xb9, 0x03, 0x81, 0x4d, 0x3c, 0xa8, 0x11, 0x6a, 0x0c, 0xd3, 0xb4, 0x82, 0x08, 0x88, 0x00,
+0x2b, 0x91, 0x90, 0x78, 0x8a, 0xe0, 0x97, 0x29, 0x2a, 0x09, 0x98, 0x02, 0xd8, 0x12, 0x90, 0xb0,
+0x94, 0x11, 0x3f, 0x3b, 0xb8, 0x41, 0x8a, 0x80, 0x88, 0x02, 0xf8, 0x12, 0x80, 0x2e, 0xb4, 0xb0,
+0xb7, 0x83, 0x8a, 0x51, 0x8c, 0x49, 0x98, 0x80, 0x30, 0x9b, 0x01, 0xb4, 0x39, 0x1d, 0xb2, 0x40,
+0xaa, 0xb4, 0xb4, 0x48, 0x09, 0xb0, 0x85, 0x0a, 0x01, 0x91, 0x8a, 0x21, 0x9e, 0xb6, 0x10, 0x19,
+0xd0, 0x31, 0x9a, 0x20, 0xb4, 0x89, 0x86, 0x1b, 0x2a, 0x13, 0x9f, 0x42, 0x0e, 0xa2, 0x00, 0x00,
+0xa8, 0x71, 0xab, 0x31, 0xe0, 0x12, 0x99, 0x12, 0xaa, 0x60, 0xaa, 0x40, 0x88, 0xa8, 0x95, 0x18,
+0x1c, 0xb8, 0xa2, 0xd1, 0x90, 0x11, 0x9c, 0x21, 0xb9, 0x15, 0x39, 0x30, 0x70, 0x13, 0x69, 0x11,
+0x29, 0x13, 0xbb, 0x64, 0xdb, 0x18, 0xb0, 0x0d, 0x81, 0xc9, 0x30, 0xbb, 0x49, 0x9a, 0x1f, 0xb0,
+0xba, 0x90, 0x29, 0x98, 0x55, 0x02, 0x63, 0x85, 0x21, 0x13, 0x80, 0x10, 0x9a, 0xbb, 0xe9, 0xc9,
+0x0a, 0xb8, 0x99, 0x13, 0x08, 0x63, 0x40, 0x19, 0x0b, 0xd9, 0x8d, 0xda, 0xac, 0x0c, 0x80, 0xab,
+0x45, 0x08, 0x62, 0x12, 0x12, 0x14, 0x02, 0x81, 0x08, 0xca, 0xab, 0xc9, 0x9d, 0x0a, 0x0b, 0x19,
+0x48, 0x12, 0x11, 0x14, 0x81, 0x0b, 0xae, 0xcb, 0xfb, 0xda, 0x89, 0x92, 0x0c, 0x53, 0x18, 0x71,
+0x11, 0x21, 0x11, 0x12, 0xa8, 0x00, 0xca, 0x8d, 0xa9, 0x9c, 0x9a, 0x90, 0x00, 0x58, 0x11, 0x11,
+0x05, 0x81, 0xb9, 0xc9, 0xfa, 0x9c, 0xca, 0x0a, 0xa1, 0x2b, 0x35, 0x20, 0x46, 0x21, 0x33, 0x11,
+0x42, 0xa8, 0x19, 0xbb, 0xae, 0xca, 0xb9, 0xb9, 0x90, 0xa2, 0x32, 0x06, 0x23, 0x03, 0x83, 0xb9,
+0xaf, 0xfa, 0xba, 0xdb, 0x0a, 0xa1, 0x1a, 0x15, 0x23, 0x27, 0x22, 0x24, 0x01, 0x13, 0xa0, 0xa8,
+0xe9, 0xaa, 0xdb, 0x9a, 0x9a, 0x89, 0x92, 0x43, 0x23, 0x24, 0x12, 0x02, 0xd8, 0xbc, 0xfb, 0xbb,
+0xad, 0x98, 0xa0, 0x20, 0x43, 0x54, 0x23, 0x53, 0x23, 0x11, 0x02, 0x99, 0xb8, 0xae, 0xab, 0xcc,
+0x9a, 0x0b, 0x19, 0x48, 0x60, 0x20, 0x22, 0x28, 0x88, 0xcb, 0xfa, 0xba, 0xbc, 0x8c, 0x88, 0x0a,
+0x41, 0x42, 0x26, 0x32, 0x33, 0x33, 0x12, 0xa1, 0xb8, 0xe9, 0xcb, 0xdb, 0xaa, 0xa9, 0x98, 0x01,
+0x42, 0x22, 0x44, 0x11, 0x88, 0x9b, 0xeb, 0xad, 0x9e, 0xab, 0x88, 0x98, 0x11, 0x44, 0x73, 0x22,
+0x31, 0x04, 0x13, 0x08, 0x0b, 0x9b, 0x9e, 0xab, 0x9d, 0x8a, 0x09, 0x28, 0x21, 0x62, 0x40, 0x01,
+0x80, 0xc9, 0xd9, 0xc9, 0xda, 0xba, 0x99, 0x91, 0x11, 0x24, 0x55, 0x33, 0x23, 0x14, 0x12, 0x02,
+0xc9, 0xc8, 0xba, 0xbb, 0x9e, 0x8b, 0x09, 0x20, 0x48, 0x60, 0x21, 0x31, 0x88, 0xc8, 0xe8, 0xc9,
+0xba, 0xcb, 0x9c, 0x09, 0x00, 0x23, 0x25, 0x45, 0x14, 0x22, 0x11, 0x21, 0x08, 0xbb, 0xea, 0xaa,
+0xcb, 0xb9, 0xa8, 0x18, 0x41, 0x30, 0x05, 0x15, 0x20, 0x9a, 0xb0, 0xbd, 0xac, 0xbd, 0xbb, 0x9c,
+0x88, 0x11, 0x34, 0x44, 0x34, 0x24, 0x42, 0x11, 0x11, 0x88, 0xaa, 0xdb, 0xab, 0xcb, 0xa9, 0x99,
+0x98, 0x23, 0x74, 0x20, 0x11, 0x10, 0x98, 0xbb, 0x9f, 0x9c, 0xac, 0xac, 0x9b, 0x0b, 0x29, 0x42,
+0x35, 0x33, 0x36, 0x42, 0x22, 0x01, 0xa2, 0xb0, 0xb9, 0x9d, 0xcb, 0xc9, 0xb0, 0x80, 0x10, 0x42,
+0x30, 0x40, 0xa2, 0xa2, 0xe2, 0x98, 0x9c, 0xca, 0x98, 0xfa, 0xa9, 0xbb, 0x98, 0xa2, 0x94, 0x14,
+0x40, 0x43, 0x53, 0x42, 0x02, 0x83, 0x03, 0x2a, 0xa8, 0x0e, 0x0c, 0x1b, 0xa2, 0x80, 0x2a, 0xbb,
+0x03, 0x3d, 0x40, 0x1f, 0x8b, 0x89, 0x8a, 0xca, 0xe0, 0xd8, 0x98, 0xa0, 0x89, 0x2a, 0x30, 0x7b,
+0x30, 0x40, 0x60, 0x20, 0x28, 0x28, 0x28, 0x5a, 0xa0, 0xa2, 0x02, 0x3c, 0x3b, 0x80, 0xb5, 0xb3,
+0xc3, 0xb4, 0xf3, 0x28, 0x1c, 0x89, 0xd0, 0x98, 0xc8, 0xc1, 0xa0, 0x80, 0x1d, 0xa9, 0x80, 0x3b,
+0x4b, 0x7b, 0x19, 0x82, 0x02, 0xa5, 0x85, 0x21, 0x28, 0x20, 0x20, 0x80, 0x40, 0x80, 0x80, 0xb6,
+0xb3, 0x03, 0x3d, 0x4b, 0x1f, 0xc0, 0xb1, 0xc2, 0xc1, 0xb1, 0xc2, 0x91, 0x2a, 0x1d, 0xa0, 0xd2,
+0x01, 0xa8, 0x80, 0x80, 0x1f, 0x49, 0x08, 0x28, 0x6a, 0x01, 0x01, 0x04, 0x21, 0x20, 0x30, 0x7c,
+0x19, 0x80, 0xa2, 0xa8, 0xb2, 0xc0, 0xf3, 0x91, 0x2a, 0x1d, 0x89, 0x2a, 0x3a, 0x1f, 0x19, 0xd0,
+0x91, 0xa2, 0x2a, 0x1d, 0xaa, 0xe3, 0x91, 0x98, 0xb2, 0x96, 0x21, 0x28, 0x50, 0x80, 0x95, 0xa3,
+0x04, 0x28, 0x2a, 0x3a, 0x08, 0x3c, 0x3c, 0x80, 0xd0, 0xb3, 0xc3, 0xc0, 0x03, 0xc8, 0xb3, 0xb4,
+0x08, 0x0d, 0x3c, 0x1e, 0x89, 0x2a, 0x1d, 0xc0, 0xa1, 0xa0, 0xb2, 0x30, 0x4b, 0xb8, 0x84, 0xb4,
+0x07, 0x28, 0x5a, 0x39, 0x29, 0xb2, 0x03, 0xc3, 0x03, 0x6c, 0xa0, 0xa2, 0x02, 0x3b, 0x0c, 0x0c,
+0xc3, 0xb3, 0xe4, 0x01, 0x2a, 0x0b, 0x3b, 0x8b, 0x3c, 0x4b, 0xf8, 0xa1, 0xa2, 0xe3, 0x91, 0xa1,
+0xb3, 0xb3, 0x03, 0x3d, 0x3b, 0xc0, 0x03, 0xc4, 0x33, 0x00, 0x58, 0x3b, 0x80, 0xb5, 0xb4, 0x83,
+0x4b, 0x3c, 0xc0, 0xb3, 0x83, 0x1f, 0x2a, 0x3a, 0x3c, 0x3b, 0x4b, 0x3b, 0x0c, 0xc8, 0xb3, 0xb4,
+0xc3, 0x03, 0x3c, 0x3c, 0x4b, 0x3b, 0x7c, 0x3b, 0x80, 0x54, 0xf4, 0x09, 0x0a, 0x82, 0x90, 0x90,
+0xa1, 0x11, 0x28, 0x1c, 0x14, 0x84, 0xb3, 0x9f, 0x84, 0x80, 0x20, 0x9a, 0x1b, 0xca, 0x82, 0x7a,
+0x88, 0x1c, 0xa8, 0x83, 0x89, 0x20, 0x3b, 0x3b, 0x1f, 0x40, 0x19, 0x1c, 0xa0, 0xd2, 0xb3, 0xb4,
+0x08, 0x3b, 0x0b, 0xc8, 0x06, 0x84, 0x15, 0x81, 0x23, 0x05, 0xb1, 0x98, 0xa2, 0xa5, 0xe0, 0x8a,
+0x19, 0x10, 0x0c, 0xaa, 0x45, 0x06, 0xb0, 0x89, 0x49, 0x03, 0xb8, 0xfa, 0x99, 0x29, 0x02, 0xbf,
+0x0c, 0x29, 0xab, 0xea, 0xa9, 0x32, 0x52, 0x21, 0x23, 0x45, 0x42, 0x11, 0x08, 0x9b, 0x8c, 0x9a,
+0x9d, 0xbc, 0xa8, 0x12, 0x14, 0x23, 0x24, 0x16, 0x13, 0x08, 0x1a, 0x1a, 0xec, 0xc9, 0xa9, 0x0a,
+0x18, 0x9a, 0xbb, 0x1d, 0x09, 0xcc, 0xcd, 0x99, 0x61, 0x42, 0x12, 0x22, 0x31, 0x43, 0x11, 0xb9,
+0xea, 0xaa, 0xbb, 0xdb, 0x9b, 0x09, 0x32, 0x52, 0x53, 0x53, 0x12, 0x21, 0x98, 0x99, 0x99, 0xab,
+0xce, 0x9b, 0x1a, 0x08, 0x0a, 0xac, 0x9c, 0x19, 0xc9, 0xce, 0xbb, 0x09, 0x46, 0x34, 0x02, 0x01,
+0x41, 0x52, 0x80, 0xaa, 0x9c, 0xaa, 0xba, 0xcc, 0x0a, 0x30, 0x31, 0x31, 0x73, 0x44, 0x12, 0x88,
+0x88, 0x82, 0xb0, 0xaf, 0x9b, 0x88, 0x88, 0xbb, 0x0c, 0x28, 0xc9, 0xcb, 0x99, 0xcb, 0xae, 0x2a,
+0x66, 0x13, 0x80, 0x20, 0x34, 0x12, 0xa9, 0xab, 0x98, 0xec, 0xac, 0x89, 0x00, 0xb9, 0x08, 0x55,
+0x33, 0x21, 0x31, 0x43, 0x82, 0xba, 0xac, 0xa9, 0xea, 0xdb, 0xab, 0x00, 0x92, 0xaa, 0x0a, 0x88,
+0xad, 0xcc, 0x1c, 0x47, 0x13, 0x98, 0x40, 0x34, 0x81, 0xba, 0x09, 0x92, 0xfc, 0xbb, 0x08, 0x02,
+0xcb, 0x28, 0x36, 0x12, 0x18, 0x51, 0x13, 0x88, 0xab, 0x01, 0xc9, 0xaf, 0x9a, 0x80, 0xa9, 0x99,
+0x81, 0x90, 0x9b, 0x9c, 0xa9, 0xbc, 0x67, 0x14, 0x80, 0x50, 0x33, 0x98, 0x19, 0x01, 0xe9, 0xac,
+0x99, 0xb9, 0xba, 0x80, 0x42, 0x11, 0x54, 0x15, 0x21, 0x22, 0x81, 0x90, 0xb0, 0xdc, 0xab, 0xab,
+0xac, 0x0a, 0x89, 0xb9, 0x89, 0x92, 0xad, 0x1a, 0xbc, 0x7b, 0x47, 0x80, 0x48, 0x25, 0x99, 0x30,
+0x01, 0xbd, 0x09, 0x98, 0xaf, 0x18, 0x98, 0x09, 0x43, 0x01, 0x31, 0x25, 0x23, 0x09, 0x21, 0xc2,
+0xcd, 0x98, 0xa9, 0xac, 0x98, 0x80, 0x9a, 0x80, 0xd1, 0x98, 0x09, 0x9b, 0x9f, 0x70, 0x84, 0x18,
+0x64, 0x80, 0x28, 0x12, 0x9b, 0x19, 0xd8, 0xac, 0x09, 0xaa, 0x8b, 0x14, 0x1a, 0x54, 0x03, 0x21,
+0x25, 0x81, 0x18, 0x81, 0xcc, 0x99, 0xea, 0x8a, 0x98, 0x9a, 0x08, 0xa8, 0x90, 0xa0, 0x88, 0xd9,
+0x9b, 0x4b, 0x57, 0x98, 0x74, 0x81, 0x39, 0x84, 0x8a, 0x12, 0xcb, 0x8a, 0xb9, 0xba, 0x9a, 0x81,
+0x09, 0x47, 0x01, 0x62, 0x12, 0x28, 0x13, 0x0b, 0x08, 0xcd, 0x99, 0xca, 0xaa, 0x89, 0x99, 0x1a,
+0x09, 0x99, 0x91, 0xe8, 0xa8, 0xfc, 0x38, 0x85, 0x3d, 0x07, 0x89, 0x34, 0xa9, 0x32, 0xc0, 0x08,
+0xc0, 0x99, 0xa8, 0xa9, 0x88, 0x00, 0x29, 0x34, 0x40, 0x53, 0x21, 0x42, 0x21, 0x2b, 0x82, 0x8e,
+0x89, 0x9f, 0x98, 0x9c, 0x88, 0x8b, 0x90, 0x80, 0x81, 0x3a, 0x08, 0xbc, 0xf8, 0xdc, 0x72, 0xba,
+0x52, 0xb0, 0x61, 0x91, 0x48, 0x81, 0x19, 0x92, 0x8a, 0x98, 0xca, 0x0a, 0xb8, 0x2b, 0x90, 0x4a,
+0x24, 0x59, 0x32, 0x30, 0x14, 0x81, 0x02, 0xa8, 0xa9, 0xcf, 0xb8, 0xbb, 0x99, 0x8e, 0x09, 0x0a,
+0x48, 0x1a, 0x21, 0x99, 0xc1, 0xd0, 0xea, 0xd8, 0x31, 0xac, 0x35, 0x8b, 0x27, 0x80, 0x52, 0x88,
+0x21, 0xa0, 0x18, 0xc8, 0x0a, 0xb9, 0x8c, 0xa8, 0x0b, 0xa1, 0x08, 0x41, 0x19, 0x25, 0x93, 0x16,
+0x12, 0x91, 0x05, 0x8a, 0x82, 0x9e, 0x90, 0xbc, 0x98, 0xbd, 0xa1, 0x0b, 0x19, 0x0a, 0x68, 0x90,
+0x04, 0x92, 0x39, 0xea, 0xc0, 0x8a, 0xb7, 0x2c, 0xb3, 0x49, 0x05, 0x38, 0x24, 0x29, 0x33, 0x1c,
+0x12, 0xcb, 0x10, 0xad, 0x2a, 0xdb, 0x19, 0xaa, 0x19, 0x98, 0x1a, 0x96, 0x58, 0x02, 0x10, 0x86,
+0x01, 0x03, 0xa8, 0x04, 0x8d, 0xa8, 0xd9, 0x98, 0xba, 0x90, 0xd9, 0x81, 0xb3, 0x21, 0x93, 0x04,
+0x01, 0x5a, 0x8b, 0x8c, 0x9c, 0x8e, 0x80, 0xba, 0x06, 0x90, 0x15, 0x12, 0x43, 0x83, 0x41, 0x80,
+0x59, 0xb8, 0x80, 0xc0, 0x99, 0xd1, 0x08, 0xa9, 0xc0, 0x91, 0x88, 0x60, 0x3b, 0x40, 0xa1, 0x25,
+0x29, 0x68, 0x90, 0x02, 0x91, 0x08, 0xe2, 0x19, 0xa9, 0xac, 0xe8, 0x89, 0x0b, 0x1e, 0x89, 0x1a,
+0x10, 0x3c, 0x49, 0x89, 0xa8, 0xe3, 0x91, 0xa2, 0x08, 0xe2, 0xa0, 0xa2, 0xb2, 0x7a, 0x5b, 0x09,
+0x41, 0x19, 0x23, 0x68, 0x01, 0x94, 0x40, 0x19, 0x28, 0x0a, 0x2a, 0x8d, 0x29, 0x1d, 0x0b, 0xa8,
+0xa2, 0x08, 0x3c, 0x3b, 0x4b, 0x6c, 0x39, 0x29, 0x08, 0xe2, 0x91, 0x82, 0x8a, 0xf8, 0xb1, 0xb2,
+0xe3, 0x03, 0x8a, 0xa2, 0x83, 0x4b, 0x3b, 0x3f, 0x0a, 0x8a, 0x8a, 0x0b, 0xc8, 0x3f, 0x2a, 0x8c,
+0x40, 0x2e, 0x00, 0x3a, 0x98, 0x82, 0x02, 0x83, 0x3b, 0x00, 0x6e, 0x19, 0x29, 0x28, 0xb0, 0x03,
+0x3c, 0x7c, 0x19, 0x80, 0xb0, 0xb3, 0xb3, 0x84, 0x84, 0x4b, 0x3b, 0xc0, 0xc3, 0xb3, 0xb4, 0xc3,
+0xb0, 0x03, 0x3d, 0x3b, 0x4b, 0x08, 0x08, 0x08, 0x08, 0x98, 0x4f, 0xb8, 0xc4, 0xb3, 0xb4, 0xc3,
+0x03, 0x3c, 0x3b, 0x80, 0x3d, 0x4b, 0x3b, 0xd0, 0xb3, 0x03, 0x80, 0x3e, 0x4b, 0x3b, 0x3c, 0x4b,
+0x3b, 0x3c, 0x3b, 0xc0, 0xb3, 0xc4, 0x4b, 0x3b, 0x3b, 0x3c, 0x00, 0xd8, 0x03, 0x3c, 0x3c, 0x4b,
+0x3b, 0x3c, 0x4b, 0x8b, 0xc0, 0x03, 0xc8, 0x48, 0x4b, 0x3b, 0x08, 0xc8, 0xc3, 0x40, 0x3b, 0x3c,
+0x4b, 0x7b, 0x19, 0x3a, 0x3b, 0x3b, 0xc0, 0x83, 0x7c, 0x19, 0x19, 0x3a, 0x3b, 0x3b, 0x40, 0xc0,
+0xb3, 0x03, 0xe0, 0xb3, 0x03, 0x3d, 0x3b, 0x4b, 0x3c, 0x4b, 0x3b, 0x3c, 0x4b, 0x8b, 0x4b, 0xb8,
+0xc3, 0x84, 0x4b, 0x3b, 0xf8, 0xa1, 0xa2, 0x83, 0x4b, 0x08, 0x08, 0x08, 0x08, 0xf8, 0xb3, 0xc3,
+0x84, 0x80, 0x3c, 0x4b, 0x3b, 0x3c, 0x00, 0x88, 0x4d, 0x3b, 0x08, 0x80, 0xe0, 0xc3, 0xb3, 0x03,
+0x3c, 0x3c, 0x4b, 0xb3, 0x03, 0x3d, 0x4b, 0x3b, 0xd0, 0x83, 0xc0, 0xb3, 0x84, 0x3b, 0x4c, 0x3b,
+0xc0, 0xc3, 0xb3, 0x03, 0x3c, 0x3c, 0xc0, 0xb3, 0x84, 0x80, 0x3c, 0x4b, 0x3c, 0x4b, 0x8b, 0x8b,
+0xb4, 0xb4, 0x03, 0x08, 0x08, 0x3f, 0x3b, 0xd0, 0xb3, 0xb3, 0x84, 0x3c, 0x4b, 0xb8, 0xb4, 0xc3,
+0x03, 0x3c, 0x4b, 0x08, 0xc3, 0xb4, 0xb3, 0xc3, 0xe4, 0x03, 0x4a, 0xa6, 0x2c, 0x1b, 0x10, 0x2a,
+0xaa, 0x95, 0x08, 0xa8, 0xb5, 0x82, 0xa2, 0xb2, 0x80, 0x80, 0x3c, 0x4c, 0x08, 0x3c, 0x80, 0x10,
+0x07, 0x8f, 0xa2, 0x01, 0x6c, 0x89, 0x81, 0x5b, 0xa9, 0xb7, 0x20, 0x99, 0x20, 0x99, 0xa3, 0x39,
+0xf7, 0x11, 0x0a, 0xa2, 0x7c, 0x99, 0x92, 0x80, 0x90, 0x82, 0x1a, 0xa1, 0x30, 0x3f, 0x98, 0x38,
+0x1b, 0x88, 0xf3, 0x83, 0x1a, 0x28, 0xda, 0xa7, 0x38, 0x89, 0x5c, 0x09, 0x98, 0x82, 0x08, 0xd1,
+0x83, 0x09, 0xb1, 0x96, 0x5b, 0x09, 0x3a, 0xf0, 0x94, 0x4a, 0x1b, 0xd3, 0x20, 0xa9, 0xa5, 0x28,
+0xb8, 0x13, 0x3f, 0x89, 0x38, 0x4d, 0x0a, 0xb1, 0x02, 0xc0, 0x93, 0x80, 0x38, 0x1d, 0xd3, 0x50,
+0x2e, 0xb0, 0x83, 0x29, 0x2c, 0xc2, 0x38, 0xf0, 0x83, 0x4b, 0xa8, 0x82, 0x08, 0x08, 0x88, 0x10,
+0x4e, 0x98, 0x28, 0xe8, 0x95, 0x5a, 0x0b, 0xc3, 0x21, 0x1c, 0x91, 0x39, 0xd8, 0x84, 0x3b, 0x99,
+0xb5, 0x40, 0x2d, 0x98, 0x01, 0x19, 0x19, 0xd0, 0xa6, 0x28, 0x0a, 0x91, 0x00, 0x08, 0x29, 0x99,
+0x02, 0x4f, 0xa9, 0x84, 0x4c, 0xa8, 0x82, 0x98, 0x83, 0x3d, 0xf2, 0x11, 0x0a, 0xb2, 0x02, 0x5b,
+0x1b, 0xb2, 0x00, 0x80, 0x98, 0xa5, 0x7e, 0x99, 0x82, 0x5b, 0xa9, 0xa5, 0x28, 0x0a, 0xa1, 0x01,
+0x09, 0xa2, 0x7a, 0x1b, 0x80, 0x28, 0xa9, 0x02, 0xb0, 0x82, 0xb0, 0x86, 0x2c, 0xb1, 0x84, 0x5e,
+0x0a, 0x90, 0x20, 0x8a, 0x21, 0x0c, 0xd5, 0x01, 0xb0, 0x04, 0x3e, 0xa0, 0x10, 0xc8, 0x85, 0x3d,
+0xb0, 0x94, 0x4a, 0x99, 0x20, 0x2b, 0x90, 0x39, 0xd0, 0xa3, 0x93, 0x2b, 0xf4, 0x02, 0x1a, 0xa0,
+0x70, 0x0c, 0x92, 0x19, 0x08, 0xb1, 0x60, 0x0c, 0x92, 0x09, 0xb3, 0x81, 0x49, 0x0b, 0xb4, 0x6b,
+0xb0, 0x11, 0x7a, 0x1e, 0xa2, 0x80, 0x28, 0x1b, 0xd3, 0x31, 0x0d, 0xa2, 0x00, 0xa0, 0x82, 0x7b,
+0xb9, 0x05, 0x2c, 0xb0, 0x83, 0x2a, 0xb1, 0x68, 0xba, 0x96, 0x08, 0x80, 0x5a, 0x0a, 0x90, 0x21,
+0x8c, 0xc6, 0x30, 0xc9, 0x84, 0x2a, 0x98, 0x11, 0x2c, 0x90, 0x18, 0xb0, 0x21, 0x0a, 0x91, 0xf3,
+0x12, 0x9a, 0x70, 0x8c, 0xb6, 0x20, 0x99, 0x20, 0xb9, 0x95, 0x39, 0x0a, 0x59, 0x2d, 0x88, 0xb2,
+0x20, 0xb9, 0x05, 0x8c, 0xa7, 0x80, 0x00, 0xa8, 0x03, 0x1b, 0x38, 0x9a, 0x69, 0xa9, 0x84, 0x4e,
+0xc8, 0x84, 0x1a, 0x00, 0xa8, 0x93, 0x39, 0xc8, 0x22, 0xf9, 0x42, 0x1d, 0x08, 0xb1, 0x22, 0x2f,
+0xc1, 0x82, 0x19, 0x91, 0x4b, 0xb1, 0x18, 0x10, 0x2c, 0xf4, 0x21, 0x8b, 0x82, 0x19, 0x80, 0x5c,
+0xa8, 0x81, 0xa1, 0x01, 0xb0, 0xb4, 0x02, 0x0a, 0xc4, 0x11, 0x4b, 0x1c, 0xc3, 0x28, 0xa0, 0x7a,
+0x09, 0x5b, 0xb8, 0x12, 0x2b, 0xf1, 0x94, 0x88, 0x10, 0x99, 0x41, 0xbb, 0x07, 0x2d, 0x90, 0x91,
+0x18, 0xe2, 0x02, 0x3b, 0xc1, 0x38, 0x89, 0x08, 0x18, 0x81, 0x8a, 0x7f, 0xb8, 0x93, 0x08, 0x82,
+0x8b, 0x84, 0x89, 0x92, 0x39, 0x4c, 0x2b, 0x3a, 0x89, 0x4c, 0xf4, 0x01, 0x98, 0x92, 0x6b, 0xa0,
+0x28, 0x99, 0xa6, 0x5c, 0xb0, 0x82, 0x09, 0xb3, 0x7b, 0x1a, 0x08, 0x19, 0xc1, 0x83, 0x0a, 0x81,
+0x81, 0x1b, 0xc7, 0x20, 0x3c, 0x99, 0x22, 0x1f, 0x92, 0x3c, 0xb1, 0x81, 0x81, 0x09, 0x90, 0xd6,
+0x21, 0xaa, 0x13, 0x0c, 0x93, 0x2c, 0x92, 0x1a, 0x38, 0x0c, 0xa3, 0x1b, 0xd7, 0xa3, 0x00, 0x90,
+0x01, 0x5b, 0x09, 0x2b, 0xc6, 0x6a, 0x89, 0x90, 0xb3, 0x82, 0x89, 0xa5, 0x19, 0x28, 0x3d, 0xd0,
+0x70, 0xaa, 0x03, 0x0a, 0x10, 0xf0, 0x03, 0xaa, 0x05, 0x2c, 0x90, 0x88, 0xa3, 0x18, 0x08, 0x88,
+0x82, 0x4f, 0x09, 0xa0, 0x21, 0xaa, 0xb4, 0x21, 0xf0, 0x11, 0x29, 0x8a, 0x21, 0x1d, 0xf4, 0x82,
+0x88, 0x10, 0x1a, 0x08, 0x80, 0xb1, 0xd2, 0x97, 0x5b, 0x89, 0x28, 0xa8, 0x20, 0x88, 0x2b, 0xb2,
+0xe3, 0xb5, 0x00, 0x82, 0x0c, 0x13, 0x8c, 0x92, 0x21, 0x0e, 0x01, 0x09, 0xa0, 0xb5, 0x30, 0x9c,
+0x96, 0x29, 0x89, 0x10, 0x3c, 0xd2, 0x18, 0xb0, 0x86, 0xb9, 0x85, 0x5b, 0xc0, 0x11, 0x19, 0x1a,
+0x08, 0xe4, 0x20, 0x89, 0xa1, 0x11, 0x0a, 0x50, 0x0e, 0xb3, 0x80, 0x21, 0xab, 0xa6, 0x00, 0x88,
+0xd3, 0x30, 0xe8, 0x12, 0x0a, 0x91, 0x00, 0x09, 0x08, 0xf2, 0x13, 0x9a, 0x91, 0x84, 0xca, 0x13,
+0xf2, 0x48, 0x8a, 0x12, 0x9c, 0x84, 0x09, 0x08, 0x98, 0x07, 0x8c, 0x83, 0xf1, 0x21, 0x9a, 0x83,
+0x2a, 0x4a, 0x8a, 0x18, 0x28, 0xe0, 0x20, 0x90, 0x08, 0x89, 0x05, 0x0f, 0x94, 0x1a, 0x01, 0x1e,
+0xb5, 0x4a, 0x90, 0x29, 0x98, 0x20, 0xb0, 0x49, 0xb0, 0xa2, 0xb2, 0x10, 0x10, 0xd0, 0x21, 0x2a,
+0x0d, 0xa3, 0xd0, 0xa7, 0x81, 0x00, 0x1a, 0x18, 0xc0, 0x91, 0xb6, 0x68, 0x9b, 0x31, 0xa9, 0x01,
+0x48, 0xab, 0x94, 0x08, 0xf2, 0x83, 0x99, 0xb3, 0x40, 0x08, 0xaa, 0x32, 0xe8, 0xa1, 0xb3, 0x96,
+0x98, 0xa4, 0xc2, 0x01, 0xa2, 0x28, 0x8a, 0xc0, 0xb7, 0x01, 0x28, 0x3d, 0xa9, 0x94, 0x08, 0x80,
+0x6b, 0xa0, 0xa0, 0xb5, 0x21, 0x2a, 0x3e, 0xc0, 0xb3, 0x01, 0x5a, 0x0a, 0x2a, 0x30, 0xb8, 0x3c,
+0x48, 0x3f, 0xa0, 0xd2, 0x01, 0x01, 0x3c, 0x3a, 0x1d, 0x4a, 0x09, 0xa8, 0x02, 0x83, 0x3f, 0x19,
+0x3a, 0xb8, 0x80, 0x80, 0x7d, 0x1b, 0x00, 0x6b, 0x1b, 0x80, 0x29, 0xe2, 0x01, 0x08, 0x5a, 0xa9,
+0xb4, 0x01, 0xb2, 0x30, 0x1f, 0x80, 0xa0, 0x82, 0x3a, 0x6c, 0x1b, 0x29, 0x6b, 0x2b, 0x28, 0x1d,
+0x49, 0x3b, 0x0a, 0x2a, 0x30, 0x1f, 0x19, 0x3a, 0x6b, 0x1b, 0x80, 0x80, 0x80, 0xb4, 0xf3, 0x93,
+0xa1, 0xb3, 0xb3, 0x03, 0x3c, 0xb8, 0xc4, 0x7b, 0x2b, 0xa8, 0x95, 0xa1, 0xa2, 0xb3, 0x48, 0x3b,
+0x3b, 0x4b, 0x3c, 0xc0, 0xb3, 0x03, 0x3d, 0x0b,
+};
+
+static const uint8_t alarmClip_level3breach[] PROGMEM = {
+0x00, 0xff, 0xff, 0xb6, 0x03, 0x3d, 0x3b, 0x4b, 0x3c, 0x80, 0xd0, 0xb3, 0xc3, 0xb3, 0x84, 0x4b,
+0x3b, 0x3c, 0xf8, 0x91, 0x82, 0x2a, 0x80, 0x4b, 0x3c, 0x3b, 0x4b, 0x3c, 0x80, 0x3c, 0x80, 0x80,
+0x4d, 0x3b, 0x3c, 0x4b, 0xb8, 0xb3, 0xc4, 0x03, 0x48, 0x3b, 0x4b, 0x3c, 0x4b, 0x3b, 0xb8, 0xf4,
+0x01, 0x88, 0xa0, 0x02, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0xfd, 0xc5, 0xb3, 0x07,
+0x08, 0x08, 0x08, 0x08, 0xc8, 0xb3, 0xc4, 0xf3, 0x91, 0x08, 0x0d, 0x9a, 0xc8, 0x91, 0x5a, 0x08,
+0x84, 0x04, 0x13, 0x24, 0x23, 0x20, 0x80, 0xb3, 0xf4, 0xb1, 0x98, 0x8a, 0x1d, 0x2a, 0x83, 0x83,
+0x3f, 0x89, 0x95, 0xc8, 0xb9, 0x9e, 0x9b, 0x9c, 0xc9, 0xb9, 0x89, 0x19, 0x16, 0x34, 0x43, 0x33,
+0x53, 0x41, 0x11, 0x92, 0xb1, 0xd9, 0xb0, 0xda, 0xa9, 0x8b, 0x0d, 0x89, 0x39, 0x32, 0x15, 0x14,
+0x51, 0x31, 0x12, 0x82, 0xa2, 0xfa, 0xc9, 0xba, 0xcc, 0xaa, 0xcb, 0xa8, 0xa9, 0x9c, 0x99, 0x08,
+0x15, 0x15, 0x15, 0x23, 0x24, 0x33, 0x14, 0x02, 0x92, 0xb0, 0xda, 0xc9, 0xc9, 0xbb, 0xcb, 0x90,
+0x19, 0x68, 0x31, 0x22, 0x44, 0x02, 0x86, 0x82, 0x08, 0x1b, 0xbb, 0xfb, 0xbc, 0xba, 0xca, 0xa0,
+0xc0, 0xc9, 0xa0, 0x81, 0x14, 0x43, 0x41, 0x33, 0x15, 0x24, 0x33, 0x02, 0x92, 0x0b, 0xcc, 0xd9,
+0xa8, 0x8d, 0xab, 0x99, 0x10, 0x33, 0x23, 0x27, 0x51, 0x30, 0x21, 0x18, 0x09, 0xcb, 0xd9, 0xc9,
+0xad, 0xac, 0xb9, 0x88, 0x98, 0x9c, 0x98, 0x3b, 0x61, 0x33, 0x73, 0x31, 0x32, 0x53, 0x12, 0x83,
+0xa1, 0xac, 0x9b, 0xcc, 0xc8, 0xa9, 0xca, 0xa0, 0x12, 0x24, 0x25, 0x12, 0x13, 0x15, 0x31, 0x90,
+0xb8, 0xae, 0x9c, 0xbc, 0xca, 0xba, 0x8b, 0x1c, 0x9a, 0x9b, 0xc9, 0x03, 0x17, 0x24, 0x53, 0x21,
+0x33, 0x16, 0x12, 0x08, 0x8a, 0xad, 0x9b, 0x9d, 0x9a, 0x9b, 0xa9, 0x11, 0x45, 0x53, 0x32, 0x82,
+0x82, 0x84, 0x01, 0xbc, 0xad, 0xca, 0xb9, 0xda, 0xc0, 0x08, 0x9a, 0xd0, 0xb8, 0x88, 0x78, 0x42,
+0x31, 0x41, 0x22, 0x43, 0x22, 0x08, 0xad, 0x9c, 0xa9, 0xca, 0xaa, 0xab, 0x10, 0x64, 0x32, 0x13,
+0x12, 0x23, 0x23, 0xca, 0xbe, 0xbc, 0x88, 0xb8, 0xf9, 0xaa, 0x88, 0x91, 0xe9, 0xca, 0x99, 0x68,
+0x33, 0x36, 0x21, 0x21, 0x31, 0x01, 0xdb, 0xcd, 0x9a, 0x89, 0x98, 0x09, 0x42, 0x35, 0x13, 0x90,
+0x00, 0x03, 0x90, 0xdd, 0xa9, 0x18, 0x88, 0x89, 0xa0, 0xc9, 0xde, 0x9b, 0xbb, 0xbd, 0xac, 0x75,
+0x32, 0x04, 0x00, 0x00, 0x08, 0xbc, 0xac, 0x8a, 0x81, 0x10, 0x21, 0x37, 0x02, 0xd0, 0x89, 0x19,
+0x00, 0x89, 0x11, 0x24, 0xa0, 0xbb, 0x1c, 0x90, 0xce, 0xad, 0x98, 0xa0, 0xeb, 0x89, 0x67, 0x21,
+0x81, 0x09, 0x88, 0x99, 0xac, 0x09, 0x20, 0x02, 0x28, 0x33, 0x24, 0xbd, 0xac, 0x19, 0x01, 0x40,
+0x42, 0x14, 0x88, 0xba, 0x8b, 0xca, 0x98, 0xca, 0xac, 0x8c, 0x09, 0xcb, 0x9c, 0x75, 0x16, 0x00,
+0x89, 0x08, 0x9a, 0xb9, 0x20, 0x04, 0x81, 0x09, 0x04, 0x98, 0xad, 0x19, 0x88, 0x31, 0x78, 0x13,
+0x80, 0xb9, 0x80, 0xaa, 0xe9, 0x19, 0xcc, 0xaa, 0xaa, 0xb1, 0xbc, 0x1a, 0x77, 0x17, 0x80, 0x0a,
+0x88, 0x99, 0x99, 0x31, 0x83, 0x90, 0x10, 0x84, 0xab, 0xac, 0x31, 0x29, 0x02, 0x44, 0xb2, 0x80,
+0x1b, 0x81, 0x8e, 0xfb, 0x9b, 0xbb, 0xa9, 0x1d, 0xba, 0x50, 0x77, 0x11, 0x90, 0x89, 0xa8, 0x9a,
+0x2a, 0x53, 0x00, 0x98, 0x31, 0xb1, 0xcb, 0x1a, 0x04, 0x28, 0x91, 0x34, 0x8d, 0x88, 0x30, 0xb1,
+0xdb, 0xbf, 0x98, 0x9c, 0x99, 0x09, 0x18, 0x77, 0x13, 0x81, 0x89, 0x98, 0x9c, 0x99, 0x31, 0x03,
+0x91, 0x31, 0x86, 0xa9, 0x9a, 0x38, 0x88, 0x21, 0x59, 0xa1, 0x0d, 0x88, 0x81, 0xfd, 0xaa, 0x9b,
+0xdb, 0x8b, 0x19, 0x67, 0x22, 0x03, 0x88, 0xa8, 0xac, 0xaa, 0x28, 0x13, 0x21, 0x33, 0x26, 0x99,
+0xe9, 0x00, 0x98, 0x11, 0x29, 0x81, 0x8e, 0xa0, 0x00, 0xcf, 0x8a, 0x8a, 0xda, 0x9a, 0x20, 0x67,
+0x12, 0x01, 0x88, 0x98, 0xba, 0xaa, 0x10, 0x12, 0x31, 0x33, 0x06, 0xa1, 0xb0, 0x89, 0xd9, 0x92,
+0x91, 0xb0, 0xba, 0x8c, 0x0c, 0xaf, 0xaa, 0xc8, 0xb9, 0x1b, 0x73, 0x43, 0x32, 0x01, 0x02, 0x80,
+0xa1, 0x40, 0x98, 0x93, 0xa8, 0xa2, 0x6c, 0x19, 0x80, 0x2a, 0x6a, 0xc9, 0xb1, 0xaa, 0xd0, 0xb8,
+0xca, 0xca, 0x80, 0x1c, 0x1b, 0x4c, 0x38, 0x02, 0x24, 0x6a, 0x30, 0x58, 0x19, 0x10, 0x80, 0xb4,
+0x01, 0xa8, 0x95, 0x82, 0x80, 0x3b, 0xc0, 0xb3, 0x8c, 0xaf, 0xc0, 0x98, 0xa8, 0xd0, 0xc1, 0x82,
+0x2a, 0x3d, 0x29, 0xb2, 0x83, 0x84, 0x33, 0x40, 0x48, 0x48, 0x3b, 0x7b, 0x19, 0xa2, 0xa2, 0xb3,
+0xc3, 0x03, 0x8c, 0x4b, 0xcb, 0xe3, 0x28, 0x1d, 0xa9, 0xa2, 0x83, 0x0b, 0x3c, 0x3b, 0x3c, 0x4b,
+0xc8, 0x97, 0x91, 0x01, 0x82, 0x3a, 0x6c, 0x89, 0x82, 0xa2, 0xb3, 0xc3, 0x03, 0xf4, 0xa3, 0xa0,
+0xa2, 0xb3, 0x3b, 0x8b, 0x3c, 0xc0, 0xf4, 0x01, 0x98, 0xc3, 0xb4, 0x21, 0xaa, 0x02, 0xc3, 0xb3,
+0x03, 0x3c, 0x80, 0xb4, 0x84, 0x80, 0x80, 0x7d, 0xa0, 0x80, 0xd2, 0x91, 0x94, 0x08, 0x88, 0x8a,
+0x7c, 0x0b, 0x0a, 0x28, 0xb0, 0x03, 0xf8, 0x03, 0xd2, 0x01, 0xc1, 0x82, 0xa2, 0x95, 0xa1, 0x23,
+0x0b, 0x97, 0x01, 0xa8, 0xb6, 0x91, 0x2a, 0x80, 0xb8, 0xe4, 0x08, 0x0a, 0xf1, 0x92, 0x39, 0x1c,
+0xe2, 0x92, 0xb1, 0x82, 0x82, 0x7c, 0x2a, 0x18, 0x19, 0x01, 0x88, 0xb5, 0xa5, 0x01, 0x98, 0x21,
+0xa8, 0xe3, 0xa3, 0xd9, 0xb1, 0x94, 0x08, 0x8a, 0x0d, 0x2a, 0x3d, 0x80, 0x2a, 0xaa, 0x38, 0x00,
+0x07, 0x02, 0x95, 0x14, 0x3c, 0x49, 0x08, 0x4a, 0x80, 0xb0, 0xe3, 0x01, 0x4a, 0x89, 0x4b, 0xaf,
+0x90, 0x81, 0x09, 0x0a, 0x1c, 0x8b, 0x3d, 0x2d, 0x11, 0x51, 0x20, 0x13, 0x91, 0x84, 0x60, 0x3a,
+0xba, 0x0b, 0x1f, 0x08, 0x41, 0x4a, 0x19, 0xb2, 0xa2, 0xbb, 0xaf, 0x98, 0x95, 0x8a, 0xdc, 0xb9,
+0xa9, 0x07, 0x33, 0x33, 0x02, 0x88, 0x1d, 0x2a, 0x11, 0x00, 0x8f, 0x8c, 0x2a, 0x31, 0x72, 0x00,
+0xa0, 0x89, 0x0b, 0x08, 0x1b, 0xeb, 0xca, 0xdb, 0xca, 0x09, 0x7a, 0x31, 0x53, 0x21, 0x01, 0x0a,
+0x9b, 0x89, 0x8b, 0xb8, 0xbc, 0xba, 0x13, 0x67, 0x23, 0x22, 0x99, 0xba, 0x8c, 0xb9, 0xb0, 0xec,
+0xd9, 0xb9, 0x9a, 0x80, 0x72, 0x43, 0x15, 0x12, 0x80, 0x8a, 0xab, 0xa9, 0x89, 0xab, 0xab, 0x1b,
+0x74, 0x62, 0x12, 0x11, 0x98, 0xaa, 0x9b, 0xba, 0xd9, 0xbb, 0xaf, 0xab, 0xaa, 0x92, 0x47, 0x53,
+0x22, 0x02, 0xa0, 0xa8, 0x8d, 0xa9, 0xa0, 0x99, 0x8b, 0x3a, 0x53, 0x27, 0x33, 0x01, 0xa8, 0x9c,
+0xb9, 0x9a, 0x9d, 0xfa, 0xa9, 0xba, 0x99, 0x91, 0x47, 0x61, 0x21, 0x11, 0x98, 0xb0, 0x8a, 0xab,
+0xa8, 0xab, 0xda, 0x20, 0x60, 0x24, 0x15, 0x82, 0x90, 0x9a, 0xaa, 0x8a, 0xea, 0xd9, 0xb9, 0xca,
+0x89, 0x19, 0x72, 0x51, 0x23, 0x13, 0x81, 0xa8, 0xca, 0xc8, 0x98, 0x8c, 0xaa, 0x8a, 0x31, 0x56,
+0x32, 0x03, 0x01, 0xaa, 0xb8, 0xa9, 0xdb, 0xcb, 0xad, 0xbc, 0xb9, 0x99, 0x93, 0x75, 0x41, 0x22,
+0x13, 0x00, 0x89, 0xac, 0xb8, 0xa9, 0xcb, 0xda, 0x98, 0x12, 0x27, 0x43, 0x12, 0x18, 0x9a, 0xba,
+0xb8, 0xca, 0xca, 0xbd, 0xda, 0xa8, 0x0a, 0x10, 0x64, 0x51, 0x22, 0x13, 0x91, 0x88, 0xbb, 0xc8,
+0xa9, 0xbc, 0xda, 0x88, 0x12, 0x36, 0x33, 0x85, 0x01, 0x8b, 0x99, 0x8a, 0xc9, 0xcb, 0x9e, 0x9c,
+0xa9, 0x98, 0x02, 0x70, 0x22, 0x17, 0x21, 0x80, 0x91, 0x99, 0xa8, 0x99, 0xdb, 0xca, 0x0a, 0x28,
+0x45, 0x42, 0x21, 0x18, 0xaa, 0xb0, 0x90, 0xc9, 0xfb, 0xab, 0x9c, 0x89, 0x1a, 0x88, 0x38, 0x07,
+0x45, 0x21, 0x11, 0x18, 0x09, 0x80, 0x99, 0xe9, 0xab, 0x8c, 0x08, 0x42, 0x23, 0x05, 0x18, 0x0a,
+0x11, 0x08, 0xca, 0x9e, 0x9e, 0x99, 0x19, 0x98, 0xa8, 0xda, 0xa1, 0x22, 0x71, 0x40, 0x21, 0x02,
+0x03, 0x22, 0x03, 0x98, 0x9d, 0x9e, 0x88, 0x28, 0x19, 0x39, 0x49, 0x82, 0x94, 0xa2, 0xf9, 0xc8,
+0xa9, 0xb0, 0x1e, 0x8a, 0x1a, 0x0b, 0x2a, 0x0a, 0x08, 0x38, 0x55, 0x84, 0x15, 0x13, 0x14, 0x91,
+0x03, 0x08, 0x3b, 0x0b, 0xec, 0xb1, 0x01, 0xba, 0x20, 0x3f, 0x2d, 0x09, 0x2a, 0x3c, 0x9a, 0x04,
+0xaa, 0xd2, 0xc1, 0xb1, 0xa2, 0xab, 0x86, 0x29, 0x2a, 0xa8, 0x06, 0x84, 0x04, 0x6a, 0x19, 0x19,
+0x01, 0x98, 0xa7, 0x00, 0x8a, 0x2b, 0x08, 0xd8, 0x28, 0xaa, 0x38, 0x7b, 0xa9, 0xb7, 0x11, 0x89,
+0x89, 0xa0, 0xb5, 0x01, 0x1c, 0x10, 0x3a, 0x3e, 0x28, 0x20, 0xab, 0xa2, 0x17, 0x1b, 0xd3, 0x81,
+0xa0, 0x50, 0x0a, 0x2a, 0xe0, 0x91, 0x84, 0x49, 0x0c, 0x28, 0xaa, 0xb5, 0x01, 0x82, 0xba, 0x03,
+0x0c, 0x48, 0x3e, 0xd0, 0x93, 0x01, 0xa8, 0x02, 0x48, 0xe8, 0x03, 0x08, 0x3d, 0x19, 0x3a, 0x6b,
+0xa9, 0x22, 0x8a, 0xc0, 0x3a, 0xf2, 0x91, 0x82, 0x2a, 0x80, 0xc0, 0x97, 0x91, 0x88, 0xa0, 0x02,
+0x3f, 0x2a, 0x80, 0x2a, 0x4b, 0xb8, 0x34, 0x0c, 0x3b, 0xc0, 0x96, 0x28, 0x80, 0x0b, 0xb4, 0x48,
+0xbb, 0x43, 0x3f, 0xa0, 0x80, 0xa2, 0x38, 0x4b, 0x1f, 0x80, 0xa2, 0x5a, 0xc0, 0x83, 0x89, 0xa2,
+0x08, 0x6c, 0x4b, 0x1b, 0x80, 0x2a, 0x3a, 0x08, 0x58, 0x1e, 0x80, 0x20, 0x0b, 0xb3, 0xf4, 0xa3,
+0x82, 0x2c, 0xa1, 0xb3, 0xf3, 0x83, 0x4b, 0x1b, 0x80, 0x80, 0x7b, 0x2b, 0xa1, 0x80, 0x30, 0x4b,
+0x1f, 0x10, 0x1c, 0x82, 0xa0, 0x38, 0x3b, 0x1f, 0xc2, 0xb3, 0x21, 0x2a, 0x3a, 0x08, 0x0d, 0x3b,
+0x3c, 0xc0, 0x97, 0xb1, 0x01, 0xa8, 0x02, 0xc3, 0x40, 0x1f, 0x91, 0xa0, 0x04, 0x2a, 0x8a, 0x30,
+0x1f, 0x80, 0x5a, 0x19, 0x3c, 0xc0, 0xc3, 0x93, 0x80, 0xa2, 0x08, 0x48, 0x8b, 0x40, 0x3f, 0xb8,
+0x84, 0x4b, 0x1b, 0x80, 0xd2, 0x84, 0x4b, 0x3b, 0x3c, 0xa0, 0x80, 0x08, 0xf3, 0x91, 0x01, 0x5a,
+0x19, 0x2a, 0x3a, 0x3e, 0x0a, 0x38, 0x3e, 0x1b, 0xc2, 0x03, 0x3d, 0x89, 0x20, 0xba, 0x96, 0x08,
+0x08, 0xb2, 0x40, 0x3f, 0x3b, 0x0a, 0xa2, 0xb8, 0xb4, 0x96, 0x4a, 0x89, 0xa2, 0x3a, 0xe2, 0xa1,
+0x83, 0x80, 0x08, 0x7c, 0x1b, 0xa2, 0x80, 0xb3, 0xb3, 0x84, 0x1f, 0xc2, 0xc3, 0x01, 0xa0, 0x94,
+0xc1, 0x84, 0x3b, 0x89, 0xb3, 0x08, 0xf4, 0xb3, 0x48, 0x1b, 0x20, 0x8a, 0xe3, 0xb3, 0x21, 0x8a,
+0x3a, 0xc8, 0x03, 0x3c, 0x80, 0x80, 0xf5, 0x01, 0x08, 0x08, 0x7b, 0x19, 0x19, 0x3a, 0x3e, 0x19,
+0x2a, 0x0a, 0x38, 0x4b, 0x3f, 0x1b, 0x20, 0x3d, 0x98, 0xb2, 0xe3, 0x93, 0xc1, 0x03, 0x2a, 0x3a,
+0x0c, 0xf3, 0x91, 0xc3, 0xb4, 0x93, 0x28, 0x3d, 0xc0, 0xb3, 0x01, 0x08, 0x08, 0x6c, 0x1b, 0x80,
+0x5a, 0x89, 0xa0, 0xb5, 0x21, 0xd0, 0xa3, 0xa2, 0x80, 0xb3, 0x3c, 0x4b, 0x3b, 0x08, 0x3c, 0x80,
+0x7d, 0x2b, 0x2a, 0xa8, 0x02, 0x3b, 0xb4, 0xb8, 0x84, 0x00, 0x88, 0xf0, 0x96, 0x2a, 0x8a, 0xb3,
+0x07, 0x0a, 0x08, 0xb2, 0x30, 0x0c, 0x48, 0x1e, 0x49, 0x2a, 0xaa, 0x23, 0xc0, 0xe3, 0x41, 0x8b,
+0x29, 0x08, 0x08, 0x08, 0x97, 0x12, 0x9f, 0x50, 0xb9, 0x82, 0xd1, 0x11, 0x19, 0x08, 0x98, 0x04,
+0xa8, 0x02, 0xf1, 0x20, 0x08, 0x28, 0x1f, 0xd1, 0x82, 0x09, 0x19, 0x5a, 0x1b, 0x10, 0xa2, 0xd2,
+0x84, 0xe0, 0x04, 0x2b, 0x19, 0x3b, 0x10, 0xf1, 0x88, 0x80, 0xe2, 0x82, 0x01, 0x89, 0x93, 0xc1,
+0x18, 0x07, 0x9a, 0x80, 0x10, 0xf0, 0x92, 0x21, 0x8a, 0x98, 0x52, 0x1b, 0x0c, 0x97, 0x99, 0x83,
+0xa0, 0x10, 0xc2, 0x0c, 0xa3, 0x94, 0x0e, 0x30, 0xb1, 0xa3, 0x29, 0x35, 0x80, 0x0d, 0x6d, 0xa8,
+0x19, 0xb2, 0x0a, 0x04, 0x19, 0x2f, 0x01, 0x89, 0x23, 0xe9, 0x92, 0x28, 0x9a, 0x91, 0x08, 0x3d,
+0x10, 0x0a, 0x8f, 0xa4, 0x00, 0x29, 0x0c, 0xf1, 0x11, 0x80, 0x3b, 0x11, 0x50, 0xd0, 0x91, 0x15,
+0xa0, 0x9a, 0x40, 0x20, 0x0b, 0xba, 0x14, 0x16, 0xca, 0x3a, 0x1a, 0x33, 0x9d, 0x1b, 0x29, 0x31,
+0xfb, 0xc8, 0x32, 0x9a, 0x0f, 0x91, 0x91, 0xb9, 0xa2, 0x29, 0x22, 0x05, 0x01, 0x07, 0x11, 0x83,
+0x96, 0x88, 0x89, 0x2b, 0xaa, 0xd2, 0x01, 0xd5, 0x00, 0xa4, 0x09, 0x23, 0xe2, 0x20, 0xb2, 0xeb,
+0x01, 0x0c, 0x62, 0xaa, 0x0b, 0x18, 0x09, 0x0a, 0xc9, 0x98, 0x94, 0xa3, 0x02, 0x27, 0x61, 0x11,
+0x18, 0x29, 0x80, 0xc2, 0xc0, 0xb9, 0xa0, 0x3a, 0xab, 0x08, 0x17, 0x12, 0x07, 0x99, 0x8a, 0x82,
+0x06, 0x92, 0x9f, 0x0a, 0x1a, 0x8d, 0x0b, 0x0d, 0x9b, 0x19, 0x20, 0x71, 0x21, 0x15, 0x33, 0x11,
+0x82, 0x91, 0xb1, 0xd8, 0xdb, 0xca, 0xa9, 0x88, 0x90, 0x03, 0x15, 0x14, 0x94, 0xa2, 0x83, 0x03,
+0xd2, 0xf0, 0xb9, 0xc9, 0x90, 0xc8, 0xda, 0x88, 0x18, 0x18, 0x38, 0x51, 0x33, 0x37, 0x31, 0x02,
+0x82, 0x00, 0x89, 0xe9, 0xac, 0x9d, 0x89, 0x09, 0x28, 0x38, 0x72, 0x13, 0x92, 0x91, 0x23, 0x35,
+0xba, 0xee, 0xb9, 0xa8, 0x99, 0xcc, 0xba, 0x2a, 0x42, 0x31, 0x30, 0x74, 0x43, 0x13, 0x00, 0x80,
+0x81, 0xd8, 0xea, 0xa9, 0x89, 0x99, 0x0c, 0x39, 0x42, 0x14, 0x02, 0x33, 0x25, 0x80, 0x8c, 0xb9,
+0xea, 0xbc, 0xcb, 0x9a, 0xba, 0xa9, 0x33, 0x34, 0x35, 0x36, 0x42, 0x22, 0x11, 0x10, 0xb0, 0xda,
+0xcb, 0xda, 0x99, 0xaa, 0x99, 0x03, 0x43, 0x35, 0x23, 0x14, 0x13, 0xa0, 0xe8, 0xb8, 0x9d, 0xcb,
+0xcb, 0xa9, 0xb9, 0x9c, 0x53, 0x23, 0x28, 0x55, 0x14, 0x81, 0x20, 0x11, 0xb0, 0xeb, 0x98, 0xc8,
+0xbb, 0x88, 0x91, 0x88, 0x44, 0x34, 0x20, 0x41, 0x14, 0xa9, 0x0c, 0xa8, 0xec, 0xba, 0xa8, 0xba,
+0xad, 0x18, 0x24, 0x00, 0x54, 0x15, 0x01, 0x12, 0x13, 0x88, 0xa9, 0xc8, 0xbc, 0x8d, 0xaa, 0xb9,
+0x10, 0x02, 0x24, 0x45, 0x32, 0x20, 0x20, 0x80, 0xdc, 0xba, 0xfb, 0xaa, 0xa9, 0xac, 0x1c, 0x12,
+0x91, 0x55, 0x13, 0x21, 0x34, 0x82, 0x18, 0x93, 0xdc, 0x89, 0xca, 0x9c, 0x88, 0x9a, 0x38, 0x04,
+0x12, 0x36, 0x82, 0x11, 0x02, 0xda, 0x8c, 0xca, 0xad, 0xb8, 0xca, 0x0b, 0x14, 0x99, 0x55, 0x82,
+0x32, 0x15, 0x10, 0x01, 0xa2, 0xba, 0x99, 0xfc, 0x98, 0xa9, 0x89, 0x91, 0x10, 0x24, 0x42, 0x22,
+0x32, 0x10, 0x9b, 0x9e, 0xfb, 0x9a, 0x9c, 0xcb, 0x0a, 0x12, 0x1e, 0x25, 0x88, 0x54, 0x80, 0x31,
+0x91, 0x00, 0x90, 0xaa, 0xaa, 0xeb, 0x0a, 0xb9, 0x2a, 0x00, 0x78, 0x11, 0x30, 0x84, 0x91, 0x91,
+0xb9, 0x9f, 0xba, 0xcc, 0xda, 0x28, 0xc8, 0x50, 0x92, 0x60, 0x02, 0x38, 0x04, 0x18, 0x01, 0x0b,
+0x99, 0xbb, 0x8d, 0x8b, 0x8c, 0x90, 0x19, 0x84, 0x21, 0x15, 0x39, 0xa2, 0xb8, 0xe2, 0xbb, 0xdb,
+0xac, 0x0e, 0xc2, 0x4b, 0xa3, 0x58, 0x84, 0x38, 0x04, 0x28, 0x02, 0x89, 0x82, 0xbb, 0x90, 0xaf,
+0x91, 0x9c, 0x92, 0x98, 0x13, 0x1a, 0x42, 0x1b, 0x20, 0x0d, 0xfb, 0xa8, 0xfb, 0x28, 0xda, 0x30,
+0x9a, 0x43, 0x82, 0x63, 0x01, 0x22, 0x93, 0x48, 0x88, 0x8a, 0xe2, 0x8a, 0xc0, 0x99, 0xb1, 0x80,
+0x10, 0x1b, 0x96, 0x80, 0xd3, 0x90, 0x99, 0xbd, 0xca, 0x2e, 0xb9, 0x49, 0xb8, 0x44, 0x00, 0x43,
+0x84, 0x42, 0x00, 0x38, 0x90, 0x1a, 0xc8, 0x0c, 0xf1, 0x08, 0xb0, 0x00, 0xb1, 0x01, 0xb3, 0x7b,
+0xc0, 0x10, 0xc9, 0x88, 0xbc, 0x9a, 0xf3, 0x09, 0xb3, 0x68, 0x01, 0x21, 0x14, 0x21, 0x04, 0x20,
+0x81, 0x89, 0x91, 0x8f, 0xa0, 0x9b, 0xb2, 0x1b, 0x80, 0x0c, 0x93, 0x08, 0x92, 0x0f, 0xa0, 0xaf,
+0xd0, 0xba, 0x00, 0xcc, 0x22, 0x9b, 0x17, 0x01, 0x34, 0x81, 0x16, 0x91, 0x22, 0x99, 0x10, 0xbb,
+0x49, 0xad, 0x81, 0x9c, 0x10, 0x0c, 0x28, 0x0a, 0x92, 0xa0, 0x94, 0xac, 0x8d, 0xac, 0xca, 0x1f,
+0xc0, 0x28, 0xd1, 0x41, 0xa2, 0x42, 0x94, 0x31, 0x92, 0x38, 0x81, 0x0a, 0xa1, 0x8f, 0xb2, 0x8b,
+0xc2, 0x1a, 0x98, 0x1a, 0xb3, 0x28, 0xb5, 0x0a, 0xd2, 0x8d, 0xbb, 0xdb, 0xfb, 0x48, 0xbb, 0x33,
+0x9a, 0x74, 0x80, 0x61, 0x80, 0x21, 0x80, 0x20, 0x98, 0x98, 0xa9, 0xa9, 0xb9, 0xb9, 0x08, 0x08,
+0x3b, 0x48, 0x3b, 0x40, 0xf8, 0x98, 0xfa, 0x9a, 0xeb, 0xa9, 0xba, 0x19, 0xd8, 0x52, 0x82, 0x62,
+0x04, 0x21, 0x14, 0x20, 0x28, 0x99, 0xa0, 0xba, 0xdb, 0xba, 0xa9, 0x0a, 0x2a, 0x68, 0x39, 0x78,
+0x29, 0x80, 0xd3, 0x93, 0x9b, 0x9d, 0xd0, 0xa9, 0xa9, 0xb9, 0xa0, 0xa2, 0x02, 0x25, 0x34, 0x86,
+0x04, 0x05, 0x10, 0x80, 0x92, 0x91, 0x91, 0x2a, 0x1d, 0x29, 0x3b, 0xbb, 0x84, 0xb3, 0x03, 0x3d,
+0x7b, 0xa9, 0xc2, 0xc8, 0xc0, 0x8b, 0x8b, 0x8e, 0x99, 0xb8, 0xa8, 0x83, 0x7b, 0x39, 0x40, 0x48,
+0x48, 0x81, 0x84, 0x93, 0x03, 0x5a, 0x2a, 0x20, 0x08, 0x38, 0x40, 0xb8, 0x84, 0x3b, 0x4c, 0x3b,
+0x1f, 0xa0, 0x08, 0x1e, 0x0b, 0x8a, 0xda, 0xc1, 0xa0, 0xa0, 0xb8, 0xb0, 0xb3, 0xc4, 0xb3, 0xb3,
+0xc4, 0x96, 0x93, 0x82, 0x60, 0x39, 0x5a, 0x28, 0x4a, 0x49, 0x08, 0x01, 0x38, 0x3b, 0x83, 0x80,
+0x4c, 0x4b, 0x1f, 0x89, 0x29, 0x1d, 0x89, 0x29, 0x0b, 0x3b, 0x1f, 0x19, 0x0a, 0x3b, 0x4b, 0x1e,
+0xa0, 0xb2, 0x3a, 0x8b, 0xc8, 0xb4, 0x03, 0x3c, 0x3c, 0xb3, 0x34, 0x48, 0x7b, 0x39, 0x49, 0x80,
+0xa2, 0x33, 0x88, 0xc0, 0x03, 0x08, 0x3e, 0x80, 0xf9, 0xb2, 0x83, 0xf0, 0x01, 0x08, 0xa8, 0xa2,
+0x3c, 0x3b, 0xc0, 0xb8, 0xc3, 0xe4, 0x01, 0x08, 0xab, 0x83, 0x4b, 0x1f, 0x80, 0x80, 0x80, 0x80,
+0x3c, 0x7b, 0x19, 0xa2, 0x95, 0x01, 0x22, 0x3a, 0x48, 0x3b, 0x3c, 0x30, 0x4b, 0xc8, 0xc0, 0x03,
+0xc8, 0xb3, 0xc8, 0x03, 0xc8, 0xc3, 0x80, 0x3c, 0x4b, 0xc8, 0xf3, 0x91, 0xa2, 0x38, 0x1f, 0x89,
+0xc2, 0x91, 0xa2, 0xb2, 0xb3, 0x3c, 0x80, 0x40, 0x80, 0x80, 0x05, 0xc8, 0x07, 0x4a, 0xa0, 0x82,
+0x20, 0x3a, 0x6c, 0x19, 0x29, 0x3b, 0x3b, 0x3b, 0x0c, 0xc8, 0x03, 0x3c, 0xd0, 0xb3, 0x03, 0x8c,
+0x3c, 0xc0, 0xb3, 0x3c, 0x3c, 0xc0, 0xf3, 0x91, 0x91, 0x82, 0xb0, 0xc3, 0xb3, 0xb4, 0xc3, 0x06,
+0xc8, 0xb3, 0x82, 0x2a, 0x80, 0xc0, 0xb7, 0x93, 0x08, 0x85, 0x89, 0x0a, 0x02, 0xf3, 0x01, 0xa1,
+0xb3, 0xb3, 0x43, 0xc3, 0x2e, 0x2a, 0xa8, 0xb3, 0x83, 0x1f, 0x20, 0x38, 0xb8, 0xc8, 0x97, 0x08,
+0x82, 0xa2, 0x96, 0xca, 0xb1, 0xc8, 0x08, 0xf1, 0x91, 0xb9, 0x91, 0xc1, 0x0e, 0x10, 0x22, 0x72,
+0x92, 0x80, 0x34, 0x48, 0x00, 0xc1, 0x91, 0x91, 0xba, 0x5a, 0x81, 0xc0, 0x91, 0xa8, 0x32, 0x06,
+0xca, 0x41, 0x89, 0x69, 0x51, 0xfb, 0xa0, 0x00, 0x01, 0xc9, 0x8c, 0x20, 0x89, 0xc8, 0xca, 0x99,
+0x29, 0x60, 0x02, 0x22, 0x72, 0x32, 0x33, 0x00, 0xa9, 0x9b, 0xa9, 0xcd, 0xeb, 0xa9, 0x00, 0x12,
+0x23, 0x73, 0x22, 0x25, 0x18, 0x0a, 0x00, 0x9a, 0xbe, 0x9c, 0x9a, 0x19, 0x90, 0xe0, 0xc9, 0x90,
+0x89, 0xe8, 0xeb, 0xa9, 0x28, 0x53, 0x24, 0x32, 0x22, 0x13, 0x15, 0x00, 0xb9, 0xcb, 0xac, 0xcb,
+0xba, 0x8b, 0x39, 0x50, 0x51, 0x33, 0x26, 0x12, 0x00, 0x80, 0x80, 0xc0, 0xeb, 0xba, 0xa8, 0x90,
+0x80, 0xb8, 0xdc, 0xa9, 0xa1, 0xc9, 0xfa, 0xba, 0xab, 0x50, 0x46, 0x23, 0x10, 0x18, 0x33, 0x15,
+0x90, 0xbc, 0xba, 0xb9, 0xbc, 0xcb, 0x1a, 0x30, 0x21, 0x43, 0x47, 0x14, 0x02, 0x88, 0x18, 0x81,
+0xb8, 0xdc, 0xaa, 0x8a, 0x9b, 0x9a, 0x01, 0xb1, 0xed, 0xaa, 0x90, 0xd8, 0xca, 0x99, 0x72, 0x35,
+0x82, 0x00, 0x32, 0x25, 0x81, 0xbb, 0x8b, 0xa8, 0xde, 0xab, 0x18, 0x81, 0xb9, 0x48, 0x47, 0x12,
+0x90, 0x21, 0x24, 0x91, 0xac, 0x89, 0x90, 0xdb, 0xbc, 0x09, 0x11, 0xb0, 0xbb, 0x01, 0xa8, 0xbf,
+0x8b, 0x99, 0x4b, 0x67, 0x02, 0x08, 0x51, 0x23, 0x91, 0xaa, 0x08, 0xa1, 0xdf, 0x9a, 0x18, 0xa0,
+0x9a, 0x31, 0x17, 0x01, 0x12, 0x33, 0x14, 0x90, 0x98, 0x81, 0xfa, 0xbb, 0x99, 0x9a, 0x8b, 0x08,
+0xb1, 0x9a, 0x2a, 0xce, 0xbb, 0xaa, 0xdb, 0x8d, 0x65, 0x03, 0x09, 0x64, 0x02, 0x09, 0x21, 0x90,
+0xeb, 0x99, 0x89, 0xac, 0x0b, 0x80, 0x81, 0x23, 0x27, 0x13, 0x32, 0x15, 0x92, 0x18, 0x08, 0xdc,
+0xba, 0x98, 0xab, 0xab, 0x11, 0xb8, 0x2a, 0x12, 0xde, 0xa9, 0xb8, 0xeb, 0x9a, 0x9b, 0x76, 0x02,
+0x19, 0x46, 0x80, 0x19, 0x13, 0xb9, 0x8c, 0x88, 0xcc, 0x8b, 0x81, 0xbb, 0x41, 0x04, 0x30, 0x44,
+0x21, 0x22, 0x21, 0x00, 0x9b, 0x9a, 0xbf, 0x9b, 0xbb, 0x0c, 0x80, 0xa8, 0x22, 0x01, 0xe9, 0x90,
+0xcb, 0xbd, 0xaa, 0xf9, 0xbb, 0x55, 0xa2, 0x59, 0x25, 0x99, 0x62, 0x90, 0x09, 0x81, 0xca, 0x89,
+0x99, 0xba, 0x29, 0x01, 0x1a, 0x47, 0x81, 0x40, 0x14, 0x98, 0x12, 0xa0, 0x0a, 0xc8, 0x9c, 0xa8,
+0x9b, 0x99, 0x0a, 0x21, 0x8a, 0x43, 0xbb, 0x39, 0xfc, 0x9c, 0xb8, 0xfb, 0xaa, 0x79, 0xa2, 0x49,
+0x17, 0x89, 0x43, 0xa0, 0x30, 0xb0, 0x8a, 0xb8, 0xbb, 0xbb, 0x8b, 0xb9, 0x31, 0x35, 0x53, 0x53,
+0x22, 0x32, 0x22, 0x88, 0x83, 0xce, 0x09, 0xac, 0x8c, 0xc8, 0x98, 0x08, 0x0a, 0x28, 0x01, 0x02,
+0x21, 0x0d, 0x8b, 0xcf, 0xa9, 0xca, 0x9c, 0xcb, 0x71, 0xc0, 0x62, 0x81, 0x58, 0x93, 0x28, 0x83,
+0x9a, 0x83, 0x9e, 0x98, 0xaa, 0x9a, 0x08, 0xba, 0x24, 0x90, 0x46, 0x00, 0x51, 0x80, 0x20, 0xa1,
+0x08, 0xb0, 0xac, 0xc1, 0xcb, 0x90, 0xba, 0x39, 0xbb, 0x60, 0x88, 0x58, 0xa0, 0x81, 0xd1, 0x89,
+0xe9, 0xa9, 0xc9, 0xb9, 0x79, 0xd2, 0x41, 0xa3, 0x51, 0x03, 0x38, 0x04, 0x09, 0x10, 0xca, 0x89,
+0xda, 0x0b, 0xb9, 0x0c, 0x90, 0x1b, 0x84, 0x81, 0x54, 0x08, 0x52, 0x00, 0x31, 0x80, 0x39, 0x99,
+0x0d, 0xc8, 0x9c, 0xc9, 0xaa, 0xa8, 0xc9, 0x92, 0x90, 0x06, 0x01, 0x22, 0x11, 0x21, 0x9a, 0x0d,
+0xcd, 0x8c, 0xf4, 0x39, 0xa0, 0x58, 0x01, 0x30, 0x14, 0x38, 0x21, 0xa9, 0x03, 0xdb, 0x98, 0xf9,
+0x1a, 0xb9, 0x0a, 0x99, 0x1b, 0x81, 0x4b, 0x34, 0x49, 0x44, 0x38, 0x32, 0x20, 0x83, 0xb3, 0xa8,
+0xf9, 0xbc, 0xd0, 0x8b, 0x9a, 0xba, 0xa2, 0x10, 0x52, 0x40, 0x51, 0x09, 0x02, 0xba, 0x9a, 0xaf,
+0xca, 0xcb, 0x48, 0xaf, 0x04, 0x1a, 0x13, 0x20, 0x63, 0x90, 0x14, 0x90, 0x21, 0xa9, 0x29, 0xba,
+0x1d, 0xa9, 0x8c, 0xd1, 0x90, 0x92, 0x09, 0x14, 0x3b, 0x24, 0x59, 0x21, 0x39, 0x32, 0x29, 0x18,
+0x1f, 0xb8, 0x9a, 0x1d, 0x0d, 0x1b, 0x9b, 0x08, 0xe0, 0x93, 0xc1, 0x91, 0x82, 0xaa, 0xe0, 0xb8,
+0xa1, 0xba, 0xb3, 0xf8, 0xa3, 0xb3, 0x16, 0x39, 0x89, 0x5a, 0x49, 0x01, 0x28, 0x95, 0x53, 0x94,
+0x22, 0x22, 0x2a, 0x40, 0x9c, 0xb4, 0x98, 0x08, 0x8d, 0x19, 0x8c, 0x29, 0xdb, 0x91, 0xd2, 0xc1,
+0x05, 0x1b, 0x30, 0x98, 0x01, 0xa2, 0x83, 0xb4, 0x08, 0xf4, 0x01, 0x08, 0xba, 0xb3, 0xc0, 0xe3,
+0xa8, 0xa2, 0x38, 0x4b, 0x8b, 0xb4, 0xf3, 0x01, 0x8a, 0xf2, 0x92, 0x89, 0x10, 0xac, 0x04, 0x0a,
+0xb4, 0x21, 0x0a, 0xb6, 0x48, 0x19, 0x49, 0xa2, 0x82, 0x96, 0xa3, 0x02, 0xb2, 0x03, 0x3c, 0x4b,
+0x1e, 0x2a, 0x3a, 0x3b, 0x03, 0x08, 0xd8, 0x43, 0xc0, 0xb3, 0x03, 0x3d, 0xc0, 0xf3, 0x01, 0x2a,
+0x1c, 0x2a, 0x80, 0x3a, 0x3c, 0x8b, 0x4b, 0x3c, 0x3b, 0x4b, 0x1f, 0x2a, 0x3a, 0x3b, 0x3b, 0x0c,
+0xc8, 0x03, 0x08, 0x68, 0xb8, 0xb4, 0xb3, 0x84, 0x80, 0x80, 0x3d, 0x4b, 0x3c, 0x80, 0x80, 0x80,
+0x3e, 0x3b, 0x4c, 0x3b, 0x80, 0x80, 0xe0, 0xc3, 0xb3, 0xb4, 0x83, 0x4b, 0x3c, 0xc0, 0xb3, 0xc3,
+0xb3, 0xb4, 0x03, 0x3d, 0x3b, 0x4b, 0x3c, 0x3b, 0x4b, 0x3c, 0x4b, 0x3b, 0x3c, 0x3b, 0x00, 0x08,
+0x88, 0x80, 0x3f, 0x3c, 0x80, 0x7d, 0x19, 0xa0, 0xa2, 0x02, 0x08, 0x08, 0x3d, 0x4b, 0x08, 0x3c,
+0xb8, 0xc4, 0xb3, 0x03, 0x3c, 0x3c, 0xc0, 0xb3, 0x84, 0xc0, 0xc3, 0x03, 0x3c, 0x3b, 0x3c, 0x8b,
+0xd0, 0xb3, 0xc3, 0x40, 0x3b, 0x3c, 0x4b, 0x3b, 0x3c, 0xc0, 0xb3, 0x03, 0x3d, 0x1f, 0x20, 0x3b,
+0x3b, 0xc0, 0x83, 0x4b, 0x3b, 0xd0, 0xb3, 0x03, 0x3c, 0x3c, 0x4b, 0x7b, 0x19, 0x3a, 0x3b, 0x3b,
+0x3b, 0xd0, 0xb3, 0xb4, 0xc3, 0x03, 0x08, 0x3d, 0x3b, 0x4c, 0x3b, 0x3b, 0x00, 0xe8, 0xb3, 0xc3,
+0xb4, 0xb3, 0xc3, 0xb4, 0x03, 0x3c, 0xc8, 0xb3, 0xb4, 0x3c, 0xb8, 0x84, 0x4b, 0x3b, 0x3c, 0x80,
+0x00, 0x88, 0x3e, 0x00, 0x88, 0x4d, 0x08, 0x08, 0x3d, 0x3c, 0x80, 0x3c, 0x4b, 0x3b, 0xd0, 0xb3,
+0xb3, 0x84, 0xb4, 0x84, 0x4b, 0x3b, 0x3c, 0x4b, 0x3b, 0x08, 0x3c, 0x3c, 0x4b, 0x3b, 0x0c, 0x03,
+0x3d, 0x4b, 0x3b, 0x3c, 0x3f, 0x19, 0xb9, 0x83, 0xf3, 0x93, 0x08, 0x08, 0x3b, 0x08, 0x3c, 0x8b,
+0xc4, 0x97, 0x14, 0x1f, 0xa0, 0x01, 0x4c, 0x99, 0x82, 0x29, 0x4b, 0x99, 0x83, 0xc0, 0x13, 0x1e,
+0xa2, 0x08, 0x08, 0xa1, 0x00, 0xe2, 0x01, 0xa8, 0x95, 0x7a, 0x1c, 0x91, 0x09, 0xb4, 0x11, 0x1d,
+0xd4, 0x40, 0x1b, 0xb1, 0x91, 0xc3, 0xd5, 0x03, 0x0a, 0x18, 0x4b, 0x09, 0x2a, 0xb1, 0xb2, 0x95,
+0x5c, 0xf0, 0x83, 0xb0, 0x83, 0x08, 0x4b, 0x89, 0x81, 0x4b, 0xa8, 0x93, 0x59, 0xc9, 0x84, 0x99,
+0x71, 0x2e, 0xb0, 0x93, 0x69, 0x8b, 0xa3, 0x39, 0xa8, 0x01, 0x98, 0xb5, 0x59, 0x1a, 0x2a, 0xb0,
+0x03, 0xa9, 0xb6, 0xd3, 0x22, 0x1e, 0xd2, 0x22, 0x3f, 0xa9, 0x94, 0x28, 0x2c, 0xa0, 0x48, 0xb9,
+0x96, 0x3a, 0x99, 0x94, 0x09, 0x00, 0xb0, 0x83, 0x5d, 0x89, 0x28, 0xa9, 0xb5, 0x92, 0xd3, 0x40,
+0x2d, 0xd1, 0x83, 0x4c, 0xa8, 0x82, 0x09, 0xc3, 0x58, 0x8b, 0xb3, 0x31, 0x3f, 0xa9, 0xa5, 0x18,
+0x90, 0x80, 0xc2, 0x50, 0x2d, 0x88, 0x80, 0x18, 0x88, 0x00, 0xa8, 0x03, 0x0c, 0xb5, 0x58, 0x8b,
+0xb5, 0x59, 0xa9, 0x83, 0x3a, 0x0a, 0xa0, 0x94, 0x3a, 0x19, 0x99, 0x72, 0x1f, 0xc2, 0x21, 0x0b,
+0xe4, 0x02, 0x3b, 0xa8, 0x82, 0x29, 0xb8, 0x14, 0x1e, 0xc2, 0x02, 0x1a, 0xa1, 0x10, 0x3b, 0xc0,
+0x50, 0x1b, 0x08, 0x09, 0xc3, 0x48, 0x3e, 0xe1, 0x93, 0x29, 0x89, 0xb3, 0x28, 0x88, 0x7c, 0x1b,
+0x00, 0x3b, 0xf5, 0x11, 0x89, 0x81, 0x5b, 0xe0, 0x12, 0x2b, 0xc0, 0x83, 0x89, 0xb3, 0x21, 0x9b,
+0x04, 0x3e, 0x19, 0x99, 0x78, 0x8a, 0xa2, 0x28, 0xd8, 0xb7, 0x11, 0x89, 0x00, 0x90, 0x28, 0xb0,
+0x69, 0x89, 0x49, 0x0a, 0xa0, 0xb4, 0x58, 0x9a, 0x22, 0x0c, 0xb2, 0xd6, 0x40, 0x8a, 0x80, 0xb2,
+0x30, 0x0c, 0xc5, 0x48, 0x99, 0x10, 0x89, 0xc2, 0x83, 0x5c, 0xa9, 0x83, 0x2a, 0x80, 0x5b, 0xa8,
+0x30, 0x9b, 0xb6, 0x81, 0x08, 0xf4, 0x21, 0x1c, 0xb3, 0x7b, 0x99, 0xb3, 0x20, 0xb8, 0x83, 0x98,
+0x21, 0x2f, 0x90, 0x00, 0x5a, 0x1c, 0xf3, 0x02, 0x1a, 0x88, 0xc4, 0x10, 0x98, 0x82, 0x09, 0x28,
+0x0a, 0x49, 0x99, 0x11, 0x3d, 0x98, 0x80, 0xa3, 0xe8, 0xa7, 0x80, 0x01, 0x0a, 0x30, 0x2f, 0xc1,
+0x40, 0x0b, 0x92, 0x0a, 0xa4, 0x88, 0xd2, 0x95, 0x98, 0x40, 0x2b, 0x8a, 0x22, 0x9d, 0xa7, 0x59,
+0x1c, 0xb2, 0x10, 0x08, 0x1a, 0xa1, 0x11, 0x9a, 0x85, 0x8b, 0xa7, 0x29, 0x39, 0xab, 0x97, 0x5a,
+0x8a, 0xa2, 0x28, 0xc1, 0x30, 0xb9, 0x11, 0xa1, 0x6a, 0xaa, 0x96, 0x09, 0xa2, 0x38, 0xc8, 0x78,
+0x0a, 0x08, 0x90, 0x01, 0x5b, 0xb9, 0x96, 0x19, 0xa1, 0x91, 0x91, 0x7a, 0x8a, 0x01, 0xb0, 0x93,
+0xc1, 0x61, 0x0d, 0x92, 0x59, 0x1c, 0xa1, 0x91, 0x82, 0xa9, 0x85, 0x1b, 0xc6, 0x38, 0x09, 0x98,
+0x30, 0xab, 0xa7, 0x38, 0xba, 0x85, 0x88, 0x80, 0x91, 0x81, 0xb8, 0x24, 0x1f, 0x80, 0x18, 0x19,
+0x1a, 0xe3, 0x31, 0xab, 0x95, 0x98, 0xc7, 0x11, 0x89, 0x10, 0x2d, 0xa2, 0x2a, 0xc1, 0x04, 0x2f,
+0xc2, 0x01, 0x89, 0x93, 0x4c, 0x98, 0x00, 0x98, 0xc4, 0x02, 0x89, 0x91, 0x11, 0x8b, 0x96, 0x4c,
+0x2a, 0x89, 0x48, 0x9b, 0x04, 0x1d, 0xc3, 0x91, 0x11, 0x1b, 0xb1, 0xa5, 0x6a, 0x99, 0x20, 0xa9,
+0x93, 0xa8, 0x97, 0x08, 0x4a, 0xa9, 0x41, 0xcb, 0x97, 0x08, 0x28, 0x0b, 0x93, 0x9a, 0xa7, 0x18,
+0x18, 0x1c, 0xc4, 0x81, 0x00, 0x88, 0xc2, 0x40, 0x2d, 0x90, 0x00, 0x09, 0xa1, 0x40, 0xca, 0x95,
+0x18, 0x09, 0x91, 0x59, 0xaa, 0x95, 0x19, 0x08, 0x19, 0x19, 0x08, 0x90, 0x5a, 0xd7, 0x38, 0x8a,
+0x20, 0xb9, 0x32, 0x8a, 0x5d, 0x09, 0x08, 0xe2, 0x01, 0x91, 0x2b, 0xa5, 0x1a, 0x91, 0x92, 0x4b,
+0x09, 0x29, 0x0a, 0xb4, 0x02, 0x1f, 0xc4, 0x11, 0x99, 0x02, 0x4f, 0xa8, 0x20, 0x8a, 0x84, 0x8c,
+0x83, 0x48, 0xeb, 0x04, 0x19, 0x1a, 0x49, 0xc9, 0x02, 0x88, 0xd2, 0x21, 0x3b, 0xb1, 0x4d, 0x80,
+0x89, 0x31, 0x1f, 0xc1, 0x12, 0x3b, 0xf1, 0x31, 0xbb, 0x85, 0x09, 0x10, 0xa9, 0x83, 0x6a, 0x2d,
+0xa1, 0x39, 0xc0, 0x11, 0x89, 0x28, 0x28, 0x0f, 0xa3, 0x3a, 0xf2, 0x21, 0x1a, 0x2b, 0x91, 0x19,
+0xb1, 0x70, 0x1c, 0x39, 0xf9, 0x04, 0x0a, 0x80, 0x91, 0x81, 0x5b, 0xa9, 0x94, 0x08, 0x29, 0xa0,
+0xa0, 0xa7, 0x49, 0x99, 0x91, 0xb3, 0x29, 0x81, 0x1a, 0x39, 0x0c, 0x13, 0x0f, 0x02, 0x1b, 0x80,
+0x19, 0xb5, 0x10, 0x0c, 0xa5, 0x19, 0x19, 0x94, 0x1e, 0xa3, 0xa9, 0xa6, 0x11, 0xb8, 0x10, 0x94,
+0x1b, 0x2a, 0x80, 0xd6, 0x5a, 0x18, 0x0c, 0xa3, 0x18, 0xd1, 0xa3, 0x21, 0x8c, 0x40, 0x0a, 0x2a,
+0x4a, 0x89, 0x10, 0x2f, 0xb1, 0x93, 0x5c, 0x1a, 0x91, 0x08, 0x01, 0x2a, 0x3e, 0x89, 0xa2, 0x8a,
+0x03, 0x83, 0x1f, 0x02, 0x0b, 0x08, 0x58, 0xbb, 0x97, 0x08, 0x2a, 0x3b, 0xc0, 0x33, 0x8f, 0xb4,
+0x91, 0x94, 0x08, 0xb2, 0x30, 0x3f, 0x1b, 0xa2, 0xa8, 0xb6, 0x01, 0xd2, 0x01, 0x08, 0xb2, 0x6a,
+0x19, 0x0a, 0x08, 0xb3, 0x48, 0x1f, 0x20, 0x1d, 0x39, 0x29, 0x1d, 0x10, 0x3c, 0x89, 0x3a, 0xc3,
+0x83, 0x3f, 0x89, 0x5a, 0x1b, 0x00, 0x08, 0xb2, 0x7b, 0x19, 0xc0, 0x01, 0xd2, 0x01, 0x4a, 0x89,
+0xb0, 0x96, 0x28, 0x3c, 0x9a, 0x94, 0x08, 0x38, 0x3f, 0x1b, 0xa2, 0x38, 0x1e, 0x39, 0x89, 0x20,
+0x3a, 0x0c, 0x48, 0x3b, 0x4b, 0xb8, 0xf4, 0x91, 0xa1, 0xb3, 0x86, 0x4b, 0x19, 0x2a, 0x3c, 0x89,
+0x20, 0x0b, 0xb4, 0x48, 0x1e, 0x80, 0xd2, 0xa2, 0x94, 0x2a, 0x2a, 0x08, 0xf3, 0x91, 0x01, 0xa2,
+0xb8, 0xc3, 0x97, 0xb1, 0xb4, 0xa1, 0xa2, 0x83, 0xc0, 0x83, 0xc0,
+};
+
+static const AlarmClip ALARM_CLIPS[ALARM_CLIP_COUNT] = {
+    { "level1breach", alarmClip_level1breach, 7626 },
+    { "level2breach", alarmClip_level2breach, 7855 },
+    { "level3breach", alarmClip_level3breach, 8374 },
+};
+
+#endif // ALARM_CLIPS_H
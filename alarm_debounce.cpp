@@ -0,0 +1,132 @@
+// alarm_debounce.cpp
+// Per-aircraft alarm level state machine. An aircraft skimming a radius boundary
+// would otherwise flip between levels from one scan to the next, re-scheduling the
+// scan timer and replaying the alarm each time. A level is confirmed as soon as the
+// aircraft is inside its entry band (escalation is never delayed), but is only
+// released, to a lower level or to none, once the aircraft has left the wider exit
+// band and has held the level for the dwell time.
+#include "alarm_debounce.h"
+#include <vector>
+
+struct AircraftAlarmState {
+    String icao24;
+    uint8_t confirmedLevel;    // 1-3
+    uint32_t confirmedSinceMs; // When confirmedLevel was entered
+    uint32_t lastSeenMs;       // Last scan that reported this aircraft
+    bool holding;              // A step down is currently being held back
+    uint8_t site;              // Last band match, reported while held outside every band
+    int8_t zone;
+};
+
+static std::vector<AircraftAlarmState> alarmStates;
+static uint32_t suppressedFlaps = 0;
+
+/**
+ * @brief Turns an aircraft's raw level for this scan into its confirmed level.
+ * Called for every aircraft with a position in the query box, so that leaving every
+ * band is debounced like any other step down.
+ * @param icao24 Aircraft address.
+ * @param entryLevel Level from the radii and ceilings narrowed by the entry band (0 = outside).
+ * @param match classifyPosition() result. match.holdLevel is the level from the exit
+ *        band (0 = outside every band), never less critical than entryLevel. When the
+ *        level is held outside every band, match.site and match.zone are set to the
+ *        last band the aircraft was in.
+ * @param nowMs Scan time (millis()); the same for every aircraft of one scan.
+ * @param dwellMs Minimum time a confirmed level is held before it may step down.
+ * @return Confirmed level (0 = none).
+ */
+int debounceProximityLevel(const char* icao24, int entryLevel, SiteMatch& match, uint32_t nowMs, uint32_t dwellMs) {
+    size_t index = 0;
+    while (index < alarmStates.size() && alarmStates[index].icao24 != icao24) {
+        index++;
+    }
+
+    if (index == alarmStates.size()) {
+        if (entryLevel == 0) {
+            return 0; // Outside the entry band, and never confirmed inside: nothing to hold
+        }
+        alarmStates.push_back({icao24, (uint8_t)entryLevel, nowMs, nowMs, false, match.site, match.zone});
+        return entryLevel;
+    }
+    AircraftAlarmState& state = alarmStates[index];
+    state.lastSeenMs = nowMs;
+    int holdLevel = match.holdLevel;
+    if (holdLevel != 0) {
+        state.site = match.site;
+        state.zone = match.zone;
+    }
+
+    if (entryLevel != 0 && entryLevel <= state.confirmedLevel) {
+        if (entryLevel < state.confirmedLevel) {
+            state.confirmedLevel = entryLevel; // Escalation: confirmed at once
+            state.confirmedSinceMs = nowMs;
+        }
+        state.holding = false;
+        return entryLevel;
+    }
+
+    // Stepping down (or out): the aircraft must be outside the exit band for the
+    // confirmed level, and the level must have been held for the dwell time.
+    bool insideBand = holdLevel != 0 && holdLevel <= state.confirmedLevel;
+    if (insideBand || nowMs - state.confirmedSinceMs < dwellMs) {
+        if (!state.holding) {
+            suppressedFlaps++; // Counted once per held-back step, not once per scan
+            state.holding = true;
+        }
+        if (holdLevel == 0) {
+            match.site = state.site;
+            match.zone = state.zone;
+        }
+        return state.confirmedLevel;
+    }
+
+    if (holdLevel == 0) {
+        alarmStates.erase(alarmStates.begin() + index); // Left every band: released
+        return 0;
+    }
+    state.holding = false;
+    state.confirmedLevel = holdLevel;
+    state.confirmedSinceMs = nowMs;
+    return holdLevel;
+}
+
+/**
+ * @brief Forgets aircraft the scan did not report with a position, so one that comes
+ * back later starts from its level at that time rather than a stale confirmed one.
+ * @param nowMs Scan time passed to debounceProximityLevel() for this scan.
+ */
+void pruneAlarmStates(uint32_t nowMs) {
+    size_t kept = 0;
+    for (size_t i = 0; i < alarmStates.size(); i++) {
+        if (alarmStates[i].lastSeenMs != nowMs) {
+            continue;
+        }
+        if (kept != i) {
+            alarmStates[kept] = alarmStates[i];
+        }
+        kept++;
+    }
+    alarmStates.resize(kept);
+}
+
+/**
+ * @brief Forgets every aircraft. Levels confirmed against old radii, bands or sites
+ * (whose indices may have moved) are not carried over a settings change.
+ */
+void resetAlarmStates() {
+    alarmStates.clear();
+}
+
+/**
+ * @brief Level changes held back by the hysteresis band or dwell time since boot.
+ */
+uint32_t getSuppressedFlapCount() {
+    return suppressedFlaps;
+}
+
+/**
+ * @brief Aircraft currently tracked by the state machine.
+ */
+size_t getTrackedAircraftCount() {
+    return alarmStates.size();
+}
@@ -0,0 +1,15 @@
+// alarm_debounce.h
+#ifndef ALARM_DEBOUNCE_H
+#define ALARM_DEBOUNCE_H
+
+#include <Arduino.h>
+#include "scan_geometry.h" // For SiteMatch
+
+// Function declarations
+int debounceProximityLevel(const char* icao24, int entryLevel, SiteMatch& match, uint32_t nowMs, uint32_t dwellMs);
+void pruneAlarmStates(uint32_t nowMs);
+void resetAlarmStates();
+uint32_t getSuppressedFlapCount();
+size_t getTrackedAircraftCount();
+
+#endif // ALARM_DEBOUNCE_H
@@ -1,51 +1,30 @@
 // alarm_manager.cpp
 #include "alarm_manager.h"
-#include "level1breach.h" // Include your audio data headers
-#include "level2breach.h"
-#include "level3breach.h"
+#include "audio_mixer.h"   // Alarm voices: tone patterns and clips
+#include "led_patterns.h"  // Blink patterns
+#include "scan_geometry.h" // For the sound settings in effect
 
-/*
- * @brief Plays an audio sample via PWM.
- * This function is called repeatedly by the audioTicker.
+/**
+ * @brief Previews an alarm level's configured sound (tone pattern or clip), ignoring
+ * soundWarning and the repeat cooldown.
+ * @param level The alarm level (1, 2, 3).
  */
-void playAudioSample() {
-  
-    if (currentAudioData && audioSampleIndex < currentAudioDataSize) {
-        uint8_t sample = currentAudioData[audioSampleIndex];
-        int pwmValue = map(sample, 0, 255, 0, 1023); // Map 8-bit to 10-bit PWM
-        analogWrite(SPEAKER_PIN, pwmValue);
-        audioSampleIndex++;
-    } else {
-        // Audio finished, stop PWM
-        analogWrite(SPEAKER_PIN, 0); // Set PWM to 0 (off)
-        audioTicker.detach(); // Stop the ticker
-        currentAudioData = nullptr; // Clear current audio data
-        Serial.println(F("Audio playback finished."));
-    }
+void playLevelSound(int level) {
+    mixerPlayLevel(level, true);
 }
 
 /**
- * @brief Starts playing a specific audio sequence.
- * @param audioData Pointer to the audio data array.
- * @param dataSize Size of the audio data array.
+ * @brief Starts the sound for an alarm level, if sound warnings are enabled. The mixer
+ * lets it play alongside a less urgent one and skips it while the level is cooling down.
+ * @param level The alarm level (1, 2, 3).
  */
-void startAudioPlayback(const uint8_t* audioData, size_t dataSize) {
+void startAudioPlayback(int level) {
   
-    if (!currentSettings.soundWarning) {
+    if (!activeScanGeometry().soundWarning) {
         Serial.println(F("Sound warning disabled in settings."));
         return;
     }
-    if (audioTicker.active()) {
-        audioTicker.detach(); // Stop any currently playing audio
-    }
-    currentAudioData = audioData;
-    currentAudioDataSize = dataSize;
-    audioSampleIndex = 0;
-    Serial.print(F("Starting audio playback of size: "));
-    Serial.println(dataSize);
-    audioTicker.attach_ms(1, playAudioSample); // Will result in approx 1kHz playback
-    Serial.print(F("Starting audio playback of size: "));
-    Serial.println(dataSize);
+    mixerPlayLevel(level, false);
 }
 
 /**
@@ -54,54 +33,56 @@ void startAudioPlayback(const uint8_t* audioData, size_t dataSize) {
  */
 void playAlarmSound(int level) {
   
-    if (!currentSettings.soundWarning) {
+    if (!activeScanGeometry().soundWarning) {
         // Ensure sound is off if warning is disabled
-        analogWrite(SPEAKER_PIN, 0);
-        audioTicker.detach();
+        mixerStopAll();
         return;
     }
 
     switch (level) {
         case 1: // Level 1: Alarm (most urgent)
             Serial.println(F("Playing Level 1 Alarm Sound!"));
-            startAudioPlayback(audioData_level1breach, sizeof(audioData_level1breach));
+            startAudioPlayback(1);
             break;
         case 2: // Level 2: Warning
             Serial.println(F("Playing Level 2 Warning Sound!"));
-            startAudioPlayback(audioData_level2breach, sizeof(audioData_level2breach));
+            startAudioPlayback(2);
             break;
         case 3: // Level 3: Detection
             Serial.println(F("Playing Level 3 Detection Sound!"));
-            startAudioPlayback(audioData_level3breach, sizeof(audioData_level3breach));
+            startAudioPlayback(3);
             break;
         default: // No alarm or all clear
             Serial.println(F("Stopping Alarm Sound."));
-            analogWrite(SPEAKER_PIN, 0); // Set PWM to 0 (off)
-            audioTicker.detach(); // Stop the ticker if active
+            mixerStopAll();
             break;
     }
 }
 
 /**
- * @brief Updates the built-in LED based on the alarm level.
+ * @brief Announces an aircraft (callsign and distance) after the alarm sound that
+ * playAlarmSound() has just started for its level. Needs the announcement words to
+ * have been uploaded; does nothing if they have not, or if the sound was not started.
+ * @param level The alarm level (1, 2, 3).
+ * @param flight The aircraft to announce.
+ */
+void announceFlight(int level, const FlightData& flight) {
+    if (!activeScanGeometry().soundWarning) {
+        return;
+    }
+    const String& name = flight.callsign.length() > 0 ? flight.callsign : flight.icao24;
+    if (mixerAnnounce(level, name, flight.distance_km)) {
+        Serial.printf("Announcing %s at %.1f km.\n", name.c_str(), flight.distance_km);
+    }
+}
+
+/**
+ * @brief Updates the built-in LED based on the alarm level: fast, medium or slow blink
+ * for levels 1-3, off when clear. An error (see LED_LAYER_ERROR) still overrides it.
  * @param level The alarm level.
  */
 void updateLED(int level) {
-  
-    digitalWrite(LED_BUILTIN_PIN, LOW); // Turn off by default (LED is active LOW)
-    switch (level) {
-        case 1: // Level 1: Solid on (or rapid blink if implemented in loop)
-            digitalWrite(LED_BUILTIN_PIN, HIGH); // Turn on (active LOW)
-            // For rapid blinking, you'd need a separate Ticker or millis() logic in loop()
-            break;
-        case 2: // Level 2: Solid on
-            digitalWrite(LED_BUILTIN_PIN, HIGH); // Turn on (active LOW)
-            break;
-        case 3: // Level 3: Solid on
-            digitalWrite(LED_BUILTIN_PIN, HIGH); // Turn on (active LOW)
-            break;
-        default: // All Clear
-            digitalWrite(LED_BUILTIN_PIN, LOW); // Turn off (active LOW)
-            break;
-    }
+    ledSetLayer(LED_CHANNEL_BUILTIN, LED_LAYER_LEVEL1, level == 1);
+    ledSetLayer(LED_CHANNEL_BUILTIN, LED_LAYER_LEVEL2, level == 2);
+    ledSetLayer(LED_CHANNEL_BUILTIN, LED_LAYER_LEVEL3, level == 3);
 }
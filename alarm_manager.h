@@ -6,9 +6,10 @@
 #include "globals.h" // For SPEAKER_PIN, LED_BUILTIN_PIN, audioTicker, currentSettings
 
 // Function declarations
-void playAudioSample();
-void startAudioPlayback(const uint8_t* audioData, size_t dataSize);
+void playLevelSound(int level);
+void startAudioPlayback(int level);
 void playAlarmSound(int level);
+void announceFlight(int level, const FlightData& flight);
 void updateLED(int level);
 
 #endif
@@ -0,0 +1,180 @@
+// announcer.cpp
+// Spoken flight announcements ("alarm ... bravo alpha whiskey one two ... four point
+// two kilometres") built by concatenating word clips. The word queue is prepared in
+// loop() when the alarm fires; the mixer then renders it from the audio engine's refill
+// callback, opening each word's file as the previous one ends within the same buffer
+// fill, so words follow each other without gaps.
+#include "announcer.h"
+#include "clip_player.h"
+#include <FS.h> // For SPIFFS
+
+static const uint8_t UNIT_DIGIT_0 = 0;
+static const uint8_t UNIT_ALPHA = 10;
+static const uint8_t UNIT_POINT = 36;
+static const uint8_t UNIT_KILOMETRES = 37;
+static const uint8_t UNIT_LEVEL_1 = 38; // "alarm"; levels 2 and 3 follow
+static const uint8_t ANNOUNCE_PAUSE = 0xFF;
+
+static const size_t MAX_CALLSIGN_CHARS = 8;
+
+static uint8_t queue[MAX_ANNOUNCE_UNITS];
+static size_t queueLength = 0;
+static size_t queuePosition = 0;
+
+// Playback
+static ClipVoice unitVoice;
+static bool unitPlaying = false;
+static uint32_t pauseLeft = 0;
+
+/**
+ * @brief Index of a word in ANNOUNCE_UNIT_NAMES.
+ * @return -1 if the name is not a known word.
+ */
+int announceUnitIndex(const String& name) {
+    for (int i = 0; i < ANNOUNCE_UNIT_COUNT; i++) {
+        if (name.equalsIgnoreCase(ANNOUNCE_UNIT_NAMES[i])) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Clip file of a word.
+ */
+String announceUnitPath(int unit) {
+    return "/clips/u/" + String(ANNOUNCE_UNIT_NAMES[unit]) + ".adp";
+}
+
+/**
+ * @brief true if a word's clip has been uploaded.
+ */
+bool announceUnitInstalled(int unit) {
+    return SPIFFS.exists(announceUnitPath(unit));
+}
+
+/**
+ * @brief Appends a word to the queue if its clip is installed.
+ */
+static void queueUnit(uint8_t unit) {
+    if (queueLength < MAX_ANNOUNCE_UNITS && announceUnitInstalled(unit)) {
+        queue[queueLength++] = unit;
+    }
+}
+
+/**
+ * @brief Appends a pause, unless the queue is empty or already ends with one.
+ */
+static void queuePause() {
+    if (queueLength > 0 && queueLength < MAX_ANNOUNCE_UNITS && queue[queueLength - 1] != ANNOUNCE_PAUSE) {
+        queue[queueLength++] = ANNOUNCE_PAUSE;
+    }
+}
+
+/**
+ * @brief Builds the word queue for an aircraft: level name, callsign spelled out in the
+ * NATO alphabet and digits, then the distance to one decimal in kilometres.
+ * Must not be called while an announcement is playing.
+ * @param level Alarm level 1-3.
+ * @param callsign Callsign (or ICAO24 address); characters other than A-Z and 0-9 are skipped.
+ * @param distanceKm Distance from the site.
+ * @return false if none of the words are installed, so there is nothing to say.
+ */
+bool prepareAnnouncement(int level, const String& callsign, float distanceKm) {
+    stopAnnouncement();
+    queueLength = 0;
+    queuePosition = 0;
+
+    if (level >= 1 && level <= 3) {
+        queueUnit(UNIT_LEVEL_1 + level - 1);
+    }
+    queuePause();
+    size_t spelled = 0;
+    for (size_t i = 0; i < callsign.length() && spelled < MAX_CALLSIGN_CHARS; i++) {
+        char c = tolower(callsign[i]);
+        if (c >= 'a' && c <= 'z') {
+            queueUnit(UNIT_ALPHA + (c - 'a'));
+        } else if (c >= '0' && c <= '9') {
+            queueUnit(UNIT_DIGIT_0 + (c - '0'));
+        } else {
+            continue;
+        }
+        spelled++;
+    }
+    queuePause();
+    long tenths = lroundf(constrain(distanceKm, 0.0f, 999.9f) * 10);
+    String whole(tenths / 10);
+    for (size_t i = 0; i < whole.length(); i++) {
+        queueUnit(UNIT_DIGIT_0 + (whole[i] - '0'));
+    }
+    queueUnit(UNIT_POINT);
+    queueUnit(UNIT_DIGIT_0 + tenths % 10);
+    queueUnit(UNIT_KILOMETRES);
+
+    while (queueLength > 0 && queue[queueLength - 1] == ANNOUNCE_PAUSE) {
+        queueLength--;
+    }
+    return queueLength > 0;
+}
+
+/**
+ * @brief Moves to the next queue entry: opens a word's clip or starts a pause.
+ * Words whose clip cannot be opened are skipped.
+ * @return false once the queue is exhausted.
+ */
+static bool startNextUnit() {
+    while (queuePosition < queueLength) {
+        uint8_t unit = queue[queuePosition++];
+        if (unit == ANNOUNCE_PAUSE) {
+            pauseLeft = ANNOUNCE_PAUSE_SAMPLES;
+            return true;
+        }
+        if (startClipFile(unitVoice, announceUnitPath(unit))) {
+            unitPlaying = true;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Renders the next run of the announcement, continuing straight into the next
+ * word when one ends.
+ * @param maxSamples Even, so word file reads stay byte-aligned.
+ * @return Samples written; less than maxSamples only when the announcement is over.
+ */
+size_t renderAnnouncement(uint8_t* dest, size_t maxSamples) {
+    size_t count = 0;
+    while (count < maxSamples) {
+        size_t room = maxSamples - count;
+        if (pauseLeft > 0) {
+            size_t samples = min((uint32_t)room, pauseLeft);
+            memset(dest + count, 128, samples);
+            count += samples;
+            pauseLeft -= samples;
+        } else if (unitPlaying) {
+            size_t samples = renderClip(unitVoice, dest + count, room);
+            count += samples;
+            if (samples < room) {
+                closeClip(unitVoice);
+                unitPlaying = false;
+                if (count & 1) {
+                    dest[count++] = 128; // One silent sample keeps the next word byte-aligned
+                }
+            }
+        } else if (!startNextUnit()) {
+            break;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Abandons the announcement and releases the word file.
+ */
+void stopAnnouncement() {
+    closeClip(unitVoice);
+    unitPlaying = false;
+    pauseLeft = 0;
+    queuePosition = queueLength;
+}
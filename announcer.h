@@ -0,0 +1,30 @@
+// announcer.h
+#ifndef ANNOUNCER_H
+#define ANNOUNCER_H
+
+#include <Arduino.h>
+#include "globals.h" // For AUDIO_SAMPLE_RATE
+
+// Words an announcement is built from. Each is a clip file (see clip_player.h) uploaded
+// as /clips/u/<name>.adp; words that are missing are left out of the announcement.
+static const char* const ANNOUNCE_UNIT_NAMES[] = {
+    "0", "1", "2", "3", "4", "5", "6", "7", "8", "9",
+    "alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf", "hotel", "india",
+    "juliett", "kilo", "lima", "mike", "november", "oscar", "papa", "quebec", "romeo",
+    "sierra", "tango", "uniform", "victor", "whiskey", "xray", "yankee", "zulu",
+    "point", "kilometres", "alarm", "warning", "detection"
+};
+const int ANNOUNCE_UNIT_COUNT = sizeof(ANNOUNCE_UNIT_NAMES) / sizeof(ANNOUNCE_UNIT_NAMES[0]);
+
+const size_t MAX_ANNOUNCE_UNITS = 24;                          // Queue length, pauses included
+const uint32_t ANNOUNCE_PAUSE_SAMPLES = AUDIO_SAMPLE_RATE / 4; // Between level, callsign and distance
+
+// Function declarations
+int announceUnitIndex(const String& name);
+String announceUnitPath(int unit);
+bool announceUnitInstalled(int unit);
+bool prepareAnnouncement(int level, const String& callsign, float distanceKm);
+size_t renderAnnouncement(uint8_t* dest, size_t maxSamples);
+void stopAnnouncement();
+
+#endif // ANNOUNCER_H
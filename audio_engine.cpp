@@ -0,0 +1,219 @@
+// audio_engine.cpp
+// Sample-accurate playback: a timer1 interrupt fires at exactly AUDIO_SAMPLE_RATE and
+// loads the next sample into the hardware sigma-delta modulator driving SPEAKER_PIN.
+// The interrupt only reads a RAM double buffer (flash may be unreadable while it is
+// being written, e.g. during a settings save); audioTicker refills the free half from
+// the current source every AUDIO_REFILL_INTERVAL_MS. Ticker callbacks keep running
+// while loop() is blocked in a scan, since the HTTP client yields while it waits.
+//
+// The output rests at mid-scale (128) between clips. Every jump away from or back to
+// it (start, end, stop) is ramped by the interrupt at AUDIO_RAMP_STEP per sample, so
+// the speaker cone moves smoothly instead of clicking.
+//
+// timer1 is then owned by the engine: analogWrite()/tone() must not be used.
+#include "audio_engine.h"
+#include <sigma_delta.h>
+
+static const uint8_t SIGMA_DELTA_CHANNEL = 0;
+static const uint32_t SIGMA_DELTA_CARRIER_HZ = 312500; // Far above audio; the speaker filters it out
+static const uint32_t TIMER1_TICKS_PER_SAMPLE = (80000000 / 16) / AUDIO_SAMPLE_RATE; // TIM_DIV16 at 80 MHz
+
+static uint8_t buffers[2][AUDIO_BUFFER_SAMPLES];
+static volatile uint16_t bufferLength[2]; // Samples in each half; 0 = free for the refill
+static volatile uint8_t playingBuffer = 0;
+static volatile uint16_t playIndex = 0;
+static volatile bool sourceFinished = true;
+static volatile bool playing = false;
+static volatile uint32_t underruns = 0;
+static volatile uint32_t isrCyclesMax = 0;
+static volatile uint8_t outputLevel = 0;  // Last sample written
+static volatile bool rampingIn = true;    // Output is still moving towards the buffered samples
+static AudioSourceFn currentSource = nullptr;
+
+/**
+ * @brief Sets the sigma-delta duty (0-255) without the core's non-IRAM helper.
+ */
+static inline void IRAM_ATTR writeSample(uint8_t sample) {
+    outputLevel = sample;
+    GPSD = (GPSD & ~(0xFF << GPSDT)) | ((uint32_t)sample << GPSDT);
+}
+
+/**
+ * @brief Moves the output one ramp step towards a level.
+ * @return true once the output is at the level.
+ */
+static inline bool IRAM_ATTR rampTowards(uint8_t target) {
+    uint8_t level = outputLevel;
+    if (level + AUDIO_RAMP_STEP < target) {
+        writeSample(level + AUDIO_RAMP_STEP);
+        return false;
+    }
+    if (level > target + AUDIO_RAMP_STEP) {
+        writeSample(level - AUDIO_RAMP_STEP);
+        return false;
+    }
+    writeSample(target);
+    return true;
+}
+
+/**
+ * @brief Outputs one sample and hands finished halves back to the refill.
+ */
+static inline void IRAM_ATTR outputNextSample() {
+    uint8_t half = playingBuffer;
+    uint16_t length = bufferLength[half];
+    if (playIndex < length) {
+        if (rampingIn) {
+            rampingIn = !rampTowards(buffers[half][playIndex]);
+            if (rampingIn) {
+                return; // The sample is output once the ramp reaches it
+            }
+        } else {
+            writeSample(buffers[half][playIndex]);
+        }
+        if (++playIndex == length) {
+            bufferLength[half] = 0;
+            playingBuffer = half ^ 1;
+            playIndex = 0;
+        }
+        return;
+    }
+    if (sourceFinished) {
+        rampingIn = true; // In case samples come back (audioEngineResume)
+        if (rampTowards(128)) {
+            timer1_disable();
+            playing = false;
+        }
+    } else {
+        underruns++; // Refill is late: hold the last sample rather than click
+    }
+}
+
+/**
+ * @brief timer1 interrupt: outputs the next sample, tracking the worst-case cost
+ * (the core's interrupt entry and exit come on top) against AUDIO_CYCLES_PER_SAMPLE.
+ */
+static void IRAM_ATTR onAudioTimer() {
+    uint32_t start = ESP.getCycleCount();
+    outputNextSample();
+    uint32_t cycles = ESP.getCycleCount() - start;
+    if (cycles > isrCyclesMax) {
+        isrCyclesMax = cycles;
+    }
+}
+
+/**
+ * @brief Tops up every free half of the double buffer, the playing one first.
+ * Runs from audioTicker (system context), never concurrently with another refill.
+ */
+static void refillBuffers() {
+    for (int i = 0; i < 2 && !sourceFinished; i++) {
+        uint8_t half = playingBuffer ^ i;
+        if (bufferLength[half] != 0) {
+            continue;
+        }
+        size_t count = currentSource(buffers[half], AUDIO_BUFFER_SAMPLES);
+        if (count == 0) {
+            sourceFinished = true;
+        } else {
+            bufferLength[half] = count; // Published after the samples are written
+        }
+    }
+    if (!playing) {
+        audioTicker.detach();
+        Serial.println(F("Audio playback finished."));
+    }
+}
+
+/**
+ * @brief Routes the sigma-delta modulator to the speaker pin and sets up timer1, then
+ * ramps the output up to mid-scale in the background. Call once from setup().
+ */
+void audioEngineBegin() {
+    sigmaDeltaSetup(SIGMA_DELTA_CHANNEL, SIGMA_DELTA_CARRIER_HZ);
+    sigmaDeltaAttachPin(SPEAKER_PIN, SIGMA_DELTA_CHANNEL);
+    writeSample(0);
+    timer1_attachInterrupt(onAudioTimer);
+    playing = true; // With no samples the interrupt only ramps to 128, then stops itself
+    timer1_enable(TIM_DIV16, TIM_EDGE, TIM_LOOP);
+    timer1_write(TIMER1_TICKS_PER_SAMPLE);
+}
+
+/**
+ * @brief Starts playing from a sample source, replacing anything already playing.
+ * @param source Sample producer; called from the refill Ticker until it returns 0.
+ */
+void audioEnginePlay(AudioSourceFn source) {
+    timer1_disable();
+    audioTicker.detach();
+    currentSource = source;
+    bufferLength[0] = bufferLength[1] = 0;
+    playingBuffer = 0;
+    playIndex = 0;
+    rampingIn = true; // From wherever the output is (mid-scale, or a clip cut off)
+    sourceFinished = false;
+    playing = true;
+    refillBuffers(); // Prime both halves before the first interrupt
+    if (bufferLength[0] == 0) {
+        sourceFinished = true; // Empty source: only ramp back to mid-scale
+    }
+    timer1_enable(TIM_DIV16, TIM_EDGE, TIM_LOOP);
+    timer1_write(TIMER1_TICKS_PER_SAMPLE);
+    if (!sourceFinished) {
+        audioTicker.attach_ms(AUDIO_REFILL_INTERVAL_MS, refillBuffers);
+    }
+}
+
+/**
+ * @brief Keeps a source playing after it has returned 0, for a source that has new
+ * samples again (e.g. the mixer got a new voice). Playback continues without a gap
+ * if the buffered tail is still draining, and starts afresh otherwise.
+ * @param source Sample producer; ignored unless the engine has to start afresh.
+ */
+void audioEngineResume(AudioSourceFn source) {
+    noInterrupts(); // The interrupt may be about to stop the timer
+    bool draining = playing && currentSource == source;
+    if (draining) {
+        sourceFinished = false;
+    }
+    interrupts();
+    if (draining) {
+        refillBuffers(); // Refills never overlap: this runs in loop() or system context, as the Ticker does
+    } else {
+        audioEnginePlay(source);
+    }
+}
+
+/**
+ * @brief Stops playback at once: the source is not called again and the output ramps
+ * back to mid-scale (audioEngineBusy() stays true for those few milliseconds).
+ */
+void audioEngineStop() {
+    audioTicker.detach();
+    noInterrupts();
+    currentSource = nullptr; // A later audioEngineResume() starts afresh
+    sourceFinished = true;
+    bufferLength[0] = bufferLength[1] = 0;
+    interrupts();
+}
+
+/**
+ * @brief true while a source is playing.
+ */
+bool audioEngineBusy() {
+    return playing;
+}
+
+/**
+ * @brief Samples output as silence because the refill fell behind, since boot.
+ */
+uint32_t audioEngineUnderruns() {
+    return underruns;
+}
+
+/**
+ * @brief Most CPU cycles one sample interrupt has taken since boot.
+ */
+uint32_t audioEngineIsrCyclesMax() {
+    return isrCyclesMax;
+}
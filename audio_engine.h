@@ -0,0 +1,27 @@
+// audio_engine.h
+#ifndef AUDIO_ENGINE_H
+#define AUDIO_ENGINE_H
+
+#include <Arduino.h>
+#include "globals.h" // For SPEAKER_PIN, AUDIO_SAMPLE_RATE, audioTicker
+
+// Fills 'dest' with up to 'maxSamples' unsigned 8-bit samples (128 = silence).
+// Called from the refill Ticker, never from the interrupt, so it may read flash.
+// Returns the number written; 0 ends playback.
+typedef size_t (*AudioSourceFn)(uint8_t* dest, size_t maxSamples);
+
+const size_t AUDIO_BUFFER_SAMPLES = 512;   // Per half of the double buffer: 64 ms at 8 kHz
+const uint32_t AUDIO_REFILL_INTERVAL_MS = 20; // Well under one half, so a late Ticker does not underrun
+const uint8_t AUDIO_RAMP_STEP = 2;         // Per sample when moving to or from mid-scale: 128 in 8 ms
+const uint32_t AUDIO_CYCLES_PER_SAMPLE = 80000000 / AUDIO_SAMPLE_RATE; // CPU budget per interrupt at 80 MHz
+
+// Function declarations
+void audioEngineBegin();
+void audioEnginePlay(AudioSourceFn source);
+void audioEngineResume(AudioSourceFn source);
+void audioEngineStop();
+bool audioEngineBusy();
+uint32_t audioEngineUnderruns();
+uint32_t audioEngineIsrCyclesMax();
+
+#endif // AUDIO_ENGINE_H
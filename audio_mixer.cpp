@@ -0,0 +1,297 @@
+// audio_mixer.cpp
+// Mixes the alarm sounds into the audio engine's single source. Each alarm level has
+// its own voice (a tone pattern or a clip), so a new alarm no longer cuts off the one
+// playing. Voices are summed as signed integers with a Q8 gain each and saturated to
+// 8 bits, in MIXER_CHUNK_SAMPLES passes from the engine's refill callback; the sample
+// interrupt still only copies a byte, so mixing costs it nothing.
+//
+// Priority follows the alarm level, 1 being the most urgent:
+// - a voice is ducked to MIXER_DUCKED_GAIN while a more urgent voice sounds, and its
+//   gain ramps back to unity over one chunk once that voice ends;
+// - two clips never talk over each other: a more urgent clip preempts (stops) a less
+//   urgent one, and a less urgent clip is not started under a more urgent one.
+// A level whose voice is still sounding, or that started within ALARM_REPEAT_COOLDOWN_MS,
+// is not restarted, so an alarm level that comes and goes between scans sounds once.
+// A voice can carry on into a spoken announcement once its alarm sound ends; the
+// announcement counts as a clip for the rules above.
+#include "audio_mixer.h"
+#include "audio_engine.h"
+#include "announcer.h"
+#include "clip_player.h"
+#include "tone_synth.h"
+#include "scan_geometry.h" // For the alarm sounds in effect
+
+enum MixerVoiceKind : uint8_t {
+    VOICE_IDLE,
+    VOICE_TONE,
+    VOICE_CLIP,
+    VOICE_ANNOUNCE
+};
+
+struct MixerVoice {
+    MixerVoiceKind kind;
+    uint16_t gain; // Q8, as reached at the end of the last chunk
+    bool announceNext; // The prepared announcement follows this voice's sound
+    ToneVoice tone;
+    ClipVoice clip;
+};
+
+static MixerVoice voices[MIXER_VOICES]; // Index = alarm level - 1
+static uint32_t lastStartMs[MIXER_VOICES];
+static bool startedOnce[MIXER_VOICES];
+
+static uint8_t voiceChunk[MIXER_CHUNK_SAMPLES];
+static int16_t mixChunk[MIXER_CHUNK_SAMPLES];
+
+static uint32_t cooldownSuppressed = 0;
+static uint32_t preempted = 0;
+static uint32_t cyclesPerSampleMax = 0;
+
+/**
+ * @brief Gain a voice should have now: ducked if a more urgent voice is sounding.
+ * @param index Voice index (alarm level - 1).
+ */
+static uint16_t targetGain(int index) {
+    for (int i = 0; i < index; i++) {
+        if (voices[i].kind != VOICE_IDLE) {
+            return MIXER_DUCKED_GAIN;
+        }
+    }
+    return MIXER_UNITY_GAIN;
+}
+
+/**
+ * @brief true for voices that speak (clips and announcements), which must not overlap.
+ */
+static bool isSpeech(const MixerVoice& voice) {
+    return voice.kind == VOICE_CLIP || voice.kind == VOICE_ANNOUNCE;
+}
+
+/**
+ * @brief Ends a voice, releasing its clip file if it has one.
+ */
+static void releaseVoice(MixerVoice& voice) {
+    if (voice.kind == VOICE_CLIP) {
+        closeClip(voice.clip);
+    } else if (voice.kind == VOICE_ANNOUNCE) {
+        stopAnnouncement();
+    }
+    voice.kind = VOICE_IDLE;
+    voice.announceNext = false;
+}
+
+/**
+ * @brief A voice's sound has ended: hands it over to its announcement, or releases it.
+ * The announcement follows the speech rule: it preempts less urgent clips and is
+ * dropped under a more urgent one.
+ * @param index Voice index (alarm level - 1).
+ */
+static void finishVoice(int index) {
+    MixerVoice& voice = voices[index];
+    if (!voice.announceNext || voice.kind == VOICE_ANNOUNCE) {
+        releaseVoice(voice);
+        return;
+    }
+    for (int i = 0; i < MIXER_VOICES; i++) {
+        if (i == index || !isSpeech(voices[i])) {
+            continue;
+        }
+        preempted++;
+        if (i < index) {
+            releaseVoice(voice);
+            return;
+        }
+        releaseVoice(voices[i]);
+    }
+    if (voice.kind == VOICE_CLIP) {
+        closeClip(voice.clip);
+    }
+    voice.kind = VOICE_ANNOUNCE;
+    voice.announceNext = false;
+}
+
+/**
+ * @brief Adds the next run of one voice into mixChunk, ramping its gain to 'target'.
+ * @return Samples the voice produced; 0 once it has ended.
+ */
+static size_t mixVoice(MixerVoice& voice, uint16_t target, size_t samples) {
+    size_t count;
+    switch (voice.kind) {
+        case VOICE_TONE:
+            count = renderTone(voice.tone, voiceChunk, samples);
+            break;
+        case VOICE_CLIP:
+            count = renderClip(voice.clip, voiceChunk, samples);
+            break;
+        default:
+            count = renderAnnouncement(voiceChunk, samples);
+            break;
+    }
+    if (count == 0) {
+        return 0;
+    }
+    // Gain in Q16 so the per-sample ramp step keeps its fraction
+    int32_t gain = (int32_t)voice.gain << 8;
+    int32_t step = (((int32_t)target - voice.gain) << 8) / (int32_t)count;
+    for (size_t i = 0; i < count; i++) {
+        gain += step;
+        mixChunk[i] += ((int16_t)voiceChunk[i] - 128) * (gain >> 8) >> 8;
+    }
+    voice.gain = target;
+    return count;
+}
+
+/**
+ * @brief AudioSourceFn: mixes all sounding voices; returns 0 once none is left.
+ */
+static size_t mixVoices(uint8_t* dest, size_t maxSamples) {
+    uint32_t start = ESP.getCycleCount();
+    size_t produced = 0;
+    while (produced < maxSamples) {
+        size_t samples = min(maxSamples - produced, MIXER_CHUNK_SAMPLES);
+        memset(mixChunk, 0, sizeof(mixChunk));
+        size_t length = 0;
+        for (int i = 0; i < MIXER_VOICES; i++) {
+            MixerVoice& voice = voices[i];
+            if (voice.kind == VOICE_IDLE) {
+                continue;
+            }
+            size_t count = mixVoice(voice, targetGain(i), samples);
+            if (count < samples) {
+                finishVoice(i); // Ended within this chunk
+            }
+            length = max(length, count);
+        }
+        if (length == 0) {
+            break;
+        }
+        for (size_t i = 0; i < length; i++) {
+            dest[produced + i] = constrain((int)mixChunk[i], -128, 127) + 128;
+        }
+        produced += length;
+    }
+    if (produced > 0) {
+        uint32_t perSample = (ESP.getCycleCount() - start) / produced;
+        cyclesPerSampleMax = max(cyclesPerSampleMax, perSample);
+    }
+    return produced;
+}
+
+/**
+ * @brief Starts the configured sound (tone pattern or clip) of an alarm level,
+ * subject to the priority and cooldown rules above.
+ * @param level Alarm level 1-3.
+ * @param preview true for a sound preview: everything else is stopped and the
+ *                cooldown is ignored.
+ * @return true if the sound was started.
+ */
+bool mixerPlayLevel(int level, bool preview) {
+    if (level < 1 || level > 3) {
+        return false;
+    }
+    int index = level - 1;
+    MixerVoice& voice = voices[index];
+    const AlarmSound& sound = activeScanGeometry().alarmSounds[level];
+    uint32_t now = millis();
+
+    if (preview) {
+        mixerStopAll();
+    } else {
+        if (voice.kind != VOICE_IDLE || (startedOnce[index] && now - lastStartMs[index] < ALARM_REPEAT_COOLDOWN_MS)) {
+            cooldownSuppressed++;
+            Serial.printf("Level %d sound played recently; not restarted.\n", level);
+            return false;
+        }
+        if (sound.source == ALARM_SOUND_CLIP) {
+            for (int i = 0; i < MIXER_VOICES; i++) {
+                if (!isSpeech(voices[i])) {
+                    continue;
+                }
+                if (i < index) {
+                    preempted++;
+                    Serial.printf("Level %d clip held back: level %d clip is playing.\n", level, i + 1);
+                    return false;
+                }
+                preempted++;
+                Serial.printf("Level %d clip preempts level %d clip.\n", level, i + 1);
+                releaseVoice(voices[i]);
+            }
+        }
+    }
+
+    if (sound.source == ALARM_SOUND_CLIP) {
+        if (!startLevelClip(voice.clip, level)) {
+            return false;
+        }
+        voice.kind = VOICE_CLIP;
+    } else {
+        startTone(voice.tone, sound);
+        voice.kind = VOICE_TONE;
+    }
+    voice.gain = targetGain(index);
+    lastStartMs[index] = now;
+    startedOnce[index] = true;
+    audioEngineResume(mixVoices);
+    return true;
+}
+
+/**
+ * @brief Queues a spoken announcement of an aircraft to follow the alarm sound that
+ * mixerPlayLevel() has just started for the same level.
+ * @param level Alarm level 1-3 whose voice carries the announcement.
+ * @param callsign Callsign (or ICAO24 address) to spell out.
+ * @param distanceKm Distance from the site.
+ * @return false if that level is not sounding, another announcement is under way, or
+ *         no announcement words are installed.
+ */
+bool mixerAnnounce(int level, const String& callsign, float distanceKm) {
+    if (level < 1 || level > 3) {
+        return false;
+    }
+    MixerVoice& voice = voices[level - 1];
+    if (voice.kind != VOICE_TONE && voice.kind != VOICE_CLIP) {
+        return false;
+    }
+    for (const MixerVoice& other : voices) {
+        if (other.kind == VOICE_ANNOUNCE || other.announceNext) {
+            return false;
+        }
+    }
+    if (!prepareAnnouncement(level, callsign, distanceKm)) {
+        return false;
+    }
+    voice.announceNext = true;
+    return true;
+}
+
+/**
+ * @brief Silences every voice at once and releases any open clip file.
+ * Does not reset the cooldowns.
+ */
+void mixerStopAll() {
+    audioEngineStop();
+    for (MixerVoice& voice : voices) {
+        releaseVoice(voice);
+    }
+}
+
+/**
+ * @brief Sound starts skipped because the level was still sounding or cooling down, since boot.
+ */
+uint32_t mixerCooldownSuppressed() {
+    return cooldownSuppressed;
+}
+
+/**
+ * @brief Clips stopped or held back by a more urgent clip, since boot.
+ */
+uint32_t mixerPreempted() {
+    return preempted;
+}
+
+/**
+ * @brief Most CPU cycles the mixer has spent per output sample (refill context), since boot.
+ */
+uint32_t mixerCyclesPerSampleMax() {
+    return cyclesPerSampleMax;
+}
@@ -0,0 +1,22 @@
+// audio_mixer.h
+#ifndef AUDIO_MIXER_H
+#define AUDIO_MIXER_H
+
+#include <Arduino.h>
+#include "globals.h" // For currentSettings, AlarmSound
+
+const int MIXER_VOICES = 3;                      // One per alarm level, most urgent (level 1) first
+const size_t MIXER_CHUNK_SAMPLES = 128;          // Mixed per pass: 16 ms at 8 kHz, and the gain ramp length
+const uint16_t MIXER_UNITY_GAIN = 256;           // Voice gains are Q8
+const uint16_t MIXER_DUCKED_GAIN = 64;           // -12 dB while a more urgent level sounds
+const uint32_t ALARM_REPEAT_COOLDOWN_MS = 30000; // A level's sound is not restarted sooner than this
+
+// Function declarations
+bool mixerPlayLevel(int level, bool preview);
+bool mixerAnnounce(int level, const String& callsign, float distanceKm);
+void mixerStopAll();
+uint32_t mixerCooldownSuppressed();
+uint32_t mixerPreempted();
+uint32_t mixerCyclesPerSampleMax();
+
+#endif // AUDIO_MIXER_H
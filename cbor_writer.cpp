@@ -0,0 +1,49 @@
+// cbor_writer.cpp
+#include "cbor_writer.h"
+
+/**
+ * @brief Writes a CBOR item head: major type plus the shortest argument encoding.
+ * @param majorType CBOR major type (0-7).
+ * @param value Argument (integer value, length or item count).
+ */
+void CborWriter::writeHead(uint8_t majorType, uint32_t value) {
+    uint8_t type = majorType << 5;
+    if (value < 24) {
+        _out.push_back(type | value);
+    } else if (value <= 0xFF) {
+        _out.push_back(type | 24);
+        _out.push_back(value);
+    } else if (value <= 0xFFFF) {
+        _out.push_back(type | 25);
+        _out.push_back(value >> 8);
+        _out.push_back(value & 0xFF);
+    } else {
+        _out.push_back(type | 26);
+        _out.push_back(value >> 24);
+        _out.push_back((value >> 16) & 0xFF);
+        _out.push_back((value >> 8) & 0xFF);
+        _out.push_back(value & 0xFF);
+    }
+}
+
+/**
+ * @brief Writes a signed integer (major type 0 or 1).
+ * @param value Value to encode.
+ */
+void CborWriter::writeInt(int32_t value) {
+    if (value >= 0) {
+        writeHead(0, value);
+    } else {
+        writeHead(1, (uint32_t)(-(value + 1)));
+    }
+}
+
+/**
+ * @brief Writes a UTF-8 text string (major type 3).
+ * @param text String bytes.
+ * @param length Length in bytes.
+ */
+void CborWriter::writeText(const char* text, size_t length) {
+    writeHead(3, length);
+    _out.insert(_out.end(), (const uint8_t*)text, (const uint8_t*)text + length);
+}
@@ -0,0 +1,29 @@
+// cbor_writer.h
+#ifndef CBOR_WRITER_H
+#define CBOR_WRITER_H
+
+#include <Arduino.h>
+#include <vector>
+
+// Minimal CBOR (RFC 8949) encoder for the binary dashboard responses.
+// Only the types the API needs: integers, text, arrays, maps, booleans.
+class CborWriter {
+public:
+    explicit CborWriter(std::vector<uint8_t>& out) : _out(out) {}
+
+    void writeUnsigned(uint32_t value) { writeHead(0, value); }
+    void writeInt(int32_t value);
+    void writeText(const char* text, size_t length);
+    void writeText(const char* text) { writeText(text, strlen(text)); }
+    void writeText(const String& text) { writeText(text.c_str(), text.length()); }
+    void writeArray(size_t count) { writeHead(4, count); }
+    void writeMap(size_t count) { writeHead(5, count); }
+    void writeBool(bool value) { _out.push_back(value ? 0xF5 : 0xF4); }
+
+private:
+    void writeHead(uint8_t majorType, uint32_t value);
+
+    std::vector<uint8_t>& _out;
+};
+
+#endif // CBOR_WRITER_H
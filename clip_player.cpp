@@ -0,0 +1,332 @@
+// clip_player.cpp
+// Decodes IMA-ADPCM clips for the mixer, either built in (alarm_clips.h) or uploaded
+// to the file system. Decoding happens in the audio engine's refill callback, a mix
+// chunk at a time, so each voice only holds its decoder state and open file; the
+// 256-byte file read chunk is shared, since voices are rendered one after another.
+#include "clip_player.h"
+#include "audio_engine.h" // For AUDIO_BUFFER_SAMPLES
+#include "audio_mixer.h"  // Playback is stopped before a clip file changes
+
+// Standard IMA-ADPCM tables; tools/encode_alarm_clips.py holds the same ones
+static const int16_t IMA_STEP_TABLE[89] PROGMEM = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767
+};
+static const int8_t IMA_INDEX_TABLE[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+static const AlarmClipId BUILT_IN_LEVEL_CLIPS[3] = {
+    ALARM_CLIP_LEVEL1BREACH, ALARM_CLIP_LEVEL2BREACH, ALARM_CLIP_LEVEL3BREACH
+};
+
+// File read buffer, shared by all voices
+static uint8_t fileChunk[AUDIO_BUFFER_SAMPLES / 2];
+
+// Most CPU cycles one decoded run has taken per sample, since boot (file reads excluded)
+static uint32_t decodeCyclesPerSampleMax = 0;
+
+// Upload in progress (the web server delivers one body chunk at a time). There is only
+// one; web_server_handlers.cpp refuses a second upload while this one is running.
+static File uploadFile;
+static String uploadPath; // Clip file the upload will replace
+static bool uploadFailed = false;
+
+/**
+ * @brief Decodes one 4-bit IMA-ADPCM code.
+ * @param state Decoder state, updated.
+ * @param code Code in the low 4 bits.
+ * @return Sample as unsigned 8-bit (128 = silence), rounded from the 16-bit prediction.
+ */
+uint8_t imaDecode(ImaAdpcmState& state, uint8_t code) {
+    int32_t step = pgm_read_word(&IMA_STEP_TABLE[state.stepIndex]);
+    int32_t diff = step >> 3;
+    if (code & 1) diff += step >> 2;
+    if (code & 2) diff += step >> 1;
+    if (code & 4) diff += step;
+    int32_t predictor = (code & 8) ? state.predictor - diff : state.predictor + diff;
+    state.predictor = constrain(predictor, -32768, 32767);
+    state.stepIndex = constrain(state.stepIndex + IMA_INDEX_TABLE[code & 7], 0, 88);
+    return constrain(((state.predictor + 128) >> 8) + 128, 0, 255);
+}
+
+/**
+ * @brief Records the cost of one decoded run in decodeCyclesPerSampleMax.
+ * @param start ESP.getCycleCount() before the run.
+ */
+static void noteDecodeCycles(uint32_t start, size_t count) {
+    if (count > 0) {
+        uint32_t perSample = (ESP.getCycleCount() - start) / count;
+        decodeCyclesPerSampleMax = max(decodeCyclesPerSampleMax, perSample);
+    }
+}
+
+/**
+ * @brief Decodes the next run of a built-in clip.
+ */
+static size_t decodeBuiltIn(ClipVoice& voice, uint8_t* dest, size_t maxSamples) {
+    size_t count = min((uint32_t)maxSamples, voice.sampleCount - voice.sample);
+    const uint8_t* data = voice.clip->data;
+    uint32_t start = ESP.getCycleCount();
+    for (size_t i = 0; i < count; i++, voice.sample++) {
+        uint8_t packed = pgm_read_byte(&data[voice.sample >> 1]);
+        dest[i] = imaDecode(voice.state, (voice.sample & 1) ? packed >> 4 : packed & 0x0F);
+    }
+    noteDecodeCycles(start, count);
+    return count;
+}
+
+/**
+ * @brief Reads and decodes the next run of a clip file.
+ * maxSamples is even, so every call but the last starts on a byte boundary.
+ */
+static size_t decodeFile(ClipVoice& voice, uint8_t* dest, size_t maxSamples) {
+    size_t count = min((uint32_t)min(maxSamples, sizeof(fileChunk) * 2), voice.sampleCount - voice.sample);
+    size_t bytes = (count + 1) / 2;
+    if (count == 0 || voice.file.read(fileChunk, bytes) != bytes) {
+        voice.file.close();
+        return 0; // End of clip, or the file is shorter than its header says
+    }
+    uint32_t start = ESP.getCycleCount();
+    for (size_t i = 0; i < count; i++) {
+        uint8_t packed = fileChunk[i >> 1];
+        dest[i] = imaDecode(voice.state, (i & 1) ? packed >> 4 : packed & 0x0F);
+    }
+    noteDecodeCycles(start, count);
+    voice.sample += count;
+    return count;
+}
+
+/**
+ * @brief Reads and checks a clip file header.
+ * @return Sample count, or 0 if the file is not a usable clip.
+ */
+static uint32_t readClipHeader(File& file) {
+    ClipFileHeader header;
+    if (file.read((uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+        header.magic != CLIP_FILE_MAGIC || header.sampleCount == 0 || header.sampleCount > MAX_CLIP_SAMPLES ||
+        file.size() < sizeof(header) + (header.sampleCount + 1) / 2) {
+        return 0;
+    }
+    return header.sampleCount;
+}
+
+/**
+ * @brief Loads a clip file into a voice, from its first sample.
+ * @param voice Voice to (re)start; a file it still holds is closed first.
+ * @param path Clip file (see ClipFileHeader).
+ * @return false if the file is missing or not a valid clip.
+ */
+bool startClipFile(ClipVoice& voice, const String& path) {
+    closeClip(voice);
+    voice.clip = nullptr;
+    voice.sample = 0;
+    voice.state.predictor = 0;
+    voice.state.stepIndex = 0;
+    if (!SPIFFS.exists(path)) {
+        return false;
+    }
+    voice.file = SPIFFS.open(path, "r");
+    if (!voice.file) {
+        return false;
+    }
+    voice.sampleCount = readClipHeader(voice.file);
+    if (voice.sampleCount == 0) {
+        Serial.println("Ignoring invalid clip file: " + path);
+        voice.file.close();
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Loads the clip for an alarm level into a voice: the uploaded one if present,
+ * else the built-in one.
+ * @param voice Voice to (re)start; a file it still holds is closed first.
+ * @param level Alarm level 1-3.
+ * @return false if the level has no clip.
+ */
+bool startLevelClip(ClipVoice& voice, int level) {
+    if (level < 1 || level > 3) {
+        return false;
+    }
+    String path = clipFilePath(level);
+    if (!startClipFile(voice, path)) {
+        voice.clip = &ALARM_CLIPS[BUILT_IN_LEVEL_CLIPS[level - 1]];
+        voice.sampleCount = voice.clip->sampleCount;
+        path = voice.clip->name;
+    }
+    Serial.printf("Starting audio playback: %s, %u samples\n", path.c_str(), voice.sampleCount);
+    return true;
+}
+
+/**
+ * @brief Decodes the next run of a voice's clip.
+ * @param maxSamples Even, so file reads stay byte-aligned.
+ * @return Samples written; 0 at the end of the clip.
+ */
+size_t renderClip(ClipVoice& voice, uint8_t* dest, size_t maxSamples) {
+    return voice.clip ? decodeBuiltIn(voice, dest, maxSamples) : decodeFile(voice, dest, maxSamples);
+}
+
+/**
+ * @brief Most CPU cycles clip decoding has taken per sample, in one decoded run, since boot.
+ */
+uint32_t clipDecodeCyclesPerSampleMax() {
+    return decodeCyclesPerSampleMax;
+}
+
+/**
+ * @brief Releases the clip file a voice holds, if any.
+ */
+void closeClip(ClipVoice& voice) {
+    if (voice.file) {
+        voice.file.close();
+    }
+}
+
+/**
+ * @brief File that overrides the built-in clip for an alarm level.
+ */
+String clipFilePath(int level) {
+    return "/clips/level" + String(level) + ".adp";
+}
+
+/**
+ * @brief Length of the uploaded clip for an alarm level.
+ * @return Sample count, or 0 if the level uses its built-in clip.
+ */
+uint32_t storedClipSamples(int level) {
+    String path = clipFilePath(level);
+    if (!SPIFFS.exists(path)) {
+        return 0;
+    }
+    File file = SPIFFS.open(path, "r");
+    if (!file) {
+        return 0;
+    }
+    uint32_t samples = readClipHeader(file);
+    file.close();
+    return samples;
+}
+
+/**
+ * @brief Checks an upload request before any of it is stored.
+ * @param path Clip file the upload is for (an alarm level's or an announcement word's);
+ *             empty if the request named neither.
+ * @param total Upload size in bytes.
+ * @param message Output: reason for refusing the upload.
+ * @return false if the upload must be refused.
+ */
+bool checkClipUpload(const String& path, size_t total, String& message) {
+    if (path.length() == 0) {
+        message = "Alarm level must be 1, 2 or 3, or a known announcement word.";
+        return false;
+    }
+    if (total <= sizeof(ClipFileHeader) || total > MAX_CLIP_UPLOAD) {
+        message = "Clip must be at most " + String(MAX_CLIP_SAMPLES / AUDIO_SAMPLE_RATE) + " seconds.";
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Starts receiving an uploaded clip into a temporary file.
+ * @param path Clip file the upload is for (see checkClipUpload()).
+ * @param total Upload size in bytes.
+ * @param message Output: reason for refusing the upload.
+ * @return false if the upload is refused.
+ */
+bool beginClipUpload(const String& path, size_t total, String& message) {
+    if (uploadFile) {
+        uploadFile.close(); // An earlier upload was abandoned
+    }
+    uploadFailed = true;
+    if (!checkClipUpload(path, total, message)) {
+        return false;
+    }
+    uploadFile = SPIFFS.open(path + ".tmp", "w");
+    if (!uploadFile) {
+        message = "File system unavailable.";
+        return false;
+    }
+    uploadPath = path;
+    uploadFailed = false;
+    return true;
+}
+
+/**
+ * @brief Appends one body chunk of the upload in progress.
+ */
+void writeClipUpload(const uint8_t* data, size_t len) {
+    if (uploadFailed || !uploadFile) {
+        return;
+    }
+    if (uploadFile.write(data, len) != len) {
+        uploadFailed = true; // File system full
+    }
+}
+
+/**
+ * @brief Drops the upload in progress and its temporary file, e.g. when the client
+ * disconnected before the body was complete.
+ */
+void abortClipUpload() {
+    if (uploadFile) {
+        uploadFile.close();
+        SPIFFS.remove(uploadPath + ".tmp");
+    }
+    uploadFailed = true;
+}
+
+/**
+ * @brief Validates the received clip and moves it into place.
+ * @param message Output: summary, or the reason for rejecting the clip.
+ * @return true if the clip was stored.
+ */
+bool finishClipUpload(String& message) {
+    if (uploadFile) {
+        uploadFile.close();
+    }
+    const String& path = uploadPath;
+    String tempPath = path + ".tmp";
+    if (uploadFailed) {
+        SPIFFS.remove(tempPath);
+        message = "Upload failed (file system full?).";
+        return false;
+    }
+    File file = SPIFFS.open(tempPath, "r");
+    uint32_t samples = file ? readClipHeader(file) : 0;
+    if (file) {
+        file.close();
+    }
+    if (samples == 0) {
+        SPIFFS.remove(tempPath);
+        message = "Not a valid clip file.";
+        return false;
+    }
+    mixerStopAll(); // The old file may be the one playing
+    SPIFFS.remove(path);
+    if (!SPIFFS.rename(tempPath, path)) {
+        message = "Could not store the clip.";
+        return false;
+    }
+    message = "Clip stored (" + String(samples / (float)AUDIO_SAMPLE_RATE, 1) + " s).";
+    return true;
+}
+
+/**
+ * @brief Removes the uploaded clip for a level, restoring the built-in one.
+ * @return true if a clip was removed.
+ */
+bool deleteStoredClip(int level) {
+    String path = clipFilePath(level);
+    if (level < 1 || level > 3 || !SPIFFS.exists(path)) {
+        return false;
+    }
+    mixerStopAll();
+    return SPIFFS.remove(path);
+}
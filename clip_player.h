@@ -0,0 +1,51 @@
+// clip_player.h
+#ifndef CLIP_PLAYER_H
+#define CLIP_PLAYER_H
+
+#include <Arduino.h>
+#include <FS.h>          // For File
+#include "alarm_clips.h" // For AlarmClip, AlarmClipId
+
+// IMA-ADPCM decoder state: the running 16-bit prediction and step table index
+struct ImaAdpcmState {
+    int16_t predictor;
+    uint8_t stepIndex;
+};
+
+// One clip in progress, built in or streamed from a file; each mixer voice owns one
+struct ClipVoice {
+    const AlarmClip* clip;  // Built-in clip, or nullptr when streaming 'file'
+    File file;
+    uint32_t sample;        // Next sample to decode
+    uint32_t sampleCount;
+    ImaAdpcmState state;
+};
+
+// Uploaded clip file: this header, then IMA-ADPCM packed as in alarm_clips.h.
+// Stored as /clips/level<N>.adp; it replaces the built-in clip for alarm level N.
+struct ClipFileHeader {
+    uint32_t magic;       // CLIP_FILE_MAGIC
+    uint32_t sampleCount; // At AUDIO_SAMPLE_RATE
+};
+
+const uint32_t CLIP_FILE_MAGIC = 0x31434146;   // "FAC1"
+const uint32_t MAX_CLIP_SAMPLES = 16 * 8000;   // 16 s
+const size_t MAX_CLIP_UPLOAD = sizeof(ClipFileHeader) + MAX_CLIP_SAMPLES / 2;
+
+// Function declarations
+uint8_t imaDecode(ImaAdpcmState& state, uint8_t code);
+bool startLevelClip(ClipVoice& voice, int level);
+bool startClipFile(ClipVoice& voice, const String& path);
+size_t renderClip(ClipVoice& voice, uint8_t* dest, size_t maxSamples);
+uint32_t clipDecodeCyclesPerSampleMax();
+void closeClip(ClipVoice& voice);
+String clipFilePath(int level);
+uint32_t storedClipSamples(int level);
+bool checkClipUpload(const String& path, size_t total, String& message);
+bool beginClipUpload(const String& path, size_t total, String& message);
+void writeClipUpload(const uint8_t* data, size_t len);
+void abortClipUpload();
+bool finishClipUpload(String& message);
+bool deleteStoredClip(int level);
+
+#endif // CLIP_PLAYER_H
@@ -0,0 +1,74 @@
+// clock.cpp
+// Time base: a 64-bit monotonic millisecond counter extended from millis(), and a UTC
+// epoch anchored to it at each SNTP sync. The core's SNTP client polls in the
+// background (every CLOCK_RESYNC_MS) and reports through a callback, so loop() never
+// polls for time. Timestamps are kept as epoch seconds and only formatted by the web UI,
+// in the browser's own time zone.
+#include "clock.h"
+#include <time.h>
+#include <coredecls.h> // For settimeofday_cb
+
+static uint32_t lastMillis = 0;
+static uint32_t millisWraps = 0;
+
+static volatile bool synced = false;
+static uint32_t syncEpoch = 0;    // UTC seconds at the last sync...
+static uint64_t syncMonotonic = 0; // ...and the monotonic time it was taken at
+
+/**
+ * @brief Overrides the core's weak default (one hour in recent cores) to set the SNTP poll interval.
+ */
+uint32_t sntp_update_delay_MS_rfc_not_less_than_15000() {
+    return CLOCK_RESYNC_MS;
+}
+
+/**
+ * @brief Called by the core after SNTP set the system time: re-anchors the epoch.
+ */
+static void onTimeSet() {
+    syncEpoch = time(nullptr);
+    syncMonotonic = clockMonotonicMs();
+    if (!synced) {
+        Serial.printf("Clock synchronized: %u\n", syncEpoch);
+    }
+    synced = true;
+}
+
+/**
+ * @brief Starts SNTP (UTC); it runs whenever the network is up. Call once from setup().
+ */
+void clockBegin() {
+    settimeofday_cb(onTimeSet);
+    configTime(0, 0, "pool.ntp.org", "time.google.com");
+}
+
+/**
+ * @brief true once SNTP has set the time at least once.
+ */
+bool clockSynced() {
+    return synced;
+}
+
+/**
+ * @brief Milliseconds since boot, without the 49-day wrap of millis().
+ * Must be called at least once per 49-day wrap; every flight scan does.
+ */
+uint64_t clockMonotonicMs() {
+    uint32_t now = millis();
+    if (now < lastMillis) {
+        millisWraps++;
+    }
+    lastMillis = now;
+    return ((uint64_t)millisWraps << 32) | now;
+}
+
+/**
+ * @brief Current UTC time as Unix epoch seconds.
+ * @return 0 until the first SNTP sync.
+ */
+uint32_t clockEpoch() {
+    if (!synced) {
+        return 0;
+    }
+    return syncEpoch + (uint32_t)((clockMonotonicMs() - syncMonotonic) / 1000);
+}
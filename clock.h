@@ -0,0 +1,15 @@
+// clock.h
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include <Arduino.h>
+
+const uint32_t CLOCK_RESYNC_MS = 3600000; // SNTP re-sync interval
+
+// Function declarations
+void clockBegin();
+bool clockSynced();
+uint64_t clockMonotonicMs();
+uint32_t clockEpoch();
+
+#endif // CLOCK_H
@@ -0,0 +1,74 @@
+// event_stream.cpp
+// Server-Sent Events channel (/events). Dashboards keep one connection open and
+// get a delta event after every scan and on every alarm-level change, instead of
+// opening a new connection per poll.
+// AsyncEventSource queues events per client and drops them for a client whose
+// queue is full, so a slow client never stalls the scan.
+#include "event_stream.h"
+#include "response_cache.h" // For the delta carried in scan events
+
+const unsigned long EVENT_STREAM_KEEPALIVE_MS = 15000; // Keeps proxies/NATs from idling the stream out
+const uint32_t EVENT_STREAM_RETRY_MS = 5000;           // Browser reconnect delay
+
+static unsigned long lastEventMs = 0;
+
+/**
+ * @brief Builds the "scan" event payload: the delta against the previous scan, in the
+ * same format as /getLiveData?since=N. A client whose last sequence is not
+ * 'since' (missed event, fresh connection) resyncs over HTTP.
+ * @param since Sequence the delta is relative to.
+ */
+static String buildScanEventJson(uint32_t since) {
+    String json;
+    if (!buildLiveDataDeltaJson(since, json)) {
+        json = String(F("{\"seq\":")) + scanSequence + F(",\"resync\":true}");
+    }
+    return json;
+}
+
+/**
+ * @brief Registers /events with the web server.
+ */
+void setupEventStream() {
+    eventStream.onConnect([](AsyncEventSourceClient* client) {
+        // Start the client from the current state
+        client->send(buildScanEventJson(0).c_str(), "scan", scanSequence, EVENT_STREAM_RETRY_MS);
+        Serial.print(F("Event stream client connected, total: "));
+        Serial.println(eventStream.count());
+    });
+    // Cap open streams so normal requests still get a socket
+    eventStream.setFilter([](AsyncWebServerRequest* request) {
+        return eventStream.count() < (size_t)MAX_EVENT_STREAM_CLIENTS;
+    });
+    server.addHandler(&eventStream);
+}
+
+/**
+ * @brief Pushes the delta against the previous scan to all subscribers.
+ * Call after the response caches are rebuilt.
+ */
+void broadcastScanEvent() {
+    eventStream.send(buildScanEventJson(scanSequence - 1).c_str(), "scan", scanSequence);
+    lastEventMs = millis();
+}
+
+/**
+ * @brief Pushes an alarm-level change to all subscribers.
+ * @param level New overall alarm level.
+ */
+void broadcastAlarmEvent(int level) {
+    char json[16];
+    snprintf(json, sizeof(json), "{\"level\":%d}", level);
+    eventStream.send(json, "alarm", scanSequence);
+    lastEventMs = millis();
+}
+
+/**
+ * @brief Sends a keep-alive when the stream has been idle. Call from loop().
+ */
+void serviceEventStreams() {
+    if (eventStream.count() > 0 && millis() - lastEventMs > EVENT_STREAM_KEEPALIVE_MS) {
+        eventStream.send("{}", "ping", 0);
+        lastEventMs = millis();
+    }
+}
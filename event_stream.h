@@ -0,0 +1,14 @@
+// event_stream.h
+#ifndef EVENT_STREAM_H
+#define EVENT_STREAM_H
+
+#include <Arduino.h>
+#include "globals.h" // For server, eventStream, currentFlights, currentOverallAlarmLevel
+
+// Function declarations
+void setupEventStream();
+void broadcastScanEvent();
+void broadcastAlarmEvent(int level);
+void serviceEventStreams();
+
+#endif // EVENT_STREAM_H
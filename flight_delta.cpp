@@ -0,0 +1,119 @@
+// flight_delta.cpp
+// Tracks which aircraft were added, changed or removed at which scan sequence, so
+// clients can ask for "everything since sequence N" instead of the full list.
+#include "flight_delta.h"
+#include <math.h>
+
+const int MAX_DELTA_TOMBSTONES = 32; // Removed aircraft remembered for delta requests
+
+struct FlightTombstone {
+    String icao24;
+    uint32_t removedSeq;
+};
+
+static FlightTombstone tombstones[MAX_DELTA_TOMBSTONES];
+static int tombstoneNext = 0;      // Ring write position
+static uint32_t deltaFloorSeq = 0; // Deltas are only complete for since >= this
+
+/**
+ * @brief Compares two reports of the same aircraft at the precision the dashboard shows.
+ * @return true if anything visible changed.
+ */
+static bool flightChanged(const FlightData& a, const FlightData& b) {
+    return a.proximity_level != b.proximity_level ||
+           a.site != b.site ||
+           a.callsign != b.callsign ||
+           lroundf(a.latitude * 10000) != lroundf(b.latitude * 10000) ||
+           lroundf(a.longitude * 10000) != lroundf(b.longitude * 10000) ||
+           lroundf(a.altitude_baro) != lroundf(b.altitude_baro) ||
+           lroundf(a.velocity * 3.6) != lroundf(b.velocity * 3.6) ||
+           lroundf(a.true_track) != lroundf(b.true_track) ||
+           lroundf(a.distance_km * 100) != lroundf(b.distance_km * 100);
+}
+
+/**
+ * @brief Records a removed aircraft. When the ring wraps, the oldest removal is
+ * forgotten and deltas from before it can no longer be served.
+ */
+static void addTombstone(const String& icao24, uint32_t seq) {
+    FlightTombstone& slot = tombstones[tombstoneNext];
+    if (slot.removedSeq != 0) {
+        deltaFloorSeq = slot.removedSeq;
+    }
+    slot.icao24 = icao24;
+    slot.removedSeq = seq;
+    tombstoneNext = (tombstoneNext + 1) % MAX_DELTA_TOMBSTONES;
+}
+
+/**
+ * @brief Sets updated_seq on the new flight list and records removals.
+ * @param previous Flight list of the previous scan.
+ * @param next Flight list of this scan (updated in place).
+ * @param seq Sequence number of this scan.
+ */
+void stampFlightChanges(const std::vector<FlightData>& previous, std::vector<FlightData>& next, uint32_t seq) {
+    // Lists hold a few dozen aircraft at most, so a linear lookup is fine.
+    for (FlightData& flight : next) {
+        flight.updated_seq = seq;
+        for (const FlightData& old : previous) {
+            if (old.icao24 == flight.icao24) {
+                if (!flightChanged(old, flight)) {
+                    flight.updated_seq = old.updated_seq;
+                }
+                break;
+            }
+        }
+    }
+
+    for (const FlightData& old : previous) {
+        bool stillPresent = false;
+        for (const FlightData& flight : next) {
+            if (flight.icao24 == old.icao24) {
+                stillPresent = true;
+                break;
+            }
+        }
+        if (!stillPresent) {
+            addTombstone(old.icao24, seq);
+        }
+    }
+}
+
+/**
+ * @brief Checks whether a delta from sequence 'since' can be built.
+ * @param since Last sequence the client has applied.
+ * @return false if the client must fall back to a full snapshot.
+ */
+bool canServeDeltaSince(uint32_t since) {
+    return since >= deltaFloorSeq && since <= scanSequence && since > 0;
+}
+
+/**
+ * @brief Lists aircraft removed after sequence 'since' that are still gone.
+ * An aircraft that left and came back after 'since' is an upsert, not a removal.
+ * @param since Last sequence the client has applied.
+ * @param removed Output list of icao24 codes, each listed once.
+ */
+void collectRemovedSince(uint32_t since, std::vector<String>& removed) {
+    for (const FlightTombstone& tombstone : tombstones) {
+        if (tombstone.removedSeq <= since) {
+            continue;
+        }
+        bool listed = false;
+        for (const FlightData& flight : currentFlights) {
+            if (flight.icao24 == tombstone.icao24) {
+                listed = true;
+                break;
+            }
+        }
+        for (const String& icao24 : removed) {
+            if (icao24 == tombstone.icao24) {
+                listed = true;
+                break;
+            }
+        }
+        if (!listed) {
+            removed.push_back(tombstone.icao24);
+        }
+    }
+}
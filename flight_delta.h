@@ -0,0 +1,14 @@
+// flight_delta.h
+#ifndef FLIGHT_DELTA_H
+#define FLIGHT_DELTA_H
+
+#include <Arduino.h>
+#include <vector>
+#include "globals.h" // For FlightData, currentFlights, scanSequence
+
+// Function declarations
+void stampFlightChanges(const std::vector<FlightData>& previous, std::vector<FlightData>& next, uint32_t seq);
+bool canServeDeltaSince(uint32_t since);
+void collectRemovedSince(uint32_t since, std::vector<String>& removed);
+
+#endif // FLIGHT_DELTA_H
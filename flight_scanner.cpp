@@ -2,19 +2,372 @@
 #include "flight_scanner.h"
 #include "globals.h"
 #include "settings_manager.h" // Assuming settings_manager has functions to get current settings
-#include "alarm_manager.h"    // For updateLED and playAlarmSound
+#include "alarm_manager.h"    // For updateLED, playAlarmSound and announceFlight
 #include <ArduinoJson.h>
 #include <ESP8266HTTPClient.h>
 #include <WiFiClientSecure.h> // MODIFIED: Use WiFiClientSecure for HTTPS
 #include <math.h>             // For round() and other math functions
 #include <ESP8266WiFi.h>      // Necessary for WiFi.status() and overall WiFi connectivity
-//#include <WiFiClientSecureBearSSL.h>
+#include <memory>             // For std::unique_ptr
+#include "response_cache.h"   // For rebuildResponseCaches
+#include "event_stream.h"     // For pushing scan/alarm events to dashboards
+#include "flight_delta.h"     // For per-aircraft change sequence numbers
+#include "metrics.h"          // For scan outcome/size metrics
+#include "scan_trace.h"       // For per-stage span tracing
+#include "scan_geometry.h"    // For the precomputed location/radii/query box
+#include "alarm_debounce.h"   // For per-aircraft level hysteresis
+#include "led_patterns.h"     // For the error LED
+#include "clock.h"            // For history timestamps
 
-// Forward declaration for calculateDistance (defined later in this file)
-float calculateDistance(float lat1, float lon1, float lat2, float lon2);
-int getProximityLevel(float distance, float r1, float r2, float r3);
+// Forward declarations (defined later in this file)
 void updateScanHistory(int level1Count, int level2Count, int level3Count, int totalCount, const std::vector<FlightData>& flights);
-String getCurrentFormattedTime();
+
+/**
+ * @brief Classifies one state row and keeps it if it is inside some site's radius or zone.
+ * @param row State row.
+ * @param geometry Geometry the request was built from.
+ * @param nowMs Scan time, for the debounce.
+ * @param flights Output list; the flight is appended if kept.
+ * @param altitudeFiltered Incremented if the altitude ceilings demoted or dropped the aircraft.
+ */
+static void classifyStateRow(JsonArray row, const ScanGeometry& geometry, uint32_t nowMs,
+                             std::vector<FlightData>& flights, uint32_t& altitudeFiltered) {
+    // Row layout: 0 icao24, 1 callsign, 2 origin_country, 5 longitude, 6 latitude,
+    // 7 baro_altitude, 8 on_ground, 9 velocity, 10 true_track, 13 geo_altitude
+    if (row[5].isNull() || row[6].isNull()) {
+        return; // No position report
+    }
+    FlightData flight;
+    flight.latitude = row[6].as<float>();
+    flight.longitude = row[5].as<float>();
+    // Geometric altitude is closer to height above the site than pressure altitude;
+    // unknown altitude counts as 0 so it can only alarm, never be filtered out.
+    float altitude = 0;
+    if (!row[8].as<bool>()) {
+        altitude = !row[13].isNull() ? row[13].as<float>() : row[7].as<float>();
+    }
+    SiteMatch match;
+    int entryLevel = classifyPosition(geometry, flight.latitude, flight.longitude, altitude, match);
+    if (match.altitudeLimited) {
+        altitudeFiltered++;
+    }
+    flight.proximity_level = debounceProximityLevel(row[0].as<const char*>(), entryLevel, match, nowMs, geometry.alarmDwellMs);
+    if (flight.proximity_level == 0) {
+        return; // Outside every band, or in one without having been inside
+    }
+    if (match.holdLevel == 0) {
+        // Held past every exit band for the rest of the dwell time
+        match.distanceKm = siteDistanceKm(geometry, match.site, flight.latitude, flight.longitude);
+    }
+    flight.distance_km = match.distanceKm;
+    if (match.zone >= 0) {
+        flight.site = geometry.geofences->zones[match.zone].name;
+        flight.alarm_policy = SITE_ALARM_SOUND;
+    } else {
+        flight.site = geometry.sites[match.site].name;
+        flight.alarm_policy = geometry.sites[match.site].alarmPolicy;
+    }
+    flight.icao24 = row[0].as<String>();
+    flight.callsign = row[1].as<String>();
+    flight.callsign.trim();
+    flight.origin_country = row[2].as<String>();
+    flight.altitude_baro = row[7].as<float>();
+    flight.velocity = row[9].as<float>();
+    flight.true_track = row[10].as<float>();
+    flights.push_back(flight);
+}
+
+// Size of the document one state row is parsed into. A row is 17-18 values with short
+// strings (well under half of this); only one row is held at a time, so the response
+// size no longer depends on the heap.
+const size_t FLIGHT_ROW_DOC_SIZE = 1024;
+
+// Reads the response body for the per-row parser: blocking reads with the stream's
+// timeout, and one byte of push-back for the lookahead between rows.
+class StateRowReader {
+public:
+    explicit StateRowReader(Stream& stream) : _stream(stream), _pushback(-1) {}
+
+    int read() {
+        if (_pushback >= 0) {
+            int c = _pushback;
+            _pushback = -1;
+            return c;
+        }
+        char c;
+        return _stream.readBytes(&c, 1) == 1 ? (uint8_t)c : -1;
+    }
+    size_t readBytes(char* buffer, size_t length) {
+        size_t count = 0;
+        if (length > 0 && _pushback >= 0) {
+            buffer[count++] = (char)_pushback;
+            _pushback = -1;
+        }
+        return count + _stream.readBytes(buffer + count, length - count);
+    }
+    // Next byte that is not JSON whitespace, or -1
+    int readToken() {
+        int c;
+        do {
+            c = read();
+        } while (c == ' ' || c == '\n' || c == '\r' || c == '\t');
+        return c;
+    }
+    void unread(int c) {
+        _pushback = c;
+    }
+
+private:
+    Stream& _stream;
+    int _pushback;
+};
+
+/**
+ * @brief Parses an OpenSky /states/all response and keeps the flights inside some site's Level 3 radius or zone.
+ * The "states" array is parsed one row at a time straight off the stream and each row
+ * is classified before the next is read, so busy airspace costs time, not heap.
+ * Each kept flight's level is the debounced one (see alarm_debounce.cpp), so the
+ * overall alarm level only changes on confirmed transitions.
+ * @param stream Response body stream.
+ * @param geometry Geometry the request was built from.
+ * @param flights Output list of classified flights.
+ * @param rowsParsed Output: number of state rows in the response.
+ * @param altitudeFiltered Output: aircraft demoted or dropped by the altitude ceilings.
+ * @return true if the body was valid JSON.
+ */
+bool parseFlightStates(Stream& stream, const ScanGeometry& geometry, std::vector<FlightData>& flights,
+                       uint32_t& rowsParsed, uint32_t& altitudeFiltered) {
+#if SCAN_TRACE_ENABLED
+    // Reads, parse and classify work interleave; the spans below show how the total splits.
+    TimedStream input(stream); // Separates time waiting on the network from parse work
+    input.setTimeout(stream.getTimeout());
+#else
+    Stream& input = stream;
+#endif
+    TRACE_BEGIN(parseStart);
+    uint32_t classifyUs = 0;
+    size_t rowMemoryMax = 0;
+
+    // {"time":..., "states":[[row], [row], ...]}; "states" is null when the box is empty
+    if (!input.find("\"states\":")) {
+        Serial.println(F("Failed to parse flight states: no \"states\" member."));
+        return false;
+    }
+    StateRowReader reader(input);
+    DynamicJsonDocument row(FLIGHT_ROW_DOC_SIZE);
+    uint32_t nowMs = millis();
+    int token = reader.readToken();
+    if (token == '[') {
+        token = reader.readToken();
+        if (token != ']') {
+            reader.unread(token);
+            token = ',';
+        }
+    } else if (token == 'n') {
+        token = ']'; // null: no aircraft
+    } else {
+        token = -1;
+    }
+    for (; token == ','; token = reader.readToken()) {
+        DeserializationError error = deserializeJson(row, reader);
+        if (error) {
+            Serial.printf("Failed to parse flight state row %u: %s\n", rowsParsed, error.c_str());
+            return false;
+        }
+        rowsParsed++;
+        rowMemoryMax = max(rowMemoryMax, row.memoryUsage());
+        uint32_t classifyStart = micros();
+        classifyStateRow(row.as<JsonArray>(), geometry, nowMs, flights, altitudeFiltered);
+        classifyUs += micros() - classifyStart;
+    }
+    if (token != ']') {
+        Serial.println(F("Failed to parse flight states: malformed \"states\" array."));
+        return false;
+    }
+    pruneAlarmStates(nowMs);
+#if SCAN_TRACE_ENABLED
+    uint32_t totalUs = micros() - parseStart;
+    traceRecord("download", parseStart, input.waitUs);
+    traceRecord("parse", parseStart + input.waitUs, totalUs - input.waitUs - classifyUs, rowMemoryMax);
+    traceRecord("classify", parseStart + totalUs - classifyUs, classifyUs, rowsParsed);
+#endif
+    return true;
+}
+
+
+/**
+ * @brief Publishes a freshly parsed flight list: counts, alarm level, LED, sound, history and response caches.
+ * Runs without yielding, so web handlers (network callbacks) never see a half-updated state.
+ * @param flights Flights kept by parseFlightStates().
+ */
+void applyScanResults(std::vector<FlightData>& flights) {
+    int levelCounts[4];
+    countProximityLevels(flights, levelCounts);
+
+    // Sites with the "none" policy are only listed; the most critical level among the
+    // other flights sets the alarm, and sound needs a "sound" site at that level.
+    // The nearest of the flights that allow sound at that level is the one announced.
+    int newAlarmLevel = 0;
+    bool soundAllowed = false;
+    size_t nearest = 0;
+    for (size_t i = 0; i < flights.size(); i++) {
+        const FlightData& flight = flights[i];
+        if (flight.alarm_policy == SITE_ALARM_NONE) {
+            continue;
+        }
+        if (newAlarmLevel == 0 || flight.proximity_level < newAlarmLevel) {
+            newAlarmLevel = flight.proximity_level;
+            soundAllowed = false;
+        }
+        if (flight.proximity_level == newAlarmLevel && flight.alarm_policy == SITE_ALARM_SOUND &&
+            (!soundAllowed || flight.distance_km < flights[nearest].distance_km)) {
+            soundAllowed = true;
+            nearest = i;
+        }
+    }
+
+    scanSequence++;
+    stampFlightChanges(currentFlights, flights, scanSequence);
+    currentFlights = flights;
+    if (newAlarmLevel != currentOverallAlarmLevel) {
+        TRACE_SCOPE("alarm_dispatch");
+        // Level 1 is the most urgent; only a new alarm or a more urgent level counts as an activation
+        bool escalated = newAlarmLevel > 0 && (currentOverallAlarmLevel == 0 || newAlarmLevel < currentOverallAlarmLevel);
+        currentOverallAlarmLevel = newAlarmLevel;
+        updateLED(currentOverallAlarmLevel);
+        broadcastAlarmEvent(currentOverallAlarmLevel);
+        playAlarmSound(soundAllowed ? currentOverallAlarmLevel : 0);
+        if (soundAllowed && currentOverallAlarmLevel == 1) {
+            announceFlight(currentOverallAlarmLevel, flights[nearest]);
+        }
+        if (escalated) {
+            metricsRecordAlarm(currentOverallAlarmLevel);
+        }
+    }
+    {
+        TRACE_SCOPE("history");
+        updateScanHistory(levelCounts[1], levelCounts[2], levelCounts[3], flights.size(), flights);
+    }
+    TRACE_SCOPE("publish");
+    rebuildResponseCaches();
+    broadcastScanEvent();
+}
+
+static uint32_t nextScanStartMs = 0; // When the scan timer was armed...
+static uint32_t nextScanDelayMs = 0; // ...and for how long
+
+/**
+ * @brief Ticker callback: flags that a scan is due.
+ * The scan itself does network I/O, so it runs from loop() rather than from the timer callback.
+ */
+void requestFlightScan() {
+    flightScanDue = true;
+}
+
+// Split form of the API URL; the request is made directly on the client so each
+// stage (DNS, connect, first byte, body) can be timed separately.
+struct ApiEndpoint {
+    bool secure;
+    String host;
+    uint16_t port;
+    String path; // Path and query
+};
+
+/**
+ * @brief Splits an http(s) URL into host, port and path.
+ * @return false if the URL is not http:// or https://.
+ */
+bool parseApiUrl(const String& url, ApiEndpoint& endpoint) {
+    int hostStart;
+    if (url.startsWith("https://")) {
+        endpoint.secure = true;
+        endpoint.port = 443;
+        hostStart = 8;
+    } else if (url.startsWith("http://")) {
+        endpoint.secure = false;
+        endpoint.port = 80;
+        hostStart = 7;
+    } else {
+        return false;
+    }
+
+    int pathStart = url.indexOf('/', hostStart);
+    String hostPort = (pathStart < 0) ? url.substring(hostStart) : url.substring(hostStart, pathStart);
+    endpoint.path = (pathStart < 0) ? String("/") : url.substring(pathStart);
+    int colon = hostPort.indexOf(':');
+    if (colon >= 0) {
+        endpoint.port = hostPort.substring(colon + 1).toInt();
+        hostPort = hostPort.substring(0, colon);
+    }
+    endpoint.host = hostPort;
+    return endpoint.host.length() > 0;
+}
+
+/**
+ * @brief Sends an HTTP/1.0 GET and reads the response head.
+ * HTTP/1.0 means no chunked encoding, so the body can be parsed straight from the client.
+ * @param client Client to use (plain or TLS).
+ * @param endpoint Parsed API URL.
+ * @param contentLength Output: Content-Length, or -1 if absent.
+ * @return HTTP status code, or a negative HTTPC_ERROR_* code.
+ */
+int sendApiRequest(WiFiClient& client, const ApiEndpoint& endpoint, int& contentLength) {
+    const unsigned long API_TIMEOUT_MS = 10000;
+    contentLength = -1;
+
+    {
+        TRACE_BEGIN(dnsStart);
+        IPAddress address;
+        bool resolved = WiFi.hostByName(endpoint.host.c_str(), address) == 1;
+        TRACE_END(dnsStart, "dns");
+        if (!resolved) {
+            Serial.println(F("DNS lookup failed."));
+            return HTTPC_ERROR_CONNECTION_FAILED;
+        }
+    }
+
+    client.setTimeout(API_TIMEOUT_MS);
+    {
+        // For HTTPS this includes the TLS handshake (BearSSL does both in connect()).
+        // The hostname is passed so TLS gets SNI; the lookup above is now cached.
+        TRACE_SCOPE(endpoint.secure ? "connect_tls" : "connect");
+        if (!client.connect(endpoint.host.c_str(), endpoint.port)) {
+            return HTTPC_ERROR_CONNECTION_FAILED;
+        }
+    }
+
+    TRACE_BEGIN(requestStart);
+    client.print(String(F("GET ")) + endpoint.path + F(" HTTP/1.0\r\nHost: ") + endpoint.host +
+                 F("\r\nUser-Agent: ESP8266-FlightAlarm\r\nConnection: close\r\n\r\n"));
+    unsigned long waitStart = millis();
+    while (!client.available()) {
+        if (!client.connected() || millis() - waitStart > API_TIMEOUT_MS) {
+            return HTTPC_ERROR_READ_TIMEOUT;
+        }
+        delay(1);
+    }
+    TRACE_END(requestStart, "ttfb");
+
+    TRACE_SCOPE("headers");
+    String statusLine = client.readStringUntil('\n');
+    int spaceIndex = statusLine.indexOf(' ');
+    if (!statusLine.startsWith("HTTP/") || spaceIndex < 0) {
+        return HTTPC_ERROR_NO_HTTP_SERVER;
+    }
+    int statusCode = statusLine.substring(spaceIndex + 1).toInt();
+
+    while (client.connected() || client.available()) {
+        String header = client.readStringUntil('\n');
+        header.trim();
+        if (header.length() == 0) {
+            break; // End of headers
+        }
+        if (header.substring(0, 15).equalsIgnoreCase("Content-Length:")) {
+            contentLength = header.substring(15).toInt();
+        }
+    }
+    return statusCode;
+}
 
 /**
  * @brief Performs a flight scan by querying the OpenSky Network API.
@@ -24,66 +377,66 @@ void performFlightScan() {
     Serial.print("Free heap at start of scan: "); Serial.println(ESP.getFreeHeap()); // Debugging heap usage
     if (WiFi.status() != WL_CONNECTED) {
         Serial.println(F("WiFi not connected. Cannot perform flight scan."));
+        metricsRecordScan(SCAN_WIFI_DOWN, 0, 0);
+        ledSetLayer(LED_CHANNEL_BUILTIN, LED_LAYER_ERROR, true);
         return;
     }
+    TRACE_NEW_SCAN();
+    TRACE_SCOPE("scan");
+    unsigned long scanStartMs = millis();
+    ScanOutcome outcome = SCAN_CONNECT_FAILED;
+    int httpCode = 0;
 
-    // Use WiFiClientSecure for HTTPS, or WiFiClient for HTTP
-    // Based on your apiServer URL, if it's "http://", WiFiClient is technically sufficient.
-    // However, if you intend HTTPS (as per your comment in the include), WiFiClientSecure is needed.
-    // Assuming you've corrected the include to <WiFiClientSecure.h>
-    //std::unique_ptr<BearSSL::WiFiClientSecure> client(new BearSSL::WiFiClientSecure);
-    //client->setInsecure();
-    WiFiClientSecure client;
-    HTTPClient http;
-
-    //WiFiClientSecure client; // For HTTPS
-    // For HTTP only: WiFiClient client;
-
-    // IMPORTANT FOR HTTPS: Add this line to allow insecure connections (for testing).
-    // For production, you should verify the server's certificate.
-    //client.setInsecure(); // This is for testing with self-signed or unverified certs. Remove for production with proper certificates.
-
-    
-    /*String apiUrl = "http://opensky-network.org/api/states/all";
-    // Add parameters to API URL
-    apiUrl += "?lamin=" + String(currentSettings.latitude - 1.0, 2); // +/- 1 degree for example bounding box
-    apiUrl += "&lamax=" + String(currentSettings.latitude + 1.0, 2);
-    apiUrl += "&lomin=" + String(currentSettings.longitude - 1.0, 2);
-    apiUrl += "&lomax=" + String(currentSettings.longitude + 1.0, 2);
-    
-    Serial.print("Requesting URL: ");
-    Serial.println(apiUrl);*/
-
-    Serial.println(F("Attempting http.begin()..."));
-    // Ensure http.begin() uses the correct client (WiFiClient or WiFiClientSecure)
-    if (http.begin(client,"https://opensky-network.org/api/states/all")) { // Pass the client object here
-        Serial.println(F("http.begin() successful. Attempting http.GET()..."));
-        int httpCode = http.GET();
-
-       if (httpCode > 0) {
-            Serial.printf("HTTP GET successful, code: %d\n", httpCode);
-            if (httpCode == HTTP_CODE_OK || httpCode == HTTP_CODE_MOVED_PERMANENTLY) {
-                String payload = http.getString();
-                Serial.println("Received payload length: " + String(payload.length()));
-                // Serial.println("Payload: " + payload); // Uncomment for full payload debug
+    // Settings changes are applied from loop(), never mid-scan, but the reference is
+    // still taken once so the request and the classification use the same geometry.
+    const ScanGeometry& geometry = activeScanGeometry();
+    const String& apiUrl = geometry.apiUrl;
+    Serial.print(F("Requesting URL: "));
+    Serial.println(apiUrl);
+
+    ApiEndpoint endpoint;
+    if (parseApiUrl(apiUrl, endpoint)) {
+        // Use WiFiClientSecure for HTTPS, or WiFiClient for HTTP
+        std::unique_ptr<WiFiClient> client;
+        if (endpoint.secure) {
+            WiFiClientSecure* secureClient = new WiFiClientSecure;
+            // IMPORTANT FOR HTTPS: allows unverified certificates.
+            // For production, you should verify the server's certificate.
+            secureClient->setInsecure();
+            client.reset(secureClient);
+        } else {
+            client.reset(new WiFiClient);
+        }
+
+        int payloadBytes = -1; // -1 if the server sent no Content-Length
+        httpCode = sendApiRequest(*client, endpoint, payloadBytes);
 
-                // Process JSON data
-                // ... (your existing JSON parsing logic) ...
+        if (httpCode == HTTP_CODE_OK) {
+            Serial.printf("HTTP GET successful, code: %d\n", httpCode);
+            std::vector<FlightData> flights;
+            uint32_t rowsParsed = 0, altitudeFiltered = 0;
+            if (parseFlightStates(*client, geometry, flights, rowsParsed, altitudeFiltered)) {
+                Serial.printf("Flights within monitoring radius: %u\n", flights.size());
+                metricsRecordScanPayload(payloadBytes, rowsParsed, flights.size(), altitudeFiltered);
+                applyScanResults(flights);
+                outcome = SCAN_OK;
             } else {
-                Serial.printf("HTTP GET failed with code: %d\n", httpCode);
-                // Handle non-200/301 responses
+                outcome = SCAN_PARSE_ERROR;
             }
+        } else if (httpCode > 0) {
+            Serial.printf("HTTP GET failed with code: %d\n", httpCode);
+            outcome = SCAN_HTTP_ERROR;
         } else {
-            Serial.printf("HTTP GET failed, error: %s\n", http.errorToString(httpCode).c_str());
+            Serial.printf("HTTP GET failed, error: %s\n", HTTPClient::errorToString(httpCode).c_str());
             // This is where connection errors or no response would be caught
         }
+        client->stop();
     } else {
-       // Serial.println("❌ http.begin() failed to connect to " + apiUrl);
-        // This indicates a fundamental issue like DNS resolution or initial connection setup.
+        Serial.println("❌ Unsupported API server URL: " + apiUrl);
     }
 
-    // Always call end() to free resources, even if begin() failed
-    http.end();
+    metricsRecordScan(outcome, httpCode, millis() - scanStartMs);
+    ledSetLayer(LED_CHANNEL_BUILTIN, LED_LAYER_ERROR, outcome != SCAN_OK); // Solid on until a scan succeeds
     Serial.print("Free heap after scan: "); Serial.println(ESP.getFreeHeap()); // Debugging heap usage
 }
 
@@ -93,28 +446,28 @@ void startFlightScanTimer() {
     Serial.println(F("Setting next flight scan timer."));
     // Schedule the next scan based on current alarm level.
     // Use flightPresentScanFreq if any alarm level is active, otherwise noFlightScanFreq.
-    int scanFrequency = (currentOverallAlarmLevel > 0) ? currentSettings.flightPresentScanFreq : currentSettings.noFlightScanFreq;
+    const ScanGeometry& geometry = activeScanGeometry();
+    int scanFrequency = (currentOverallAlarmLevel > 0) ? geometry.flightPresentScanSec : geometry.noFlightScanSec;
 
     // Detach any existing ticker before attaching a new one
     flightScanTicker.detach();
 
-    // Attach the ticker to call performFlightScan() after 'scanFrequency' seconds
-    flightScanTicker.once(scanFrequency, performFlightScan);
+    // Attach the ticker to flag the next scan after 'scanFrequency' seconds
+    flightScanTicker.once(scanFrequency, requestFlightScan);
+    nextScanStartMs = millis();
+    nextScanDelayMs = (uint32_t)scanFrequency * 1000;
 }
 
 /**
- * @brief Determines the proximity level of a flight based on distance and configured radii.
- * @param distance Distance of the flight in kilometers.
- * @param r1 Radius for Level 1 (most critical).
- * @param r2 Radius for Level 2.
- * @param r3 Radius for Level 3.
- * @return Proximity level (1, 2, 3, or 0 for none).
+ * @brief Time until flightScanTicker flags the next scan, for the power manager's idle wait.
+ * @return 0 if a scan is already due.
  */
-int getProximityLevel(float distance, float r1, float r2, float r3) {
-    if (distance <= r1) return 1;
-    if (distance <= r2) return 2;
-    if (distance <= r3) return 3;
-    return 0; // No proximity alarm
+uint32_t msUntilNextScan() {
+    if (flightScanDue) {
+        return 0;
+    }
+    uint32_t elapsed = millis() - nextScanStartMs;
+    return (elapsed < nextScanDelayMs) ? nextScanDelayMs - elapsed : 0;
 }
 
 /**
@@ -127,7 +480,7 @@ int getProximityLevel(float distance, float r1, float r2, float r3) {
  */
 void updateScanHistory(int level1Count, int level2Count, int level3Count, int totalCount, const std::vector<FlightData>& flights) {
     ScanHistoryEntry newEntry;
-    newEntry.timestamp = getCurrentFormattedTime();
+    newEntry.timestamp = clockEpoch();
     newEntry.level1 = level1Count;
     newEntry.level2 = level2Count;
     newEntry.level3 = level3Count;
@@ -144,19 +497,3 @@ void updateScanHistory(int level1Count, int level2Count, int level3Count, int to
     }
 }
 
-/**
- * @brief Gets the current time formatted as a string.
- * @return Formatted time string (e.g., "YYYY-MM-DD HH:MM:SS").
- */
-String getCurrentFormattedTime() {
-    time_t rawTime = timeClient.getEpochTime();
-    struct tm * ti;
-    ti = localtime(&rawTime);
-
-    char buffer[20];
-    // Format: YYYY-MM-DD HH:MM:SS
-    sprintf(buffer, "%04d-%02d-%02d %02d:%02d:%02d",
-            ti->tm_year + 1900, ti->tm_mon + 1, ti->tm_mday,
-            ti->tm_hour, ti->tm_min, ti->tm_sec);
-    return String(buffer);
-}
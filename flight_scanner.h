@@ -6,11 +6,13 @@
 #include <ESP8266HTTPClient.h>
 #include <ArduinoJson.h>
 #include "globals.h" // For currentSettings, currentFlights, scanHistory, Ticker
-#include "utils.h"   // For calculateDistance, determineProximityLevel, getTimestamp
+#include "utils.h"   // For countProximityLevels
 #include "alarm_manager.h" // For playAlarmSound, updateLED
 
 // Function declarations
 void performFlightScan();
+void requestFlightScan();
 void startFlightScanTimer();
+uint32_t msUntilNextScan();
 
 #endif // FLIGHT_SCANNER_H
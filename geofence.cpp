@@ -0,0 +1,282 @@
+// geofence.cpp
+#include "geofence.h"
+#include <FS.h> // For SPIFFS
+
+static const char* GEOFENCE_FILE = "/zones.bin";
+static const uint32_t GEOFENCE_MAGIC = 0x314E5A46; // "FZN1"
+
+static GeofenceSetPtr activeGeofences = std::make_shared<GeofenceSet>();
+static std::vector<uint8_t> importedFile; // Accepted upload not yet written to flash
+static bool importPending = false;
+
+// Bounds-checked little-endian reader over the upload/file buffer
+struct ByteReader {
+    const uint8_t* data;
+    size_t length;
+    size_t pos;
+    bool ok;
+
+    bool take(void* out, size_t n) {
+        if (!ok || pos + n > length) {
+            ok = false;
+            return false;
+        }
+        memcpy(out, data + pos, n);
+        pos += n;
+        return true;
+    }
+};
+
+/**
+ * @brief Builds the latitude-slab edge buckets of a zone.
+ * About four edges per slab on average, capped at MAX_GEOFENCE_SLABS.
+ */
+static void buildSlabs(GeofenceZone& zone) {
+    uint16_t slabCount = constrain((int)zone.edges.size() / 4, 1, MAX_GEOFENCE_SLABS);
+    zone.slabHeight = max((zone.latMax - zone.latMin) / slabCount, 1e-6f);
+
+    // Two passes (count, then fill), as for the site grid in scan_geometry.cpp
+    zone.slabStart.assign(slabCount + 1, 0);
+    std::vector<uint16_t> fill;
+    for (int pass = 0; pass < 2; pass++) {
+        if (pass == 1) {
+            for (uint16_t k = 0; k < slabCount; k++) {
+                zone.slabStart[k + 1] += zone.slabStart[k];
+            }
+            zone.slabEdges.assign(zone.slabStart[slabCount], 0);
+            fill.assign(zone.slabStart.begin(), zone.slabStart.end() - 1);
+        }
+        for (uint16_t e = 0; e < zone.edges.size(); e++) {
+            uint16_t v = zone.edges[e];
+            float lo = min(zone.lat[v], zone.lat[v + 1]);
+            float hi = max(zone.lat[v], zone.lat[v + 1]);
+            int k0 = constrain((int)((lo - zone.latMin) / zone.slabHeight), 0, slabCount - 1);
+            int k1 = constrain((int)((hi - zone.latMin) / zone.slabHeight), 0, slabCount - 1);
+            for (int k = k0; k <= k1; k++) {
+                if (pass == 0) {
+                    zone.slabStart[k + 1]++;
+                } else {
+                    zone.slabEdges[fill[k]++] = e;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Parses and indexes the binary zone list.
+ * @param data Binary form (see geofence.h).
+ * @param length Size of data.
+ * @param set Output set.
+ * @param message Output: summary or the reason for rejecting the data.
+ * @return true if the data was valid.
+ */
+static bool parseGeofences(const uint8_t* data, size_t length, GeofenceSet& set, String& message) {
+    ByteReader in = { data, length, 0, true };
+    uint32_t magic = 0;
+    uint16_t zoneCount = 0, reserved = 0;
+    in.take(&magic, 4);
+    in.take(&zoneCount, 2);
+    in.take(&reserved, 2);
+    if (!in.ok || magic != GEOFENCE_MAGIC) {
+        message = "Not a zone file.";
+        return false;
+    }
+    if (zoneCount > MAX_GEOFENCE_ZONES) {
+        message = "Too many zones (max " + String(MAX_GEOFENCE_ZONES) + ").";
+        return false;
+    }
+
+    set.zones.clear();
+    set.vertexCount = 0;
+    for (uint16_t z = 0; z < zoneCount; z++) {
+        GeofenceZone zone;
+        uint8_t nameLength = 0;
+        uint16_t ringCount = 0;
+        in.take(&zone.level, 1);
+        in.take(&nameLength, 1);
+        in.take(&ringCount, 2);
+        char name[256];
+        in.take(name, nameLength);
+        if (!in.ok) {
+            break;
+        }
+        name[nameLength] = '\0';
+        zone.name = name;
+        if (zone.level < 1 || zone.level > 3) {
+            message = "Zone '" + zone.name + "': level must be 1, 2 or 3.";
+            return false;
+        }
+
+        zone.latMin = zone.lonMin = 1000;
+        zone.latMax = zone.lonMax = -1000;
+        for (uint16_t r = 0; r < ringCount && in.ok; r++) {
+            uint16_t vertexCount = 0;
+            in.take(&vertexCount, 2);
+            if (set.vertexCount + zone.lat.size() + vertexCount > (size_t)MAX_GEOFENCE_VERTICES) {
+                message = "Too many vertices (max " + String(MAX_GEOFENCE_VERTICES) + ").";
+                return false;
+            }
+            if (vertexCount < 4) {
+                message = "Zone '" + zone.name + "': ring with fewer than 3 corners.";
+                return false;
+            }
+            uint16_t first = zone.lat.size();
+            for (uint16_t v = 0; v < vertexCount && in.ok; v++) {
+                float lat = 0, lon = 0;
+                in.take(&lat, 4);
+                in.take(&lon, 4);
+                if (!(fabs(lat) <= 90 && fabs(lon) <= 180)) { // Also rejects NaN
+                    message = "Zone '" + zone.name + "': coordinate out of range.";
+                    return false;
+                }
+                zone.lat.push_back(lat);
+                zone.lon.push_back(lon);
+                zone.latMin = min(zone.latMin, lat);
+                zone.latMax = max(zone.latMax, lat);
+                zone.lonMin = min(zone.lonMin, lon);
+                zone.lonMax = max(zone.lonMax, lon);
+                if (v > 0) {
+                    zone.edges.push_back(first + v - 1);
+                }
+            }
+            // Edges only join consecutive vertices, so an open ring would leave a gap
+            // that the ray cast counts wrong on one side
+            if (in.ok && (zone.lat.back() != zone.lat[first] || zone.lon.back() != zone.lon[first])) {
+                message = "Zone '" + zone.name + "': ring " + String(r + 1) + " is not closed (last vertex must equal the first).";
+                return false;
+            }
+        }
+        if (!in.ok) {
+            break;
+        }
+        if (zone.edges.empty()) {
+            message = "Zone '" + zone.name + "' has no polygon.";
+            return false;
+        }
+        buildSlabs(zone);
+        zone.useSlabs = zone.edges.size() >= (size_t)GEOFENCE_SLAB_MIN_EDGES;
+        set.vertexCount += zone.lat.size();
+        set.zones.push_back(std::move(zone));
+    }
+    if (!in.ok || in.pos != length) {
+        message = "Zone file is truncated or malformed.";
+        return false;
+    }
+    message = String(set.zones.size()) + " zone(s), " + String(set.vertexCount) + " vertices.";
+    return true;
+}
+
+/**
+ * @brief Loads the stored zones at boot. Missing file or file system: no zones.
+ */
+void loadGeofences() {
+    File file = SPIFFS.open(GEOFENCE_FILE, "r");
+    if (!file) {
+        Serial.println(F("No polygon zones stored."));
+        return;
+    }
+    std::vector<uint8_t> data(file.size());
+    size_t read = file.read(data.data(), data.size());
+    file.close();
+
+    std::shared_ptr<GeofenceSet> set = std::make_shared<GeofenceSet>();
+    String message;
+    if (read != data.size() || !parseGeofences(data.data(), data.size(), *set, message)) {
+        Serial.print(F("Ignoring stored polygon zones: "));
+        Serial.println(message);
+        return;
+    }
+    activeGeofences = set;
+    Serial.print(F("Polygon zones loaded: "));
+    Serial.println(message);
+}
+
+/**
+ * @brief Validates and indexes an uploaded zone list and makes it current.
+ * The scan geometry picks it up on its next rebuild; storeImportedGeofences() writes it
+ * to flash from loop(), since this runs in a network callback.
+ * @param data Binary form (see geofence.h); an empty zone list clears all zones.
+ * @param length Size of data.
+ * @param message Output: summary or the reason for rejecting the upload.
+ * @return true if the zones were accepted.
+ */
+bool importGeofences(const uint8_t* data, size_t length, String& message) {
+    std::shared_ptr<GeofenceSet> set = std::make_shared<GeofenceSet>();
+    if (!parseGeofences(data, length, *set, message)) {
+        return false;
+    }
+    importedFile.assign(data, data + length);
+    importPending = true;
+    activeGeofences = set;
+    return true;
+}
+
+/**
+ * @brief Writes the last accepted upload to flash, if there is one. Call from loop().
+ */
+void storeImportedGeofences() {
+    if (!importPending) {
+        return;
+    }
+    importPending = false;
+    File file = SPIFFS.open(GEOFENCE_FILE, "w");
+    if (!file || file.write(importedFile.data(), importedFile.size()) != importedFile.size()) {
+        Serial.println(F("Polygon zones not stored (file system unavailable); active until reboot."));
+    }
+    if (file) {
+        file.close();
+    }
+    std::vector<uint8_t>().swap(importedFile); // Free the copy
+}
+
+/**
+ * @brief The current zone set (possibly empty, never null).
+ */
+GeofenceSetPtr currentGeofences() {
+    return activeGeofences;
+}
+
+/**
+ * @brief Finds the most critical zone containing a position.
+ * Per zone: bounding-box reject, then an even-odd ray cast over the edges in the
+ * position's latitude slab, or over all edges of a small zone.
+ * @param set Zones to test.
+ * @param latitude Position latitude (degrees).
+ * @param longitude Position longitude (degrees).
+ * @param zoneIndex Output: index of the matching zone, set only when the result is non-zero.
+ * @return Level (1-3) of the most critical containing zone, or 0.
+ */
+int geofenceLevel(const GeofenceSet& set, float latitude, float longitude, int& zoneIndex) {
+    int bestLevel = 0;
+    for (size_t z = 0; z < set.zones.size(); z++) {
+        const GeofenceZone& zone = set.zones[z];
+        if ((bestLevel != 0 && zone.level >= bestLevel) ||
+            latitude < zone.latMin || latitude > zone.latMax || longitude < zone.lonMin || longitude > zone.lonMax) {
+            continue;
+        }
+        uint16_t first = 0, end = zone.edges.size(); // Candidates: edges, or slabEdges entries with slabs
+        if (zone.useSlabs) {
+            int slabCount = zone.slabStart.size() - 1;
+            int k = constrain((int)((latitude - zone.latMin) / zone.slabHeight), 0, slabCount - 1);
+            first = zone.slabStart[k];
+            end = zone.slabStart[k + 1];
+        }
+        bool inside = false;
+        for (uint16_t i = first; i < end; i++) {
+            uint16_t v = zone.edges[zone.useSlabs ? zone.slabEdges[i] : i];
+            float lat1 = zone.lat[v], lat2 = zone.lat[v + 1];
+            if ((lat1 > latitude) != (lat2 > latitude)) {
+                float crossLon = zone.lon[v] + (latitude - lat1) * (zone.lon[v + 1] - zone.lon[v]) / (lat2 - lat1);
+                if (longitude < crossLon) {
+                    inside = !inside;
+                }
+            }
+        }
+        if (inside) {
+            bestLevel = zone.level;
+            zoneIndex = z;
+        }
+    }
+    return bestLevel;
+}
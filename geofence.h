@@ -0,0 +1,56 @@
+// geofence.h
+#ifndef GEOFENCE_H
+#define GEOFENCE_H
+
+#include <Arduino.h>
+#include <memory>
+#include <vector>
+
+// Polygon zones ("geofences"), each mapped to one alarm level. The web UI converts an
+// uploaded GeoJSON file into the compact binary form below; the device validates it,
+// builds the lookup index once and keeps it in /zones.bin.
+//
+// Binary form (little-endian):
+//   "FZN1", uint16 zoneCount, uint16 reserved
+//   per zone:  uint8 level (1-3), uint8 nameLength, uint16 ringCount, name bytes
+//   per ring:  uint16 vertexCount, vertexCount x (float32 latitude, float32 longitude)
+// Rings must be closed (last vertex == first); an open ring is rejected. Outer rings
+// and holes of all polygons of a zone are simply rings; the even-odd rule sorts them out.
+
+const int MAX_GEOFENCE_ZONES = 8;
+const int MAX_GEOFENCE_VERTICES = 512;     // Over all zones
+const int MAX_GEOFENCE_SLABS = 32;         // Per zone
+const int GEOFENCE_SLAB_MIN_EDGES = 16;    // Fewer edges are all tested: faster than the slab lookup (tools/host/bench_geofence.cpp)
+const size_t MAX_GEOFENCE_UPLOAD = 8 + MAX_GEOFENCE_ZONES * (4 + 32) + MAX_GEOFENCE_VERTICES * 10;
+
+struct GeofenceZone {
+    String name;
+    uint8_t level;
+    float latMin, latMax, lonMin, lonMax; // Bounding box
+    std::vector<float> lat, lon;          // Vertices of all rings, back to back
+    std::vector<uint16_t> edges;          // Edge i runs from vertex edges[i] to edges[i] + 1
+    // Edge buckets: the bounding box is cut into latitude slabs; the edges crossing
+    // slab k are edges[slabEdges[slabStart[k] .. slabStart[k + 1])].
+    float slabHeight;
+    std::vector<uint16_t> slabStart;
+    std::vector<uint16_t> slabEdges;
+    bool useSlabs;                        // At least GEOFENCE_SLAB_MIN_EDGES edges
+};
+
+struct GeofenceSet {
+    std::vector<GeofenceZone> zones;
+    size_t vertexCount;
+};
+
+// Immutable once built; the scan geometry keeps a reference, so a new upload can
+// replace the set while a scan still uses the old one.
+typedef std::shared_ptr<const GeofenceSet> GeofenceSetPtr;
+
+// Function declarations
+void loadGeofences();
+bool importGeofences(const uint8_t* data, size_t length, String& message);
+void storeImportedGeofences();
+GeofenceSetPtr currentGeofences();
+int geofenceLevel(const GeofenceSet& set, float latitude, float longitude, int& zoneIndex);
+
+#endif // GEOFENCE_H
@@ -9,21 +9,19 @@ AppSettings currentSettings;
 std::vector<FlightData> currentFlights;
 std::vector<ScanHistoryEntry> scanHistory;
 int currentOverallAlarmLevel = 0; // Initial state: No alarm
+volatile bool flightScanDue = false;
+uint32_t scanSequence = 0;
+volatile bool rebootRequested = false;
+volatile bool settingsChangePending = false;
 
 // Define AP_SSID and AP_PASSWORD here, and ONLY here
 const char* AP_SSID = "FlightAlarmSetup";
 const char* AP_PASSWORD = "password123";
 
 // Initialize global objects
-ESP8266WebServer server(HTTP_PORT);
+AsyncWebServer server(HTTP_PORT);
+AsyncEventSource eventStream("/events");
 DNSServer dnsServer;
-WiFiUDP ntpUdp;
-NTPClient timeClient(ntpUdp, "pool.ntp.org", UTC_OFFSET_SECONDS);
 Ticker flightScanTicker;
 Ticker audioTicker;
-
-// Audio playback variables (definitions)
-const uint8_t* currentAudioData = nullptr;
-size_t currentAudioDataSize = 0;
-size_t audioSampleIndex = 0;
-unsigned long lastAudioSampleTime = 0;
+Ticker ledTicker;
@@ -4,14 +4,13 @@
 
 // ============================================================================
 // 1. Necessary Includes at the Top
-//    (Order matters for some dependencies, e.g., NTPClient needs WiFiUdp)
+//    (Order matters for some dependencies, e.g., ESPAsyncTCP before ESPAsyncWebServer)
 // ============================================================================
 #include <Arduino.h>
 #include <vector>             // For std::vector
-#include <ESP8266WebServer.h> // For ESP8266WebServer
+#include <ESPAsyncTCP.h>       // For ESPAsyncWebServer
+#include <ESPAsyncWebServer.h> // For AsyncWebServer, AsyncEventSource
 #include <DNSServer.h>        // For DNSServer
-#include <WiFiUdp.h>          // For WiFiUDP (NTPClient depends on this)
-#include <NTPClient.h>        // For NTPClient
 #include <Ticker.h>           // For Ticker
 
 
@@ -20,6 +19,42 @@
 //    Define these BEFORE any variables of their types are declared.
 // ============================================================================
 
+// What an aircraft inside a monitored site's radii triggers
+enum SiteAlarmPolicy : uint8_t {
+    SITE_ALARM_SOUND = 0, // LED and sound (sound still subject to soundWarning)
+    SITE_ALARM_LED = 1,   // LED only
+    SITE_ALARM_NONE = 2   // Listed on the dashboard, no alarm
+};
+
+// An additional monitored location (the primary one is latitude/longitude in AppSettings)
+struct MonitoredSite {
+    String name;
+    float latitude;
+    float longitude;
+    float radiusLevel1;
+    float radiusLevel2;
+    float radiusLevel3;
+    SiteAlarmPolicy alarmPolicy;
+};
+
+// Where an alarm level's sound comes from
+enum AlarmSoundSource : uint8_t {
+    ALARM_SOUND_TONE = 0, // Synthesized beep pattern (tone_synth.cpp)
+    ALARM_SOUND_CLIP = 1  // Uploaded clip if present, else the built-in clip
+};
+
+// Sound for one alarm level. A tone is 'beeps' beeps of beepMs each, separated by
+// gapMs of silence; within each beep the pitch sweeps linearly from startHz to endHz.
+struct AlarmSound {
+    AlarmSoundSource source;
+    uint16_t startHz;
+    uint16_t endHz;   // Equal to startHz for a steady tone
+    uint16_t beepMs;
+    uint16_t gapMs;
+    uint8_t beeps;
+    uint8_t volume;   // Percent
+};
+
 // Structure to hold all configurable settings
 struct AppSettings {
     String ssid;
@@ -34,6 +69,12 @@ struct AppSettings {
     int noFlightScanFreq;
     int flightPresentScanFreq;
     bool soundWarning;
+    std::vector<MonitoredSite> sites; // Additional sites, at most MAX_EXTRA_SITES
+    float altitudeCeiling[4];         // Per-level ceiling (m) applied to every site and zone; index 1-3, 0 = none
+    float alarmHysteresisPercent;     // Exit band: a level is left only beyond its radius/ceiling plus this much
+    int alarmDwellSec;                // Minimum time a confirmed level is held before stepping down
+    AlarmSound alarmSounds[4];        // Index 1-3 = alarm level
+    float alarmEntryBandPercent;      // Entry band: a level is entered only this much inside its radius/ceiling
 };
 
 // Structure to hold flight data
@@ -49,14 +90,17 @@ struct FlightData {
     String origin_country;
     float distance_km;
     int proximity_level;   // 0=none, 1=Level1, 2=Level2, 3=Level3
+    String site;           // Name of the monitored site proximity_level/distance_km refer to
+    SiteAlarmPolicy alarm_policy; // That site's alarm policy
     String destination;
     String source;
     String international_domestic;
+    uint32_t updated_seq;  // Scan sequence at which this aircraft was added or last changed
 };
 
 // Structure for scan history entry
 struct ScanHistoryEntry {
-    String timestamp;
+    uint32_t timestamp;   // UTC epoch seconds (clock.h); 0 if the clock was not yet set
     int level1;
     int level2;
     int level3;
@@ -75,19 +119,17 @@ extern AppSettings currentSettings;
 extern std::vector<FlightData> currentFlights;
 extern std::vector<ScanHistoryEntry> scanHistory;
 extern int currentOverallAlarmLevel;
+extern volatile bool flightScanDue; // Set by flightScanTicker, consumed in loop()
+extern uint32_t scanSequence;       // Incremented for every completed scan; 0 = no scan yet
+extern volatile bool rebootRequested; // Set by /rebootESP, handled in loop() once the reply is out
+extern volatile bool settingsChangePending; // Set by the web handlers; loop() stores and applies the change between scans
 
-extern ESP8266WebServer server;
+extern AsyncWebServer server;
+extern AsyncEventSource eventStream;
 extern DNSServer dnsServer;
-extern WiFiUDP ntpUdp;
-extern NTPClient timeClient;
 extern Ticker flightScanTicker;
-extern Ticker audioTicker;
-
-// Audio playback variables (extern)
-extern const uint8_t* currentAudioData;
-extern size_t currentAudioDataSize;
-extern size_t audioSampleIndex;
-extern unsigned long lastAudioSampleTime;
+extern Ticker audioTicker; // Refills the audio engine's sample buffers
+extern Ticker ledTicker;   // Steps the blinking LED patterns
 
 
 // ============================================================================
@@ -96,15 +138,17 @@ extern unsigned long lastAudioSampleTime;
 // ============================================================================
 
 const int HTTP_PORT = 80;
-const int SPEAKER_PIN = D3; // GPIO0 on Wemos D1 Mini (D3 pin) for PWM audio
+const int SPEAKER_PIN = D3; // GPIO0 on Wemos D1 Mini (D3 pin) for sigma-delta audio
 const int LED_BUILTIN_PIN = D4; // GPIO2 on Wemos D1 Mini (D4 pin) for built-in LED
 
 // Correct declarations for AP_SSID and AP_PASSWORD (NO INITIALIZER HERE)
 extern const char* AP_SSID;
 extern const char* AP_PASSWORD;
 
-const long UTC_OFFSET_SECONDS = 5.5 * 3600; // IST is UTC+5:30
 const int MAX_SCAN_HISTORY = 10;
-const unsigned long AUDIO_SAMPLE_INTERVAL_US = 1000000 / 8000; // 8kHz sample rate = 125 us per sample
+const int MAX_EXTRA_SITES = 15;        // Monitored sites besides the primary location
+const char* const PRIMARY_SITE_NAME = "Home";
+const int MAX_EVENT_STREAM_CLIENTS = 3; // Open /events connections; leaves sockets free for normal requests
+const uint32_t AUDIO_SAMPLE_RATE = 8000; // Hz; the clips are 8-bit unsigned at this rate
 
 #endif // GLOBALS_H
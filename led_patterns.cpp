@@ -0,0 +1,121 @@
+// led_patterns.cpp
+// Drives the indicator LEDs from one Ticker. Each channel keeps a bit mask of active
+// layers; the lowest set bit picks the pattern, and the Ticker steps every blinking
+// channel through its bit sequence. Everything is fixed-size and writes a pin only
+// when its state changes. The Ticker is detached while no channel blinks.
+#include "led_patterns.h"
+
+struct LedChannel {
+    uint8_t pin;
+    bool activeLow;
+};
+
+// The Wemos D1 Mini's built-in LED (GPIO2) lights when the pin is low
+static const LedChannel LED_CHANNELS[] = {
+    { (uint8_t)LED_BUILTIN_PIN, true },
+};
+static const int LED_CHANNEL_COUNT = sizeof(LED_CHANNELS) / sizeof(LED_CHANNELS[0]);
+
+static const LedPattern LAYER_PATTERNS[LED_LAYER_COUNT] = {
+    { 0x1, 1 },    // Error: solid on
+    { 0x1, 2 },    // Level 1: 100 ms on, 100 ms off
+    { 0x7, 6 },    // Level 2: 300 ms on, 300 ms off
+    { 0x3FF, 20 }, // Level 3: 1 s on, 1 s off
+};
+
+struct LedChannelState {
+    uint8_t layers;   // Bit n set = LedLayer n active
+    uint8_t position; // Step within the pattern
+    int8_t lit;       // Pin state last written: 1 on, 0 off, -1 not yet written
+};
+
+static LedChannelState channelStates[LED_CHANNEL_COUNT];
+
+/**
+ * @brief Sets a channel's LED, touching the pin only if the state changes.
+ */
+static void writeLed(int channel, bool on) {
+    LedChannelState& state = channelStates[channel];
+    if (state.lit == (int8_t)on) {
+        return;
+    }
+    state.lit = on;
+    digitalWrite(LED_CHANNELS[channel].pin, on != LED_CHANNELS[channel].activeLow ? HIGH : LOW);
+}
+
+/**
+ * @brief Pattern of a channel's highest-priority active layer, or nullptr if none is active.
+ */
+static const LedPattern* topPattern(const LedChannelState& state) {
+    return state.layers ? &LAYER_PATTERNS[__builtin_ctz(state.layers)] : nullptr;
+}
+
+/**
+ * @brief Shows the current step of a channel's pattern.
+ * @return true if the pattern blinks, i.e. the channel needs the Ticker.
+ */
+static bool showStep(int channel) {
+    const LedPattern* pattern = topPattern(channelStates[channel]);
+    if (!pattern) {
+        writeLed(channel, false);
+        return false;
+    }
+    writeLed(channel, (pattern->bits >> channelStates[channel].position) & 1);
+    return pattern->length > 1;
+}
+
+/**
+ * @brief ledTicker callback: advances every blinking channel by one step.
+ */
+static void onLedStep() {
+    bool blinking = false;
+    for (int i = 0; i < LED_CHANNEL_COUNT; i++) {
+        LedChannelState& state = channelStates[i];
+        const LedPattern* pattern = topPattern(state);
+        if (pattern && ++state.position >= pattern->length) {
+            state.position = 0;
+        }
+        blinking |= showStep(i);
+    }
+    if (!blinking) {
+        ledTicker.detach();
+    }
+}
+
+/**
+ * @brief Configures the LED pins, all off. Call once from setup().
+ */
+void ledBegin() {
+    for (int i = 0; i < LED_CHANNEL_COUNT; i++) {
+        pinMode(LED_CHANNELS[i].pin, OUTPUT);
+        channelStates[i] = { 0, 0, -1 };
+        writeLed(i, false);
+    }
+}
+
+/**
+ * @brief Turns a layer on or off for a channel. A new top pattern starts from its
+ * first step at once; the call never blocks.
+ * @param channel LED channel (LED_CHANNEL_BUILTIN).
+ * @param layer Reason to light the LED.
+ * @param active true to show the layer's pattern (when nothing more important is active).
+ */
+void ledSetLayer(int channel, LedLayer layer, bool active) {
+    if (channel < 0 || channel >= LED_CHANNEL_COUNT || layer >= LED_LAYER_COUNT) {
+        return;
+    }
+    LedChannelState& state = channelStates[channel];
+    const LedPattern* before = topPattern(state);
+    if (active) {
+        state.layers |= 1 << layer;
+    } else {
+        state.layers &= ~(1 << layer);
+    }
+    if (topPattern(state) == before) {
+        return;
+    }
+    state.position = 0;
+    if (showStep(channel)) {
+        ledTicker.attach_ms(LED_STEP_MS, onLedStep); // (Re)armed now, so the first step lasts a full LED_STEP_MS
+    }
+}
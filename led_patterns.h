@@ -0,0 +1,31 @@
+// led_patterns.h
+#ifndef LED_PATTERNS_H
+#define LED_PATTERNS_H
+
+#include <Arduino.h>
+#include "globals.h" // For LED_BUILTIN_PIN, ledTicker
+
+// Reasons to light an LED, highest priority first: a channel shows the pattern of its
+// highest active layer, so an error overrides any alarm level.
+enum LedLayer : uint8_t {
+    LED_LAYER_ERROR,  // Solid on: WiFi down or the last scan failed
+    LED_LAYER_LEVEL1, // Fast blink
+    LED_LAYER_LEVEL2, // Medium blink
+    LED_LAYER_LEVEL3, // Slow blink
+    LED_LAYER_COUNT
+};
+
+// Bit n is the LED state during step n (LSB first); the sequence repeats every 'length' steps
+struct LedPattern {
+    uint32_t bits;
+    uint8_t length; // 1-32; 1 = steady
+};
+
+const uint32_t LED_STEP_MS = 100; // One pattern bit
+const int LED_CHANNEL_BUILTIN = 0; // Index into the channel table in led_patterns.cpp
+
+// Function declarations
+void ledBegin();
+void ledSetLayer(int channel, LedLayer layer, bool active);
+
+#endif // LED_PATTERNS_H
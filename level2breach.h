@@ -1,499 +0,0 @@
-#ifndef level2Breach_h
-#define level2Breach_h
-
-#include <Arduino.h> 
-
-const uint8_t audioData_level2breach[] PROGMEM = {
-0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7e, 0x80, 0x7e, 0x80, 0x7e, 0x80, 0x7f,
-0x80, 0x7f, 0x80, 0x7e, 0x80, 0x7e, 0x80, 0x7f, 0x7f, 0x80, 0x7e, 0x7f, 0x80, 0x7e, 0x80, 0x7e,
-0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f,
-0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e,
-0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80,
-0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80,
-0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7e, 0x80, 0x7e, 0x7f,
-0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
-0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x80, 0x7e, 0x80,
-0x7e, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f,
-0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e,
-0x7f, 0x7d, 0x7e, 0x7d, 0x7d, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7b, 0x7c, 0x7b, 0x7c, 0x7b, 0x7c,
-0x7c, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x83, 0x83, 0x85, 0x85, 0x87, 0x88, 0x89, 0x89, 0x88, 0x88,
-0x87, 0x85, 0x87, 0x86, 0x87, 0x88, 0x86, 0x86, 0x83, 0x81, 0x7f, 0x7e, 0x7c, 0x7c, 0x7b, 0x7b,
-0x7b, 0x7a, 0x77, 0x76, 0x74, 0x73, 0x71, 0x70, 0x70, 0x6e, 0x6f, 0x6f, 0x70, 0x70, 0x73, 0x74,
-0x76, 0x7a, 0x7c, 0x7e, 0x80, 0x82, 0x84, 0x86, 0x88, 0x8a, 0x8a, 0x8d, 0x8c, 0x8d, 0x8b, 0x8b,
-0x88, 0x88, 0x85, 0x85, 0x82, 0x82, 0x80, 0x80, 0x7d, 0x7d, 0x7b, 0x7b, 0x79, 0x7a, 0x79, 0x7b,
-0x7c, 0x7e, 0x7f, 0x82, 0x83, 0x84, 0x87, 0x87, 0x8a, 0x8c, 0x8c, 0x8f, 0x8e, 0x8f, 0x90, 0x8f,
-0x8d, 0x8d, 0x8a, 0x88, 0x85, 0x83, 0x7f, 0x7d, 0x7a, 0x76, 0x74, 0x71, 0x70, 0x6e, 0x6c, 0x6b,
-0x68, 0x68, 0x67, 0x65, 0x66, 0x66, 0x69, 0x6b, 0x6d, 0x70, 0x72, 0x76, 0x79, 0x7d, 0x7f, 0x84,
-0x87, 0x89, 0x8d, 0x8e, 0x91, 0x92, 0x92, 0x92, 0x90, 0x90, 0x8d, 0x8c, 0x8a, 0x87, 0x85, 0x82,
-0x80, 0x7d, 0x7b, 0x7a, 0x77, 0x78, 0x76, 0x78, 0x79, 0x7b, 0x7c, 0x80, 0x81, 0x84, 0x86, 0x89,
-0x8b, 0x8d, 0x8e, 0x90, 0x91, 0x90, 0x91, 0x8e, 0x8e, 0x8d, 0x8a, 0x89, 0x85, 0x83, 0x80, 0x7b,
-0x78, 0x75, 0x71, 0x70, 0x6f, 0x6c, 0x6c, 0x68, 0x68, 0x65, 0x65, 0x64, 0x65, 0x67, 0x68, 0x6b,
-0x6d, 0x72, 0x73, 0x78, 0x7a, 0x7e, 0x81, 0x84, 0x89, 0x8c, 0x90, 0x92, 0x94, 0x93, 0x95, 0x91,
-0x91, 0x8e, 0x8d, 0x8a, 0x87, 0x86, 0x83, 0x81, 0x7e, 0x7c, 0x7a, 0x77, 0x77, 0x75, 0x77, 0x77,
-0x7b, 0x7c, 0x80, 0x82, 0x85, 0x86, 0x89, 0x8b, 0x8d, 0x8e, 0x91, 0x91, 0x92, 0x91, 0x8f, 0x8e,
-0x8c, 0x8a, 0x87, 0x84, 0x82, 0x7f, 0x7b, 0x78, 0x75, 0x72, 0x70, 0x6f, 0x6e, 0x6c, 0x69, 0x68,
-0x66, 0x66, 0x64, 0x66, 0x67, 0x69, 0x6b, 0x6e, 0x72, 0x73, 0x78, 0x7a, 0x7e, 0x82, 0x86, 0x8a,
-0x8e, 0x92, 0x94, 0x96, 0x96, 0x96, 0x93, 0x91, 0x8e, 0x8b, 0x88, 0x86, 0x82, 0x81, 0x7e, 0x7a,
-0x79, 0x76, 0x76, 0x74, 0x76, 0x76, 0x79, 0x7b, 0x7f, 0x81, 0x85, 0x86, 0x89, 0x8b, 0x8c, 0x8f,
-0x90, 0x91, 0x92, 0x92, 0x90, 0x8f, 0x8c, 0x8b, 0x88, 0x83, 0x81, 0x7d, 0x7b, 0x78, 0x74, 0x73,
-0x70, 0x70, 0x6e, 0x6e, 0x6b, 0x6b, 0x68, 0x68, 0x67, 0x66, 0x68, 0x69, 0x6c, 0x6f, 0x71, 0x75,
-0x77, 0x7a, 0x7d, 0x81, 0x83, 0x89, 0x8c, 0x90, 0x93, 0x94, 0x96, 0x96, 0x94, 0x93, 0x8f, 0x8d,
-0x8a, 0x86, 0x84, 0x81, 0x7e, 0x7b, 0x79, 0x76, 0x74, 0x74, 0x73, 0x76, 0x78, 0x7a, 0x7f, 0x82,
-0x86, 0x88, 0x8b, 0x8c, 0x8f, 0x90, 0x90, 0x92, 0x92, 0x91, 0x90, 0x8d, 0x8b, 0x86, 0x84, 0x7f,
-0x7e, 0x7a, 0x78, 0x76, 0x74, 0x72, 0x70, 0x6f, 0x6c, 0x6c, 0x69, 0x65, 0x64, 0x62, 0x62, 0x61,
-0x66, 0x69, 0x6c, 0x73, 0x77, 0x7b, 0x80, 0x83, 0x88, 0x8c, 0x92, 0x96, 0x9a, 0x9a, 0x9b, 0x98,
-0x95, 0x90, 0x8a, 0x87, 0x83, 0x81, 0x7e, 0x7a, 0x79, 0x75, 0x72, 0x71, 0x72, 0x73, 0x78, 0x7d,
-0x82, 0x88, 0x8b, 0x8f, 0x8e, 0x8f, 0x90, 0x92, 0x92, 0x95, 0x94, 0x93, 0x8f, 0x8a, 0x84, 0x82,
-0x7e, 0x7d, 0x7d, 0x7c, 0x79, 0x77, 0x72, 0x70, 0x6c, 0x6c, 0x6a, 0x69, 0x65, 0x62, 0x5e, 0x5b,
-0x57, 0x59, 0x61, 0x63, 0x70, 0x78, 0x80, 0x87, 0x8a, 0x91, 0x96, 0x9a, 0x9f, 0xa3, 0xa2, 0xa0,
-0x9c, 0x94, 0x8c, 0x83, 0x7c, 0x76, 0x74, 0x71, 0x71, 0x6f, 0x6f, 0x6f, 0x71, 0x76, 0x7c, 0x85,
-0x8c, 0x92, 0x93, 0x94, 0x92, 0x91, 0x91, 0x92, 0x94, 0x93, 0x92, 0x8e, 0x88, 0x83, 0x81, 0x7f,
-0x81, 0x84, 0x84, 0x85, 0x83, 0x81, 0x7b, 0x77, 0x75, 0x6f, 0x6c, 0x67, 0x61, 0x57, 0x4f, 0x45,
-0x42, 0x40, 0x4c, 0x63, 0x74, 0x89, 0x99, 0xa0, 0xa1, 0xa5, 0xa9, 0xa8, 0xa6, 0xa6, 0x99, 0x8a,
-0x7f, 0x72, 0x69, 0x65, 0x69, 0x67, 0x6a, 0x6e, 0x72, 0x77, 0x85, 0x8f, 0x96, 0x9b, 0x9c, 0x95,
-0x8e, 0x8c, 0x87, 0x86, 0x87, 0x87, 0x82, 0x84, 0x85, 0x87, 0x8b, 0x8f, 0x8f, 0x8e, 0x8c, 0x8a,
-0x86, 0x88, 0x88, 0x84, 0x7d, 0x76, 0x6c, 0x64, 0x61, 0x5d, 0x58, 0x51, 0x44, 0x3e, 0x3a, 0x46,
-0x67, 0x81, 0x98, 0xa9, 0xac, 0xa4, 0xa3, 0xa5, 0xa3, 0x9d, 0x98, 0x85, 0x72, 0x66, 0x65, 0x67,
-0x6c, 0x78, 0x77, 0x78, 0x7b, 0x83, 0x8b, 0x99, 0x9f, 0x9c, 0x93, 0x87, 0x7b, 0x77, 0x7a, 0x80,
-0x80, 0x81, 0x80, 0x81, 0x87, 0x8f, 0x97, 0x9b, 0x99, 0x94, 0x8e, 0x8a, 0x8b, 0x8a, 0x87, 0x7f,
-0x79, 0x70, 0x6a, 0x68, 0x65, 0x60, 0x5c, 0x57, 0x52, 0x4e, 0x4f, 0x53, 0x61, 0x7d, 0x8f, 0x97,
-0x9e, 0x9b, 0x95, 0x91, 0x92, 0x8e, 0x7f, 0x7b, 0x73, 0x6e, 0x72, 0x7d, 0x83, 0x84, 0x87, 0x86,
-0x84, 0x8b, 0x90, 0x90, 0x8e, 0x8c, 0x84, 0x7e, 0x7e, 0x7e, 0x7c, 0x7f, 0x82, 0x85, 0x88, 0x8d,
-0x90, 0x8d, 0x90, 0x8e, 0x8c, 0x8b, 0x8b, 0x89, 0x86, 0x86, 0x82, 0x7c, 0x7a, 0x74, 0x6a, 0x64,
-0x5f, 0x59, 0x5a, 0x59, 0x55, 0x51, 0x53, 0x67, 0x83, 0x92, 0x9f, 0x9e, 0x94, 0x8e, 0x8c, 0x8f,
-0x83, 0x7b, 0x72, 0x6a, 0x6b, 0x77, 0x83, 0x89, 0x88, 0x88, 0x84, 0x88, 0x90, 0x96, 0x92, 0x8c,
-0x83, 0x7c, 0x79, 0x82, 0x85, 0x87, 0x87, 0x88, 0x88, 0x8c, 0x90, 0x91, 0x8d, 0x8b, 0x87, 0x88,
-0x8a, 0x8d, 0x8a, 0x85, 0x7e, 0x75, 0x71, 0x6d, 0x6a, 0x64, 0x5f, 0x5a, 0x59, 0x56, 0x55, 0x57,
-0x61, 0x7c, 0x8e, 0x98, 0x9e, 0x9c, 0x92, 0x8e, 0x8d, 0x88, 0x7b, 0x74, 0x6c, 0x6b, 0x71, 0x7c,
-0x82, 0x83, 0x86, 0x85, 0x88, 0x8b, 0x90, 0x8e, 0x8c, 0x88, 0x87, 0x83, 0x85, 0x85, 0x85, 0x85,
-0x8a, 0x8b, 0x8b, 0x8c, 0x8c, 0x89, 0x8a, 0x8c, 0x8a, 0x8a, 0x89, 0x86, 0x7f, 0x7a, 0x75, 0x6e,
-0x69, 0x62, 0x60, 0x5b, 0x59, 0x54, 0x54, 0x53, 0x65, 0x7d, 0x8d, 0x9a, 0x9e, 0x98, 0x94, 0x90,
-0x8e, 0x86, 0x7b, 0x72, 0x6d, 0x6b, 0x74, 0x7e, 0x82, 0x83, 0x83, 0x85, 0x87, 0x90, 0x93, 0x92,
-0x8c, 0x88, 0x82, 0x81, 0x84, 0x87, 0x87, 0x87, 0x89, 0x89, 0x89, 0x8d, 0x8c, 0x8a, 0x88, 0x88,
-0x86, 0x86, 0x86, 0x82, 0x79, 0x74, 0x6f, 0x6b, 0x66, 0x65, 0x5e, 0x5a, 0x55, 0x55, 0x59, 0x61,
-0x77, 0x86, 0x91, 0x97, 0x9a, 0x95, 0x93, 0x90, 0x8a, 0x82, 0x7a, 0x76, 0x71, 0x73, 0x77, 0x7b,
-0x7c, 0x7f, 0x83, 0x85, 0x8b, 0x8f, 0x92, 0x91, 0x90, 0x8f, 0x8c, 0x8a, 0x89, 0x85, 0x86, 0x87,
-0x8a, 0x89, 0x8a, 0x8a, 0x87, 0x87, 0x85, 0x84, 0x81, 0x80, 0x7c, 0x76, 0x73, 0x71, 0x6d, 0x66,
-0x63, 0x5d, 0x59, 0x54, 0x54, 0x5e, 0x6e, 0x7c, 0x89, 0x93, 0x94, 0x95, 0x93, 0x94, 0x90, 0x8a,
-0x83, 0x7c, 0x74, 0x71, 0x75, 0x79, 0x7c, 0x7d, 0x80, 0x81, 0x85, 0x8d, 0x91, 0x95, 0x94, 0x91,
-0x8c, 0x89, 0x8a, 0x88, 0x88, 0x87, 0x87, 0x86, 0x87, 0x88, 0x87, 0x86, 0x84, 0x80, 0x7f, 0x7c,
-0x7b, 0x78, 0x75, 0x71, 0x6f, 0x6b, 0x68, 0x64, 0x62, 0x60, 0x63, 0x69, 0x6f, 0x77, 0x7e, 0x81,
-0x85, 0x86, 0x89, 0x89, 0x8a, 0x88, 0x87, 0x83, 0x83, 0x82, 0x84, 0x82, 0x83, 0x82, 0x82, 0x82,
-0x83, 0x84, 0x84, 0x86, 0x85, 0x86, 0x86, 0x86, 0x84, 0x85, 0x85, 0x87, 0x87, 0x89, 0x88, 0x88,
-0x85, 0x83, 0x7f, 0x7e, 0x7d, 0x7e, 0x7f, 0x7d, 0x7d, 0x7a, 0x79, 0x76, 0x74, 0x73, 0x72, 0x73,
-0x72, 0x72, 0x74, 0x74, 0x74, 0x77, 0x77, 0x77, 0x7a, 0x7b, 0x7e, 0x80, 0x80, 0x82, 0x82, 0x83,
-0x83, 0x84, 0x85, 0x86, 0x87, 0x86, 0x86, 0x85, 0x85, 0x85, 0x84, 0x85, 0x83, 0x84, 0x83, 0x84,
-0x84, 0x83, 0x85, 0x84, 0x85, 0x85, 0x83, 0x84, 0x82, 0x82, 0x80, 0x80, 0x7f, 0x7f, 0x7d, 0x7d,
-0x7c, 0x7c, 0x7b, 0x7a, 0x7a, 0x79, 0x78, 0x78, 0x77, 0x79, 0x78, 0x79, 0x78, 0x7a, 0x7a, 0x7a,
-0x7b, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x82, 0x81, 0x83, 0x82, 0x83,
-0x83, 0x84, 0x83, 0x84, 0x84, 0x83, 0x84, 0x83, 0x84, 0x82, 0x82, 0x83, 0x82, 0x82, 0x81, 0x82,
-0x80, 0x81, 0x81, 0x80, 0x7f, 0x7d, 0x7e, 0x7e, 0x7c, 0x7e, 0x7d, 0x7d, 0x7d, 0x7c, 0x7d, 0x7c,
-0x7d, 0x7b, 0x7c, 0x7b, 0x7c, 0x7b, 0x7c, 0x7b, 0x7c, 0x7c, 0x7b, 0x7c, 0x7b, 0x7d, 0x7c, 0x7e,
-0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x82, 0x82, 0x82, 0x81, 0x83, 0x81, 0x83,
-0x84, 0x82, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x81, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7e,
-0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7e, 0x7d, 0x7e, 0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c,
-0x7d, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7b, 0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x80, 0x7f, 0x7e,
-0x80, 0x7f, 0x80, 0x7f, 0x81, 0x80, 0x81, 0x81, 0x82, 0x82, 0x83, 0x82, 0x83, 0x82, 0x81, 0x81,
-0x81, 0x81, 0x81, 0x81, 0x82, 0x80, 0x81, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
-0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7b, 0x7d, 0x7d,
-0x7c, 0x7d, 0x7c, 0x7e, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x82, 0x82,
-0x80, 0x82, 0x81, 0x80, 0x82, 0x82, 0x81, 0x83, 0x83, 0x82, 0x82, 0x81, 0x82, 0x7f, 0x80, 0x81,
-0x80, 0x80, 0x7f, 0x80, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7d, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7c,
-0x7b, 0x7d, 0x7b, 0x7c, 0x7b, 0x7c, 0x7c, 0x7d, 0x7b, 0x7d, 0x7c, 0x7e, 0x7e, 0x7f, 0x7f, 0x81,
-0x80, 0x82, 0x83, 0x82, 0x83, 0x82, 0x81, 0x83, 0x82, 0x82, 0x83, 0x82, 0x83, 0x82, 0x82, 0x81,
-0x82, 0x81, 0x82, 0x81, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x7d, 0x80, 0x7f, 0x7e, 0x7e, 0x7c,
-0x7d, 0x7b, 0x7a, 0x7b, 0x7a, 0x79, 0x7a, 0x7a, 0x79, 0x7c, 0x79, 0x7a, 0x79, 0x7b, 0x7a, 0x7d,
-0x7b, 0x7f, 0x81, 0x82, 0x83, 0x85, 0x83, 0x83, 0x84, 0x82, 0x82, 0x83, 0x81, 0x83, 0x83, 0x84,
-0x83, 0x81, 0x83, 0x81, 0x7f, 0x83, 0x83, 0x85, 0x87, 0x84, 0x83, 0x82, 0x7f, 0x7d, 0x7d, 0x7e,
-0x7d, 0x7f, 0x7d, 0x7d, 0x7e, 0x7b, 0x7b, 0x77, 0x77, 0x75, 0x75, 0x74, 0x73, 0x74, 0x76, 0x79,
-0x79, 0x7e, 0x7f, 0x81, 0x83, 0x82, 0x83, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x86, 0x87, 0x84,
-0x82, 0x7f, 0x7e, 0x7b, 0x7d, 0x7d, 0x7f, 0x81, 0x84, 0x85, 0x87, 0x88, 0x87, 0x86, 0x85, 0x86,
-0x83, 0x85, 0x83, 0x84, 0x83, 0x82, 0x81, 0x7e, 0x7d, 0x79, 0x76, 0x73, 0x70, 0x6e, 0x6a, 0x69,
-0x6a, 0x67, 0x6b, 0x72, 0x73, 0x7c, 0x83, 0x85, 0x8b, 0x8c, 0x8c, 0x8a, 0x8a, 0x88, 0x87, 0x86,
-0x88, 0x87, 0x86, 0x86, 0x81, 0x7f, 0x7b, 0x78, 0x75, 0x77, 0x77, 0x7b, 0x80, 0x84, 0x89, 0x8a,
-0x8e, 0x8c, 0x8b, 0x8a, 0x88, 0x86, 0x88, 0x86, 0x87, 0x86, 0x87, 0x83, 0x81, 0x7c, 0x78, 0x74,
-0x6f, 0x6c, 0x67, 0x66, 0x62, 0x65, 0x62, 0x68, 0x6e, 0x72, 0x7c, 0x84, 0x89, 0x90, 0x92, 0x94,
-0x90, 0x8f, 0x8d, 0x89, 0x88, 0x87, 0x86, 0x84, 0x84, 0x7e, 0x7c, 0x78, 0x72, 0x71, 0x70, 0x73,
-0x75, 0x7d, 0x82, 0x88, 0x8e, 0x93, 0x93, 0x94, 0x93, 0x90, 0x8e, 0x8c, 0x8c, 0x8a, 0x89, 0x87,
-0x84, 0x80, 0x7c, 0x77, 0x72, 0x6b, 0x68, 0x63, 0x60, 0x5d, 0x5e, 0x5d, 0x60, 0x6a, 0x6e, 0x77,
-0x83, 0x8a, 0x91, 0x95, 0x99, 0x96, 0x95, 0x95, 0x8f, 0x8b, 0x8b, 0x87, 0x84, 0x82, 0x7f, 0x78,
-0x75, 0x71, 0x6c, 0x6c, 0x6e, 0x6f, 0x76, 0x7f, 0x84, 0x8c, 0x91, 0x95, 0x95, 0x96, 0x94, 0x91,
-0x90, 0x8f, 0x8c, 0x8c, 0x8b, 0x86, 0x83, 0x7e, 0x78, 0x72, 0x6d, 0x68, 0x65, 0x62, 0x5e, 0x5d,
-0x5e, 0x5d, 0x64, 0x6b, 0x70, 0x7c, 0x86, 0x8d, 0x94, 0x98, 0x9a, 0x98, 0x98, 0x94, 0x8f, 0x8c,
-0x8a, 0x85, 0x83, 0x80, 0x7b, 0x75, 0x72, 0x6c, 0x6a, 0x6a, 0x6d, 0x6f, 0x79, 0x81, 0x88, 0x90,
-0x94, 0x97, 0x98, 0x98, 0x95, 0x93, 0x92, 0x8f, 0x8d, 0x8d, 0x8a, 0x85, 0x81, 0x7c, 0x75, 0x71,
-0x6b, 0x67, 0x64, 0x61, 0x5f, 0x5e, 0x5e, 0x5f, 0x61, 0x6b, 0x6f, 0x79, 0x84, 0x8b, 0x91, 0x97,
-0x9a, 0x99, 0x98, 0x96, 0x91, 0x8f, 0x8c, 0x89, 0x84, 0x83, 0x7c, 0x76, 0x71, 0x6c, 0x68, 0x69,
-0x6b, 0x6f, 0x76, 0x7f, 0x85, 0x8d, 0x93, 0x97, 0x97, 0x99, 0x96, 0x95, 0x93, 0x92, 0x8e, 0x8d,
-0x8b, 0x87, 0x82, 0x7c, 0x77, 0x70, 0x6c, 0x66, 0x64, 0x61, 0x60, 0x5d, 0x5f, 0x5f, 0x61, 0x69,
-0x6f, 0x76, 0x82, 0x87, 0x91, 0x96, 0x99, 0x9a, 0x97, 0x98, 0x92, 0x90, 0x8f, 0x8a, 0x86, 0x84,
-0x7d, 0x77, 0x73, 0x6b, 0x69, 0x68, 0x6a, 0x6e, 0x74, 0x7d, 0x82, 0x8a, 0x90, 0x94, 0x94, 0x98,
-0x95, 0x95, 0x95, 0x93, 0x92, 0x90, 0x8e, 0x87, 0x84, 0x7c, 0x75, 0x70, 0x6d, 0x68, 0x66, 0x65,
-0x62, 0x61, 0x60, 0x60, 0x5e, 0x67, 0x69, 0x70, 0x7d, 0x81, 0x8c, 0x91, 0x96, 0x97, 0x95, 0x97,
-0x94, 0x92, 0x93, 0x90, 0x8b, 0x88, 0x83, 0x7a, 0x77, 0x6e, 0x6a, 0x67, 0x69, 0x6b, 0x71, 0x78,
-0x80, 0x85, 0x8c, 0x91, 0x92, 0x94, 0x96, 0x94, 0x96, 0x95, 0x96, 0x94, 0x91, 0x8d, 0x86, 0x83,
-0x7a, 0x75, 0x71, 0x6d, 0x6a, 0x6a, 0x67, 0x66, 0x63, 0x62, 0x62, 0x5e, 0x64, 0x69, 0x6b, 0x77,
-0x7d, 0x84, 0x8c, 0x8f, 0x94, 0x92, 0x94, 0x94, 0x93, 0x95, 0x93, 0x90, 0x8d, 0x88, 0x80, 0x7b,
-0x74, 0x70, 0x6d, 0x6e, 0x70, 0x74, 0x79, 0x7d, 0x80, 0x85, 0x87, 0x88, 0x8c, 0x8d, 0x91, 0x92,
-0x94, 0x94, 0x92, 0x8e, 0x8b, 0x85, 0x82, 0x7d, 0x7b, 0x78, 0x76, 0x76, 0x72, 0x72, 0x6f, 0x6e,
-0x6c, 0x6c, 0x6a, 0x6b, 0x6d, 0x6e, 0x70, 0x73, 0x76, 0x78, 0x7a, 0x7e, 0x7f, 0x82, 0x85, 0x87,
-0x8a, 0x8d, 0x8d, 0x8e, 0x8d, 0x8d, 0x89, 0x88, 0x85, 0x83, 0x80, 0x80, 0x7d, 0x7d, 0x7d, 0x7e,
-0x7d, 0x7e, 0x80, 0x7f, 0x81, 0x82, 0x84, 0x84, 0x86, 0x86, 0x87, 0x86, 0x87, 0x85, 0x83, 0x83,
-0x80, 0x7f, 0x7d, 0x7d, 0x7b, 0x7c, 0x7b, 0x7c, 0x7a, 0x7b, 0x7a, 0x7a, 0x7a, 0x79, 0x7a, 0x79,
-0x78, 0x79, 0x78, 0x79, 0x79, 0x77, 0x78, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x80,
-0x81, 0x82, 0x81, 0x83, 0x83, 0x84, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85, 0x84, 0x84, 0x83, 0x84,
-0x83, 0x83, 0x82, 0x82, 0x81, 0x82, 0x80, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80,
-0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7c, 0x7d, 0x7c, 0x7c, 0x7b, 0x7c,
-0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7d, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x81,
-0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x82, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
-0x80, 0x81, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e,
-0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7e, 0x7d, 0x7e, 0x7d,
-0x7e, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7e, 0x7f, 0x7e, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80,
-0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f,
-0x7f, 0x7e, 0x7f, 0x7e, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f,
-0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
-0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80,
-0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80,
-0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f,
-0x80, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f,
-0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f,
-0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f,
-0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80,
-0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
-0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
-0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
-0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f,
-0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f,
-0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7e, 0x80, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
-0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7e,
-0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x80, 0x7f, 0x82, 0x7e, 0x7e, 0x80, 0x7f,
-0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7e,
-0x7e, 0x7d, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x7e, 0x82, 0x7f, 0x81, 0x80, 0x7f, 0x83, 0x7d,
-0x83, 0x7f, 0x80, 0x81, 0x7f, 0x80, 0x7f, 0x80, 0x7d, 0x80, 0x7d, 0x80, 0x7d, 0x7d, 0x7e, 0x7c,
-0x7e, 0x7c, 0x7f, 0x7d, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x7e, 0x81, 0x7f, 0x81, 0x80,
-0x7e, 0x81, 0x7e, 0x81, 0x7e, 0x81, 0x7c, 0x82, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x82, 0x7a,
-0x84, 0x79, 0x83, 0x7f, 0x7e, 0x83, 0x7c, 0x83, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7e,
-0x80, 0x7e, 0x7d, 0x81, 0x7d, 0x80, 0x7e, 0x80, 0x80, 0x81, 0x81, 0x7f, 0x7e, 0x81, 0x80, 0x7f,
-0x81, 0x7d, 0x81, 0x80, 0x81, 0x7e, 0x80, 0x7e, 0x80, 0x7d, 0x7f, 0x7f, 0x81, 0x7c, 0x81, 0x7e,
-0x7e, 0x82, 0x79, 0x83, 0x7b, 0x80, 0x80, 0x7f, 0x7c, 0x85, 0x7a, 0x81, 0x7f, 0x7e, 0x83, 0x7c,
-0x7e, 0x80, 0x7f, 0x81, 0x7c, 0x7e, 0x83, 0x7d, 0x80, 0x7c, 0x82, 0x7c, 0x80, 0x7d, 0x80, 0x7e,
-0x7c, 0x80, 0x7e, 0x83, 0x7c, 0x80, 0x7c, 0x82, 0x7c, 0x84, 0x7d, 0x7d, 0x82, 0x7f, 0x83, 0x7e,
-0x7d, 0x7d, 0x80, 0x7d, 0x82, 0x7e, 0x7f, 0x81, 0x7d, 0x83, 0x7b, 0x80, 0x80, 0x7e, 0x80, 0x81,
-0x81, 0x7e, 0x7f, 0x7f, 0x82, 0x80, 0x7c, 0x80, 0x7d, 0x81, 0x7e, 0x80, 0x81, 0x7c, 0x7e, 0x82,
-0x7e, 0x7f, 0x80, 0x7b, 0x86, 0x7b, 0x7f, 0x81, 0x7d, 0x82, 0x7d, 0x80, 0x83, 0x7d, 0x7f, 0x82,
-0x79, 0x82, 0x80, 0x7f, 0x80, 0x7a, 0x84, 0x7c, 0x81, 0x80, 0x7c, 0x81, 0x7d, 0x81, 0x7f, 0x7f,
-0x7c, 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x7c, 0x83, 0x7c, 0x85, 0x7f, 0x7b, 0x81, 0x7c, 0x83, 0x7d,
-0x80, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x7e, 0x7d, 0x83, 0x7f, 0x82, 0x7e, 0x80, 0x81, 0x7f, 0x82,
-0x7a, 0x83, 0x7b, 0x7f, 0x7d, 0x83, 0x7d, 0x81, 0x7a, 0x81, 0x82, 0x7c, 0x81, 0x7b, 0x85, 0x7c,
-0x81, 0x7d, 0x83, 0x7c, 0x80, 0x81, 0x7b, 0x83, 0x7b, 0x7f, 0x7d, 0x85, 0x7a, 0x81, 0x7b, 0x7c,
-0x83, 0x7d, 0x83, 0x7b, 0x80, 0x7f, 0x80, 0x83, 0x7d, 0x7c, 0x84, 0x7f, 0x7f, 0x81, 0x7e, 0x82,
-0x7c, 0x82, 0x80, 0x7b, 0x7f, 0x7f, 0x81, 0x81, 0x7c, 0x81, 0x7b, 0x82, 0x81, 0x7d, 0x7e, 0x80,
-0x7e, 0x84, 0x7c, 0x7d, 0x85, 0x7a, 0x85, 0x7a, 0x81, 0x80, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x81,
-0x7b, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x83, 0x7f, 0x7f, 0x7f, 0x79, 0x88, 0x81, 0x79, 0x82,
-0x7b, 0x82, 0x7f, 0x80, 0x7e, 0x7c, 0x81, 0x82, 0x80, 0x79, 0x7f, 0x80, 0x81, 0x80, 0x80, 0x7c,
-0x81, 0x7e, 0x80, 0x84, 0x79, 0x82, 0x7c, 0x81, 0x81, 0x7c, 0x7e, 0x83, 0x7f, 0x7f, 0x7f, 0x7f,
-0x7e, 0x7e, 0x80, 0x80, 0x80, 0x7b, 0x7e, 0x80, 0x81, 0x80, 0x7a, 0x7e, 0x85, 0x7e, 0x7f, 0x7b,
-0x85, 0x7b, 0x84, 0x82, 0x7e, 0x7b, 0x7f, 0x88, 0x7c, 0x7c, 0x77, 0x83, 0x81, 0x7c, 0x7d, 0x7d,
-0x7e, 0x84, 0x7f, 0x7d, 0x7e, 0x7f, 0x84, 0x7f, 0x7d, 0x82, 0x7c, 0x7e, 0x81, 0x7d, 0x7e, 0x82,
-0x7f, 0x7c, 0x81, 0x7d, 0x82, 0x7d, 0x7c, 0x82, 0x7f, 0x80, 0x80, 0x7d, 0x82, 0x81, 0x7e, 0x7f,
-0x80, 0x81, 0x82, 0x81, 0x7f, 0x7f, 0x80, 0x81, 0x7e, 0x7d, 0x82, 0x7d, 0x7e, 0x7f, 0x7e, 0x7f,
-0x80, 0x7b, 0x7d, 0x81, 0x7e, 0x7d, 0x7d, 0x7f, 0x82, 0x7f, 0x7e, 0x7e, 0x82, 0x81, 0x7e, 0x7f,
-0x7d, 0x7f, 0x81, 0x83, 0x7d, 0x7d, 0x7f, 0x83, 0x7c, 0x7d, 0x81, 0x7d, 0x7e, 0x7f, 0x7f, 0x80,
-0x7f, 0x7d, 0x7e, 0x84, 0x7e, 0x7b, 0x7d, 0x81, 0x82, 0x7b, 0x80, 0x82, 0x80, 0x7d, 0x81, 0x82,
-0x80, 0x7d, 0x7e, 0x83, 0x80, 0x7d, 0x7d, 0x82, 0x81, 0x80, 0x80, 0x7e, 0x82, 0x80, 0x80, 0x81,
-0x7d, 0x7f, 0x7e, 0x7b, 0x7d, 0x7b, 0x7c, 0x79, 0x79, 0x78, 0x79, 0x7a, 0x77, 0x76, 0x77, 0x79,
-0x78, 0x76, 0x79, 0x7a, 0x79, 0x7b, 0x7b, 0x7d, 0x7d, 0x80, 0x83, 0x84, 0x83, 0x87, 0x89, 0x8a,
-0x89, 0x8b, 0x8e, 0x8f, 0x8d, 0x8b, 0x8d, 0x91, 0x8d, 0x88, 0x87, 0x89, 0x89, 0x86, 0x80, 0x81,
-0x83, 0x82, 0x80, 0x7c, 0x7d, 0x80, 0x7d, 0x79, 0x78, 0x7c, 0x79, 0x78, 0x72, 0x74, 0x75, 0x70,
-0x6e, 0x69, 0x6a, 0x69, 0x67, 0x69, 0x69, 0x68, 0x6b, 0x70, 0x73, 0x74, 0x77, 0x7d, 0x86, 0x86,
-0x88, 0x8d, 0x94, 0x96, 0x97, 0x96, 0x97, 0x99, 0x96, 0x95, 0x92, 0x8f, 0x8e, 0x8a, 0x88, 0x84,
-0x81, 0x81, 0x81, 0x7d, 0x7c, 0x7b, 0x7d, 0x7e, 0x7e, 0x7e, 0x80, 0x83, 0x83, 0x86, 0x85, 0x86,
-0x84, 0x84, 0x83, 0x80, 0x7c, 0x7b, 0x79, 0x74, 0x6e, 0x6a, 0x63, 0x63, 0x65, 0x63, 0x5f, 0x5c,
-0x62, 0x69, 0x69, 0x69, 0x6e, 0x77, 0x7f, 0x81, 0x86, 0x8b, 0x93, 0x96, 0x9a, 0x9b, 0x9e, 0x9d,
-0x9d, 0x9d, 0x9b, 0x96, 0x92, 0x8f, 0x8d, 0x89, 0x83, 0x80, 0x7d, 0x7d, 0x79, 0x79, 0x78, 0x79,
-0x79, 0x7c, 0x7e, 0x80, 0x81, 0x82, 0x85, 0x86, 0x87, 0x87, 0x85, 0x85, 0x82, 0x80, 0x7d, 0x7a,
-0x77, 0x71, 0x6d, 0x65, 0x61, 0x61, 0x65, 0x63, 0x5c, 0x5c, 0x62, 0x6a, 0x6a, 0x6c, 0x70, 0x7b,
-0x82, 0x86, 0x8b, 0x91, 0x95, 0x98, 0x9d, 0x9f, 0x9f, 0x9b, 0x9c, 0x9c, 0x9a, 0x95, 0x8e, 0x8d,
-0x8a, 0x87, 0x81, 0x7e, 0x7b, 0x79, 0x79, 0x77, 0x78, 0x78, 0x78, 0x7c, 0x7e, 0x7f, 0x81, 0x82,
-0x86, 0x87, 0x88, 0x88, 0x87, 0x84, 0x83, 0x80, 0x7e, 0x79, 0x72, 0x6f, 0x6b, 0x65, 0x60, 0x60,
-0x63, 0x60, 0x5b, 0x5e, 0x63, 0x69, 0x6a, 0x6d, 0x74, 0x7d, 0x80, 0x87, 0x8e, 0x93, 0x96, 0x98,
-0x9c, 0xa1, 0xa1, 0x9d, 0x9c, 0x9d, 0x99, 0x96, 0x91, 0x8d, 0x8a, 0x84, 0x81, 0x7d, 0x7b, 0x77,
-0x77, 0x76, 0x78, 0x76, 0x78, 0x7a, 0x7e, 0x7f, 0x82, 0x84, 0x87, 0x87, 0x89, 0x89, 0x88, 0x87,
-0x83, 0x81, 0x7f, 0x79, 0x75, 0x6f, 0x6b, 0x64, 0x60, 0x60, 0x62, 0x5f, 0x5c, 0x5d, 0x63, 0x66,
-0x6a, 0x6d, 0x76, 0x7c, 0x81, 0x86, 0x8f, 0x94, 0x98, 0x99, 0x9e, 0xa0, 0xa1, 0x9e, 0x9d, 0x9b,
-0x99, 0x94, 0x90, 0x8d, 0x88, 0x82, 0x7d, 0x7c, 0x78, 0x76, 0x75, 0x74, 0x76, 0x75, 0x78, 0x7b,
-0x7e, 0x80, 0x83, 0x85, 0x87, 0x88, 0x8a, 0x8a, 0x8a, 0x87, 0x84, 0x81, 0x7e, 0x79, 0x73, 0x6f,
-0x68, 0x63, 0x62, 0x61, 0x61, 0x5e, 0x5e, 0x61, 0x64, 0x68, 0x6d, 0x73, 0x7a, 0x7f, 0x83, 0x8b,
-0x92, 0x97, 0x9a, 0x9b, 0x9f, 0x9f, 0x9e, 0x9c, 0x9c, 0x99, 0x94, 0x90, 0x8c, 0x89, 0x84, 0x7f,
-0x7b, 0x79, 0x75, 0x75, 0x74, 0x75, 0x75, 0x78, 0x79, 0x7e, 0x7f, 0x83, 0x85, 0x88, 0x88, 0x8a,
-0x8a, 0x89, 0x87, 0x84, 0x82, 0x7d, 0x79, 0x74, 0x6f, 0x6a, 0x63, 0x62, 0x61, 0x61, 0x5e, 0x5e,
-0x60, 0x64, 0x67, 0x6b, 0x73, 0x79, 0x7f, 0x84, 0x8a, 0x90, 0x95, 0x99, 0x9c, 0x9d, 0x9f, 0x9d,
-0x9c, 0x9a, 0x99, 0x95, 0x91, 0x8d, 0x89, 0x83, 0x80, 0x7c, 0x7a, 0x77, 0x77, 0x76, 0x77, 0x77,
-0x79, 0x7c, 0x7e, 0x80, 0x83, 0x86, 0x87, 0x89, 0x88, 0x88, 0x86, 0x85, 0x83, 0x80, 0x7b, 0x78,
-0x71, 0x6d, 0x68, 0x63, 0x62, 0x61, 0x61, 0x5f, 0x61, 0x62, 0x66, 0x6b, 0x6f, 0x78, 0x7d, 0x83,
-0x87, 0x8d, 0x94, 0x96, 0x9b, 0x9e, 0x9e, 0x9e, 0x9a, 0x9a, 0x97, 0x95, 0x8f, 0x8d, 0x88, 0x85,
-0x7f, 0x7d, 0x79, 0x78, 0x76, 0x77, 0x76, 0x79, 0x7a, 0x7c, 0x7e, 0x82, 0x83, 0x87, 0x89, 0x8a,
-0x8a, 0x8a, 0x88, 0x85, 0x83, 0x7f, 0x7d, 0x78, 0x74, 0x6d, 0x69, 0x63, 0x61, 0x5f, 0x60, 0x5f,
-0x60, 0x62, 0x66, 0x68, 0x6e, 0x75, 0x7c, 0x83, 0x88, 0x8c, 0x92, 0x95, 0x99, 0x9b, 0x9e, 0x9e,
-0x9d, 0x99, 0x98, 0x93, 0x90, 0x8c, 0x88, 0x85, 0x7f, 0x7d, 0x79, 0x78, 0x76, 0x77, 0x77, 0x79,
-0x79, 0x7c, 0x7d, 0x82, 0x84, 0x87, 0x89, 0x8c, 0x8c, 0x8b, 0x8b, 0x88, 0x87, 0x82, 0x80, 0x7a,
-0x77, 0x72, 0x6e, 0x68, 0x62, 0x5f, 0x5e, 0x5e, 0x5f, 0x5f, 0x63, 0x65, 0x6a, 0x6d, 0x74, 0x7b,
-0x83, 0x88, 0x8d, 0x92, 0x95, 0x98, 0x9a, 0x9d, 0x9d, 0x9d, 0x9a, 0x96, 0x94, 0x8f, 0x8c, 0x88,
-0x85, 0x80, 0x7e, 0x7a, 0x79, 0x77, 0x77, 0x78, 0x79, 0x7c, 0x7c, 0x7f, 0x82, 0x83, 0x87, 0x89,
-0x8a, 0x8c, 0x8a, 0x89, 0x89, 0x87, 0x83, 0x80, 0x7c, 0x79, 0x74, 0x70, 0x6b, 0x67, 0x62, 0x60,
-0x60, 0x5f, 0x61, 0x62, 0x66, 0x69, 0x6d, 0x71, 0x77, 0x7d, 0x83, 0x87, 0x8b, 0x91, 0x93, 0x96,
-0x97, 0x99, 0x99, 0x98, 0x96, 0x94, 0x91, 0x8d, 0x8a, 0x87, 0x84, 0x81, 0x7f, 0x7d, 0x7c, 0x7b,
-0x7b, 0x7a, 0x7c, 0x7d, 0x7f, 0x83, 0x83, 0x86, 0x87, 0x89, 0x89, 0x8a, 0x8a, 0x89, 0x87, 0x86,
-0x82, 0x81, 0x7d, 0x7b, 0x77, 0x74, 0x70, 0x6d, 0x69, 0x67, 0x64, 0x64, 0x63, 0x65, 0x66, 0x69,
-0x6d, 0x70, 0x74, 0x77, 0x7c, 0x81, 0x84, 0x89, 0x8c, 0x8f, 0x91, 0x92, 0x94, 0x92, 0x92, 0x90,
-0x8f, 0x8d, 0x8a, 0x89, 0x86, 0x83, 0x82, 0x7f, 0x7f, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f, 0x81,
-0x81, 0x83, 0x83, 0x85, 0x86, 0x85, 0x86, 0x85, 0x86, 0x84, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7d,
-0x7d, 0x7c, 0x7b, 0x78, 0x77, 0x75, 0x72, 0x70, 0x70, 0x6f, 0x70, 0x6f, 0x71, 0x70, 0x72, 0x73,
-0x73, 0x75, 0x77, 0x79, 0x7b, 0x7e, 0x80, 0x83, 0x85, 0x86, 0x88, 0x88, 0x8a, 0x8a, 0x89, 0x8a,
-0x8a, 0x89, 0x87, 0x87, 0x85, 0x85, 0x83, 0x84, 0x85, 0x84, 0x84, 0x84, 0x83, 0x84, 0x83, 0x82,
-0x83, 0x83, 0x82, 0x83, 0x83, 0x84, 0x82, 0x83, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7d,
-0x7d, 0x7b, 0x7b, 0x78, 0x78, 0x77, 0x77, 0x76, 0x75, 0x75, 0x74, 0x75, 0x75, 0x76, 0x75, 0x77,
-0x77, 0x79, 0x79, 0x7b, 0x7b, 0x7e, 0x7e, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x83, 0x82, 0x84,
-0x84, 0x83, 0x84, 0x83, 0x84, 0x84, 0x83, 0x84, 0x83, 0x84, 0x84, 0x84, 0x85, 0x84, 0x85, 0x84,
-0x85, 0x84, 0x85, 0x84, 0x85, 0x83, 0x83, 0x84, 0x82, 0x83, 0x82, 0x82, 0x82, 0x80, 0x80, 0x7f,
-0x7f, 0x7d, 0x7e, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b, 0x79, 0x7a, 0x79, 0x78, 0x78, 0x78, 0x77, 0x78,
-0x77, 0x78, 0x77, 0x79, 0x78, 0x79, 0x7a, 0x7a, 0x7b, 0x7b, 0x7d, 0x7c, 0x7e, 0x7e, 0x7f, 0x80,
-0x80, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x84, 0x84, 0x84, 0x84, 0x84, 0x85, 0x84,
-0x85, 0x84, 0x85, 0x85, 0x84, 0x85, 0x84, 0x85, 0x83, 0x84, 0x84, 0x82, 0x83, 0x81, 0x82, 0x80,
-0x81, 0x7f, 0x80, 0x7e, 0x7f, 0x7d, 0x7e, 0x7d, 0x7c, 0x7d, 0x7b, 0x7c, 0x7c, 0x7b, 0x7c, 0x7a,
-0x7b, 0x7b, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x78, 0x79, 0x78, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b,
-0x7a, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x80, 0x80, 0x81, 0x82, 0x82, 0x83, 0x83, 0x84, 0x83, 0x85,
-0x84, 0x85, 0x85, 0x85, 0x86, 0x85, 0x85, 0x84, 0x85, 0x84, 0x84, 0x83, 0x84, 0x82, 0x83, 0x82,
-0x81, 0x82, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7d,
-0x7e, 0x7d, 0x7e, 0x7d, 0x7c, 0x7d, 0x7b, 0x7c, 0x7b, 0x7a, 0x7b, 0x79, 0x7a, 0x79, 0x79, 0x78,
-0x79, 0x78, 0x7a, 0x79, 0x7a, 0x7b, 0x7b, 0x7c, 0x7c, 0x7e, 0x7e, 0x7e, 0x80, 0x7f, 0x81, 0x80,
-0x82, 0x82, 0x82, 0x83, 0x82, 0x83, 0x82, 0x83, 0x83, 0x83, 0x82, 0x83, 0x82, 0x83, 0x83, 0x83,
-0x83, 0x82, 0x83, 0x82, 0x83, 0x82, 0x82, 0x81, 0x82, 0x82, 0x82, 0x81, 0x82, 0x81, 0x82, 0x81,
-0x81, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x7e, 0x7f, 0x7e, 0x7e, 0x7d, 0x7e, 0x7c, 0x7d, 0x7d, 0x7b,
-0x7c, 0x7b, 0x7b, 0x7a, 0x7b, 0x7a, 0x7a, 0x7b, 0x7a, 0x7b, 0x7b, 0x7a, 0x7b, 0x7b, 0x7c, 0x7b,
-0x7d, 0x7d, 0x7d, 0x7e, 0x7d, 0x7f, 0x7e, 0x80, 0x7f, 0x80, 0x81, 0x80, 0x81, 0x81, 0x82, 0x81,
-0x82, 0x82, 0x81, 0x83, 0x83, 0x82, 0x83, 0x82, 0x83, 0x83, 0x82, 0x83, 0x82, 0x82, 0x81, 0x81,
-0x82, 0x81, 0x82, 0x81, 0x82, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7f,
-0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c,
-0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d, 0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7d,
-0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81,
-0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80,
-0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
-0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x80, 0x7e, 0x80,
-0x80, 0x80, 0x82, 0x85, 0x88, 0x81, 0x7f, 0x80, 0x7b, 0x7c, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d,
-0x7e, 0x7c, 0x7d, 0x7e, 0x7e, 0x7f, 0x7d, 0x7e, 0x80, 0x81, 0x83, 0x83, 0x85, 0x84, 0x7f, 0x7e,
-0x82, 0x82, 0x82, 0x82, 0x82, 0x84, 0x82, 0x81, 0x7f, 0x80, 0x7f, 0x7d, 0x7e, 0x7e, 0x7d, 0x80,
-0x7f, 0x7f, 0x7c, 0x7d, 0x7d, 0x7b, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7c, 0x7d, 0x7c, 0x7d,
-0x7b, 0x7c, 0x7c, 0x7e, 0x7d, 0x7e, 0x7c, 0x7d, 0x7d, 0x7c, 0x7d, 0x7b, 0x7d, 0x7b, 0x7d, 0x7b,
-0x7b, 0x7b, 0x7a, 0x7b, 0x7a, 0x7a, 0x7a, 0x79, 0x7b, 0x7b, 0x7d, 0x7d, 0x80, 0x81, 0x82, 0x82,
-0x84, 0x85, 0x88, 0x88, 0x89, 0x87, 0x87, 0x86, 0x87, 0x86, 0x88, 0x87, 0x87, 0x84, 0x82, 0x82,
-0x81, 0x82, 0x82, 0x83, 0x81, 0x81, 0x80, 0x7f, 0x81, 0x83, 0x88, 0x89, 0x89, 0x86, 0x84, 0x84,
-0x83, 0x86, 0x89, 0x89, 0x89, 0x87, 0x86, 0x81, 0x80, 0x7e, 0x7d, 0x7f, 0x81, 0x81, 0x7c, 0x77,
-0x72, 0x72, 0x71, 0x73, 0x70, 0x6d, 0x6b, 0x65, 0x63, 0x60, 0x62, 0x66, 0x69, 0x6e, 0x71, 0x73,
-0x77, 0x7a, 0x7f, 0x85, 0x8a, 0x90, 0x93, 0x96, 0x95, 0x95, 0x91, 0x8f, 0x8b, 0x8a, 0x87, 0x86,
-0x81, 0x7e, 0x79, 0x74, 0x73, 0x70, 0x73, 0x74, 0x78, 0x7a, 0x7e, 0x80, 0x84, 0x87, 0x8d, 0x90,
-0x94, 0x96, 0x96, 0x96, 0x94, 0x95, 0x93, 0x94, 0x91, 0x8c, 0x89, 0x83, 0x80, 0x7d, 0x7a, 0x7a,
-0x7a, 0x7b, 0x79, 0x77, 0x75, 0x72, 0x6f, 0x70, 0x6f, 0x6f, 0x6c, 0x68, 0x62, 0x5c, 0x58, 0x56,
-0x59, 0x61, 0x68, 0x72, 0x79, 0x7d, 0x82, 0x86, 0x89, 0x8f, 0x94, 0x9b, 0x9e, 0x9f, 0x9e, 0x99,
-0x96, 0x8f, 0x8b, 0x86, 0x82, 0x7c, 0x78, 0x72, 0x6c, 0x6a, 0x68, 0x69, 0x6b, 0x6f, 0x71, 0x76,
-0x7a, 0x81, 0x87, 0x8f, 0x94, 0x98, 0x9b, 0x9e, 0x9e, 0x9b, 0x99, 0x98, 0x96, 0x95, 0x92, 0x90,
-0x8b, 0x86, 0x80, 0x7e, 0x7b, 0x7d, 0x7c, 0x7d, 0x7b, 0x7b, 0x78, 0x76, 0x72, 0x71, 0x70, 0x71,
-0x70, 0x6d, 0x68, 0x62, 0x5c, 0x57, 0x54, 0x55, 0x5c, 0x65, 0x71, 0x7a, 0x81, 0x83, 0x86, 0x88,
-0x8a, 0x91, 0x97, 0xa0, 0xa1, 0xa0, 0x9a, 0x95, 0x8e, 0x8a, 0x86, 0x81, 0x7d, 0x78, 0x71, 0x6a,
-0x65, 0x66, 0x66, 0x6b, 0x6e, 0x72, 0x74, 0x77, 0x7a, 0x82, 0x8a, 0x94, 0x9a, 0x9e, 0x9c, 0x9c,
-0x9b, 0x9a, 0x9d, 0x9d, 0x9d, 0x9a, 0x92, 0x8c, 0x85, 0x83, 0x81, 0x81, 0x80, 0x7f, 0x7b, 0x78,
-0x74, 0x74, 0x74, 0x76, 0x75, 0x71, 0x6e, 0x6a, 0x69, 0x67, 0x64, 0x61, 0x5b, 0x57, 0x53, 0x56,
-0x5f, 0x6d, 0x79, 0x80, 0x81, 0x80, 0x82, 0x87, 0x91, 0x9a, 0xa2, 0xa5, 0xa1, 0x9c, 0x97, 0x93,
-0x93, 0x90, 0x8c, 0x82, 0x78, 0x6f, 0x6b, 0x6a, 0x6c, 0x6c, 0x6a, 0x65, 0x63, 0x64, 0x6c, 0x75,
-0x7f, 0x86, 0x8a, 0x8f, 0x92, 0x98, 0x9e, 0xa3, 0xa7, 0xa7, 0xa4, 0x9f, 0x9a, 0x97, 0x95, 0x92,
-0x8f, 0x89, 0x83, 0x7a, 0x74, 0x6f, 0x70, 0x70, 0x73, 0x72, 0x6f, 0x6c, 0x69, 0x6a, 0x69, 0x69,
-0x65, 0x62, 0x5e, 0x59, 0x53, 0x56, 0x60, 0x6f, 0x7e, 0x82, 0x80, 0x7d, 0x7d, 0x88, 0x97, 0xa3,
-0xa8, 0xa5, 0x9f, 0x97, 0x94, 0x94, 0x98, 0x96, 0x8f, 0x81, 0x73, 0x67, 0x66, 0x68, 0x6e, 0x6e,
-0x68, 0x5f, 0x5d, 0x62, 0x70, 0x7c, 0x85, 0x88, 0x87, 0x8a, 0x8f, 0x9a, 0xa3, 0xa9, 0xa8, 0xa5,
-0x9e, 0x9b, 0x9c, 0x9d, 0x9b, 0x96, 0x8b, 0x82, 0x7b, 0x78, 0x78, 0x77, 0x74, 0x70, 0x6d, 0x6b,
-0x6c, 0x6c, 0x6d, 0x6b, 0x68, 0x66, 0x63, 0x61, 0x60, 0x5e, 0x5b, 0x58, 0x5e, 0x68, 0x76, 0x7c,
-0x7c, 0x7a, 0x7d, 0x8a, 0x97, 0xa1, 0xa1, 0x9d, 0x9a, 0x9c, 0xa0, 0xa1, 0x9e, 0x93, 0x88, 0x7f,
-0x7c, 0x78, 0x74, 0x6c, 0x67, 0x61, 0x61, 0x61, 0x64, 0x69, 0x6c, 0x6e, 0x74, 0x7c, 0x87, 0x8e,
-0x92, 0x97, 0x9d, 0xa4, 0xa6, 0xa5, 0xa6, 0xa5, 0xa5, 0xa1, 0x9b, 0x94, 0x8d, 0x89, 0x83, 0x7f,
-0x79, 0x75, 0x71, 0x71, 0x6f, 0x6f, 0x6d, 0x6a, 0x69, 0x68, 0x6a, 0x69, 0x66, 0x64, 0x62, 0x63,
-0x60, 0x5d, 0x5b, 0x60, 0x6d, 0x78, 0x7a, 0x76, 0x77, 0x83, 0x95, 0x9e, 0x9a, 0x95, 0x94, 0x9f,
-0xa6, 0xa6, 0x9a, 0x8d, 0x88, 0x89, 0x89, 0x83, 0x74, 0x67, 0x65, 0x6a, 0x6a, 0x66, 0x5f, 0x61,
-0x69, 0x73, 0x77, 0x7a, 0x7d, 0x84, 0x8d, 0x95, 0x9e, 0xa2, 0xa0, 0xa1, 0xa3, 0xa7, 0xaa, 0xa4,
-0x9c, 0x93, 0x91, 0x8d, 0x8a, 0x84, 0x7d, 0x77, 0x76, 0x74, 0x74, 0x73, 0x70, 0x6e, 0x6e, 0x6e,
-0x6f, 0x6b, 0x6a, 0x68, 0x67, 0x67, 0x64, 0x63, 0x5e, 0x5b, 0x5c, 0x66, 0x71, 0x70, 0x6e, 0x72,
-0x7e, 0x90, 0x92, 0x8f, 0x8e, 0x98, 0xa3, 0xa5, 0x9d, 0x97, 0x94, 0x98, 0x96, 0x8d, 0x81, 0x77,
-0x74, 0x76, 0x70, 0x69, 0x62, 0x62, 0x6a, 0x6c, 0x68, 0x6a, 0x71, 0x7c, 0x84, 0x85, 0x88, 0x8e,
-0x98, 0xa0, 0xa3, 0xa2, 0xa0, 0xa4, 0xa6, 0xa5, 0x9e, 0x97, 0x95, 0x91, 0x8d, 0x84, 0x7d, 0x7b,
-0x7a, 0x77, 0x72, 0x70, 0x6f, 0x70, 0x6f, 0x6d, 0x6d, 0x6c, 0x6c, 0x6a, 0x6a, 0x6a, 0x69, 0x66,
-0x63, 0x62, 0x60, 0x61, 0x68, 0x70, 0x6f, 0x6b, 0x75, 0x85, 0x8c, 0x88, 0x84, 0x92, 0x9f, 0x9f,
-0x95, 0x93, 0x9b, 0x9d, 0x96, 0x8b, 0x86, 0x83, 0x80, 0x79, 0x74, 0x6e, 0x6b, 0x69, 0x6b, 0x6a,
-0x69, 0x69, 0x70, 0x78, 0x7c, 0x7d, 0x81, 0x8c, 0x93, 0x96, 0x95, 0x9c, 0xa3, 0xa5, 0xa0, 0xa0,
-0xa0, 0xa0, 0x9a, 0x93, 0x8f, 0x8c, 0x88, 0x81, 0x7d, 0x79, 0x77, 0x76, 0x74, 0x72, 0x70, 0x71,
-0x70, 0x70, 0x6f, 0x6e, 0x6f, 0x6e, 0x6e, 0x6b, 0x6b, 0x69, 0x66, 0x60, 0x5f, 0x65, 0x6c, 0x6b,
-0x60, 0x69, 0x7d, 0x80, 0x78, 0x77, 0x88, 0x98, 0x92, 0x89, 0x92, 0x9e, 0x9e, 0x92, 0x90, 0x93,
-0x93, 0x89, 0x83, 0x80, 0x7e, 0x79, 0x76, 0x71, 0x70, 0x6f, 0x71, 0x71, 0x6f, 0x72, 0x76, 0x7a,
-0x7b, 0x7f, 0x83, 0x88, 0x8b, 0x8e, 0x91, 0x96, 0x98, 0x9b, 0x98, 0x9a, 0x9d, 0x9c, 0x97, 0x96,
-0x95, 0x94, 0x8c, 0x88, 0x87, 0x85, 0x7e, 0x7b, 0x7a, 0x79, 0x74, 0x73, 0x74, 0x72, 0x72, 0x72,
-0x73, 0x73, 0x71, 0x73, 0x73, 0x73, 0x71, 0x6f, 0x6f, 0x6b, 0x67, 0x5f, 0x63, 0x70, 0x69, 0x5b,
-0x64, 0x73, 0x75, 0x69, 0x6d, 0x80, 0x88, 0x7f, 0x80, 0x8f, 0x99, 0x95, 0x90, 0x96, 0x9d, 0x97,
-0x91, 0x90, 0x8f, 0x8d, 0x87, 0x81, 0x7c, 0x7d, 0x7b, 0x76, 0x71, 0x74, 0x75, 0x73, 0x71, 0x75,
-0x7a, 0x7c, 0x7b, 0x81, 0x85, 0x89, 0x8a, 0x8e, 0x92, 0x94, 0x96, 0x96, 0x98, 0x98, 0x98, 0x96,
-0x95, 0x94, 0x8f, 0x8b, 0x8a, 0x86, 0x82, 0x7e, 0x7d, 0x7b, 0x76, 0x75, 0x74, 0x74, 0x72, 0x72,
-0x72, 0x75, 0x73, 0x74, 0x75, 0x77, 0x76, 0x75, 0x76, 0x74, 0x74, 0x71, 0x6f, 0x6b, 0x6a, 0x64,
-0x67, 0x6c, 0x65, 0x61, 0x69, 0x71, 0x6b, 0x6a, 0x75, 0x7f, 0x7f, 0x7e, 0x87, 0x92, 0x92, 0x90,
-0x95, 0x9a, 0x9c, 0x97, 0x95, 0x98, 0x97, 0x91, 0x8c, 0x8c, 0x8a, 0x86, 0x80, 0x7f, 0x7e, 0x7c,
-0x77, 0x78, 0x79, 0x77, 0x77, 0x77, 0x78, 0x7b, 0x7a, 0x7b, 0x7e, 0x80, 0x83, 0x82, 0x86, 0x88,
-0x8a, 0x8c, 0x8d, 0x8c, 0x90, 0x90, 0x8e, 0x8d, 0x8f, 0x8f, 0x8b, 0x89, 0x8a, 0x88, 0x84, 0x81,
-0x80, 0x7f, 0x7b, 0x77, 0x78, 0x76, 0x73, 0x73, 0x72, 0x73, 0x72, 0x72, 0x72, 0x75, 0x75, 0x74,
-0x77, 0x77, 0x79, 0x78, 0x77, 0x79, 0x78, 0x75, 0x75, 0x72, 0x70, 0x6f, 0x75, 0x70, 0x69, 0x6e,
-0x73, 0x6e, 0x6c, 0x72, 0x79, 0x79, 0x79, 0x7e, 0x86, 0x8a, 0x87, 0x8b, 0x91, 0x95, 0x90, 0x91,
-0x95, 0x96, 0x93, 0x8f, 0x8f, 0x91, 0x8c, 0x88, 0x85, 0x88, 0x84, 0x7f, 0x7d, 0x7f, 0x7c, 0x7a,
-0x78, 0x79, 0x79, 0x78, 0x76, 0x77, 0x7b, 0x79, 0x79, 0x7d, 0x80, 0x80, 0x81, 0x82, 0x87, 0x87,
-0x88, 0x89, 0x8d, 0x8d, 0x8d, 0x8b, 0x8e, 0x8e, 0x8a, 0x89, 0x89, 0x87, 0x85, 0x81, 0x81, 0x7f,
-0x7d, 0x7a, 0x7a, 0x79, 0x78, 0x75, 0x76, 0x76, 0x78, 0x76, 0x77, 0x78, 0x7a, 0x79, 0x7b, 0x7b,
-0x7c, 0x7c, 0x7b, 0x7d, 0x7b, 0x7b, 0x79, 0x79, 0x77, 0x76, 0x73, 0x73, 0x73, 0x73, 0x71, 0x6f,
-0x73, 0x73, 0x73, 0x72, 0x76, 0x78, 0x7a, 0x7b, 0x7e, 0x81, 0x84, 0x84, 0x85, 0x88, 0x88, 0x88,
-0x87, 0x8a, 0x8a, 0x87, 0x87, 0x87, 0x87, 0x85, 0x84, 0x83, 0x84, 0x81, 0x81, 0x81, 0x80, 0x7f,
-0x7f, 0x7d, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7f, 0x7d, 0x7f, 0x7f, 0x81, 0x82, 0x81, 0x83, 0x85,
-0x84, 0x85, 0x85, 0x88, 0x88, 0x87, 0x89, 0x89, 0x8a, 0x89, 0x89, 0x89, 0x8a, 0x88, 0x87, 0x88,
-0x87, 0x86, 0x84, 0x83, 0x83, 0x80, 0x7f, 0x7f, 0x7d, 0x7d, 0x7a, 0x7b, 0x7a, 0x7a, 0x78, 0x79,
-0x79, 0x7a, 0x78, 0x7a, 0x79, 0x7b, 0x7a, 0x7a, 0x7a, 0x79, 0x7a, 0x78, 0x79, 0x78, 0x79, 0x78,
-0x78, 0x78, 0x79, 0x77, 0x77, 0x76, 0x77, 0x76, 0x77, 0x76, 0x75, 0x77, 0x75, 0x78, 0x77, 0x77,
-0x78, 0x7b, 0x7a, 0x7b, 0x7d, 0x7e, 0x7e, 0x81, 0x82, 0x82, 0x85, 0x84, 0x84, 0x87, 0x86, 0x87,
-0x87, 0x88, 0x87, 0x87, 0x86, 0x87, 0x85, 0x85, 0x84, 0x85, 0x83, 0x84, 0x82, 0x82, 0x82, 0x81,
-0x82, 0x81, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x82, 0x81, 0x83, 0x82, 0x83,
-0x83, 0x83, 0x84, 0x82, 0x83, 0x82, 0x83, 0x83, 0x82, 0x82, 0x82, 0x80, 0x81, 0x7f, 0x80, 0x7f,
-0x80, 0x7e, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7e, 0x80,
-0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7b, 0x79, 0x7b, 0x7a, 0x7b, 0x79, 0x79,
-0x79, 0x7b, 0x78, 0x7a, 0x7a, 0x7b, 0x79, 0x7b, 0x7b, 0x7a, 0x7b, 0x7b, 0x7c, 0x7c, 0x7d, 0x7d,
-0x7c, 0x7d, 0x7d, 0x7d, 0x7c, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f,
-0x7e, 0x7f, 0x7e, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80,
-0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80,
-0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f,
-0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f,
-0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80,
-0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
-0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
-0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e,
-0x7d, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7e, 0x7d, 0x7d, 0x7e, 0x7d, 0x7e, 0x7d, 0x7e,
-0x7d, 0x7e, 0x7d, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f,
-0x7e, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80,
-0x81, 0x80, 0x81, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81,
-0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f,
-0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f,
-0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
-0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f,
-0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80,
-0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80,
-0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f,
-0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7e,
-0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e,
-0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e,
-0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f,
-0x80, 0x7e, 0x80, 0x80, 0x7f, 0x80, 0x84, 0x82, 0x7e, 0x81, 0x7e, 0x7f, 0x7f, 0x80, 0x7f, 0x80,
-0x7f, 0x7e, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x80, 0x7e, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7f,
-0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-0x81, 0x81, 0x7e, 0x7e, 0x80, 0x7e, 0x7f, 0x7f, 0x7d, 0x81, 0x7f, 0x7f, 0x80, 0x80, 0x7d, 0x81,
-0x7f, 0x7d, 0x83, 0x7d, 0x7e, 0x82, 0x7f, 0x7e, 0x7e, 0x81, 0x7f, 0x7e, 0x81, 0x7f, 0x7e, 0x80,
-0x82, 0x7b, 0x80, 0x82, 0x7d, 0x7f, 0x83, 0x7f, 0x7a, 0x86, 0x7f, 0x7b, 0x82, 0x7e, 0x7f, 0x7f,
-0x80, 0x7d, 0x80, 0x80, 0x7d, 0x7f, 0x80, 0x7e, 0x7e, 0x81, 0x7b, 0x81, 0x80, 0x7e, 0x7e, 0x81,
-0x7e, 0x7f, 0x7f, 0x7f, 0x81, 0x7c, 0x81, 0x80, 0x7e, 0x7f, 0x7f, 0x81, 0x7f, 0x7c, 0x83, 0x7e,
-0x7c, 0x82, 0x80, 0x80, 0x7a, 0x83, 0x7e, 0x80, 0x7f, 0x7d, 0x80, 0x80, 0x7f, 0x7f, 0x81, 0x7c,
-0x81, 0x80, 0x7e, 0x7f, 0x80, 0x7d, 0x82, 0x80, 0x7b, 0x82, 0x80, 0x80, 0x7d, 0x81, 0x82, 0x7a,
-0x83, 0x80, 0x7b, 0x85, 0x7a, 0x7f, 0x86, 0x7a, 0x7d, 0x83, 0x7f, 0x7a, 0x84, 0x7e, 0x7b, 0x82,
-0x82, 0x7a, 0x81, 0x84, 0x78, 0x82, 0x7f, 0x7e, 0x7c, 0x85, 0x79, 0x85, 0x7c, 0x7f, 0x83, 0x7a,
-0x81, 0x80, 0x81, 0x7a, 0x82, 0x7f, 0x7f, 0x7e, 0x7d, 0x83, 0x7c, 0x7e, 0x84, 0x7c, 0x7d, 0x88,
-0x76, 0x83, 0x84, 0x76, 0x84, 0x82, 0x7c, 0x85, 0x79, 0x7f, 0x86, 0x7c, 0x78, 0x85, 0x84, 0x74,
-0x86, 0x84, 0x75, 0x85, 0x82, 0x77, 0x84, 0x7f, 0x7e, 0x7f, 0x7e, 0x81, 0x7f, 0x7e, 0x7f, 0x82,
-0x77, 0x83, 0x82, 0x7d, 0x7b, 0x83, 0x82, 0x74, 0x89, 0x7e, 0x75, 0x8d, 0x78, 0x7b, 0x8b, 0x74,
-0x7b, 0x8d, 0x76, 0x7e, 0x84, 0x7e, 0x7a, 0x85, 0x83, 0x73, 0x86, 0x85, 0x75, 0x84, 0x7f, 0x77,
-0x8c, 0x79, 0x7c, 0x8d, 0x6f, 0x88, 0x84, 0x75, 0x82, 0x82, 0x7c, 0x80, 0x7e, 0x81, 0x83, 0x72,
-0x8e, 0x7a, 0x78, 0x89, 0x7c, 0x7e, 0x83, 0x7d, 0x80, 0x82, 0x7e, 0x80, 0x7e, 0x83, 0x7f, 0x7d,
-0x81, 0x82, 0x77, 0x85, 0x80, 0x78, 0x84, 0x83, 0x73, 0x85, 0x84, 0x78, 0x81, 0x81, 0x7f, 0x7a,
-0x84, 0x82, 0x76, 0x82, 0x89, 0x74, 0x7f, 0x88, 0x79, 0x7d, 0x88, 0x79, 0x80, 0x83, 0x7a, 0x87,
-0x79, 0x7f, 0x86, 0x7c, 0x7e, 0x80, 0x80, 0x80, 0x7f, 0x7c, 0x84, 0x7f, 0x73, 0x8c, 0x7f, 0x75,
-0x84, 0x84, 0x74, 0x8a, 0x7f, 0x72, 0x91, 0x78, 0x78, 0x89, 0x7c, 0x7c, 0x85, 0x79, 0x80, 0x82,
-0x7d, 0x7c, 0x85, 0x7d, 0x79, 0x88, 0x79, 0x80, 0x80, 0x7d, 0x7d, 0x84, 0x80, 0x7b, 0x7f, 0x80,
-0x82, 0x7c, 0x80, 0x7f, 0x80, 0x7b, 0x82, 0x81, 0x7a, 0x7f, 0x82, 0x7b, 0x82, 0x82, 0x77, 0x86,
-0x7d, 0x7f, 0x81, 0x7c, 0x7d, 0x84, 0x7e, 0x7d, 0x80, 0x83, 0x7c, 0x7d, 0x88, 0x78, 0x80, 0x80,
-0x82, 0x77, 0x84, 0x84, 0x72, 0x84, 0x85, 0x7d, 0x7d, 0x82, 0x81, 0x75, 0x89, 0x85, 0x6c, 0x87,
-0x8a, 0x71, 0x8a, 0x7f, 0x73, 0x8a, 0x80, 0x7a, 0x7c, 0x87, 0x77, 0x82, 0x83, 0x7d, 0x78, 0x84,
-0x84, 0x78, 0x82, 0x7c, 0x85, 0x81, 0x79, 0x7f, 0x88, 0x76, 0x82, 0x83, 0x7a, 0x81, 0x83, 0x79,
-0x7c, 0x8c, 0x76, 0x7c, 0x86, 0x7f, 0x7a, 0x81, 0x7f, 0x7f, 0x85, 0x7b, 0x7c, 0x8b, 0x76, 0x7a,
-0x88, 0x80, 0x7b, 0x7a, 0x88, 0x7b, 0x81, 0x7e, 0x7b, 0x85, 0x7b, 0x7d, 0x87, 0x7e, 0x77, 0x83,
-0x85, 0x79, 0x7f, 0x81, 0x7c, 0x8d, 0x71, 0x7a, 0x8d, 0x7a, 0x7e, 0x7f, 0x7a, 0x87, 0x78, 0x7e,
-0x88, 0x76, 0x7d, 0x8c, 0x75, 0x7b, 0x88, 0x7b, 0x7f, 0x7f, 0x82, 0x7b, 0x82, 0x80, 0x77, 0x8a,
-0x7f, 0x71, 0x87, 0x88, 0x73, 0x83, 0x85, 0x74, 0x86, 0x83, 0x77, 0x80, 0x85, 0x7b, 0x79, 0x89,
-0x80, 0x73, 0x88, 0x81, 0x7a, 0x7f, 0x82, 0x80, 0x76, 0x89, 0x7c, 0x7f, 0x82, 0x7b, 0x7e, 0x89,
-0x79, 0x79, 0x90, 0x74, 0x79, 0x8c, 0x82, 0x6e, 0x89, 0x83, 0x77, 0x86, 0x7f, 0x7a, 0x82, 0x85,
-0x77, 0x80, 0x83, 0x7f, 0x7a, 0x81, 0x83, 0x7a, 0x7d, 0x83, 0x7d, 0x7e, 0x81, 0x7e, 0x83, 0x79,
-0x81, 0x83, 0x7e, 0x7c, 0x7a, 0x8b, 0x79, 0x76, 0x91, 0x74, 0x7a, 0x87, 0x82, 0x7b, 0x7b, 0x85,
-0x81, 0x77, 0x85, 0x80, 0x79, 0x85, 0x7d, 0x7e, 0x7c, 0x8a, 0x75, 0x81, 0x7e, 0x7d, 0x87, 0x7a,
-0x7b, 0x84, 0x81, 0x76, 0x84, 0x86, 0x77, 0x77, 0x8d, 0x7a, 0x7e, 0x7e, 0x80, 0x80, 0x82, 0x77,
-0x82, 0x83, 0x7a, 0x7f, 0x7d, 0x84, 0x7f, 0x7d, 0x7a, 0x84, 0x81, 0x79, 0x84, 0x84, 0x73, 0x85,
-0x86, 0x70, 0x87, 0x87, 0x77, 0x7e, 0x80, 0x82, 0x7f, 0x78, 0x84, 0x7f, 0x7a, 0x83, 0x83, 0x78,
-0x7f, 0x85, 0x83, 0x71, 0x7f, 0x8e, 0x75, 0x80, 0x7e, 0x7e, 0x88, 0x75, 0x7f, 0x8d, 0x71, 0x80,
-0x8d, 0x6f, 0x86, 0x82, 0x79, 0x7f, 0x85, 0x80, 0x73, 0x84, 0x88, 0x7c, 0x78, 0x7f, 0x81, 0x85,
-0x77, 0x81, 0x8b, 0x6e, 0x81, 0x8e, 0x78, 0x77, 0x85, 0x82, 0x7a, 0x80, 0x83, 0x81, 0x73, 0x86,
-0x84, 0x7a, 0x80, 0x7f, 0x81, 0x7c, 0x7e, 0x81, 0x81, 0x7b, 0x83, 0x7a, 0x81, 0x82, 0x7c, 0x7d,
-0x84, 0x7c, 0x7f, 0x82, 0x7c, 0x83, 0x7a, 0x7f, 0x85, 0x7c, 0x7b, 0x81, 0x82, 0x7e, 0x7a, 0x84,
-0x7f, 0x80, 0x78, 0x86, 0x83, 0x77, 0x7f, 0x84, 0x7b, 0x81, 0x85, 0x74, 0x87, 0x7e, 0x7e, 0x7e,
-0x7e, 0x84, 0x7e, 0x7a, 0x7d, 0x87, 0x7e, 0x77, 0x87, 0x89, 0x71, 0x7f, 0x85, 0x7d, 0x82, 0x7e,
-0x7b, 0x82, 0x87, 0x75, 0x82, 0x84, 0x77, 0x82, 0x87, 0x79, 0x79, 0x86, 0x7f, 0x7e, 0x7e, 0x7f,
-0x7d, 0x80, 0x82, 0x81, 0x7e, 0x7e, 0x76, 0x8c, 0x83, 0x74, 0x85, 0x7f, 0x7d, 0x7c, 0x86, 0x82,
-0x7b, 0x79, 0x84, 0x82, 0x7e, 0x7d, 0x81, 0x7f, 0x7d, 0x82, 0x7c, 0x83, 0x7c, 0x80, 0x7d, 0x82,
-0x80, 0x7f, 0x7a, 0x81, 0x86, 0x76, 0x80, 0x83, 0x7f, 0x7b, 0x83, 0x7f, 0x76, 0x85, 0x85, 0x7c,
-0x7a, 0x83, 0x7e, 0x7b, 0x8a, 0x81, 0x6e, 0x87, 0x89, 0x77, 0x82, 0x80, 0x79, 0x7e, 0x8a, 0x7c,
-0x74, 0x89, 0x7b, 0x7e, 0x7f, 0x82, 0x7a, 0x7f, 0x84, 0x78, 0x84, 0x82, 0x7b, 0x7c, 0x81, 0x7e,
-0x81, 0x81, 0x7b, 0x7d, 0x89, 0x7a, 0x7c, 0x83, 0x78, 0x85, 0x7e, 0x7b, 0x80, 0x86, 0x78, 0x7d,
-0x88, 0x81, 0x73, 0x82, 0x86, 0x7b, 0x7f, 0x7e, 0x82, 0x81, 0x7d, 0x7e, 0x80, 0x7d, 0x87, 0x77,
-0x7e, 0x86, 0x7f, 0x77, 0x81, 0x86, 0x7a, 0x7d, 0x84, 0x81, 0x78, 0x7e, 0x84, 0x80, 0x7c, 0x7f,
-0x7e, 0x83, 0x7d, 0x7e, 0x82, 0x80, 0x7c, 0x7d, 0x85, 0x7a, 0x84, 0x7c, 0x7e, 0x80, 0x81, 0x7e,
-0x80, 0x80, 0x7c, 0x82, 0x80, 0x80, 0x7b, 0x7f, 0x87, 0x7d, 0x77, 0x87, 0x7e, 0x7d, 0x80, 0x7c,
-0x84, 0x7b, 0x81, 0x80, 0x7e, 0x7c, 0x85, 0x80, 0x7c, 0x80, 0x7e, 0x82, 0x7a, 0x81, 0x84, 0x78,
-0x7a, 0x8d, 0x80, 0x72, 0x83, 0x86, 0x7b, 0x7d, 0x7f, 0x83, 0x83, 0x74, 0x83, 0x88, 0x7b, 0x73,
-0x87, 0x89, 0x74, 0x80, 0x85, 0x7e, 0x7d, 0x7b, 0x85, 0x7e, 0x7d, 0x80, 0x7e, 0x80, 0x7f, 0x7e,
-0x82, 0x82, 0x77, 0x84, 0x7e, 0x7f, 0x82, 0x7b, 0x7e, 0x84, 0x80, 0x7b, 0x82, 0x7c, 0x7f, 0x82,
-0x83, 0x7a, 0x7d, 0x82, 0x7d, 0x83, 0x7e, 0x7d, 0x7f, 0x83, 0x7c, 0x7f, 0x85, 0x77, 0x81, 0x82,
-0x7d, 0x7e, 0x7f, 0x82, 0x7c, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x82, 0x7d, 0x80, 0x7a, 0x86, 0x82,
-0x76, 0x84, 0x7f, 0x7f, 0x7d, 0x82, 0x81, 0x7b, 0x7c, 0x82, 0x81, 0x80, 0x7b, 0x7f, 0x81, 0x7e,
-0x81, 0x7b, 0x85, 0x7c, 0x7d, 0x7e, 0x83, 0x82, 0x7b, 0x7b, 0x81, 0x84, 0x7d, 0x7c, 0x80, 0x7e,
-0x80, 0x83, 0x7c, 0x7e, 0x7f, 0x80, 0x7e, 0x7f, 0x80, 0x7d, 0x82, 0x7e, 0x7e, 0x82, 0x7d, 0x7c,
-0x83, 0x80, 0x7d, 0x81, 0x7f, 0x7e, 0x7f, 0x81, 0x7c, 0x80, 0x83, 0x7e, 0x7d, 0x7f, 0x7f, 0x7c,
-0x82, 0x81, 0x7f, 0x7a, 0x81, 0x80, 0x7a, 0x83, 0x83, 0x79, 0x7e, 0x82, 0x7e, 0x82, 0x7d, 0x80,
-0x7e, 0x7f, 0x85, 0x7b, 0x7c, 0x82, 0x80, 0x7e, 0x80, 0x7d, 0x7f, 0x81, 0x7e, 0x7e, 0x7f, 0x84,
-0x7b, 0x7d, 0x84, 0x7e, 0x7e, 0x7e, 0x7f, 0x83, 0x7e, 0x7c, 0x82, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e,
-0x82, 0x7c, 0x7d, 0x82, 0x81, 0x7a, 0x7f, 0x82, 0x7e, 0x7f, 0x80, 0x7e, 0x7f, 0x80, 0x7e, 0x7f,
-0x7e, 0x7f, 0x80, 0x7c, 0x80, 0x82, 0x7f, 0x7e, 0x7f, 0x7e, 0x81, 0x81, 0x7f, 0x7c, 0x7f, 0x80,
-0x82, 0x7d, 0x7c, 0x82, 0x7e, 0x7d, 0x81, 0x82, 0x7d, 0x7c, 0x81, 0x80, 0x7e, 0x7f, 0x7e, 0x7f,
-0x7e, 0x7d, 0x82, 0x83, 0x7d, 0x7c, 0x81, 0x81, 0x82, 0x7a, 0x7d, 0x84, 0x7f, 0x7c, 0x81, 0x80,
-0x7d, 0x80, 0x7d, 0x82, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x81, 0x81, 0x7d, 0x7e, 0x80, 0x81, 0x7f,
-0x7f, 0x7f, 0x7e, 0x7e, 0x81, 0x82, 0x7b, 0x7d, 0x83, 0x80, 0x7d, 0x7e, 0x81, 0x81, 0x7b, 0x7d,
-0x86, 0x7e, 0x79, 0x81, 0x82, 0x7f, 0x7d, 0x81, 0x80, 0x7d, 0x7f, 0x81, 0x82, 0x7e, 0x7d, 0x81,
-0x81, 0x7e, 0x80, 0x7e, 0x80, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x7e, 0x7f, 0x80, 0x7f, 0x80,
-0x7e, 0x7e, 0x80, 0x7f, 0x7f, 0x7d, 0x81, 0x7e, 0x80, 0x7f, 0x80, 0x80, 0x7e, 0x7f, 0x7f, 0x80,
-0x80, 0x7e, 0x7f, 0x7e, 0x81, 0x7e, 0x7e, 0x82, 0x7e, 0x7d, 0x7e, 0x81, 0x80, 0x7e, 0x7f, 0x7f,
-0x7f, 0x81, 0x7f, 0x7e, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7d, 0x80, 0x80, 0x7f, 0x7e, 0x80, 0x7e,
-0x7e, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x80, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x80, 0x7f,
-0x7f, 0x7e, 0x80, 0x7f, 0x80, 0x7e, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7e,
-0x80, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x7e, 0x80, 0x7f, 0x7e, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-0x7e, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x80, 0x7e, 0x7f, 0x80, 0x7f, 0x80, 0x7e, 0x80, 0x80, 0x7e,
-0x80, 0x7e, 0x7f, 0x7f, 0x7e, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7e, 0x7f,
-0x7f, 0x80, 0x7e, 0x80, 0x80, 0x7f, 0x80, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x7e, 0x80, 0x7f, 0x80,
-0x7e, 0x7f, 0x7e, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x7e, 0x80, 0x7f, 0x80,
-0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x80, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x80,
-0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x80, 0x7f, 0x7e,
-0x80, 0x7e, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f,
-0x7e, 0x7f, 0x7e, 0x80, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x80, 0x7e, 0x7f, 0x7f, 0x80, 0x7e, 0x7f,
-0x7e, 0x80, 0x7e, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x80, 0x7e, 0x7f, 0x7e, 0x7f, 0x7e, 0x7f,
-0x7e, 0x80, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x80, 0x7e, 0x80, 0x7f,
-0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x7e, 0x80,
-0x7e, 0x7f, 0x7f, 0x7e, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x7f, 0x80, 0x7f, 0x80,
-0x7f, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x80, 0x7f, 0x80, 0x7f, 
-};
-#endif
@@ -0,0 +1,280 @@
+// metrics.cpp
+// Prometheus text-format metrics, served at /metrics.
+#include "metrics.h"
+#include "static_assets.h" // For boot-to-first-page time
+#include "settings_manager.h" // For settings load time
+#include "alarm_debounce.h" // For suppressed alarm flaps
+#include "audio_engine.h" // For audio underruns
+#include "audio_mixer.h"  // For mixer cost and suppressed alarm sounds
+#include "clip_player.h"  // For clip decode cost
+#include "wifi_manager.h" // For WiFi connects
+#include "power_manager.h" // For web activity and power state times
+#include "response_cache.h" // For JSON/CBOR encode cost
+
+const int HISTOGRAM_MAX_BUCKETS = 8;
+const int MAX_TRACKED_HTTP_CODES = 8;
+
+// Histogram with fixed upper bounds; counts are per bucket (made cumulative when rendered).
+// Observations above the last bound only appear in the +Inf bucket (= count).
+struct Histogram {
+    const char* name;
+    const char* help;
+    const uint32_t* bounds;
+    uint8_t boundCount;
+    uint32_t buckets[HISTOGRAM_MAX_BUCKETS];
+    uint32_t count;
+    uint64_t sum;
+};
+
+static const uint32_t SCAN_DURATION_BOUNDS_MS[] = { 250, 500, 1000, 2000, 4000, 8000, 16000 };
+static const uint32_t PAYLOAD_BOUNDS_BYTES[] = { 1024, 4096, 8192, 16384, 32768, 65536 };
+static const uint32_t ROW_BOUNDS[] = { 0, 5, 10, 25, 50, 100, 200 };
+static const uint32_t KEPT_BOUNDS[] = { 0, 1, 2, 5, 10, 20, 50 };
+static const uint32_t REQUEST_BOUNDS_MS[] = { 5, 10, 25, 50, 100, 250, 1000 };
+static const uint32_t WIFI_CONNECT_BOUNDS_MS[] = { 250, 500, 1000, 2000, 4000, 8000, 16000, 60000 };
+
+#define BOUNDS(array) array, sizeof(array) / sizeof(array[0])
+
+static Histogram scanDuration = { "flight_scan_duration_ms", "Wall time of a flight scan", BOUNDS(SCAN_DURATION_BOUNDS_MS) };
+static Histogram scanPayload = { "flight_scan_payload_bytes", "API response body size", BOUNDS(PAYLOAD_BOUNDS_BYTES) };
+static Histogram scanRows = { "flight_scan_rows_parsed", "State rows parsed per scan", BOUNDS(ROW_BOUNDS) };
+static Histogram scanKept = { "flight_scan_aircraft_kept", "Aircraft inside the monitoring radius per scan", BOUNDS(KEPT_BOUNDS) };
+static Histogram requestDuration = { "http_request_duration_ms", "Time from handler start until the response was sent", BOUNDS(REQUEST_BOUNDS_MS) };
+static Histogram wifiConnectDuration = { "wifi_connect_duration_ms", "Time from boot or a lost connection until WiFi had an address again", BOUNDS(WIFI_CONNECT_BOUNDS_MS) };
+
+static uint32_t scanOutcomes[SCAN_OUTCOME_COUNT];
+static int httpCodes[MAX_TRACKED_HTTP_CODES];
+static uint32_t httpCodeCounts[MAX_TRACKED_HTTP_CODES];
+static uint32_t webRequests[ROUTE_COUNT];
+static uint64_t handlerMicros[ROUTE_COUNT];
+static uint32_t alarmActivations[4]; // Index = alarm level 1-3
+static uint32_t altitudeFilteredAircraft = 0;
+static uint32_t loopPassMaxUs[2]; // Index 1 = passes that ran a flight scan
+
+static const char* const SCAN_OUTCOME_LABELS[SCAN_OUTCOME_COUNT] = {
+    "ok", "wifi_down", "connect_failed", "http_error", "parse_error"
+};
+static const char* const ROUTE_LABELS[ROUTE_COUNT] = {
+    "static", "live_data", "scan_history", "settings", "metrics", "other"
+};
+static const char* const PAYLOAD_LABELS[PAYLOAD_COUNT] = { "live_data", "scan_history" };
+
+/**
+ * @brief Adds one observation to a histogram.
+ */
+static void observe(Histogram& histogram, uint32_t value) {
+    for (uint8_t i = 0; i < histogram.boundCount; i++) {
+        if (value <= histogram.bounds[i]) {
+            histogram.buckets[i]++;
+            break;
+        }
+    }
+    histogram.count++;
+    histogram.sum += value;
+}
+
+/**
+ * @brief Records the outcome of a scan.
+ * @param outcome Scan outcome.
+ * @param httpCode HTTP status (or negative HTTPClient error); 0 if no request was made.
+ * @param durationMs Scan wall time.
+ */
+void metricsRecordScan(ScanOutcome outcome, int httpCode, uint32_t durationMs) {
+    scanOutcomes[outcome]++;
+    if (outcome != SCAN_WIFI_DOWN) {
+        observe(scanDuration, durationMs);
+    }
+    if (httpCode == 0) {
+        return;
+    }
+    for (int i = 0; i < MAX_TRACKED_HTTP_CODES; i++) {
+        if (httpCodes[i] == httpCode || httpCodes[i] == 0) {
+            httpCodes[i] = httpCode;
+            httpCodeCounts[i]++;
+            return;
+        }
+    }
+    // Table full: the code is only visible through the outcome counters
+}
+
+/**
+ * @brief Records the size of a successfully received scan.
+ * @param payloadBytes Body size (negative if unknown).
+ * @param rowsParsed State rows in the response.
+ * @param aircraftKept Aircraft inside the monitoring radius.
+ */
+void metricsRecordScanPayload(int payloadBytes, uint32_t rowsParsed, uint32_t aircraftKept, uint32_t altitudeFiltered) {
+    altitudeFilteredAircraft += altitudeFiltered;
+    if (payloadBytes >= 0) {
+        observe(scanPayload, payloadBytes);
+    }
+    observe(scanRows, rowsParsed);
+    observe(scanKept, aircraftKept);
+}
+
+/**
+ * @brief Counts an alarm activation: the overall level rising from none, or escalating to
+ * the more urgent 'level'. Stepping down to a less urgent level is not an activation.
+ * @param level Alarm level 1-3.
+ */
+void metricsRecordAlarm(int level) {
+    if (level >= 1 && level <= 3) {
+        alarmActivations[level]++;
+    }
+}
+
+/**
+ * @brief Records how long it took to (re)connect to WiFi.
+ * @param durationMs Time from boot or the loss of the connection until the station had an address.
+ */
+void metricsRecordWifiConnect(uint32_t durationMs) {
+    observe(wifiConnectDuration, durationMs);
+}
+
+/**
+ * @brief Tracks the longest loop() pass, i.e. the longest stall of everything loop() drives.
+ * @param durationUs Duration of the pass.
+ * @param scanned true if the pass ran a flight scan (those are expected to take seconds).
+ */
+void metricsRecordLoopPass(uint32_t durationUs, bool scanned) {
+    loopPassMaxUs[scanned] = max(loopPassMaxUs[scanned], durationUs);
+}
+
+/**
+ * @brief Counts a web request and times it until its connection is done.
+ * Call at the start of a handler.
+ * @param request Request being handled.
+ * @param route Route label.
+ */
+void metricsTrackRequest(AsyncWebServerRequest* request, WebRoute route) {
+    webRequests[route]++;
+    powerNoteWebActivity();
+    unsigned long startMs = millis();
+    request->onDisconnect([startMs]() {
+        observe(requestDuration, millis() - startMs);
+    });
+}
+
+/**
+ * @brief Adds the CPU time a request handler took, from its start until the response
+ * was queued. Streaming the body afterwards is not included.
+ * @param route Route label.
+ * @param durationUs Handler time; the handler runs without being preempted, so this is its CPU time.
+ */
+void metricsRecordHandlerTime(WebRoute route, uint32_t durationUs) {
+    handlerMicros[route] += durationUs;
+}
+
+/**
+ * @brief Writes a histogram in Prometheus text format.
+ */
+static void printHistogram(Print& out, const Histogram& histogram) {
+    out.printf("# HELP %s %s\n# TYPE %s histogram\n", histogram.name, histogram.help, histogram.name);
+    uint32_t cumulative = 0;
+    for (uint8_t i = 0; i < histogram.boundCount; i++) {
+        cumulative += histogram.buckets[i];
+        out.printf("%s_bucket{le=\"%u\"} %u\n", histogram.name, histogram.bounds[i], cumulative);
+    }
+    out.printf("%s_bucket{le=\"+Inf\"} %u\n", histogram.name, histogram.count);
+    out.printf("%s_sum %llu\n%s_count %u\n", histogram.name, histogram.sum, histogram.name, histogram.count);
+}
+
+/**
+ * @brief Handles GET /metrics.
+ */
+void handleMetrics(AsyncWebServerRequest* request) {
+    metricsTrackRequest(request, ROUTE_METRICS);
+    AsyncResponseStream* out = request->beginResponseStream("text/plain; version=0.0.4");
+
+    out->printf("# HELP esp_free_heap_bytes Free heap\n# TYPE esp_free_heap_bytes gauge\nesp_free_heap_bytes %u\n",
+                ESP.getFreeHeap());
+    out->printf("# HELP esp_max_free_block_bytes Largest allocatable block\n# TYPE esp_max_free_block_bytes gauge\nesp_max_free_block_bytes %u\n",
+                ESP.getMaxFreeBlockSize());
+    out->printf("# HELP esp_heap_fragmentation_percent Heap fragmentation\n# TYPE esp_heap_fragmentation_percent gauge\nesp_heap_fragmentation_percent %u\n",
+                ESP.getHeapFragmentation());
+    out->printf("# HELP esp_uptime_seconds Time since boot\n# TYPE esp_uptime_seconds counter\nesp_uptime_seconds %lu\n",
+                millis() / 1000);
+    if (getFirstPageServedMs() != 0) {
+        out->printf("# HELP esp_boot_to_first_page_ms Time from boot until the UI was first served\n# TYPE esp_boot_to_first_page_ms gauge\nesp_boot_to_first_page_ms %lu\n",
+                    getFirstPageServedMs());
+    }
+    out->printf("# HELP esp_settings_load_microseconds Time spent loading settings at boot\n# TYPE esp_settings_load_microseconds gauge\nesp_settings_load_microseconds %lu\n",
+                getSettingsLoadMicros());
+
+    out->print(F("# HELP flight_scans_total Flight scans by outcome\n# TYPE flight_scans_total counter\n"));
+    for (int i = 0; i < SCAN_OUTCOME_COUNT; i++) {
+        out->printf("flight_scans_total{outcome=\"%s\"} %u\n", SCAN_OUTCOME_LABELS[i], scanOutcomes[i]);
+    }
+    out->print(F("# HELP flight_scan_http_responses_total API responses by HTTP status (negative: client error)\n# TYPE flight_scan_http_responses_total counter\n"));
+    for (int i = 0; i < MAX_TRACKED_HTTP_CODES && httpCodes[i] != 0; i++) {
+        out->printf("flight_scan_http_responses_total{code=\"%d\"} %u\n", httpCodes[i], httpCodeCounts[i]);
+    }
+    printHistogram(*out, scanDuration);
+    printHistogram(*out, scanPayload);
+    printHistogram(*out, scanRows);
+    printHistogram(*out, scanKept);
+    out->printf("# HELP alarm_flaps_suppressed_total Level changes held back by the hysteresis band or dwell time\n# TYPE alarm_flaps_suppressed_total counter\nalarm_flaps_suppressed_total %u\n",
+                getSuppressedFlapCount());
+    out->printf("# HELP alarm_tracked_aircraft Aircraft in the alarm debounce table\n# TYPE alarm_tracked_aircraft gauge\nalarm_tracked_aircraft %u\n",
+                (unsigned)getTrackedAircraftCount());
+    out->printf("# HELP audio_underrun_samples_total Audio samples output as silence because the buffer refill was late\n# TYPE audio_underrun_samples_total counter\naudio_underrun_samples_total %u\n",
+                audioEngineUnderruns());
+    out->printf("# HELP audio_isr_cycles_max Most CPU cycles one sample interrupt has taken (budget %u)\n# TYPE audio_isr_cycles_max gauge\naudio_isr_cycles_max %u\n",
+                AUDIO_CYCLES_PER_SAMPLE, audioEngineIsrCyclesMax());
+    out->printf("# HELP audio_mix_cycles_per_sample_max Most CPU cycles the mixer has spent per output sample\n# TYPE audio_mix_cycles_per_sample_max gauge\naudio_mix_cycles_per_sample_max %u\n",
+                mixerCyclesPerSampleMax());
+    out->printf("# HELP audio_clip_decode_cycles_per_sample_max Most CPU cycles IMA-ADPCM clip decoding has taken per sample\n# TYPE audio_clip_decode_cycles_per_sample_max gauge\naudio_clip_decode_cycles_per_sample_max %u\n",
+                clipDecodeCyclesPerSampleMax());
+    out->print(F("# HELP alarm_sounds_suppressed_total Alarm sound starts skipped by the mixer\n# TYPE alarm_sounds_suppressed_total counter\n"));
+    out->printf("alarm_sounds_suppressed_total{reason=\"cooldown\"} %u\nalarm_sounds_suppressed_total{reason=\"preempted\"} %u\n",
+                mixerCooldownSuppressed(), mixerPreempted());
+    printHistogram(*out, wifiConnectDuration);
+    out->printf("# HELP wifi_connects_total Successful WiFi connections by path (cached: RTC-cached access point and address)\n# TYPE wifi_connects_total counter\nwifi_connects_total{path=\"cached\"} %u\nwifi_connects_total{path=\"full\"} %u\n",
+                wifiConnectCount(true), wifiConnectCount(false));
+    out->printf("# HELP esp_loop_pass_max_microseconds Longest loop() pass since boot\n# TYPE esp_loop_pass_max_microseconds gauge\nesp_loop_pass_max_microseconds{scan=\"false\"} %u\nesp_loop_pass_max_microseconds{scan=\"true\"} %u\n",
+                loopPassMaxUs[0], loopPassMaxUs[1]);
+    out->print(F("# HELP power_state_milliseconds_total Time in each power state since boot\n# TYPE power_state_milliseconds_total counter\n"));
+    out->printf("power_state_milliseconds_total{state=\"active\"} %llu\npower_state_milliseconds_total{state=\"modem_sleep\"} %llu\npower_state_milliseconds_total{state=\"light_sleep\"} %llu\n",
+                powerStateMs(POWER_ACTIVE), powerStateMs(POWER_MODEM_SLEEP), powerStateMs(POWER_LIGHT_SLEEP));
+    uint32_t dutyPermille = powerDutyCycleEstimatePermille();
+    out->printf("# HELP power_duty_cycle_estimate_ratio Estimated share of the time since boot the CPU was awake: time outside light-sleep waits, counted as fully asleep (a lower bound)\n# TYPE power_duty_cycle_estimate_ratio gauge\npower_duty_cycle_estimate_ratio %u.%03u\n",
+                dutyPermille / 1000, dutyPermille % 1000);
+    out->printf("# HELP power_average_current_estimate_milliamps Average supply current since boot, estimated from the time in each power state and datasheet currents; not measured (a lower bound)\n# TYPE power_average_current_estimate_milliamps gauge\npower_average_current_estimate_milliamps %u.%03u\n",
+                powerAverageCurrentUa() / 1000, powerAverageCurrentUa() % 1000);
+    out->printf("# HELP flight_altitude_filtered_total Aircraft demoted or dropped by the altitude ceilings\n# TYPE flight_altitude_filtered_total counter\nflight_altitude_filtered_total %u\n",
+                altitudeFilteredAircraft);
+
+    out->print(F("# HELP api_encode_microseconds Time the last build of a payload took, by encoding\n# TYPE api_encode_microseconds gauge\n"));
+    for (int payload = 0; payload < PAYLOAD_COUNT; payload++) {
+        for (int cbor = 0; cbor < 2; cbor++) {
+            out->printf("api_encode_microseconds{payload=\"%s\",encoding=\"%s\"} %u\n", PAYLOAD_LABELS[payload],
+                        cbor ? "cbor" : "json", lastEncodeStats((ResponsePayload)payload, cbor).micros);
+        }
+    }
+    out->print(F("# HELP api_body_bytes Size of the last build of a payload, by encoding\n# TYPE api_body_bytes gauge\n"));
+    for (int payload = 0; payload < PAYLOAD_COUNT; payload++) {
+        for (int cbor = 0; cbor < 2; cbor++) {
+            out->printf("api_body_bytes{payload=\"%s\",encoding=\"%s\"} %u\n", PAYLOAD_LABELS[payload],
+                        cbor ? "cbor" : "json", lastEncodeStats((ResponsePayload)payload, cbor).bytes);
+        }
+    }
+
+    out->print(F("# HELP http_requests_total Web requests by route\n# TYPE http_requests_total counter\n"));
+    for (int i = 0; i < ROUTE_COUNT; i++) {
+        out->printf("http_requests_total{route=\"%s\"} %u\n", ROUTE_LABELS[i], webRequests[i]);
+    }
+    out->print(F("# HELP http_handler_cpu_microseconds_total CPU time in the live data and history handlers, by route\n# TYPE http_handler_cpu_microseconds_total counter\n"));
+    for (WebRoute route : { ROUTE_LIVE_DATA, ROUTE_SCAN_HISTORY }) {
+        out->printf("http_handler_cpu_microseconds_total{route=\"%s\"} %llu\n", ROUTE_LABELS[route], handlerMicros[route]);
+    }
+    printHistogram(*out, requestDuration);
+
+    out->print(F("# HELP alarm_activations_total Alarm activations by level: the overall alarm rising from none or escalating to that level\n# TYPE alarm_activations_total counter\n"));
+    for (int level = 1; level <= 3; level++) {
+        out->printf("alarm_activations_total{level=\"%d\"} %u\n", level, alarmActivations[level]);
+    }
+    out->printf("# HELP flight_scan_sequence Completed scans since boot\n# TYPE flight_scan_sequence counter\nflight_scan_sequence %u\n",
+                scanSequence);
+
+    request->send(out);
+}
@@ -0,0 +1,41 @@
+// metrics.h
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+#include "globals.h" // For AsyncWebServerRequest
+
+// Outcome of one flight scan, for flight_scans_total{outcome=...}
+enum ScanOutcome {
+    SCAN_OK,
+    SCAN_WIFI_DOWN,
+    SCAN_CONNECT_FAILED,
+    SCAN_HTTP_ERROR,
+    SCAN_PARSE_ERROR,
+    SCAN_OUTCOME_COUNT
+};
+
+// Route label for http_requests_total{route=...}
+enum WebRoute {
+    ROUTE_STATIC,
+    ROUTE_LIVE_DATA,
+    ROUTE_SCAN_HISTORY,
+    ROUTE_SETTINGS,
+    ROUTE_METRICS,
+    ROUTE_OTHER,
+    ROUTE_COUNT
+};
+
+// Function declarations
+// All recorders are plain counter/bucket increments: they are only called from
+// loop() and network callbacks, which never preempt each other on the ESP8266.
+void metricsRecordScan(ScanOutcome outcome, int httpCode, uint32_t durationMs);
+void metricsRecordScanPayload(int payloadBytes, uint32_t rowsParsed, uint32_t aircraftKept, uint32_t altitudeFiltered);
+void metricsRecordAlarm(int level);
+void metricsRecordWifiConnect(uint32_t durationMs);
+void metricsRecordLoopPass(uint32_t durationUs, bool scanned);
+void metricsTrackRequest(AsyncWebServerRequest* request, WebRoute route);
+void metricsRecordHandlerTime(WebRoute route, uint32_t durationUs);
+void handleMetrics(AsyncWebServerRequest* request);
+
+#endif // METRICS_H
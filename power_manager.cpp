@@ -0,0 +1,150 @@
+// power_manager.cpp
+// Chooses the WiFi sleep type for the time between flight scans and idles loop() so the
+// SDK can use it. The station stays associated in every state; only how often the radio
+// (and in light sleep, the CPU) wakes between beacons changes:
+//
+//   ACTIVE       scan about to run, station not connected, or setup AP open
+//   MODEM_SLEEP  sound playing (timer1 must keep running), an alarm LED blinking,
+//                event-stream clients connected or a web request in the last POWER_WEB_HOLD_MS
+//   LIGHT_SLEEP  otherwise; loop() waits in delay() until the next scan, at most
+//                POWER_IDLE_SLICE_MS at a time
+//
+// Light sleep is the SDK's automatic one: it only happens inside delay(), and every
+// Ticker still fires on time, so the scan timer wakes the device deterministically.
+// Time in each state is accumulated for the duty cycle and current estimates in /metrics.
+// Both are best cases: the SDK gives no notice of when it actually sleeps, so every
+// light-sleep wait counts as asleep, though the CPU also wakes inside it for beacons,
+// Tickers and network traffic.
+#include "power_manager.h"
+#include "audio_engine.h"   // For audioEngineBusy
+#include "flight_scanner.h" // For msUntilNextScan
+#include "wifi_manager.h"   // For wifiStationReady
+
+static PowerState state = POWER_MODEM_SLEEP; // The core's default sleep type
+static uint64_t stateMs[POWER_STATE_COUNT];
+static uint32_t accountedMs = 0;
+static uint32_t lastWebActivityMs = 0;
+static bool webActivitySeen = false;
+
+/**
+ * @brief Books the time since the last call to 'which'.
+ */
+static void account(PowerState which) {
+    uint32_t now = millis();
+    stateMs[which] += now - accountedMs;
+    accountedMs = now;
+}
+
+/**
+ * @brief Books the loop() work since the last idle wait. The CPU was awake for it even
+ * with light sleep selected, and the radio still slept between beacons: modem sleep.
+ */
+static void accountWork() {
+    account(state == POWER_LIGHT_SLEEP ? POWER_MODEM_SLEEP : state);
+}
+
+/**
+ * @brief Applies a state's WiFi sleep type if it changed.
+ */
+static void enterState(PowerState next) {
+    if (next == state) {
+        return;
+    }
+    state = next;
+    switch (next) {
+        case POWER_ACTIVE:      WiFi.setSleepMode(WIFI_NONE_SLEEP); break;
+        case POWER_MODEM_SLEEP: WiFi.setSleepMode(WIFI_MODEM_SLEEP); break;
+        case POWER_LIGHT_SLEEP: WiFi.setSleepMode(WIFI_LIGHT_SLEEP, POWER_LISTEN_INTERVAL); break;
+        default: break;
+    }
+}
+
+/**
+ * @brief Picks the lowest state the device's current work allows.
+ */
+static PowerState idleState() {
+    if (!wifiStationReady() || (WiFi.getMode() & WIFI_AP)) {
+        return POWER_ACTIVE;
+    }
+    bool webActive = eventStream.count() > 0 ||
+                     (webActivitySeen && millis() - lastWebActivityMs < POWER_WEB_HOLD_MS);
+    if (audioEngineBusy() || currentOverallAlarmLevel > 0 || webActive) {
+        return POWER_MODEM_SLEEP;
+    }
+    return POWER_LIGHT_SLEEP;
+}
+
+/**
+ * @brief Turns the radio fully on for work that needs it (a flight scan).
+ * Call from loop() before the work; the next powerIdle() drops back.
+ */
+void powerWake() {
+    accountWork();
+#if POWER_SAVE_ENABLED
+    enterState(POWER_ACTIVE);
+#endif
+}
+
+/**
+ * @brief Idles the rest of the loop() pass in the lowest state that fits. Call at the
+ * end of loop(); returns after at most POWER_IDLE_SLICE_MS, or when the next scan is due.
+ */
+void powerIdle() {
+    accountWork();
+#if POWER_SAVE_ENABLED
+    PowerState next = idleState();
+    enterState(next);
+    if (next == POWER_ACTIVE) {
+        return; // Connection state machine and captive DNS want every pass
+    }
+    uint32_t waitMs = (next == POWER_LIGHT_SLEEP) ? POWER_IDLE_SLICE_MS : POWER_MODEM_SLICE_MS;
+    waitMs = min(waitMs, msUntilNextScan());
+    if (waitMs > 0) {
+        delay(waitMs);
+        account(next);
+    }
+#endif
+}
+
+/**
+ * @brief Holds off light sleep for POWER_WEB_HOLD_MS; called for every web request.
+ */
+void powerNoteWebActivity() {
+    lastWebActivityMs = millis();
+    webActivitySeen = true;
+}
+
+/**
+ * @brief Time spent in a state since boot.
+ */
+uint64_t powerStateMs(PowerState which) {
+    return stateMs[which];
+}
+
+/**
+ * @brief Estimated share of the time since boot the CPU was awake, in permille: the time
+ * outside light-sleep waits. A lower bound, since the CPU also wakes inside those waits.
+ */
+uint32_t powerDutyCycleEstimatePermille() {
+    uint64_t total = stateMs[POWER_ACTIVE] + stateMs[POWER_MODEM_SLEEP] + stateMs[POWER_LIGHT_SLEEP];
+    if (total == 0) {
+        return 1000;
+    }
+    return (uint32_t)((total - stateMs[POWER_LIGHT_SLEEP]) * 1000 / total);
+}
+
+/**
+ * @brief Estimated average supply current since boot, in microamps: the time in each
+ * state weighted by its datasheet current. Not measured; a lower bound for the same
+ * reason as the duty cycle estimate.
+ */
+uint32_t powerAverageCurrentUa() {
+    uint64_t total = stateMs[POWER_ACTIVE] + stateMs[POWER_MODEM_SLEEP] + stateMs[POWER_LIGHT_SLEEP];
+    if (total == 0) {
+        return POWER_ACTIVE_UA;
+    }
+    uint64_t charge = stateMs[POWER_ACTIVE] * POWER_ACTIVE_UA +
+                      stateMs[POWER_MODEM_SLEEP] * POWER_MODEM_SLEEP_UA +
+                      stateMs[POWER_LIGHT_SLEEP] * POWER_LIGHT_SLEEP_UA;
+    return (uint32_t)(charge / total);
+}
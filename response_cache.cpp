@@ -0,0 +1,418 @@
+// response_cache.cpp
+#include "response_cache.h"
+#include <ArduinoJson.h>
+#include <math.h>         // For lroundf
+#include <algorithm>      // For std::min
+#include "utils.h"        // For countProximityLevels
+#include "flight_delta.h" // For delta (since=N) responses
+#include "cbor_writer.h"  // For the compact binary representation
+
+static CachedResponsePtr liveDataResponse;
+static CachedResponsePtr scanHistoryResponse;
+static CachedResponsePtr liveDataCborResponse;    // Built on first CBOR request per version
+static CachedResponsePtr scanHistoryCborResponse;
+static CachedResponsePtr liveDataDeltaResponse;   // Last delta built, for the 'since' it was built for
+static uint32_t liveDataDeltaSince = 0;
+static uint32_t responseVersion = 0;
+static EncodeStats encodeStats[PAYLOAD_COUNT][2]; // Index 1 = CBOR
+
+/**
+ * @brief Estimates the JsonDocument capacity needed for a list of flights.
+ * @param flightCount Number of flights to serialize.
+ * @return Capacity in bytes.
+ */
+static size_t flightsJsonCapacity(size_t flightCount) {
+    // 12 members per flight plus room for the copied String values
+    return JSON_ARRAY_SIZE(flightCount) + flightCount * (JSON_OBJECT_SIZE(12) + 112);
+}
+
+/**
+ * @brief Writes one flight's fields into a JSON object.
+ * @param flightObj Destination object.
+ * @param flight Flight to serialize.
+ */
+static void serializeFlight(JsonObject flightObj, const FlightData& flight) {
+    flightObj["icao24"] = flight.icao24;
+    flightObj["callsign"] = flight.callsign;
+    flightObj["origin_country"] = flight.origin_country;
+    flightObj["latitude"] = flight.latitude;
+    flightObj["longitude"] = flight.longitude;
+    flightObj["altitude_baro"] = flight.altitude_baro;
+    flightObj["velocity"] = flight.velocity;
+    flightObj["true_track"] = flight.true_track;
+    flightObj["distance_km"] = flight.distance_km;
+    flightObj["proximity_level"] = flight.proximity_level;
+    flightObj["destination"] = flight.destination;
+    flightObj["site"] = flight.site;
+}
+
+/**
+ * @brief Returns the dashboard status text for an alarm level.
+ * @param level Overall alarm level (0-3).
+ */
+static const char* overallStatusText(int level) {
+    switch (level) {
+        case 1: return "LEVEL 1 ALARM";
+        case 2: return "LEVEL 2 WARNING";
+        case 3: return "LEVEL 3 DETECTION";
+        default: return "ALL CLEAR";
+    }
+}
+
+/**
+ * @brief Writes the scan sequence, overall status and per-level counts.
+ * @param doc Destination document (root object).
+ */
+static void serializeLiveStatus(JsonDocument& doc) {
+    int levelCounts[4];
+    countProximityLevels(currentFlights, levelCounts);
+
+    doc["seq"] = scanSequence;
+    doc["overallStatus"] = overallStatusText(currentOverallAlarmLevel);
+    doc["overallLevel"] = currentOverallAlarmLevel;
+    doc["level1Count"] = levelCounts[1];
+    doc["level2Count"] = levelCounts[2];
+    doc["level3Count"] = levelCounts[3];
+    doc["totalFlights"] = currentFlights.size();
+}
+
+/**
+ * @brief Serializes the current live data (status, counts and current flights).
+ * @param body Output JSON text.
+ */
+static void buildLiveDataJson(String& body) {
+    DynamicJsonDocument doc(JSON_OBJECT_SIZE(9) + flightsJsonCapacity(currentFlights.size()));
+    serializeLiveStatus(doc);
+    doc["full"] = true;
+
+    JsonArray flightsArray = doc.createNestedArray("currentFlights");
+    for (const FlightData& flight : currentFlights) {
+        serializeFlight(flightsArray.createNestedObject(), flight);
+    }
+    serializeJson(doc, body);
+}
+
+/**
+ * @brief Serializes only what changed after scan sequence 'since'.
+ * "upserts" holds aircraft added or changed, "removed" the icao24 codes that left.
+ * @param since Last sequence the client has applied.
+ * @param body Output JSON text.
+ * @return false if the delta cannot be built and a full snapshot must be sent instead.
+ */
+bool buildLiveDataDeltaJson(uint32_t since, String& body) {
+    if (!canServeDeltaSince(since)) {
+        return false;
+    }
+
+    size_t upsertCount = 0;
+    for (const FlightData& flight : currentFlights) {
+        if (flight.updated_seq > since) {
+            upsertCount++;
+        }
+    }
+    std::vector<String> removed;
+    collectRemovedSince(since, removed);
+
+    DynamicJsonDocument doc(JSON_OBJECT_SIZE(10) + flightsJsonCapacity(upsertCount) +
+                            JSON_ARRAY_SIZE(removed.size()) + removed.size() * 8);
+    serializeLiveStatus(doc);
+    doc["since"] = since;
+
+    JsonArray upserts = doc.createNestedArray("upserts");
+    for (const FlightData& flight : currentFlights) {
+        if (flight.updated_seq > since) {
+            serializeFlight(upserts.createNestedObject(), flight);
+        }
+    }
+    JsonArray removedArray = doc.createNestedArray("removed");
+    for (const String& icao24 : removed) {
+        removedArray.add(icao24);
+    }
+    serializeJson(doc, body);
+    return true;
+}
+
+/**
+ * @brief Serializes the scan history, newest entry first.
+ * @param body Output JSON text.
+ */
+static void buildScanHistoryJson(String& body) {
+    size_t capacity = JSON_ARRAY_SIZE(scanHistory.size());
+    for (const ScanHistoryEntry& entry : scanHistory) {
+        capacity += JSON_OBJECT_SIZE(7) + 24 + flightsJsonCapacity(entry.flights_at_scan.size());
+    }
+
+    DynamicJsonDocument doc(capacity);
+    JsonArray historyArray = doc.to<JsonArray>();
+    for (const ScanHistoryEntry& entry : scanHistory) {
+        JsonObject entryObj = historyArray.createNestedObject();
+        entryObj["timestamp"] = entry.timestamp;
+        entryObj["level1"] = entry.level1;
+        entryObj["level2"] = entry.level2;
+        entryObj["level3"] = entry.level3;
+        entryObj["total"] = entry.total;
+        entryObj["status"] = entry.status;
+
+        JsonArray flightsAtScan = entryObj.createNestedArray("flights_at_scan");
+        for (const FlightData& flight : entry.flights_at_scan) {
+            serializeFlight(flightsAtScan.createNestedObject(), flight);
+        }
+    }
+    serializeJson(doc, body);
+}
+
+// --- CBOR representation ---
+// Flights are sent as rows of plain integers/strings. The field names and the
+// fixed-point scale of each column are sent once per response ("schema"/"scale");
+// a scale of 0 marks a string column, otherwise value = integer / scale.
+
+static const char* const FLIGHT_SCHEMA[] = {
+    "icao24", "callsign", "origin_country", "latitude", "longitude", "altitude_baro",
+    "velocity", "true_track", "distance_km", "proximity_level", "destination", "site"
+};
+static const uint32_t FLIGHT_SCALE[] = { 0, 0, 0, 100000, 100000, 1, 10, 10, 100, 1, 0, 0 };
+const size_t FLIGHT_COLUMNS = sizeof(FLIGHT_SCALE) / sizeof(FLIGHT_SCALE[0]);
+
+/**
+ * @brief Writes the "schema" and "scale" map entries.
+ */
+static void writeFlightSchema(CborWriter& cbor) {
+    cbor.writeText("schema");
+    cbor.writeArray(FLIGHT_COLUMNS);
+    for (const char* name : FLIGHT_SCHEMA) {
+        cbor.writeText(name);
+    }
+    cbor.writeText("scale");
+    cbor.writeArray(FLIGHT_COLUMNS);
+    for (uint32_t scale : FLIGHT_SCALE) {
+        cbor.writeUnsigned(scale);
+    }
+}
+
+/**
+ * @brief Writes one flight as a row matching FLIGHT_SCHEMA.
+ */
+static void writeFlightRow(CborWriter& cbor, const FlightData& flight) {
+    cbor.writeArray(FLIGHT_COLUMNS);
+    cbor.writeText(flight.icao24);
+    cbor.writeText(flight.callsign);
+    cbor.writeText(flight.origin_country);
+    cbor.writeInt(lroundf(flight.latitude * 100000));
+    cbor.writeInt(lroundf(flight.longitude * 100000));
+    cbor.writeInt(lroundf(flight.altitude_baro));
+    cbor.writeInt(lroundf(flight.velocity * 10));
+    cbor.writeInt(lroundf(flight.true_track * 10));
+    cbor.writeInt(lroundf(flight.distance_km * 100));
+    cbor.writeInt(flight.proximity_level);
+    cbor.writeText(flight.destination);
+    cbor.writeText(flight.site);
+}
+
+/**
+ * @brief CBOR counterpart of buildLiveDataJson(); same member names.
+ */
+static void buildLiveDataCbor(std::vector<uint8_t>& body) {
+    int levelCounts[4];
+    countProximityLevels(currentFlights, levelCounts);
+
+    body.reserve(64 + currentFlights.size() * 48);
+    CborWriter cbor(body);
+    cbor.writeMap(11);
+    cbor.writeText("seq");           cbor.writeUnsigned(scanSequence);
+    cbor.writeText("overallStatus"); cbor.writeText(overallStatusText(currentOverallAlarmLevel));
+    cbor.writeText("overallLevel");  cbor.writeInt(currentOverallAlarmLevel);
+    cbor.writeText("level1Count");   cbor.writeInt(levelCounts[1]);
+    cbor.writeText("level2Count");   cbor.writeInt(levelCounts[2]);
+    cbor.writeText("level3Count");   cbor.writeInt(levelCounts[3]);
+    cbor.writeText("totalFlights");  cbor.writeUnsigned(currentFlights.size());
+    cbor.writeText("full");          cbor.writeBool(true);
+    writeFlightSchema(cbor);
+    cbor.writeText("currentFlights");
+    cbor.writeArray(currentFlights.size());
+    for (const FlightData& flight : currentFlights) {
+        writeFlightRow(cbor, flight);
+    }
+}
+
+/**
+ * @brief CBOR counterpart of buildScanHistoryJson(). The entries are wrapped in a
+ * map so the flight schema can be sent once for the whole history.
+ */
+static void buildScanHistoryCbor(std::vector<uint8_t>& body) {
+    CborWriter cbor(body);
+    cbor.writeMap(3);
+    writeFlightSchema(cbor);
+    cbor.writeText("history");
+    cbor.writeArray(scanHistory.size());
+    for (const ScanHistoryEntry& entry : scanHistory) {
+        cbor.writeMap(7);
+        cbor.writeText("timestamp"); cbor.writeUnsigned(entry.timestamp);
+        cbor.writeText("level1");    cbor.writeInt(entry.level1);
+        cbor.writeText("level2");    cbor.writeInt(entry.level2);
+        cbor.writeText("level3");    cbor.writeInt(entry.level3);
+        cbor.writeText("total");     cbor.writeInt(entry.total);
+        cbor.writeText("status");    cbor.writeText(entry.status);
+        cbor.writeText("flights_at_scan");
+        cbor.writeArray(entry.flights_at_scan.size());
+        for (const FlightData& flight : entry.flights_at_scan) {
+            writeFlightRow(cbor, flight);
+        }
+    }
+}
+
+/**
+ * @brief Creates an immutable response object for the given version.
+ * @param version Response version, used for the ETag.
+ * @param tag Single-letter prefix keeping ETags distinct between endpoints.
+ * @param payload Payload the cost is recorded for.
+ * @param builder Serializer that fills the body.
+ */
+static CachedResponsePtr makeResponse(uint32_t version, char tag, ResponsePayload payload, void (*builder)(String&)) {
+    std::shared_ptr<CachedResponse> response = std::make_shared<CachedResponse>();
+    response->version = version;
+    response->etag = String("\"") + tag + String(version) + "\"";
+    response->contentType = "application/json";
+    uint32_t start = micros();
+    builder(response->body);
+    response->encodeMicros = micros() - start;
+    encodeStats[payload][0] = { response->encodeMicros, response->body.length() };
+    return response;
+}
+
+/**
+ * @brief Binary variant of makeResponse(). ETags get a "c" suffix so a JSON
+ * validator never matches a CBOR body.
+ */
+static CachedResponsePtr makeCborResponse(uint32_t version, char tag, ResponsePayload payload, void (*builder)(std::vector<uint8_t>&)) {
+    std::shared_ptr<CachedResponse> response = std::make_shared<CachedResponse>();
+    response->version = version;
+    response->etag = String("\"") + tag + String(version) + "c\"";
+    response->contentType = "application/cbor";
+    uint32_t start = micros();
+    builder(response->binaryBody);
+    response->encodeMicros = micros() - start;
+    encodeStats[payload][1] = { response->encodeMicros, (uint32_t)response->binaryBody.size() };
+    return response;
+}
+
+/**
+ * @brief Re-serializes the live data and scan history payloads.
+ * Call once after every scan (and once at startup); requests are then answered
+ * from these buffers without touching the flight lists.
+ */
+void rebuildResponseCaches() {
+    responseVersion++;
+    liveDataResponse = makeResponse(responseVersion, 'L', PAYLOAD_LIVE_DATA, buildLiveDataJson);
+    scanHistoryResponse = makeResponse(responseVersion, 'H', PAYLOAD_SCAN_HISTORY, buildScanHistoryJson);
+    liveDataCborResponse.reset();
+    scanHistoryCborResponse.reset();
+    liveDataDeltaResponse.reset();
+}
+
+CachedResponsePtr getLiveDataResponse() {
+    return liveDataResponse;
+}
+
+CachedResponsePtr getScanHistoryResponse() {
+    return scanHistoryResponse;
+}
+
+CachedResponsePtr getLiveDataCborResponse() {
+    if (!liveDataCborResponse) {
+        liveDataCborResponse = makeCborResponse(responseVersion, 'L', PAYLOAD_LIVE_DATA, buildLiveDataCbor);
+    }
+    return liveDataCborResponse;
+}
+
+CachedResponsePtr getScanHistoryCborResponse() {
+    if (!scanHistoryCborResponse) {
+        scanHistoryCborResponse = makeCborResponse(responseVersion, 'H', PAYLOAD_SCAN_HISTORY, buildScanHistoryCbor);
+    }
+    return scanHistoryCborResponse;
+}
+
+/**
+ * @brief Delta live data (/getLiveData?since=N) as a cached response.
+ * Clients that are up to date all ask for the same 'since', so the last delta built is
+ * kept until the next scan; its ETag lets a repeated poll be answered with a 304.
+ * @param since Last sequence the client has applied.
+ * @return nullptr if the delta cannot be built and a full snapshot must be sent instead.
+ */
+CachedResponsePtr getLiveDataDeltaResponse(uint32_t since) {
+    if (liveDataDeltaResponse && liveDataDeltaSince == since) {
+        return liveDataDeltaResponse;
+    }
+    std::shared_ptr<CachedResponse> response = std::make_shared<CachedResponse>();
+    uint32_t start = micros();
+    if (!buildLiveDataDeltaJson(since, response->body)) {
+        return nullptr;
+    }
+    response->encodeMicros = micros() - start;
+    response->version = responseVersion;
+    response->etag = String("\"D") + String(responseVersion) + "-" + String(since) + "\"";
+    response->contentType = "application/json";
+    liveDataDeltaResponse = response;
+    liveDataDeltaSince = since;
+    return liveDataDeltaResponse;
+}
+
+/**
+ * @brief Sends a cached response, or 304 Not Modified if the client already has this version.
+ * The body is streamed from the cached buffer as the connection accepts data; the
+ * response holds a reference to it, so a rebuild mid-transfer cannot free it.
+ * @param request Request to answer.
+ * @param cached Response to send.
+ */
+void sendCachedResponse(AsyncWebServerRequest* request, const CachedResponsePtr& cached) {
+    if (!cached) {
+        request->send(503, "text/plain", "Data not ready yet.");
+        return;
+    }
+
+    AsyncWebServerResponse* response;
+    if (request->hasHeader("If-None-Match") && request->header("If-None-Match").indexOf(cached->etag) >= 0) {
+        response = request->beginResponse(304);
+    } else {
+        bool binary = !cached->binaryBody.empty();
+        const uint8_t* data = binary ? cached->binaryBody.data() : (const uint8_t*)cached->body.c_str();
+        size_t length = binary ? cached->binaryBody.size() : cached->body.length();
+        CachedResponsePtr keepAlive = cached;
+        response = request->beginResponse(cached->contentType, length,
+            [keepAlive, data, length](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+                size_t chunk = std::min(maxLen, length - index);
+                memcpy(buffer, data + index, chunk);
+                return chunk;
+            });
+    }
+    // no-cache: the browser may keep the body but must revalidate on every poll
+    response->addHeader("Cache-Control", "no-cache");
+    response->addHeader("ETag", cached->etag);
+    response->addHeader("Vary", "Accept");
+    request->send(response);
+}
+
+/**
+ * @brief Time and size of the last encoding of a payload, for comparing JSON with CBOR.
+ * The CBOR figures only exist once a client has asked for CBOR.
+ * @param payload Payload.
+ * @param cbor true for the CBOR encoding, false for JSON.
+ */
+EncodeStats lastEncodeStats(ResponsePayload payload, bool cbor) {
+    return encodeStats[payload][cbor];
+}
+
+/**
+ * @brief Serializes a JSON payload afresh for one request, as every request did before
+ * the cache existed. Only for load tests comparing the two (?nocache=1).
+ * @param payload Payload to build.
+ * @return nullptr until the first scan, like the cached path.
+ */
+CachedResponsePtr buildUncachedResponse(ResponsePayload payload) {
+    if (!liveDataResponse) {
+        return nullptr;
+    }
+    if (payload == PAYLOAD_LIVE_DATA) {
+        return makeResponse(responseVersion, 'L', payload, buildLiveDataJson);
+    }
+    return makeResponse(responseVersion, 'H', payload, buildScanHistoryJson);
+}
@@ -0,0 +1,49 @@
+// response_cache.h
+#ifndef RESPONSE_CACHE_H
+#define RESPONSE_CACHE_H
+
+#include <Arduino.h>
+#include <memory>    // For std::shared_ptr
+#include <vector>
+#include "globals.h" // For currentFlights, scanHistory, AsyncWebServerRequest
+
+// A serialized API response. Built once per scan and never modified afterwards;
+// a rebuild publishes a new object, so a handler holding a pointer always sees a
+// complete body.
+struct CachedResponse {
+    uint32_t version;
+    String etag;
+    const char* contentType;
+    String body;                      // JSON representation
+    std::vector<uint8_t> binaryBody;  // CBOR representation
+    uint32_t encodeMicros;            // Time spent serializing, for comparing the encodings
+};
+
+typedef std::shared_ptr<const CachedResponse> CachedResponsePtr;
+
+// Payloads whose JSON and CBOR encodings are compared in /metrics
+enum ResponsePayload {
+    PAYLOAD_LIVE_DATA,
+    PAYLOAD_SCAN_HISTORY,
+    PAYLOAD_COUNT
+};
+
+// Cost of the last encoding of one payload (0/0 until it has been built once)
+struct EncodeStats {
+    uint32_t micros;
+    uint32_t bytes;
+};
+
+// Function declarations
+void rebuildResponseCaches();
+CachedResponsePtr getLiveDataResponse();
+CachedResponsePtr getScanHistoryResponse();
+CachedResponsePtr getLiveDataCborResponse();
+CachedResponsePtr getScanHistoryCborResponse();
+bool buildLiveDataDeltaJson(uint32_t since, String& body);
+CachedResponsePtr getLiveDataDeltaResponse(uint32_t since);
+void sendCachedResponse(AsyncWebServerRequest* request, const CachedResponsePtr& cached);
+EncodeStats lastEncodeStats(ResponsePayload payload, bool cbor);
+CachedResponsePtr buildUncachedResponse(ResponsePayload payload);
+
+#endif // RESPONSE_CACHE_H
@@ -0,0 +1,361 @@
+// scan_geometry.cpp
+#include "scan_geometry.h"
+#include "utils.h" // For degToRad
+#include <math.h>
+
+// Double buffer: a rebuild fills the inactive slot and then flips the pointer, so a
+// reader holding the active geometry never sees a half-written one.
+static ScanGeometry geometryBuffers[2];
+static ScanGeometry* activeGeometry = &geometryBuffers[0];
+
+static const float KM_PER_DEG_LAT = 6371.0 * PI / 180.0; // Mean Earth radius
+
+/**
+ * @brief Fills the precomputed values of one site.
+ */
+static void buildSite(SiteGeometry& site, const String& name, float latitude, float longitude,
+                      float r1, float r2, float r3, SiteAlarmPolicy policy, float entryScale, float exitScale) {
+    site.name = name;
+    site.latitude = latitude;
+    site.longitude = longitude;
+    site.kmPerDegLon = KM_PER_DEG_LAT * cos(degToRad(latitude));
+    site.radiusSq[0] = 0;
+    site.radiusSq[1] = r1 * r1;
+    site.radiusSq[2] = r2 * r2;
+    site.radiusSq[3] = r3 * r3;
+    for (int level = 0; level <= 3; level++) {
+        site.exitRadiusSq[level] = site.radiusSq[level] * exitScale * exitScale;
+        site.radiusSq[level] *= entryScale * entryScale;
+    }
+    site.alarmPolicy = policy;
+}
+
+/**
+ * @brief Half-extents (degrees) of the box enclosing a site's Level 3 exit circle.
+ */
+static void siteSpan(const SiteGeometry& site, float& latSpan, float& lonSpan) {
+    float radius3 = sqrt(site.exitRadiusSq[3]);
+    latSpan = radius3 / KM_PER_DEG_LAT;
+    lonSpan = (site.kmPerDegLon > 0.01 * KM_PER_DEG_LAT) ? radius3 / site.kmPerDegLon : 180.0;
+}
+
+/**
+ * @brief Wraps a longitude difference into [-180, 180]: the shortest way, across the antimeridian if need be.
+ */
+static float wrapLongitudeDelta(float dLon) {
+    if (dLon > 180.0) return dLon - 360.0;
+    if (dLon < -180.0) return dLon + 360.0;
+    return dLon;
+}
+
+/**
+ * @brief The copy of 'longitude' (+/- 360) nearest to 'reference'.
+ */
+static float unwrapLongitude(float longitude, float reference) {
+    return reference + wrapLongitudeDelta(longitude - reference);
+}
+
+static int gridRow(const ScanGeometry& g, float latitude) {
+    return constrain((int)((latitude - g.latMin) / g.cellLat), 0, SCAN_GRID_DIM - 1);
+}
+
+static int gridColumn(const ScanGeometry& g, float longitude) {
+    return constrain((int)((longitude - g.lonMin) / g.cellLon), 0, SCAN_GRID_DIM - 1);
+}
+
+/**
+ * @brief Grid columns covered by the longitude interval [west, east] (same frame as the box).
+ * In a box spanning the whole circle, the part of the interval past one edge wraps to the other.
+ * @return Bit n set = column n.
+ */
+static uint32_t columnMask(const ScanGeometry& g, float west, float east) {
+    static_assert(SCAN_GRID_DIM <= 32, "column mask holds one bit per grid column");
+    if (east - west >= 360.0) {
+        return (1ULL << SCAN_GRID_DIM) - 1;
+    }
+    uint32_t mask = 0;
+    if (west < g.lonMin) {
+        for (int col = gridColumn(g, west + 360.0); col < SCAN_GRID_DIM; col++) mask |= 1u << col;
+        west = g.lonMin;
+    }
+    if (east > g.lonMax) {
+        for (int col = 0; col <= gridColumn(g, east - 360.0); col++) mask |= 1u << col;
+        east = g.lonMax;
+    }
+    for (int col = gridColumn(g, west); col <= gridColumn(g, east); col++) mask |= 1u << col;
+    return mask;
+}
+
+/**
+ * @brief Builds the merged query box and the grid index over it.
+ * Longitudes are unwrapped around the primary location, so a box across the
+ * antimeridian is one continuous range (lonMin/lonMax may then lie past +/-180).
+ * A box that would span the whole circle is the circle centred on the primary location.
+ */
+static void buildIndex(ScanGeometry& g) {
+    float latSpan, lonSpan;
+    float reference = g.sites[0].longitude;
+    g.latMin = g.lonMin = 1000;
+    g.latMax = g.lonMax = -1000;
+    for (const SiteGeometry& site : g.sites) {
+        siteSpan(site, latSpan, lonSpan);
+        float center = unwrapLongitude(site.longitude, reference);
+        g.latMin = min(g.latMin, site.latitude - latSpan);
+        g.latMax = max(g.latMax, site.latitude + latSpan);
+        g.lonMin = min(g.lonMin, center - lonSpan);
+        g.lonMax = max(g.lonMax, center + lonSpan);
+    }
+    for (const GeofenceZone& zone : g.geofences->zones) {
+        float shift = unwrapLongitude((zone.lonMin + zone.lonMax) / 2, reference) - (zone.lonMin + zone.lonMax) / 2;
+        g.latMin = min(g.latMin, zone.latMin);
+        g.latMax = max(g.latMax, zone.latMax);
+        g.lonMin = min(g.lonMin, zone.lonMin + shift);
+        g.lonMax = max(g.lonMax, zone.lonMax + shift);
+    }
+    g.latMin = max(g.latMin, -90.0f);
+    g.latMax = min(g.latMax, 90.0f);
+    if (g.lonMax - g.lonMin >= 360.0) {
+        g.lonMin = reference - 180.0;
+        g.lonMax = reference + 180.0;
+    }
+    g.cellLat = max((g.latMax - g.latMin) / SCAN_GRID_DIM, 1e-4f);
+    g.cellLon = max((g.lonMax - g.lonMin) / SCAN_GRID_DIM, 1e-4f);
+
+    // Two passes (count, then fill) give a compact CSR layout with no per-cell vectors
+    const int cellCount = SCAN_GRID_DIM * SCAN_GRID_DIM;
+    g.cellStart.assign(cellCount + 1, 0);
+    for (int pass = 0; pass < 2; pass++) {
+        std::vector<uint16_t> fill;
+        if (pass == 1) {
+            for (int i = 0; i < cellCount; i++) {
+                g.cellStart[i + 1] += g.cellStart[i];
+            }
+            g.cellSites.assign(g.cellStart[cellCount], 0);
+            fill.assign(g.cellStart.begin(), g.cellStart.end() - 1);
+        }
+        for (size_t s = 0; s < g.sites.size(); s++) {
+            siteSpan(g.sites[s], latSpan, lonSpan);
+            float center = unwrapLongitude(g.sites[s].longitude, reference);
+            int row0 = gridRow(g, g.sites[s].latitude - latSpan), row1 = gridRow(g, g.sites[s].latitude + latSpan);
+            uint32_t columns = columnMask(g, center - lonSpan, center + lonSpan);
+            for (int row = row0; row <= row1; row++) {
+                for (int col = 0; col < SCAN_GRID_DIM; col++) {
+                    if (!(columns & (1u << col))) {
+                        continue;
+                    }
+                    int cell = row * SCAN_GRID_DIM + col;
+                    if (pass == 0) {
+                        g.cellStart[cell + 1]++;
+                    } else {
+                        g.cellSites[fill[cell]++] = s;
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Recomputes the derived scan geometry from the settings and makes it active.
+ * @param settings Settings to derive from.
+ */
+void rebuildScanGeometry(const AppSettings& settings) {
+    ScanGeometry* next = (activeGeometry == &geometryBuffers[0]) ? &geometryBuffers[1] : &geometryBuffers[0];
+
+    next->kmPerDegLat = KM_PER_DEG_LAT;
+    float entryScale = 1.0 - constrain(settings.alarmEntryBandPercent, 0.0f, 50.0f) / 100.0;
+    float exitScale = 1.0 + constrain(settings.alarmHysteresisPercent, 0.0f, 50.0f) / 100.0;
+    next->sites.resize(1 + settings.sites.size());
+    buildSite(next->sites[0], PRIMARY_SITE_NAME, settings.latitude, settings.longitude,
+              settings.radiusLevel1, settings.radiusLevel2, settings.radiusLevel3, SITE_ALARM_SOUND, entryScale, exitScale);
+    for (size_t i = 0; i < settings.sites.size(); i++) {
+        const MonitoredSite& site = settings.sites[i];
+        buildSite(next->sites[i + 1], site.name, site.latitude, site.longitude,
+                  site.radiusLevel1, site.radiusLevel2, site.radiusLevel3, site.alarmPolicy, entryScale, exitScale);
+    }
+    next->geofences = currentGeofences();
+    next->ceiling[0] = next->exitCeiling[0] = INFINITY;
+    for (int level = 1; level <= 3; level++) {
+        float nominal = settings.altitudeCeiling[level] > 0 ? settings.altitudeCeiling[level] : INFINITY;
+        next->ceiling[level] = nominal * entryScale;
+        next->exitCeiling[level] = nominal * exitScale;
+    }
+    buildIndex(*next);
+    next->useIndex = next->sites.size() >= (size_t)SCAN_INDEX_MIN_SITES;
+
+    // One request per scan covers every site, however many there are. The API takes
+    // longitudes in [-180, 180] with lomin <= lomax, so a box across the antimeridian
+    // is widened to the full longitude band of its latitudes.
+    bool crossesAntimeridian = next->lonMin < -180.0 || next->lonMax > 180.0;
+    next->apiUrl = settings.apiServer;
+    next->apiUrl += "?lamin=" + String(next->latMin, 4);
+    next->apiUrl += "&lamax=" + String(next->latMax, 4);
+    next->apiUrl += "&lomin=" + String(crossesAntimeridian ? -180.0f : next->lonMin, 4);
+    next->apiUrl += "&lomax=" + String(crossesAntimeridian ? 180.0f : next->lonMax, 4);
+
+    next->alarmDwellMs = (uint32_t)max(settings.alarmDwellSec, 0) * 1000;
+    next->noFlightScanSec = max(settings.noFlightScanFreq, 1);
+    next->flightPresentScanSec = max(settings.flightPresentScanFreq, 1);
+    next->soundWarning = settings.soundWarning;
+    memcpy(next->alarmSounds, settings.alarmSounds, sizeof(next->alarmSounds));
+
+    activeGeometry = next;
+    Serial.printf("Scan geometry rebuilt: %u site(s), %u zone(s), %u index entries, query: %s\n",
+                  next->sites.size(), next->geofences->zones.size(), next->cellSites.size(), next->apiUrl.c_str());
+}
+
+/**
+ * @brief The geometry currently in effect. Capture the reference once per scan.
+ * @return Active geometry.
+ */
+const ScanGeometry& activeScanGeometry() {
+    return *activeGeometry;
+}
+
+/**
+ * @brief Applies the altitude ceilings to a horizontal match.
+ * An aircraft above a level's ceiling falls to the next level whose ceiling it is
+ * under (still inside that level's radius, since the radii are nested).
+ * @param ceiling ScanGeometry::ceiling or ScanGeometry::exitCeiling.
+ * @return Level 1-3, or 4 if it is above every remaining ceiling.
+ */
+static int applyCeilings(const float* ceiling, int level, float altitude) {
+    while (level <= 3 && altitude > ceiling[level]) {
+        level++;
+    }
+    return level;
+}
+
+/**
+ * @brief Distance from a site to a position.
+ * @param geometry Active geometry.
+ * @param site Index into geometry.sites.
+ * @param latitude Position latitude (degrees).
+ * @param longitude Position longitude (degrees).
+ * @return Distance (km), local equirectangular approximation.
+ */
+float siteDistanceKm(const ScanGeometry& geometry, uint8_t site, float latitude, float longitude) {
+    const SiteGeometry& s = geometry.sites[site];
+    float dx = wrapLongitudeDelta(longitude - s.longitude) * s.kmPerDegLon;
+    float dy = (latitude - s.latitude) * geometry.kmPerDegLat;
+    return sqrt(dx * dx + dy * dy);
+}
+
+/**
+ * @brief Classifies a position against every monitored site near it.
+ * With many sites (ScanGeometry::useIndex), only those listed in the position's grid
+ * cell are tested, otherwise all of them. Each test uses the
+ * local equirectangular approximation (error well under 1% at the radii this device
+ * monitors) and compares squared distances; the square root is only taken for the
+ * matching site. Polygon zones are tested after the circles. When several sites or
+ * zones match, one that raises alarms wins over one that does not, then the more
+ * critical level, then the nearer site. Levels are 3D: each is a cylinder capped
+ * by its altitude ceiling, both narrowed by the entry band. The same test against
+ * the radii and ceilings widened by the exit band gives the hold level used by
+ * debounceProximityLevel().
+ * @param geometry Active geometry.
+ * @param latitude Aircraft latitude (degrees).
+ * @param longitude Aircraft longitude (degrees).
+ * @param altitude Aircraft altitude (m); 0 if unknown, which never exceeds a ceiling.
+ * @param match Output: matching site, distance and hold level, set when the result
+ *        or match.holdLevel is non-zero (the site is then the exit-band match).
+ * @return Proximity level (1, 2, 3) or 0 if outside every site's radii and every zone.
+ */
+int classifyPosition(const ScanGeometry& geometry, float latitude, float longitude, float altitude, SiteMatch& match) {
+    match.holdLevel = 0;
+    match.altitudeLimited = false;
+    // Longitude in the box's frame: lonMin <= boxLon < lonMin + 360
+    float boxLon = geometry.lonMin + fmodf(longitude - geometry.lonMin + 720.0f, 360.0f);
+    if (latitude < geometry.latMin || latitude > geometry.latMax || boxLon > geometry.lonMax) {
+        return 0;
+    }
+    uint16_t first = 0, end = geometry.sites.size(); // Candidates: sites, or cellSites entries with the index
+    if (geometry.useIndex) {
+        int cell = gridRow(geometry, latitude) * SCAN_GRID_DIM + gridColumn(geometry, boxLon);
+        first = geometry.cellStart[cell];
+        end = geometry.cellStart[cell + 1];
+    }
+
+    int bestLevel = 0;
+    int bestRank = 0x7fff;
+    float bestDSq = 0;
+    int holdLevel = 0;
+    int holdRank = 0x7fff;
+    uint8_t holdSite = 0;
+    float holdDSq = 0;
+    for (uint16_t i = first; i < end; i++) {
+        uint8_t siteIndex = geometry.useIndex ? geometry.cellSites[i] : i;
+        const SiteGeometry& site = geometry.sites[siteIndex];
+        float dx = wrapLongitudeDelta(longitude - site.longitude) * site.kmPerDegLon;
+        float dy = (latitude - site.latitude) * geometry.kmPerDegLat;
+        float dSq = dx * dx + dy * dy;
+        if (dSq > site.exitRadiusSq[3]) {
+            continue;
+        }
+        int policyRank = site.alarmPolicy == SITE_ALARM_NONE ? 4 : 0;
+
+        int exitLevel = (dSq <= site.exitRadiusSq[1]) ? 1 : (dSq <= site.exitRadiusSq[2]) ? 2 : 3;
+        exitLevel = applyCeilings(geometry.exitCeiling, exitLevel, altitude);
+        if (exitLevel <= 3 && (policyRank + exitLevel < holdRank ||
+                               (policyRank + exitLevel == holdRank && dSq < holdDSq))) {
+            holdRank = policyRank + exitLevel;
+            holdLevel = exitLevel;
+            holdSite = siteIndex;
+            holdDSq = dSq;
+        }
+        if (dSq > site.radiusSq[3]) {
+            continue; // In the exit band only
+        }
+
+        int horizontalLevel = (dSq <= site.radiusSq[1]) ? 1 : (dSq <= site.radiusSq[2]) ? 2 : 3;
+        int level = applyCeilings(geometry.ceiling, horizontalLevel, altitude);
+        if (level != horizontalLevel) {
+            match.altitudeLimited = true;
+            if (level > 3) {
+                continue;
+            }
+        }
+        int rank = policyRank + level;
+        if (rank < bestRank || (rank == bestRank && dSq < bestDSq)) {
+            bestRank = rank;
+            bestLevel = level;
+            bestDSq = dSq;
+            match.site = siteIndex;
+        }
+    }
+    match.zone = -1;
+
+    int zoneIndex;
+    int zoneLevel = geofenceLevel(*geometry.geofences, latitude, longitude, zoneIndex);
+    bool holdIsZone = false;
+    if (zoneLevel != 0) {
+        // Polygons have no exit band; only their ceilings are widened
+        int zoneHold = applyCeilings(geometry.exitCeiling, zoneLevel, altitude);
+        int cappedLevel = applyCeilings(geometry.ceiling, zoneLevel, altitude);
+        if (cappedLevel != zoneLevel) {
+            match.altitudeLimited = true;
+            zoneLevel = cappedLevel > 3 ? 0 : cappedLevel;
+        }
+        if (zoneHold <= 3 && zoneHold < holdRank) { // Zones always raise alarms: rank == level
+            holdLevel = zoneHold;
+            holdIsZone = true;
+        }
+    }
+    match.holdLevel = holdLevel;
+
+    // Report the zone if it set the level, or if only its band holds the aircraft
+    if (zoneLevel != 0 ? zoneLevel < bestRank : (bestLevel == 0 && holdIsZone)) {
+        match.site = 0;
+        match.zone = zoneIndex;
+        match.distanceKm = siteDistanceKm(geometry, 0, latitude, longitude);
+        return zoneLevel;
+    }
+
+    if (bestLevel != 0) {
+        match.distanceKm = sqrt(bestDSq);
+    } else if (holdLevel != 0) {
+        match.site = holdSite;
+        match.distanceKm = sqrt(holdDSq);
+    }
+    return bestLevel;
+}
@@ -0,0 +1,66 @@
+// scan_geometry.h
+#ifndef SCAN_GEOMETRY_H
+#define SCAN_GEOMETRY_H
+
+#include <Arduino.h>
+#include <vector>
+#include "globals.h" // For AppSettings struct
+#include "geofence.h" // For polygon zones
+
+// Precomputed values for one monitored site
+struct SiteGeometry {
+    String name;
+    float latitude;       // Degrees
+    float longitude;
+    float kmPerDegLon;    // Local equirectangular scale: kmPerDegLat * cos(latitude)
+    float radiusSq[4];    // Squared radii (km^2) narrowed by the entry band; index 1-3 = level, index 0 unused
+    float exitRadiusSq[4]; // Squared radii widened by the exit band
+    SiteAlarmPolicy alarmPolicy;
+};
+
+// Values derived from the settings that the scan hot path and the alarms it raises
+// need. Built once per settings change, so classifying an aircraft is a few multiplies
+// and compares per site (per nearby site, found with a grid lookup, when there are many
+// sites).
+struct ScanGeometry {
+    float kmPerDegLat;
+    std::vector<SiteGeometry> sites;      // [0] is the primary location
+    GeofenceSetPtr geofences;             // Polygon zones in effect (never null)
+    float ceiling[4];                     // Per-level altitude ceiling (m) lowered by the entry band, index 1-3; INFINITY = none
+    float exitCeiling[4];                 // Ceilings raised by the exit band
+    float latMin, latMax, lonMin, lonMax; // Merged box enclosing every site's Level 3 exit circle and every zone;
+                                          // longitudes unwrapped around the primary location (may pass +/-180)
+    // Spatial index: the merged box is cut into SCAN_GRID_DIM x SCAN_GRID_DIM cells; the
+    // sites whose Level 3 box overlaps cell i are cellSites[cellStart[i] .. cellStart[i + 1]).
+    float cellLat, cellLon;               // Cell size (degrees)
+    std::vector<uint16_t> cellStart;
+    std::vector<uint8_t> cellSites;
+    bool useIndex;                        // Look sites up in the grid; with fewer than SCAN_INDEX_MIN_SITES
+                                          // sites testing all of them is faster
+    String apiUrl;        // Full bounding-box request URL
+    uint32_t alarmDwellMs;                // Minimum time a confirmed level is held before stepping down
+    int noFlightScanSec;  // Scheduler intervals, clamped to at least 1 s
+    int flightPresentScanSec;
+    bool soundWarning;                    // Alarm sounds enabled
+    AlarmSound alarmSounds[4];            // Per-level sound, index 1-3 = alarm level
+};
+
+// Where an aircraft sits relative to the monitored sites
+struct SiteMatch {
+    uint8_t site;      // Index into ScanGeometry::sites
+    int8_t zone;       // Index into geofences->zones if a polygon zone matched, else -1
+    float distanceKm;  // To the matching site; to the primary location for a zone match
+    int8_t holdLevel;  // Most critical level whose exit band contains the position (0 = none)
+    bool altitudeLimited; // Some site or zone would have matched at a more critical level but for the ceilings
+};
+
+const int SCAN_GRID_DIM = 8;
+const int SCAN_INDEX_MIN_SITES = 4; // Break-even of the grid lookup in classifyPosition() (tools/host/bench_scan_geometry.cpp)
+
+// Function declarations
+void rebuildScanGeometry(const AppSettings& settings);
+const ScanGeometry& activeScanGeometry();
+int classifyPosition(const ScanGeometry& geometry, float latitude, float longitude, float altitude, SiteMatch& match);
+float siteDistanceKm(const ScanGeometry& geometry, uint8_t site, float latitude, float longitude);
+
+#endif // SCAN_GEOMETRY_H
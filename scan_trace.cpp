@@ -0,0 +1,66 @@
+// scan_trace.cpp
+#include "scan_trace.h"
+
+#if SCAN_TRACE_ENABLED
+
+struct TraceEvent {
+    const char* name;    // Static string; never freed
+    uint32_t startUs;    // micros() at span start (wraps every ~71 minutes)
+    uint32_t durationUs;
+    uint32_t scan;       // Scan the span belongs to (counts scan attempts, not only successful ones)
+    int32_t arg;         // Optional stage-specific value, -1 if unused
+};
+
+static TraceEvent traceRing[TRACE_RING_SIZE];
+static uint16_t traceNext = 0;
+static uint16_t traceCount = 0;
+static uint32_t traceScanId = 0;
+
+/**
+ * @brief Starts a new scan: following spans are tagged with the next scan id.
+ */
+void traceNewScan() {
+    traceScanId++;
+}
+
+/**
+ * @brief Stores a finished span in the ring buffer, overwriting the oldest.
+ * @param name Stage name (string literal).
+ * @param startUs Span start, micros().
+ * @param durationUs Span length.
+ * @param arg Optional value shown in the trace viewer (e.g. bytes, rows), -1 for none.
+ */
+void traceRecord(const char* name, uint32_t startUs, uint32_t durationUs, int32_t arg) {
+    TraceEvent& event = traceRing[traceNext];
+    event.name = name;
+    event.startUs = startUs;
+    event.durationUs = durationUs;
+    event.scan = traceScanId;
+    event.arg = arg;
+    traceNext = (traceNext + 1) % TRACE_RING_SIZE;
+    if (traceCount < TRACE_RING_SIZE) {
+        traceCount++;
+    }
+}
+
+/**
+ * @brief Handles GET /trace: the ring buffer as Chrome trace-event JSON, oldest first.
+ */
+void handleTrace(AsyncWebServerRequest* request) {
+    AsyncResponseStream* out = request->beginResponseStream("application/json");
+    out->print(F("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+    uint16_t first = (traceNext + TRACE_RING_SIZE - traceCount) % TRACE_RING_SIZE;
+    for (uint16_t i = 0; i < traceCount; i++) {
+        const TraceEvent& event = traceRing[(first + i) % TRACE_RING_SIZE];
+        out->printf("%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%u,\"dur\":%u,\"args\":{\"scan\":%u",
+                    i ? "," : "", event.name, event.startUs, event.durationUs, event.scan);
+        if (event.arg >= 0) {
+            out->printf(",\"value\":%d", event.arg);
+        }
+        out->print(F("}}"));
+    }
+    out->print(F("]}"));
+    request->send(out);
+}
+
+#endif // SCAN_TRACE_ENABLED
@@ -0,0 +1,82 @@
+// scan_trace.h
+#ifndef SCAN_TRACE_H
+#define SCAN_TRACE_H
+
+// Per-stage latency tracing for the scan pipeline, exported at /trace in Chrome
+// trace-event JSON (load it in chrome://tracing or ui.perfetto.dev).
+// Set SCAN_TRACE_ENABLED to 0 to compile all of it out: the macros below then
+// expand to nothing and /trace is not registered.
+#ifndef SCAN_TRACE_ENABLED
+#define SCAN_TRACE_ENABLED 1
+#endif
+
+#include <Arduino.h>
+#include "globals.h" // For AsyncWebServerRequest
+
+#if SCAN_TRACE_ENABLED
+
+const int TRACE_RING_SIZE = 64; // Spans kept; roughly the last 5-6 scans
+
+// Function declarations
+void traceNewScan();
+void traceRecord(const char* name, uint32_t startUs, uint32_t durationUs, int32_t arg = -1);
+void handleTrace(AsyncWebServerRequest* request);
+
+// Records a span from construction to end of scope
+class TraceSpan {
+public:
+    explicit TraceSpan(const char* name) : _name(name), _startUs(micros()) {}
+    ~TraceSpan() { traceRecord(_name, _startUs, micros() - _startUs); }
+
+private:
+    const char* _name;
+    uint32_t _startUs;
+};
+
+// Stream wrapper that accumulates the time spent waiting inside reads, so a
+// streaming parse can be split into network wait and parse work.
+class TimedStream : public Stream {
+public:
+    explicit TimedStream(Stream& stream) : waitUs(0), _stream(stream) {}
+
+    int available() override { return _stream.available(); }
+    int peek() override { return _stream.peek(); }
+    int read() override {
+        uint32_t start = micros();
+        int c = _stream.read();
+        waitUs += micros() - start;
+        return c;
+    }
+    size_t readBytes(char* buffer, size_t length) override {
+        uint32_t start = micros();
+        size_t count = _stream.readBytes(buffer, length);
+        waitUs += micros() - start;
+        return count;
+    }
+    size_t write(uint8_t) override { return 0; }
+
+    uint32_t waitUs;
+
+private:
+    Stream& _stream;
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_NEW_SCAN() traceNewScan()
+#define TRACE_SCOPE(name) TraceSpan TRACE_CONCAT(traceSpan_, __LINE__)(name)
+#define TRACE_BEGIN(var) uint32_t var = micros()
+#define TRACE_END(var, name) traceRecord(name, var, micros() - var)
+#define TRACE_END_ARG(var, name, arg) traceRecord(name, var, micros() - var, arg)
+
+#else
+
+#define TRACE_NEW_SCAN() do {} while (0)
+#define TRACE_SCOPE(name) do {} while (0)
+#define TRACE_BEGIN(var) do {} while (0)
+#define TRACE_END(var, name) do {} while (0)
+#define TRACE_END_ARG(var, name, arg) do {} while (0)
+
+#endif // SCAN_TRACE_ENABLED
+
+#endif // SCAN_TRACE_H
@@ -1,6 +1,11 @@
 // settings_manager.cpp
 #include "settings_manager.h"
-#include <ArduinoJson.h> // For JSON serialization/deserialization
+#include "settings_store.h" // For the binary settings record in flash
+#include "scan_geometry.h"  // For rebuilding the derived scan geometry
+#include "flight_scanner.h" // For rescheduling the scan
+#include "wifi_manager.h"   // For reconnecting with new credentials
+#include "geofence.h"       // For storing uploaded zones
+#include "alarm_debounce.h" // For forgetting alarm states confirmed under the old radii
 
 // Define default settings here, these should match your HTML's DEFAULT_SETTINGS
 const AppSettings DEFAULT_APP_SETTINGS = {
@@ -15,88 +20,277 @@ const AppSettings DEFAULT_APP_SETTINGS = {
     20.0, // radiusLevel3
     60,   // noFlightScanFreq (seconds)
     10,   // flightPresentScanFreq (seconds)
-    true  // soundWarning
+    true, // soundWarning
+    {},   // sites (none besides the primary location)
+    { 0, 3000, 6000, 0 }, // altitudeCeiling (m): Level 1 below 3000 m, Level 2 below 6000 m, Level 3 unlimited
+    10.0, // alarmHysteresisPercent
+    30,   // alarmDwellSec
+    {     // alarmSounds: urgent rising chirps, medium beeps, slow low beeps
+        {},
+        { ALARM_SOUND_TONE, 2000, 2600, 150, 80, 10, 100 },
+        { ALARM_SOUND_TONE, 1200, 1200, 300, 300, 4, 80 },
+        { ALARM_SOUND_TONE, 800, 800, 500, 700, 2, 60 }
+    },
+    0.0   // alarmEntryBandPercent: enter at the nominal radius/ceiling
 };
 
+static const char* LEGACY_SETTINGS_FILE = "/settings.json";
+static const char* const SITE_ALARM_POLICY_NAMES[] = { "sound", "led", "none" }; // Indexed by SiteAlarmPolicy
+static const char* const ALARM_SOUND_SOURCE_NAMES[] = { "tone", "clip" }; // Indexed by AlarmSoundSource
+static unsigned long settingsLoadMicros = 0;
+static AppSettings stagedSettings; // Received from the web UI, stored and applied by loop()
+static bool settingsStaged = false;
 
-void loadSettings() {
-    Serial.println(F("Loading settings..."));
-    File settingsFile = SPIFFS.open("/settings.json", "r");
+/**
+ * @brief Fills a JSON document with the settings (web export format).
+ * @param settings Settings to export.
+ * @param doc Destination document.
+ */
+void settingsToJson(const AppSettings& settings, JsonDocument& doc) {
+    doc["ssid"] = settings.ssid;
+    doc["password"] = settings.password;
+    doc["apiServer"] = settings.apiServer;
+    doc["apiKey"] = settings.apiKey;
+    doc["latitude"] = settings.latitude;
+    doc["longitude"] = settings.longitude;
+    doc["radiusLevel1"] = settings.radiusLevel1;
+    doc["radiusLevel2"] = settings.radiusLevel2;
+    doc["radiusLevel3"] = settings.radiusLevel3;
+    doc["noFlightScanFreq"] = settings.noFlightScanFreq;
+    doc["flightPresentScanFreq"] = settings.flightPresentScanFreq;
+    doc["soundWarning"] = settings.soundWarning;
+
+    JsonArray sites = doc.createNestedArray("sites");
+    for (const MonitoredSite& site : settings.sites) {
+        JsonObject siteObj = sites.createNestedObject();
+        siteObj["name"] = site.name;
+        siteObj["latitude"] = site.latitude;
+        siteObj["longitude"] = site.longitude;
+        siteObj["radiusLevel1"] = site.radiusLevel1;
+        siteObj["radiusLevel2"] = site.radiusLevel2;
+        siteObj["radiusLevel3"] = site.radiusLevel3;
+        siteObj["alarm"] = SITE_ALARM_POLICY_NAMES[site.alarmPolicy];
+    }
+    doc["altitudeCeilingLevel1"] = settings.altitudeCeiling[1];
+    doc["altitudeCeilingLevel2"] = settings.altitudeCeiling[2];
+    doc["altitudeCeilingLevel3"] = settings.altitudeCeiling[3];
+    doc["alarmHysteresisPercent"] = settings.alarmHysteresisPercent;
+    doc["alarmDwellSec"] = settings.alarmDwellSec;
+    doc["alarmEntryBandPercent"] = settings.alarmEntryBandPercent;
+    JsonArray sounds = doc.createNestedArray("alarmSounds");
+    for (int level = 1; level <= 3; level++) {
+        const AlarmSound& sound = settings.alarmSounds[level];
+        JsonObject soundObj = sounds.createNestedObject();
+        soundObj["source"] = ALARM_SOUND_SOURCE_NAMES[sound.source];
+        soundObj["startHz"] = sound.startHz;
+        soundObj["endHz"] = sound.endHz;
+        soundObj["beepMs"] = sound.beepMs;
+        soundObj["gapMs"] = sound.gapMs;
+        soundObj["beeps"] = sound.beeps;
+        soundObj["volume"] = sound.volume;
+    }
+}
+
+static SiteAlarmPolicy parseAlarmPolicy(const char* name) {
+    for (uint8_t i = 0; i <= SITE_ALARM_NONE; i++) {
+        if (name && strcmp(name, SITE_ALARM_POLICY_NAMES[i]) == 0) {
+            return (SiteAlarmPolicy)i;
+        }
+    }
+    return SITE_ALARM_SOUND;
+}
+
+static void readJsonString(JsonVariantConst value, String& out) {
+    if (value.is<const char*>()) {
+        out = value.as<const char*>();
+    }
+}
+
+/**
+ * @brief Applies the keys present in a JSON document (web import format).
+ * Keys that are missing keep their current value in 'settings'.
+ * @param doc Source document.
+ * @param settings Settings to update.
+ */
+void settingsFromJson(const JsonDocument& doc, AppSettings& settings) {
+    readJsonString(doc["ssid"], settings.ssid);
+    readJsonString(doc["password"], settings.password);
+    readJsonString(doc["apiServer"], settings.apiServer);
+    readJsonString(doc["apiKey"], settings.apiKey);
+    settings.latitude = doc["latitude"] | settings.latitude;
+    settings.longitude = doc["longitude"] | settings.longitude;
+    settings.radiusLevel1 = doc["radiusLevel1"] | settings.radiusLevel1;
+    settings.radiusLevel2 = doc["radiusLevel2"] | settings.radiusLevel2;
+    settings.radiusLevel3 = doc["radiusLevel3"] | settings.radiusLevel3;
+    settings.noFlightScanFreq = doc["noFlightScanFreq"] | settings.noFlightScanFreq;
+    settings.flightPresentScanFreq = doc["flightPresentScanFreq"] | settings.flightPresentScanFreq;
+    settings.soundWarning = doc["soundWarning"] | settings.soundWarning;
+    settings.altitudeCeiling[1] = max(doc["altitudeCeilingLevel1"] | settings.altitudeCeiling[1], 0.0f);
+    settings.altitudeCeiling[2] = max(doc["altitudeCeilingLevel2"] | settings.altitudeCeiling[2], 0.0f);
+    settings.altitudeCeiling[3] = max(doc["altitudeCeilingLevel3"] | settings.altitudeCeiling[3], 0.0f);
+    settings.alarmHysteresisPercent = constrain(doc["alarmHysteresisPercent"] | settings.alarmHysteresisPercent, 0.0f, 50.0f);
+    settings.alarmDwellSec = constrain(doc["alarmDwellSec"] | settings.alarmDwellSec, 0, 600);
+    settings.alarmEntryBandPercent = constrain(doc["alarmEntryBandPercent"] | settings.alarmEntryBandPercent, 0.0f, 50.0f);
+
+    // "alarmSounds" holds levels 1-3 in order; missing keys keep their value
+    JsonArrayConst sounds = doc["alarmSounds"];
+    for (int level = 1; level <= 3 && level <= (int)sounds.size(); level++) {
+        JsonObjectConst soundObj = sounds[level - 1];
+        AlarmSound& sound = settings.alarmSounds[level];
+        if (soundObj["source"].is<const char*>()) {
+            sound.source = strcmp(soundObj["source"], ALARM_SOUND_SOURCE_NAMES[ALARM_SOUND_CLIP]) == 0 ? ALARM_SOUND_CLIP : ALARM_SOUND_TONE;
+        }
+        sound.startHz = constrain(soundObj["startHz"] | (int)sound.startHz, 100, 3800);
+        sound.endHz = constrain(soundObj["endHz"] | (int)sound.endHz, 100, 3800);
+        sound.beepMs = constrain(soundObj["beepMs"] | (int)sound.beepMs, 20, 2000);
+        sound.gapMs = constrain(soundObj["gapMs"] | (int)sound.gapMs, 0, 2000);
+        sound.beeps = constrain(soundObj["beeps"] | (int)sound.beeps, 1, 20);
+        sound.volume = constrain(soundObj["volume"] | (int)sound.volume, 0, 100);
+    }
+
+    // "sites" replaces the whole list; sites with unusable geometry are dropped
+    if (doc["sites"].is<JsonArrayConst>()) {
+        settings.sites.clear();
+        for (JsonObjectConst siteObj : doc["sites"].as<JsonArrayConst>()) {
+            if (settings.sites.size() >= (size_t)MAX_EXTRA_SITES) {
+                Serial.println(F("Too many monitored sites; extra entries ignored."));
+                break;
+            }
+            MonitoredSite site;
+            site.name = siteObj["name"] | "Site";
+            site.latitude = siteObj["latitude"] | 0.0f;
+            site.longitude = siteObj["longitude"] | 0.0f;
+            site.radiusLevel1 = siteObj["radiusLevel1"] | 0.0f;
+            site.radiusLevel2 = siteObj["radiusLevel2"] | 0.0f;
+            site.radiusLevel3 = siteObj["radiusLevel3"] | 0.0f;
+            site.alarmPolicy = parseAlarmPolicy(siteObj["alarm"] | "sound");
+            if (fabs(site.latitude) > 90 || fabs(site.longitude) > 180 || site.radiusLevel1 <= 0 ||
+                site.radiusLevel2 < site.radiusLevel1 || site.radiusLevel3 < site.radiusLevel2) {
+                Serial.print(F("Ignoring invalid monitored site: "));
+                Serial.println(site.name);
+                continue;
+            }
+            settings.sites.push_back(site);
+        }
+    }
+}
+
+/**
+ * @brief One-time migration of a settings.json left by older firmware into the binary record.
+ * The file is renamed to settings.json.bak once the record has been written.
+ * @return true if settings were migrated into currentSettings.
+ */
+static bool migrateLegacySettingsFile() {
+    if (!SPIFFS.exists(LEGACY_SETTINGS_FILE)) {
+        return false;
+    }
+    File settingsFile = SPIFFS.open(LEGACY_SETTINGS_FILE, "r");
     if (!settingsFile) {
-        Serial.println(F("settings.json not found. Creating default settings."));
-        currentSettings = DEFAULT_APP_SETTINGS; // Set to hardcoded defaults
-        saveSettings(); // Save these defaults to file
-        return;
+        return false;
     }
 
-    DynamicJsonDocument doc(512); // Adjust size as needed
+    DynamicJsonDocument doc(SETTINGS_JSON_CAPACITY);
     DeserializationError error = deserializeJson(doc, settingsFile);
     settingsFile.close();
-
     if (error) {
         Serial.print(F("Failed to parse settings.json: "));
         Serial.println(error.f_str());
-        Serial.println(F("Using default settings."));
-        currentSettings = DEFAULT_APP_SETTINGS; // Fallback to hardcoded defaults
+        return false;
+    }
+
+    settingsFromJson(doc, currentSettings);
+    if (!saveSettings()) {
+        return false;
+    }
+    SPIFFS.rename(LEGACY_SETTINGS_FILE, "/settings.json.bak");
+    Serial.println(F("Migrated settings.json to the binary settings record."));
+    return true;
+}
+
+void loadSettings() {
+    Serial.println(F("Loading settings..."));
+    unsigned long startUs = micros();
+    currentSettings = DEFAULT_APP_SETTINGS; // Fields missing from an older record keep these
+
+    if (readStoredSettings(currentSettings)) {
+        settingsLoadMicros = micros() - startUs;
+        Serial.printf("Settings loaded successfully in %lu us.\n", settingsLoadMicros);
+        return;
+    }
+
+    if (migrateLegacySettingsFile()) {
+        settingsLoadMicros = micros() - startUs;
         return;
     }
 
-    // Populate currentSettings from JSON
-    currentSettings.ssid = doc["ssid"].as<String>();
-    currentSettings.password = doc["password"].as<String>();
-    currentSettings.apiServer = doc["apiServer"].as<String>();
-    currentSettings.apiKey = doc["apiKey"].as<String>();
-    currentSettings.latitude = doc["latitude"].as<float>();
-    currentSettings.longitude = doc["longitude"].as<float>();
-    currentSettings.radiusLevel1 = doc["radiusLevel1"].as<float>();
-    currentSettings.radiusLevel2 = doc["radiusLevel2"].as<float>();
-    currentSettings.radiusLevel3 = doc["radiusLevel3"].as<float>();
-    currentSettings.noFlightScanFreq = doc["noFlightScanFreq"].as<int>();
-    currentSettings.flightPresentScanFreq = doc["flightPresentScanFreq"].as<int>();
-    currentSettings.soundWarning = doc["soundWarning"].as<bool>();
-
-    Serial.println(F("Settings loaded successfully."));
+    Serial.println(F("No stored settings found. Creating default settings."));
+    currentSettings = DEFAULT_APP_SETTINGS;
+    saveSettings(); // Save these defaults to flash
+    settingsLoadMicros = micros() - startUs;
 }
 
 bool saveSettings() {
     Serial.println(F("Saving settings..."));
-    DynamicJsonDocument doc(512); // Adjust size as needed
-
-    // Populate JSON with currentSettings
-    doc["ssid"] = currentSettings.ssid;
-    doc["password"] = currentSettings.password;
-    doc["apiServer"] = currentSettings.apiServer;
-    doc["apiKey"] = currentSettings.apiKey;
-    doc["latitude"] = currentSettings.latitude;
-    doc["longitude"] = currentSettings.longitude;
-    doc["radiusLevel1"] = currentSettings.radiusLevel1;
-    doc["radiusLevel2"] = currentSettings.radiusLevel2;
-    doc["radiusLevel3"] = currentSettings.radiusLevel3;
-    doc["noFlightScanFreq"] = currentSettings.noFlightScanFreq;
-    doc["flightPresentScanFreq"] = currentSettings.flightPresentScanFreq;
-    doc["soundWarning"] = currentSettings.soundWarning;
-
-    File settingsFile = SPIFFS.open("/settings.json", "w");
-    if (!settingsFile) {
-        Serial.println(F("Failed to open settings.json for writing."));
+    if (!writeStoredSettings(currentSettings)) {
+        Serial.println(F("Failed to save settings record."));
         return false;
     }
+    Serial.println(F("Settings saved to flash."));
+    return true;
+}
 
-    if (serializeJson(doc, settingsFile) == 0) {
-        Serial.println(F("Failed to write to settings.json."));
-        settingsFile.close();
-        return false;
-    }
+/**
+ * @brief Time the last loadSettings() took.
+ * @return Duration in microseconds.
+ */
+unsigned long getSettingsLoadMicros() {
+    return settingsLoadMicros;
+}
 
-    settingsFile.close();
-    Serial.println(F("Settings saved to settings.json."));
-    return true;
+/**
+ * @brief Settings a web edit starts from: those of an earlier edit that loop() has not
+ * taken yet, otherwise the current ones.
+ */
+AppSettings settingsForEdit() {
+    return settingsStaged ? stagedSettings : currentSettings;
+}
+
+/**
+ * @brief Hands settings from a web handler to loop(), which stores and applies them.
+ * Leaves currentSettings and the flash alone, so it is safe from a network callback,
+ * even one that runs while a scan is reading the settings.
+ */
+void stageSettings(const AppSettings& settings) {
+    stagedSettings = settings;
+    settingsStaged = true;
+    settingsChangePending = true;
 }
 
-// NEW: Function to reset settings to hardcoded default values
-bool resetAppSettingsToDefaults() {
-    Serial.println(F("Resetting app settings to default values in memory..."));
-    currentSettings = DEFAULT_APP_SETTINGS; // Copy hardcoded defaults to current settings
-    // Save these defaults to SPIFFS immediately
-    return saveSettings();
+/**
+ * @brief Stages the default settings (see stageSettings()).
+ */
+void stageDefaultSettings() {
+    Serial.println(F("Default settings staged."));
+    stageSettings(DEFAULT_APP_SETTINGS);
+}
+
+/**
+ * @brief Puts staged settings and zones into effect without a reboot.
+ * Called from loop() (never during a scan): makes staged settings current and writes
+ * them and any uploaded zones to flash, rebuilds the derived geometry, then replaces
+ * the pending scan timer with an immediate scan under the new settings.
+ */
+void applySettingsChange() {
+    Serial.println(F("Applying settings change..."));
+    if (settingsStaged) {
+        currentSettings = stagedSettings;
+        settingsStaged = false;
+        saveSettings(); // On failure the settings still apply until the next reboot
+    }
+    storeImportedGeofences();
+    rebuildScanGeometry(currentSettings);
+    resetAlarmStates();
+    wifiSettingsChanged();
+    flightScanTicker.detach();
+    requestFlightScan(); // loop() re-arms the timer with the new intervals afterwards
 }
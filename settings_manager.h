@@ -3,12 +3,24 @@
 #define SETTINGS_MANAGER_H
 
 #include <Arduino.h>
-#include <FS.h> // For SPIFFS
+#include <FS.h> // For SPIFFS (legacy settings.json migration)
+#include <ArduinoJson.h>
 #include "globals.h" // For AppSettings struct
 
+// Document capacity for the settings JSON, including a full list of monitored sites and the alarm sounds
+const size_t SETTINGS_JSON_CAPACITY = 640 + JSON_ARRAY_SIZE(MAX_EXTRA_SITES) + MAX_EXTRA_SITES * (JSON_OBJECT_SIZE(7) + 24) +
+                                      JSON_ARRAY_SIZE(3) + 3 * JSON_OBJECT_SIZE(7);
+
 // Function declarations
 void loadSettings();
 bool saveSettings();
-bool resetAppSettingsToDefaults(); // NEW: Function to reset settings to default values
+AppSettings settingsForEdit();
+void stageSettings(const AppSettings& settings);
+void stageDefaultSettings();
+// JSON is only the web import/export format; the device stores a binary record (settings_store.h)
+void settingsToJson(const AppSettings& settings, JsonDocument& doc);
+void settingsFromJson(const JsonDocument& doc, AppSettings& settings);
+unsigned long getSettingsLoadMicros();
+void applySettingsChange();
 
 #endif // SETTINGS_MANAGER_H
@@ -0,0 +1,426 @@
+// settings_store.cpp
+#include "settings_store.h"
+
+extern "C" uint32_t _EEPROM_start; // Linker symbol: start of the reserved EEPROM sector (memory-mapped)
+extern "C" uint32_t _FS_end;       // Linker symbol: end of the file system area (memory-mapped)
+
+static const uint32_t NO_SLOT = 0xFFFFFFFF;
+
+static const uint32_t SETTINGS_MAGIC = 0x53504146; // "FAPS"
+static const uint16_t SETTINGS_VERSION = 6; // 2: monitored sites, 3: altitude ceilings, 4: alarm debounce, 5: alarm sounds, 6: entry band
+
+// Slot header. 'length' is the payload size written by the firmware that saved the
+// record; the CRC covers exactly that many payload bytes.
+struct SettingsRecordHeader {
+    uint32_t magic;
+    uint32_t sequence; // Increases with every save; the highest valid one wins
+    uint16_t version;
+    uint16_t length;
+    uint32_t crc;
+};
+
+struct StoredSite {
+    char name[SETTINGS_SITE_NAME_LEN];
+    float latitude;
+    float longitude;
+    float radiusLevel1;
+    float radiusLevel2;
+    float radiusLevel3;
+    uint8_t alarmPolicy;
+};
+
+struct StoredAlarmSound {
+    uint16_t startHz;
+    uint16_t endHz;
+    uint16_t beepMs;
+    uint16_t gapMs;
+    uint8_t beeps;
+    uint8_t volume;
+    uint8_t source;
+};
+
+// Payload layout. Fields are only ever appended: a record saved by older firmware is
+// shorter, and the missing tail keeps its default values when it is read back.
+struct SettingsRecordPayload {
+    char ssid[SETTINGS_SSID_LEN];
+    char password[SETTINGS_PASSWORD_LEN];
+    char apiServer[SETTINGS_API_SERVER_LEN];
+    char apiKey[SETTINGS_API_KEY_LEN];
+    float latitude;
+    float longitude;
+    float radiusLevel1;
+    float radiusLevel2;
+    float radiusLevel3;
+    int32_t noFlightScanFreq;
+    int32_t flightPresentScanFreq;
+    uint8_t soundWarning;
+    // Version 2
+    uint8_t siteCount;
+    StoredSite sites[MAX_EXTRA_SITES];
+    // Version 3
+    float altitudeCeiling[3]; // Levels 1-3
+    // Version 4
+    float alarmHysteresisPercent;
+    int32_t alarmDwellSec;
+    // Version 5
+    StoredAlarmSound alarmSounds[3]; // Levels 1-3
+    // Version 6
+    float alarmEntryBandPercent;
+};
+
+struct __attribute__((aligned(4))) SettingsRecord {
+    SettingsRecordHeader header;
+    SettingsRecordPayload payload;
+};
+
+static_assert(sizeof(SettingsRecord) <= SETTINGS_RECORD_MAX_SLOTS * SETTINGS_SLOT_SIZE, "settings record does not fit its flash slots");
+static_assert(sizeof(SettingsRecord) % 4 == 0, "flash reads and writes must be whole words");
+
+// Up to SETTINGS_RECORD_MAX_SLOTS slots. Reads cover as many slots as fit so that a
+// longer record saved by newer firmware can still be CRC-checked (and its known prefix used).
+union SettingsSlot {
+    SettingsRecord record;
+    uint32_t words[SETTINGS_RECORD_MAX_SLOTS * SETTINGS_SLOT_SIZE / 4];
+};
+
+// Static so that saving from a network callback does not put them on its stack
+static SettingsSlot slotBuffer;
+static SettingsRecord pendingRecord;
+
+/**
+ * @brief Number of sectors the store uses in turn: the EEPROM sector and the one below
+ * it. The flash layouts with a file system of 8 KB blocks leave that one unused; where
+ * the file system reaches up to the EEPROM sector, only the EEPROM sector is used.
+ */
+static uint32_t storeSectorCount() {
+    return ((uint32_t)&_FS_end <= (uint32_t)&_EEPROM_start - SPI_FLASH_SEC_SIZE) ? SETTINGS_SECTOR_COUNT : 1;
+}
+
+static uint32_t storeSectorAddress(uint32_t sector) {
+    return (uint32_t)&_EEPROM_start - 0x40200000 - sector * SPI_FLASH_SEC_SIZE;
+}
+
+// Slots are numbered across the sectors: slot / SETTINGS_SLOT_COUNT is the sector
+static uint32_t slotAddress(uint32_t slot) {
+    return storeSectorAddress(slot / SETTINGS_SLOT_COUNT) + (slot % SETTINGS_SLOT_COUNT) * SETTINGS_SLOT_SIZE;
+}
+
+static uint32_t crc32(const uint8_t* data, size_t length) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+/**
+ * @brief Slots a record with a payload of 'length' bytes occupies.
+ */
+static uint32_t recordSlots(uint32_t length) {
+    return (sizeof(SettingsRecordHeader) + length + SETTINGS_SLOT_SIZE - 1) / SETTINGS_SLOT_SIZE;
+}
+
+// Slots this firmware's records occupy
+static const uint32_t RECORD_SLOTS = recordSlots(sizeof(SettingsRecordPayload));
+
+/**
+ * @brief Reads the record starting at 'slot' into slotBuffer.
+ * @return Slots read: SETTINGS_RECORD_MAX_SLOTS, or fewer at the end of a sector; 0 on error.
+ */
+static uint32_t readRecordAt(uint32_t slot) {
+    uint32_t slots = min(SETTINGS_RECORD_MAX_SLOTS, SETTINGS_SLOT_COUNT - slot % SETTINGS_SLOT_COUNT);
+    if (!ESP.flashRead(slotAddress(slot), slotBuffer.words, slots * SETTINGS_SLOT_SIZE)) {
+        return 0;
+    }
+    return slots;
+}
+
+/**
+ * @brief true if slotBuffer holds an intact record within the 'slotsRead' slots read.
+ */
+static bool isValidRecord(uint32_t slotsRead) {
+    const SettingsRecordHeader& h = slotBuffer.record.header;
+    if (h.magic != SETTINGS_MAGIC || h.length == 0 || recordSlots(h.length) > slotsRead) {
+        return false;
+    }
+    return crc32((const uint8_t*)&slotBuffer.record.payload, h.length) == h.crc;
+}
+
+static bool isBlankSlot(uint32_t slot) {
+    if (!ESP.flashRead(slotAddress(slot), slotBuffer.words, SETTINGS_SLOT_SIZE)) {
+        return false;
+    }
+    for (size_t i = 0; i < SETTINGS_SLOT_SIZE / 4; i++) {
+        if (slotBuffer.words[i] != 0xFFFFFFFF) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Finds the newest valid record in any of the store's sectors.
+ * @param latestSlot Set to the slot holding it (unchanged if none).
+ * @param latestSequence Set to its sequence number (unchanged if none).
+ * @param nextSlot Set to the first slot after it in the same sector that starts enough
+ *                 blank slots for a new record, or NO_SLOT if there is none (or no record exists).
+ * @return true if a valid record exists.
+ */
+static bool scanSlots(uint32_t& latestSlot, uint32_t& latestSequence, uint32_t& nextSlot) {
+    bool found = false;
+    uint32_t latestLength = 0;
+    uint32_t slotCount = storeSectorCount() * SETTINGS_SLOT_COUNT;
+    for (uint32_t slot = 0; slot < slotCount; ) {
+        uint32_t slotsRead = readRecordAt(slot);
+        if (slotsRead == 0 || !isValidRecord(slotsRead)) {
+            slot++;
+            continue;
+        }
+        const SettingsRecordHeader& h = slotBuffer.record.header;
+        if (!found || h.sequence > latestSequence) {
+            found = true;
+            latestSlot = slot;
+            latestSequence = h.sequence;
+            latestLength = h.length;
+        }
+        slot += recordSlots(h.length);
+    }
+
+    nextSlot = NO_SLOT;
+    if (!found) {
+        return false;
+    }
+    // First run of RECORD_SLOTS blank slots after the latest record, in the same sector
+    uint32_t sectorEnd = (latestSlot / SETTINGS_SLOT_COUNT + 1) * SETTINGS_SLOT_COUNT;
+    uint32_t runStart = latestSlot + recordSlots(latestLength);
+    for (uint32_t slot = runStart; slot < sectorEnd; slot++) {
+        if (!isBlankSlot(slot)) {
+            runStart = slot + 1;
+        } else if (slot + 1 - runStart == RECORD_SLOTS) {
+            nextSlot = runStart;
+            break;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Erases a sector unless every slot in it is already blank.
+ */
+static bool prepareSector(uint32_t sector) {
+    for (uint32_t slot = sector * SETTINGS_SLOT_COUNT; slot < (sector + 1) * SETTINGS_SLOT_COUNT; slot++) {
+        if (!isBlankSlot(slot)) {
+            return ESP.flashEraseSector(storeSectorAddress(sector) / SPI_FLASH_SEC_SIZE);
+        }
+    }
+    return true;
+}
+
+static void copyField(char* dest, size_t capacity, const String& value, const __FlashStringHelper* name) {
+    if (value.length() >= capacity) {
+        Serial.print(F("Warning: setting truncated: "));
+        Serial.println(name);
+    }
+    strlcpy(dest, value.c_str(), capacity);
+}
+
+/**
+ * @brief Converts settings to the fixed record layout; over-long strings are truncated.
+ * @param settings Source settings.
+ * @param p Destination payload (fully overwritten, unused bytes zeroed).
+ */
+static void packSettings(const AppSettings& settings, SettingsRecordPayload& p) {
+    memset(&p, 0, sizeof(p));
+    copyField(p.ssid, sizeof(p.ssid), settings.ssid, F("ssid"));
+    copyField(p.password, sizeof(p.password), settings.password, F("password"));
+    copyField(p.apiServer, sizeof(p.apiServer), settings.apiServer, F("apiServer"));
+    copyField(p.apiKey, sizeof(p.apiKey), settings.apiKey, F("apiKey"));
+    p.latitude = settings.latitude;
+    p.longitude = settings.longitude;
+    p.radiusLevel1 = settings.radiusLevel1;
+    p.radiusLevel2 = settings.radiusLevel2;
+    p.radiusLevel3 = settings.radiusLevel3;
+    p.noFlightScanFreq = settings.noFlightScanFreq;
+    p.flightPresentScanFreq = settings.flightPresentScanFreq;
+    p.soundWarning = settings.soundWarning ? 1 : 0;
+
+    p.siteCount = min(settings.sites.size(), (size_t)MAX_EXTRA_SITES);
+    for (uint8_t i = 0; i < p.siteCount; i++) {
+        const MonitoredSite& site = settings.sites[i];
+        StoredSite& stored = p.sites[i];
+        copyField(stored.name, sizeof(stored.name), site.name, F("site name"));
+        stored.latitude = site.latitude;
+        stored.longitude = site.longitude;
+        stored.radiusLevel1 = site.radiusLevel1;
+        stored.radiusLevel2 = site.radiusLevel2;
+        stored.radiusLevel3 = site.radiusLevel3;
+        stored.alarmPolicy = site.alarmPolicy;
+    }
+    for (int level = 1; level <= 3; level++) {
+        p.altitudeCeiling[level - 1] = settings.altitudeCeiling[level];
+    }
+    p.alarmHysteresisPercent = settings.alarmHysteresisPercent;
+    p.alarmDwellSec = settings.alarmDwellSec;
+    for (int level = 1; level <= 3; level++) {
+        const AlarmSound& sound = settings.alarmSounds[level];
+        StoredAlarmSound& stored = p.alarmSounds[level - 1];
+        stored.startHz = sound.startHz;
+        stored.endHz = sound.endHz;
+        stored.beepMs = sound.beepMs;
+        stored.gapMs = sound.gapMs;
+        stored.beeps = sound.beeps;
+        stored.volume = sound.volume;
+        stored.source = sound.source;
+    }
+    p.alarmEntryBandPercent = settings.alarmEntryBandPercent;
+}
+
+/**
+ * @brief Converts a record payload back to settings.
+ * @param p Source payload; string terminators are forced, even with a good CRC.
+ * @param settings Destination settings.
+ */
+static void unpackSettings(SettingsRecordPayload& p, AppSettings& settings) {
+    p.ssid[sizeof(p.ssid) - 1] = '\0';
+    p.password[sizeof(p.password) - 1] = '\0';
+    p.apiServer[sizeof(p.apiServer) - 1] = '\0';
+    p.apiKey[sizeof(p.apiKey) - 1] = '\0';
+
+    settings.ssid = p.ssid;
+    settings.password = p.password;
+    settings.apiServer = p.apiServer;
+    settings.apiKey = p.apiKey;
+    settings.latitude = p.latitude;
+    settings.longitude = p.longitude;
+    settings.radiusLevel1 = p.radiusLevel1;
+    settings.radiusLevel2 = p.radiusLevel2;
+    settings.radiusLevel3 = p.radiusLevel3;
+    settings.noFlightScanFreq = p.noFlightScanFreq;
+    settings.flightPresentScanFreq = p.flightPresentScanFreq;
+    settings.soundWarning = p.soundWarning != 0;
+
+    settings.sites.clear();
+    uint8_t siteCount = min(p.siteCount, (uint8_t)MAX_EXTRA_SITES);
+    for (uint8_t i = 0; i < siteCount; i++) {
+        StoredSite& stored = p.sites[i];
+        stored.name[sizeof(stored.name) - 1] = '\0';
+        MonitoredSite site;
+        site.name = stored.name;
+        site.latitude = stored.latitude;
+        site.longitude = stored.longitude;
+        site.radiusLevel1 = stored.radiusLevel1;
+        site.radiusLevel2 = stored.radiusLevel2;
+        site.radiusLevel3 = stored.radiusLevel3;
+        site.alarmPolicy = stored.alarmPolicy <= SITE_ALARM_NONE ? (SiteAlarmPolicy)stored.alarmPolicy : SITE_ALARM_SOUND;
+        settings.sites.push_back(site);
+    }
+    settings.altitudeCeiling[0] = 0;
+    for (int level = 1; level <= 3; level++) {
+        settings.altitudeCeiling[level] = p.altitudeCeiling[level - 1];
+    }
+    settings.alarmHysteresisPercent = p.alarmHysteresisPercent;
+    settings.alarmDwellSec = p.alarmDwellSec;
+    for (int level = 1; level <= 3; level++) {
+        const StoredAlarmSound& stored = p.alarmSounds[level - 1];
+        AlarmSound& sound = settings.alarmSounds[level];
+        sound.startHz = stored.startHz;
+        sound.endHz = stored.endHz;
+        sound.beepMs = stored.beepMs;
+        sound.gapMs = stored.gapMs;
+        sound.beeps = stored.beeps;
+        sound.volume = stored.volume;
+        sound.source = stored.source == ALARM_SOUND_CLIP ? ALARM_SOUND_CLIP : ALARM_SOUND_TONE;
+    }
+    settings.alarmEntryBandPercent = p.alarmEntryBandPercent;
+}
+
+/**
+ * @brief Loads the newest valid settings record.
+ * @param settings Must hold the defaults on entry: fields missing from an older record keep them.
+ * @return true if a valid record was found and applied.
+ */
+bool readStoredSettings(AppSettings& settings) {
+    uint32_t latestSlot = 0, latestSequence = 0, nextSlot;
+    if (!scanSlots(latestSlot, latestSequence, nextSlot)) {
+        return false;
+    }
+    readRecordAt(latestSlot);
+    const SettingsRecordHeader& header = slotBuffer.record.header;
+
+    // Overlay the stored prefix onto a payload built from the defaults
+    SettingsRecordPayload& payload = pendingRecord.payload; // Scratch; saves never run during boot
+    packSettings(settings, payload);
+    memcpy(&payload, &slotBuffer.record.payload, min((size_t)header.length, sizeof(payload)));
+    unpackSettings(payload, settings);
+
+    Serial.printf("Settings record v%u (seq %u) read from slot %u.\n",
+                  header.version, latestSequence, latestSlot);
+    return true;
+}
+
+/**
+ * @brief Appends the settings as a new record in the next blank slot.
+ * An identical record is not rewritten. Sectors are used in turn; a full one is erased
+ * only after the next record was written to the other one.
+ * @param settings Settings to store.
+ * @return true if the record was written and read back intact.
+ */
+bool writeStoredSettings(const AppSettings& settings) {
+    uint32_t latestSlot = 0, latestSequence = 0, nextSlot;
+    bool haveLatest = scanSlots(latestSlot, latestSequence, nextSlot);
+
+    memset(&pendingRecord.header, 0, sizeof(pendingRecord.header));
+    SettingsRecordPayload& p = pendingRecord.payload;
+    packSettings(settings, p);
+
+    SettingsRecordHeader& h = pendingRecord.header;
+    h.magic = SETTINGS_MAGIC;
+    h.sequence = haveLatest ? latestSequence + 1 : 1;
+    h.version = SETTINGS_VERSION;
+    h.length = sizeof(SettingsRecordPayload);
+    h.crc = crc32((const uint8_t*)&p, sizeof(SettingsRecordPayload));
+
+    if (haveLatest && readRecordAt(latestSlot) > 0 && slotBuffer.record.header.length == h.length &&
+        slotBuffer.record.header.crc == h.crc && memcmp(&slotBuffer.record.payload, &p, sizeof(p)) == 0) {
+        Serial.println(F("Settings unchanged; flash not written."));
+        return true;
+    }
+
+    // The next record goes after the latest one in its sector. When that sector is full
+    // it goes to the start of the other sector, and the full one is only erased once the
+    // new record has been verified: a power loss at any point leaves a valid record.
+    uint32_t sectorCount = storeSectorCount();
+    uint32_t oldSector = haveLatest ? latestSlot / SETTINGS_SLOT_COUNT : NO_SLOT;
+    bool switchSector = (nextSlot == NO_SLOT);
+    if (switchSector) {
+        uint32_t sector = haveLatest ? (oldSector + 1) % sectorCount : 0;
+        if (sector == oldSector) {
+            // Single-sector layout (see storeSectorCount): the old record cannot be kept
+            Serial.println(F("Warning: no spare settings sector, erasing the only one."));
+        }
+        if (!prepareSector(sector)) {
+            Serial.println(F("Failed to erase settings sector."));
+            return false;
+        }
+        nextSlot = sector * SETTINGS_SLOT_COUNT;
+    }
+
+    if (!ESP.flashWrite(slotAddress(nextSlot), (uint32_t*)&pendingRecord, sizeof(pendingRecord))) {
+        Serial.println(F("Failed to write settings record."));
+        return false;
+    }
+
+    if (!isValidRecord(readRecordAt(nextSlot)) || slotBuffer.record.header.crc != h.crc) {
+        Serial.println(F("Settings record failed verification."));
+        return false;
+    }
+    if (switchSector && haveLatest && oldSector != nextSlot / SETTINGS_SLOT_COUNT) {
+        // Keeps the spare sector blank for the next switch
+        ESP.flashEraseSector(storeSectorAddress(oldSector) / SPI_FLASH_SEC_SIZE);
+    }
+    Serial.printf("Settings record (seq %u) written to slot %u.\n", h.sequence, nextSlot);
+    return true;
+}
@@ -0,0 +1,31 @@
+// settings_store.h
+#ifndef SETTINGS_STORE_H
+#define SETTINGS_STORE_H
+
+#include <Arduino.h>
+#include "globals.h" // For AppSettings struct
+
+// Binary settings record kept in the flash sector the core reserves for EEPROM and
+// the unused sector below it. Each sector is split into fixed slots; every save goes
+// to the next blank slot, so the previous record stays valid until the new one has
+// been written and verified. When a sector is full the next record starts the other
+// one, and the full sector is erased only after that record has been verified.
+// A record takes as many consecutive slots as it needs. The slot size stays at the
+// 512 bytes of the first format, so records written by older firmware are still found.
+const uint32_t SETTINGS_SLOT_SIZE = 512;
+const uint32_t SETTINGS_SLOT_COUNT = 4096 / SETTINGS_SLOT_SIZE; // Per sector
+const uint32_t SETTINGS_RECORD_MAX_SLOTS = 2; // Longest record that can be read back
+const uint32_t SETTINGS_SECTOR_COUNT = 2;
+
+// Field capacities (including the terminating NUL) of the string settings
+const size_t SETTINGS_SSID_LEN = 33;
+const size_t SETTINGS_PASSWORD_LEN = 65;
+const size_t SETTINGS_API_SERVER_LEN = 129;
+const size_t SETTINGS_API_KEY_LEN = 65;
+const size_t SETTINGS_SITE_NAME_LEN = 16;
+
+// Function declarations
+bool readStoredSettings(AppSettings& settings);
+bool writeStoredSettings(const AppSettings& settings);
+
+#endif // SETTINGS_STORE_H
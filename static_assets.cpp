@@ -0,0 +1,68 @@
+// static_assets.cpp
+// Serves the web UI from the PROGMEM arrays generated into web_assets.h by
+// tools/build_web_assets.py. Bodies are stored gzipped and streamed from flash
+// as-is; no file system mount and no heap copy is involved.
+#include "static_assets.h"
+#include "web_assets.h"
+#include "metrics.h" // For request counters/latency
+
+static unsigned long firstPageServedMs = 0; // millis() when index.html was first sent, 0 = not yet
+
+/**
+ * @brief Serves the request from the embedded asset table, if it names an asset.
+ * "/" maps to "/index.html"; query strings (cache-busting "?v=") are ignored.
+ * @param request Request to answer.
+ * @return true if the request was answered.
+ */
+bool serveStaticAsset(AsyncWebServerRequest* request) {
+    String uri = request->url();
+    if (uri == "/") {
+        uri = "/index.html";
+    }
+
+    for (size_t i = 0; i < WEB_ASSET_COUNT; i++) {
+        const WebAsset& asset = WEB_ASSETS[i];
+        if (uri != asset.uri) {
+            continue;
+        }
+
+        AsyncWebServerResponse* response;
+        if (request->hasHeader("If-None-Match") && request->header("If-None-Match").indexOf(asset.etag) >= 0) {
+            response = request->beginResponse(304);
+        } else {
+            response = request->beginResponse_P(200, asset.mimeType, asset.data, asset.length);
+            response->addHeader("Content-Encoding", "gzip");
+        }
+        response->addHeader("ETag", asset.etag);
+        response->addHeader("Cache-Control", asset.immutable ? "public, max-age=31536000, immutable" : "no-cache");
+        request->send(response);
+
+        if (firstPageServedMs == 0 && !asset.immutable) {
+            firstPageServedMs = millis();
+            Serial.printf("First page served %lu ms after boot.\n", firstPageServedMs);
+        }
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Route handler for explicitly registered asset paths (e.g. "/").
+ * @param request Request to answer.
+ */
+void handleStaticAsset(AsyncWebServerRequest* request) {
+    metricsTrackRequest(request, ROUTE_STATIC);
+    if (!serveStaticAsset(request)) {
+        Serial.print(F("Error: static asset not found: "));
+        Serial.println(request->url());
+        request->send(404, "text/plain", "404: Not Found");
+    }
+}
+
+/**
+ * @brief Boot-to-first-page time.
+ * @return millis() at which index.html was first served, or 0 if it has not been yet.
+ */
+unsigned long getFirstPageServedMs() {
+    return firstPageServedMs;
+}
@@ -0,0 +1,13 @@
+// static_assets.h
+#ifndef STATIC_ASSETS_H
+#define STATIC_ASSETS_H
+
+#include <Arduino.h>
+#include "globals.h" // For AsyncWebServerRequest
+
+// Function declarations
+bool serveStaticAsset(AsyncWebServerRequest* request);
+void handleStaticAsset(AsyncWebServerRequest* request);
+unsigned long getFirstPageServedMs();
+
+#endif // STATIC_ASSETS_H
@@ -0,0 +1,76 @@
+// tone_synth.cpp
+// Direct digital synthesis of the alarm beep patterns: a 32-bit phase accumulator
+// indexes a 256-entry sine table, the phase increment ramps linearly for sweeps, and
+// a short linear attack/release envelope keeps beep edges click-free. Samples are
+// rendered by the mixer in the audio engine's refill callback, so a tone costs no clip data.
+#include "tone_synth.h"
+
+static const int8_t SINE_TABLE[256] PROGMEM = {
+    0, 3, 6, 9, 12, 16, 19, 22, 25, 28, 31, 34, 37, 40, 43, 46,
+    49, 51, 54, 57, 60, 63, 65, 68, 71, 73, 76, 78, 81, 83, 85, 88,
+    90, 92, 94, 96, 98, 100, 102, 104, 106, 107, 109, 111, 112, 113, 115, 116,
+    117, 118, 120, 121, 122, 122, 123, 124, 125, 125, 126, 126, 126, 127, 127, 127,
+    127, 127, 127, 127, 126, 126, 126, 125, 125, 124, 123, 122, 122, 121, 120, 118,
+    117, 116, 115, 113, 112, 111, 109, 107, 106, 104, 102, 100, 98, 96, 94, 92,
+    90, 88, 85, 83, 81, 78, 76, 73, 71, 68, 65, 63, 60, 57, 54, 51,
+    49, 46, 43, 40, 37, 34, 31, 28, 25, 22, 19, 16, 12, 9, 6, 3,
+    0, -3, -6, -9, -12, -16, -19, -22, -25, -28, -31, -34, -37, -40, -43, -46,
+    -49, -51, -54, -57, -60, -63, -65, -68, -71, -73, -76, -78, -81, -83, -85, -88,
+    -90, -92, -94, -96, -98, -100, -102, -104, -106, -107, -109, -111, -112, -113, -115, -116,
+    -117, -118, -120, -121, -122, -122, -123, -124, -125, -125, -126, -126, -126, -127, -127, -127,
+    -127, -127, -127, -127, -126, -126, -126, -125, -125, -124, -123, -122, -122, -121, -120, -118,
+    -117, -116, -115, -113, -112, -111, -109, -107, -106, -104, -102, -100, -98, -96, -94, -92,
+    -90, -88, -85, -83, -81, -78, -76, -73, -71, -68, -65, -63, -60, -57, -54, -51,
+    -49, -46, -43, -40, -37, -34, -31, -28, -25, -22, -19, -16, -12, -9, -6, -3,
+};
+
+static const uint32_t ENVELOPE_SAMPLES = AUDIO_SAMPLE_RATE / 250; // 4 ms attack and release
+
+static uint32_t hzToIncrement(uint16_t hz) {
+    return (uint32_t)(((uint64_t)hz << 32) / AUDIO_SAMPLE_RATE);
+}
+
+/**
+ * @brief Renders the next run of a tone pattern.
+ * @return Samples written; 0 once the pattern (last gap included) is over.
+ */
+size_t renderTone(ToneVoice& voice, uint8_t* dest, size_t maxSamples) {
+    size_t count = 0;
+    while (count < maxSamples && voice.beepsLeft > 0) {
+        if (voice.position < voice.beepSamples) {
+            uint32_t edge = min(voice.position, voice.beepSamples - 1 - voice.position);
+            uint32_t gain = edge < ENVELOPE_SAMPLES ? voice.amplitude * edge / ENVELOPE_SAMPLES : voice.amplitude;
+            int8_t sine = (int8_t)pgm_read_byte(&SINE_TABLE[voice.phase >> 24]);
+            dest[count++] = 128 + ((sine * (int32_t)gain) >> 8);
+            voice.phase += voice.increment;
+            voice.increment += voice.incrementStep;
+        } else {
+            dest[count++] = 128;
+        }
+        if (++voice.position == voice.beepSamples + voice.gapSamples) {
+            voice.position = 0;
+            voice.phase = 0;
+            voice.increment = voice.startIncrement;
+            voice.beepsLeft--; // The last gap is played too, so back-to-back alarms stay separated
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Loads a beep pattern into a voice, from its first sample.
+ * @param voice Voice to (re)start.
+ * @param sound Pattern (frequencies, cadence, volume).
+ */
+void startTone(ToneVoice& voice, const AlarmSound& sound) {
+    voice.beepSamples = max((uint32_t)sound.beepMs * AUDIO_SAMPLE_RATE / 1000, (uint32_t)1);
+    voice.gapSamples = (uint32_t)sound.gapMs * AUDIO_SAMPLE_RATE / 1000;
+    voice.beepsLeft = sound.beeps;
+    voice.startIncrement = hzToIncrement(sound.startHz);
+    voice.incrementStep = ((int32_t)hzToIncrement(sound.endHz) - (int32_t)voice.startIncrement) / (int32_t)voice.beepSamples;
+    voice.amplitude = (uint16_t)min((int)sound.volume, 100) * 256 / 100;
+    voice.phase = 0;
+    voice.increment = voice.startIncrement;
+    voice.position = 0;
+    Serial.printf("Starting tone: %u-%u Hz, %u x %u/%u ms\n", sound.startHz, sound.endHz, sound.beeps, sound.beepMs, sound.gapMs);
+}
@@ -0,0 +1,27 @@
+// tone_synth.h
+#ifndef TONE_SYNTH_H
+#define TONE_SYNTH_H
+
+#include <Arduino.h>
+#include "globals.h" // For AlarmSound, AUDIO_SAMPLE_RATE
+
+// One beep pattern in progress; each mixer voice owns one
+struct ToneVoice {
+    // Pattern, converted to samples and phase increments
+    uint32_t beepSamples;
+    uint32_t gapSamples;
+    uint8_t beepsLeft;
+    uint32_t startIncrement;  // Phase step at startHz (2^32 = one cycle)
+    int32_t incrementStep;    // Added per sample for the sweep
+    uint16_t amplitude;       // 0-256
+    // Oscillator state
+    uint32_t phase;
+    uint32_t increment;
+    uint32_t position;        // Sample within the current beep + gap
+};
+
+// Function declarations
+void startTone(ToneVoice& voice, const AlarmSound& sound);
+size_t renderTone(ToneVoice& voice, uint8_t* dest, size_t maxSamples);
+
+#endif // TONE_SYNTH_H
@@ -0,0 +1,234 @@
+#!/usr/bin/env python3
+"""Compile the web UI (web/) into web_assets.h for serving straight from flash.
+
+Every asset is minified, gzipped and content-hashed, then emitted as a PROGMEM
+byte array together with a routing table (URI, MIME type, ETag). The firmware
+serves these arrays as-is with Content-Encoding: gzip; no file system is needed
+to bring up the UI.
+
+index.html references the other assets as "/<name>?v=<hash>", so those can be
+cached forever (Cache-Control: immutable); index.html itself is revalidated
+with its ETag on every load.
+
+Usage: python3 tools/build_web_assets.py   (re-run after editing anything in web/)
+"""
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SOURCE_DIR = os.path.join(ROOT, "web")
+OUTPUT_HEADER = os.path.join(ROOT, "web_assets.h")
+ENTRY_PAGE = "index.html"
+
+MIME_TYPES = {
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".json": "application/json",
+    ".ico": "image/x-icon",
+    ".png": "image/png",
+    ".svg": "image/svg+xml",
+}
+
+
+# Characters after which a "/" in script starts a regular expression, not a division
+REGEX_PRECEDERS = set("(,=:[!&|?{};+-*%<>~^")
+REGEX_KEYWORDS = ("return", "typeof", "case", "do", "else", "in", "of", "void", "delete", "throw", "new")
+
+
+def strip_code(text, js):
+    """Removes comments, indentation, trailing spaces and blank lines, but only where
+    they are code: string, template literal and regular expression contents are copied
+    unchanged. CSS (js=False) only has strings and block comments."""
+    out = []
+    stack = ["code"]  # Innermost context last: code, template, or the code of a ${...}
+    braces = [0]      # Open braces per code context, to find the "}" that ends a ${...}
+    i, n = 0, len(text)
+    at_line_start = True
+
+    def last_code_char():
+        for chunk in reversed(out):
+            stripped = chunk.rstrip()
+            if stripped:
+                return stripped
+        return ""
+
+    while i < n:
+        c = text[i]
+        if stack[-1] == "template":
+            if c == "\\":
+                out.append(text[i:i + 2])
+                i += 2
+            elif c == "`":
+                out.append(c)
+                stack.pop()
+                i += 1
+            elif text.startswith("${", i):
+                out.append("${")
+                stack.append("code")
+                braces.append(0)
+                i += 2
+            else:
+                out.append(c)
+                i += 1
+            continue
+
+        if at_line_start:
+            while i < n and text[i] in " \t":
+                i += 1
+            at_line_start = False
+            continue
+        if c == "\n":
+            while out and out[-1] in (" ", "\t"):
+                out.pop()
+            if out and out[-1] != "\n":
+                out.append("\n")
+            at_line_start = True
+            i += 1
+        elif c in "\"'":
+            end = i + 1
+            while end < n and text[end] != c and text[end] != "\n":
+                end += 2 if text[end] == "\\" else 1
+            out.append(text[i:end + 1])
+            i = end + 1
+        elif text.startswith("/*", i):
+            end = text.find("*/", i + 2)
+            i = n if end < 0 else end + 2
+        elif js and text.startswith("//", i):
+            while i < n and text[i] != "\n":
+                i += 1
+        elif js and c == "`":
+            out.append(c)
+            stack.append("template")
+            i += 1
+        elif js and c == "/":
+            before = last_code_char()
+            word = re.search(r"[A-Za-z_$][\w$]*$", before)
+            if not before or before[-1] in REGEX_PRECEDERS or (word and word.group() in REGEX_KEYWORDS):
+                end, in_class = i + 1, False
+                while end < n and text[end] != "\n" and (in_class or text[end] != "/"):
+                    if text[end] == "\\":
+                        end += 1
+                    elif text[end] == "[":
+                        in_class = True
+                    elif text[end] == "]":
+                        in_class = False
+                    end += 1
+                out.append(text[i:end + 1])
+                i = end + 1
+            else:
+                out.append(c)
+                i += 1
+        elif js and c == "{":
+            braces[-1] += 1
+            out.append(c)
+            i += 1
+        elif js and c == "}" and braces[-1] == 0 and len(stack) > 1:
+            out.append(c)  # Ends a ${...}: back into the template literal
+            stack.pop()
+            braces.pop()
+            i += 1
+        else:
+            if js and c == "}":
+                braces[-1] -= 1
+            out.append(c)
+            i += 1
+    return "".join(out).strip("\n") + "\n"
+
+
+def minify(name, text):
+    """Conservative minification: comments, indentation and blank lines only.
+    Statements are left alone, so no full parser is needed, but strings, template
+    literals and regular expressions are recognised and copied verbatim."""
+    ext = os.path.splitext(name)[1]
+    if ext == ".js":
+        return strip_code(text, True)
+    if ext == ".css":
+        return strip_code(text, False)
+    if ext == ".html":
+        text = re.sub(r"<!--.*?-->", "", text, flags=re.S)
+    lines = [line.strip() for line in text.splitlines()]
+    return "\n".join(line for line in lines if line) + "\n"
+
+
+def content_hash(data):
+    return hashlib.sha256(data).hexdigest()[:16]
+
+
+def gzip_bytes(data):
+    # mtime=0 keeps the output byte-identical between builds
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def c_identifier(name):
+    return "webAsset_" + re.sub(r"[^A-Za-z0-9]", "_", name)
+
+
+def c_array(data):
+    rows = []
+    for i in range(0, len(data), 16):
+        rows.append(", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(rows)
+
+
+def main():
+    if not os.path.isdir(SOURCE_DIR):
+        sys.exit("web/ not found")
+
+    names = sorted(n for n in os.listdir(SOURCE_DIR) if os.path.isfile(os.path.join(SOURCE_DIR, n)))
+    sources = {}
+    raw_sizes = {}
+    for name in names:
+        with open(os.path.join(SOURCE_DIR, name), "rb") as f:
+            raw = f.read()
+        raw_sizes[name] = len(raw)
+        if os.path.splitext(name)[1] in (".html", ".css", ".js"):
+            raw = minify(name, raw.decode("utf-8")).encode("utf-8")
+        sources[name] = raw
+
+    # Versioned URLs for everything the entry page references
+    hashes = {name: content_hash(data) for name, data in sources.items() if name != ENTRY_PAGE}
+    if ENTRY_PAGE in sources:
+        page = sources[ENTRY_PAGE]
+        for name, digest in hashes.items():
+            for quote in (b'"', b"'"):
+                page = page.replace(quote + b"/" + name.encode() + quote,
+                                    quote + b"/" + name.encode() + b"?v=" + digest.encode() + quote)
+        sources[ENTRY_PAGE] = page
+
+    arrays = []
+    table = []
+    total_raw = total_gz = 0
+    for name in names:
+        data = sources[name]
+        packed = gzip_bytes(data)
+        ident = c_identifier(name)
+        mime = MIME_TYPES.get(os.path.splitext(name)[1], "application/octet-stream")
+        immutable = "false" if name == ENTRY_PAGE else "true"
+        arrays.append("static const uint8_t %s[] PROGMEM = {\n%s\n};\n" % (ident, c_array(packed)))
+        table.append('    { "/%s", "%s", "\\"%s\\"", %s, sizeof(%s), %s },'
+                     % (name, mime, content_hash(data), ident, ident, immutable))
+        total_raw += raw_sizes[name]
+        total_gz += len(packed)
+        print("%-12s %7d -> %6d minified -> %6d gzip" % (name, raw_sizes[name], len(data), len(packed)))
+    print("total        %7d -> %6d bytes" % (total_raw, total_gz))
+
+    with open(OUTPUT_HEADER, "w") as f:
+        f.write("// web_assets.h\n")
+        f.write("// GENERATED by tools/build_web_assets.py from web/ -- do not edit by hand.\n")
+        f.write("#ifndef WEB_ASSETS_H\n#define WEB_ASSETS_H\n\n#include <Arduino.h>\n\n")
+        f.write("struct WebAsset {\n")
+        f.write("    const char* uri;\n    const char* mimeType;\n    const char* etag;  // Quoted content hash\n")
+        f.write("    const uint8_t* data;  // gzip body in PROGMEM\n    size_t length;\n")
+        f.write("    bool immutable;       // Referenced with a versioned URL, so it can be cached forever\n};\n\n")
+        f.write("\n".join(arrays))
+        f.write("\nstatic const WebAsset WEB_ASSETS[] = {\n%s\n};\n" % "\n".join(table))
+        f.write("static const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);\n\n")
+        f.write("#endif // WEB_ASSETS_H\n")
+
+
+if __name__ == "__main__":
+    main()
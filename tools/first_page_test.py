@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+"""Boot-to-first-page test for the device, run from a PC on the same network.
+
+Reboots the device through /rebootESP, waits for it to go down, then polls "/"
+until it answers and loads the page the way a browser does (index.html, then
+/style.css and /script.js). Reports, per run and as the median:
+- the time from the reboot request until "/" first answered
+- the time until all three assets had been received
+- the bytes received
+- the time to first byte (TTFB) of each asset once the device is up, i.e. from
+  sending the request until the status line and headers arrived
+- the device's own esp_boot_to_first_page_ms from /metrics, if it exports one
+  (firmware that embeds the web assets does)
+
+The host only needs /rebootESP and the three asset paths. So the same test
+gives before/after numbers when it is run once against firmware that serves
+the UI from SPIFFS and once against firmware with the embedded assets.
+
+Usage: python3 tools/first_page_test.py <device-ip> [--runs 3] [--timeout 60] [--label NAME]
+
+Only the Python standard library is needed.
+"""
+import argparse
+import http.client
+import re
+import statistics
+import time
+
+ASSETS = ["/", "/style.css", "/script.js"]
+
+
+def get(host, port, path, timeout):
+    conn = http.client.HTTPConnection(host, port, timeout=timeout)
+    try:
+        sent = time.monotonic()
+        conn.request("GET", path, headers={"Accept-Encoding": "gzip"})
+        reply = conn.getresponse()
+        ttfb = time.monotonic() - sent
+        return reply.status, reply.read(), ttfb
+    finally:
+        conn.close()
+
+
+def wait_until_down(args):
+    deadline = time.monotonic() + 10
+    while time.monotonic() < deadline:
+        try:
+            get(args.host, args.port, "/", 1)
+        except OSError:
+            return True
+        time.sleep(0.1)
+    return False
+
+
+def run_once(args):
+    try:
+        get(args.host, args.port, "/rebootESP", 5)
+    except OSError:
+        pass  # Firmware that restarts before the reply is out
+    start = time.monotonic()
+    if not wait_until_down(args):
+        print("device did not go down after /rebootESP")
+        return None
+
+    first_answer = None
+    while time.monotonic() - start < args.timeout:
+        try:
+            status, body, _ = get(args.host, args.port, "/", 2)
+        except OSError:
+            time.sleep(0.05)
+            continue
+        if status == 200:
+            first_answer = time.monotonic() - start
+            break
+        time.sleep(0.05)
+    if first_answer is None:
+        print("no page within %.0f s" % args.timeout)
+        return None
+
+    received = len(body)
+    for path in ASSETS[1:]:
+        status, asset, _ = get(args.host, args.port, path, 10)
+        if status != 200:
+            print("%s answered %d" % (path, status))
+            return None
+        received += len(asset)
+    page_loaded = time.monotonic() - start
+
+    ttfb = {}
+    for path in ASSETS:  # Device up and idle: the serving cost alone
+        status, _, ttfb[path] = get(args.host, args.port, path, 10)
+
+    device_ms = None
+    try:
+        status, metrics, _ = get(args.host, args.port, "/metrics", 5)
+        match = re.search(rb"^esp_boot_to_first_page_ms (\d+)", metrics, re.M) if status == 200 else None
+        device_ms = int(match.group(1)) if match else None
+    except OSError:
+        pass
+    return first_answer, page_loaded, received, device_ms, ttfb
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("host", help="device IP address or host name")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--runs", type=int, default=3)
+    parser.add_argument("--timeout", type=float, default=60, help="seconds to wait for the page after a reboot")
+    parser.add_argument("--label", default="", help="name of the firmware under test, for the report")
+    args = parser.parse_args()
+
+    results = []
+    for n in range(args.runs):
+        result = run_once(args)
+        if result is None:
+            continue
+        first_answer, page_loaded, received, device_ms, ttfb = result
+        print("run %d: first answer %.2f s, page loaded %.2f s, %d bytes, device boot-to-first-page %s" % (
+            n + 1, first_answer, page_loaded, received, "%d ms" % device_ms if device_ms is not None else "n/a"))
+        print("       TTFB " + ", ".join("%s %.0f ms" % (path, ttfb[path] * 1000) for path in ASSETS))
+        results.append(result)
+    if not results:
+        return
+    print("%s median of %d: first answer %.2f s, page loaded %.2f s, %d bytes" % (
+        args.label or args.host, len(results),
+        statistics.median(r[0] for r in results), statistics.median(r[1] for r in results),
+        statistics.median(r[2] for r in results)))
+    print("median TTFB: " + ", ".join("%s %.0f ms" % (path, statistics.median(r[4][path] for r in results) * 1000)
+                                      for path in ASSETS))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,118 @@
+// bench_geofence.cpp
+// Host benchmark for the polygon zone test: per-position cost of geofenceLevel()
+// casting its ray over the edges of one latitude slab against casting it over every
+// edge, for star polygons of 4 to 500 corners. The break-even sets
+// GEOFENCE_SLAB_MIN_EDGES (geofence.h). Each star is written in the binary zone form
+// and loaded through importGeofences(), as an upload would be. Both paths must agree
+// on every position, and a star whose ring is not closed must be rejected.
+//
+// Build and run from the repository root:
+//   g++ -std=gnu++17 -O2 -Itools/host/shim -Itools/host -I. -o /tmp/bench_geofence
+//       tools/host/bench_geofence.cpp tools/host/host_runtime.cpp geofence.cpp
+//   /tmp/bench_geofence
+#include "host_runtime.h"
+#include "geofence.h"
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+const int POSITIONS = 200000;
+const int TIMING_RUNS = 5; // Best of, to ride out scheduler noise
+
+static void put(std::vector<uint8_t>& out, const void* data, size_t length) {
+    out.insert(out.end(), (const uint8_t*)data, (const uint8_t*)data + length);
+}
+
+// One level 2 zone: a star with 'corners' corners alternating between radius 1 and 0.5
+// degrees around 15 N 75 E, closed by repeating the first vertex unless 'closed' is false
+static std::vector<uint8_t> encodeStarZone(int corners, bool closed = true) {
+    std::vector<uint8_t> out;
+    uint32_t magic = 0x314E5A46; // "FZN1"
+    uint16_t zoneCount = 1, reserved = 0, ringCount = 1;
+    uint16_t vertexCount = closed ? corners + 1 : corners;
+    uint8_t level = 2;
+    const char name[] = "Star";
+    uint8_t nameLength = sizeof(name) - 1;
+    put(out, &magic, 4);
+    put(out, &zoneCount, 2);
+    put(out, &reserved, 2);
+    put(out, &level, 1);
+    put(out, &nameLength, 1);
+    put(out, &ringCount, 2);
+    put(out, name, nameLength);
+    put(out, &vertexCount, 2);
+    for (int i = 0; i < vertexCount; i++) {
+        double angle = 2 * PI * (i % corners) / corners;
+        double radius = (i % corners) % 2 ? 0.5 : 1.0;
+        float lat = 15 + radius * sin(angle);
+        float lon = 75 + radius * cos(angle);
+        put(out, &lat, 4);
+        put(out, &lon, 4);
+    }
+    return out;
+}
+
+// Best-of-TIMING_RUNS time of geofenceLevel() over all positions, in ns per position
+static double timeLevel(const GeofenceSet& set, const std::vector<std::pair<float, float>>& positions, int& hits) {
+    double best = 1e30;
+    for (int run = 0; run < TIMING_RUNS; run++) {
+        int zoneIndex;
+        hits = 0;
+        auto t0 = std::chrono::steady_clock::now();
+        for (const auto& p : positions) {
+            hits += geofenceLevel(set, p.first, p.second, zoneIndex) != 0;
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::nano>(t1 - t0).count() / positions.size());
+    }
+    return best;
+}
+
+int main() {
+    std::mt19937 rng(2);
+    std::uniform_real_distribution<float> unit(-1.1f, 1.1f);
+
+    std::vector<uint8_t> open = encodeStarZone(8, false);
+    String openMessage;
+    if (importGeofences(open.data(), open.size(), openMessage)) {
+        printf("an open ring was accepted\n");
+        return 1;
+    }
+
+    printf("corners  slabs  slab index (ns/position)  all edges (ns/position)  default  result\n");
+    for (int corners : {4, 8, 12, 16, 24, 32, 48, 64, 128, 500}) {
+        std::vector<uint8_t> upload = encodeStarZone(corners);
+        String message;
+        if (!importGeofences(upload.data(), upload.size(), message)) {
+            printf("%7d  rejected: %s\n", corners, message.c_str());
+            return 1;
+        }
+        GeofenceSetPtr set = currentGeofences();
+        GeofenceSet indexed = *set, allEdges = *set;
+        indexed.zones[0].useSlabs = true;
+        allEdges.zones[0].useSlabs = false;
+
+        std::vector<std::pair<float, float>> positions(POSITIONS);
+        for (auto& p : positions) {
+            p = {15 + unit(rng), 75 + unit(rng)};
+        }
+
+        int indexedHits, allHits;
+        double indexedNs = timeLevel(indexed, positions, indexedHits);
+        double allNs = timeLevel(allEdges, positions, allHits);
+        int mismatches = 0;
+        for (const auto& p : positions) {
+            int zoneIndex;
+            mismatches += geofenceLevel(indexed, p.first, p.second, zoneIndex) != geofenceLevel(allEdges, p.first, p.second, zoneIndex);
+        }
+
+        printf("%7d  %5u  %24.1f  %23.1f  %7s  %s (%d inside)\n", corners, (unsigned)set->zones[0].slabStart.size() - 1,
+               indexedNs, allNs, set->zones[0].useSlabs ? "index" : "all",
+               mismatches == 0 && indexedHits == allHits ? "match" : "MISMATCH", indexedHits);
+        if (mismatches || indexedHits != allHits) {
+            return 1;
+        }
+    }
+    return 0;
+}
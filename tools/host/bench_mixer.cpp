@@ -0,0 +1,80 @@
+// bench_mixer.cpp
+// Host benchmark of the alarm mixer: starts all three voices at once (the level 1 and
+// level 2 tone patterns and the level 3 clip) and plays them through the real timer1
+// interrupt handler and refill Ticker (audio_engine.cpp), so mixVoices() runs as on
+// the device. Reports the mixer's own cycles per output sample, from the
+// ESP.getCycleCount() high-water mark it keeps (mixerCyclesPerSampleMax()), and the
+// average over the whole render, against the timer1 budget of one sample period at
+// 80 MHz (AUDIO_CYCLES_PER_SAMPLE). Fails if the mixer exceeds that budget, if the
+// engine underruns, or if the output is silent.
+//
+// Cycles here are host TSC cycles. The mixer is integer-only, but the ESP8266 core is
+// much slower per cycle, so the host headroom is an upper bound; the device figure is
+// audio_mix_cycles_per_sample_max on /metrics.
+//
+// Build and run from the repository root:
+//   g++ -std=gnu++17 -O2 -Itools/host/shim -Itools/host -I. -o /tmp/bench_mixer
+//       tools/host/bench_mixer.cpp tools/host/host_runtime.cpp audio_mixer.cpp audio_engine.cpp
+//       clip_player.cpp tone_synth.cpp announcer.cpp scan_geometry.cpp geofence.cpp utils.cpp
+//   /tmp/bench_mixer
+#include "host_runtime.h"
+#include "audio_mixer.h"
+#include "audio_engine.h"
+#include "scan_geometry.h"
+#include <vector>
+
+Ticker audioTicker;
+
+static const uint32_t SAMPLE_US = 1000000 / AUDIO_SAMPLE_RATE;
+
+int main() {
+    AppSettings settings = {}; // The mixer reads the alarm sounds from the geometry built from these
+    settings.alarmSounds[1] = { ALARM_SOUND_TONE, 2000, 2600, 150, 80, 10, 100 };
+    settings.alarmSounds[2] = { ALARM_SOUND_TONE, 1200, 1200, 300, 300, 4, 80 };
+    settings.alarmSounds[3] = { ALARM_SOUND_CLIP, 800, 800, 500, 700, 2, 60 };
+    rebuildScanGeometry(settings);
+
+    audioEngineBegin();
+    while (hostTimer1Enabled) { // Boot ramp up to mid-scale
+        hostMicros += SAMPLE_US;
+        hostTimer1Callback();
+    }
+    for (int level = 3; level >= 1; level--) { // Least urgent first, so none is held back
+        if (!mixerPlayLevel(level, false)) {
+            printf("level %d did not start\n", level);
+            return 1;
+        }
+    }
+
+    // One timer1 interrupt per sample period, the refill Ticker every AUDIO_REFILL_INTERVAL_MS
+    std::vector<uint8_t> output;
+    uint64_t nextTickerUs = hostMicros + AUDIO_REFILL_INTERVAL_MS * 1000ull;
+    uint64_t refillCycles = 0;
+    while (hostTimer1Enabled) {
+        hostMicros += SAMPLE_US;
+        hostTimer1Callback();
+        output.push_back(GPSD & 0xFF);
+        if (hostMicros >= nextTickerUs) {
+            uint32_t start = ESP.getCycleCount();
+            runDueTickers();
+            refillCycles += ESP.getCycleCount() - start;
+            nextTickerUs += AUDIO_REFILL_INTERVAL_MS * 1000ull;
+        }
+    }
+
+    int low = 255, high = 0;
+    for (uint8_t sample : output) {
+        low = min(low, (int)sample);
+        high = max(high, (int)sample);
+    }
+    uint32_t peak = mixerCyclesPerSampleMax();
+    double average = output.empty() ? 0 : (double)refillCycles / output.size();
+    printf("3 voices: %zu samples (%.2f s), output range %d-%d, underruns %u\n", output.size(),
+           output.size() / (double)AUDIO_SAMPLE_RATE, low, high, audioEngineUnderruns());
+    printf("mixer cycles/sample: peak %u, average %.1f (refill, incl. Ticker); budget %u at 80 MHz: %.0fx headroom\n",
+           peak, average, AUDIO_CYCLES_PER_SAMPLE, peak ? (double)AUDIO_CYCLES_PER_SAMPLE / peak : 0.0);
+
+    bool ok = peak > 0 && peak < AUDIO_CYCLES_PER_SAMPLE && audioEngineUnderruns() == 0 && high - low > 16;
+    printf("%s\n", ok ? "within budget" : "FAILED");
+    return ok ? 0 : 1;
+}
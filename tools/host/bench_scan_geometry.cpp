@@ -0,0 +1,91 @@
+// bench_scan_geometry.cpp
+// Host benchmark for the multi-site scan geometry: the cost of classifying one
+// aircraft (classifyPosition) with the grid index and with the plain test of every
+// site, for 1 up to the most sites the settings allow (MAX_EXTRA_SITES + 1). Both
+// paths must agree on every position. SCAN_INDEX_MIN_SITES is set from the point
+// where the index starts to win; the "uses" column shows the path the device takes.
+// Pass a larger site count to look further: /tmp/bench_scan_geometry 40
+//
+// Build and run from the repository root:
+//   g++ -std=gnu++17 -O2 -Itools/host/shim -Itools/host -I. -o /tmp/bench_scan_geometry
+//       tools/host/bench_scan_geometry.cpp tools/host/host_runtime.cpp scan_geometry.cpp geofence.cpp utils.cpp
+//   /tmp/bench_scan_geometry [max sites]
+#include "host_runtime.h"
+#include "scan_geometry.h"
+#include <chrono>
+#include <random>
+
+const int POSITIONS = 200000;
+
+typedef std::vector<std::pair<float, float>> Positions;
+
+const int TIMING_RUNS = 5;
+
+// Best time per position of classifyPosition() over TIMING_RUNS runs;
+// 'levels' receives level * 256 + site per position
+static double timeClassify(const ScanGeometry& geometry, const Positions& positions, std::vector<int>& levels) {
+    SiteMatch match;
+    levels.resize(positions.size());
+    double bestNs = 1e30;
+    for (int run = 0; run < TIMING_RUNS; run++) {
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < positions.size(); i++) {
+            int level = classifyPosition(geometry, positions[i].first, positions[i].second, 0, match);
+            levels[i] = level * 256 + (level ? match.site : 0);
+        }
+        bestNs = min(bestNs, std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+    }
+    return bestNs / positions.size();
+}
+
+int main(int argc, char** argv) {
+    int maxSites = argc > 1 ? atoi(argv[1]) : MAX_EXTRA_SITES + 1;
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    printf("sites  indexed (ns/aircraft)  all sites (ns/aircraft)  candidates/cell  uses     result\n");
+    for (int siteCount = 1; siteCount <= maxSites; siteCount += siteCount < 4 ? 1 : 4) {
+        AppSettings settings = {};
+        settings.apiServer = "opensky-network.org";
+        settings.latitude = 15.36f;
+        settings.longitude = 75.02f;
+        settings.radiusLevel1 = 5;
+        settings.radiusLevel2 = 10;
+        settings.radiusLevel3 = 20;
+        settings.noFlightScanFreq = 60;
+        settings.flightPresentScanFreq = 10;
+        std::mt19937 siteRng(siteCount);
+        for (int i = 1; i < siteCount; i++) {
+            settings.sites.push_back({"Site", 15.36f + unit(siteRng) * 1.5f, 75.02f + unit(siteRng) * 1.5f,
+                                      3, 6, 10, SITE_ALARM_SOUND});
+        }
+        rebuildScanGeometry(settings);
+        ScanGeometry indexed = activeScanGeometry();
+        ScanGeometry linear = indexed;
+        indexed.useIndex = true;
+        linear.useIndex = false;
+
+        Positions positions(POSITIONS);
+        for (auto& p : positions) {
+            p.first = indexed.latMin + (unit(rng) + 1) / 2 * (indexed.latMax - indexed.latMin);
+            p.second = indexed.lonMin + (unit(rng) + 1) / 2 * (indexed.lonMax - indexed.lonMin);
+        }
+
+        std::vector<int> indexedLevels, linearLevels;
+        double indexedNs = timeClassify(indexed, positions, indexedLevels);
+        double linearNs = timeClassify(linear, positions, linearLevels);
+        int inside = 0;
+        for (int level : linearLevels) {
+            inside += level != 0;
+        }
+        bool match = indexedLevels == linearLevels;
+
+        printf("%5d  %21.1f  %23.1f  %15.2f  %-7s  %s (%d inside)\n", siteCount, indexedNs, linearNs,
+               (double)indexed.cellSites.size() / (SCAN_GRID_DIM * SCAN_GRID_DIM),
+               activeScanGeometry().useIndex ? "index" : "all", match ? "match" : "MISMATCH", inside);
+        if (!match) {
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,123 @@
+// check_adpcm.cpp
+// Host round-trip check of the built-in alarm clips: decodes every clip in
+// alarm_clips.h with the firmware's decoder (renderClip() in clip_player.cpp) and
+// compares it with its WAV master in audio/. The SNR printed for each clip must equal
+// the one tools/encode_alarm_clips.py printed when it encoded the clip, since the
+// encoder scores its codes on the same decoder step. Also reports the decoder's cost
+// per sample: the average over the clip from ESP.getCycleCount() around each decoded
+// run, and the high-water mark the firmware exports as
+// audio_clip_decode_cycles_per_sample_max (clipDecodeCyclesPerSampleMax()). Cycles
+// here are host TSC cycles, and the high-water mark includes the first, cold-cache
+// run and any preemption by the host OS; the device figure is that metric on /metrics.
+//
+// The compression ratio is stated against the 8-bit PCM the clips used to be stored
+// as: 4-bit codes make IMA-ADPCM 2:1 here (4:1 only applies to 16-bit sources).
+//
+// Build and run from the repository root:
+//   g++ -std=gnu++17 -O2 -Itools/host/shim -Itools/host -I. -o /tmp/check_adpcm
+//       tools/host/check_adpcm.cpp tools/host/host_runtime.cpp clip_player.cpp
+//   /tmp/check_adpcm
+#include "host_runtime.h"
+#include "clip_player.h"
+#include <vector>
+
+void mixerStopAll() {} // clip_player.cpp stops the mixer before replacing a clip file
+
+const int TIMING_RUNS = 200;
+
+// Reads a mono 8- or 16-bit PCM WAV file as played: unsigned 8-bit, rounded as the decoder does
+static bool readWavMaster(const String& path, std::vector<uint8_t>& samples) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) {
+        return false;
+    }
+    std::vector<uint8_t> data;
+    uint8_t buffer[4096];
+    while (size_t count = fread(buffer, 1, sizeof(buffer), file)) {
+        data.insert(data.end(), buffer, buffer + count);
+    }
+    fclose(file);
+
+    uint16_t bits = 0;
+    for (size_t pos = 12; pos + 8 <= data.size();) {
+        uint32_t size;
+        memcpy(&size, &data[pos + 4], 4);
+        if (memcmp(&data[pos], "fmt ", 4) == 0 && pos + 24 <= data.size()) {
+            memcpy(&bits, &data[pos + 22], 2);
+        } else if (memcmp(&data[pos], "data", 4) == 0) {
+            size = min<size_t>(size, data.size() - pos - 8);
+            const uint8_t* pcm = &data[pos + 8];
+            if (bits == 8) {
+                samples.assign(pcm, pcm + size);
+            } else if (bits == 16) {
+                for (size_t i = 0; i + 1 < size; i += 2) {
+                    int16_t sample = pcm[i] | (pcm[i + 1] << 8);
+                    samples.push_back(constrain(((sample + 128) >> 8) + 128, 0, 255));
+                }
+            }
+            return !samples.empty();
+        }
+        pos += 8 + size + (size & 1);
+    }
+    return false;
+}
+
+static void decodeAll(const AlarmClip& clip, std::vector<uint8_t>& out) {
+    ClipVoice voice;
+    voice.clip = &clip;
+    voice.sample = 0;
+    voice.sampleCount = clip.sampleCount;
+    voice.state.predictor = 0;
+    voice.state.stepIndex = 0;
+    out.resize(clip.sampleCount);
+    size_t decoded = 0;
+    while (size_t count = renderClip(voice, out.data() + decoded, min<size_t>(512, out.size() - decoded))) {
+        decoded += count;
+    }
+}
+
+int main() {
+    int failures = 0;
+    printf("clip             samples  PCM (B)  ADPCM (B)  ratio  SNR (dB)  decode (cycles/sample)\n");
+    size_t totalPcm = 0, totalAdpcm = 0;
+    for (int i = 0; i < ALARM_CLIP_COUNT; i++) {
+        const AlarmClip& clip = ALARM_CLIPS[i];
+        std::vector<uint8_t> reference;
+        if (!readWavMaster(String("audio/") + clip.name + ".wav", reference)) {
+            printf("%-16s no readable WAV master in audio/\n", clip.name);
+            failures++;
+            continue;
+        }
+
+        std::vector<uint8_t> decoded;
+        uint32_t bestCycles = UINT32_MAX;
+        for (int run = 0; run < TIMING_RUNS; run++) {
+            uint32_t start = ESP.getCycleCount();
+            decodeAll(clip, decoded);
+            bestCycles = min(bestCycles, ESP.getCycleCount() - start);
+        }
+
+        if (reference.size() != decoded.size()) {
+            printf("%-16s %7zu  length differs from the master (%zu samples)\n", clip.name, decoded.size(), reference.size());
+            failures++;
+            continue;
+        }
+        double signal = 0, noise = 0;
+        for (size_t n = 0; n < reference.size(); n++) {
+            signal += (reference[n] - 128.0) * (reference[n] - 128.0);
+            noise += (double)(reference[n] - decoded[n]) * (reference[n] - decoded[n]);
+        }
+        size_t pcmBytes = clip.sampleCount; // 8-bit PCM
+        size_t adpcmBytes = (clip.sampleCount + 1) / 2;
+        totalPcm += pcmBytes;
+        totalAdpcm += adpcmBytes;
+        printf("%-16s %7zu  %7zu  %9zu  %4.2f:1  %8.1f  %22.2f\n", clip.name, decoded.size(), pcmBytes, adpcmBytes,
+               (double)pcmBytes / adpcmBytes, noise > 0 ? 10 * log10(max(signal, 1.0) / noise) : INFINITY,
+               (double)bestCycles / decoded.size());
+    }
+    printf("total                     %7zu  %9zu  %4.2f:1\n", totalPcm, totalAdpcm,
+           totalAdpcm ? (double)totalPcm / totalAdpcm : 0.0);
+    printf("decode cycles/sample, worst run (audio_clip_decode_cycles_per_sample_max): %u\n",
+           clipDecodeCyclesPerSampleMax());
+    return failures ? 1 : 0;
+}
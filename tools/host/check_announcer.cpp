@@ -0,0 +1,155 @@
+// check_announcer.cpp
+// Host check of the spoken announcements: installs a stub clip file for every word
+// (random IMA-ADPCM codes of a different length per word, odd and even) in the
+// simulated SPIFFS, prepares an announcement with prepareAnnouncement() and renders it
+// with renderAnnouncement() in the mixer's 128-sample runs. The output must equal,
+// sample for sample, the expected words each decoded on its own, joined with nothing
+// but the two ANNOUNCE_PAUSE_SAMPLES pauses and the one silent sample after an
+// odd-length word. A word decoded from the wrong byte offset, a dropped sample or an
+// inserted gap all break that match. Cases:
+// - "BAW12 " at 4.249 km: alarm | bravo alpha whiskey 1 2 | 4 point 2 kilometres
+// - an ICAO24 address at 12.96 km for level 3, in 126-sample runs
+// - a word that is not installed is left out
+// - an announcement stopped halfway releases its word file, and the next one plays in full
+// Also reports renderAnnouncement()'s cycles per sample (host TSC cycles).
+//
+// Build and run from the repository root:
+//   g++ -std=gnu++17 -O2 -Itools/host/shim -Itools/host -I. -o /tmp/check_announcer
+//       tools/host/check_announcer.cpp tools/host/host_runtime.cpp announcer.cpp clip_player.cpp
+//   /tmp/check_announcer
+#include "host_runtime.h"
+#include "announcer.h"
+#include "clip_player.h"
+#include <random>
+#include <vector>
+
+void mixerStopAll() {} // clip_player.cpp stops the mixer before replacing a clip file
+
+static const uint8_t PAUSE = 0xFF;
+
+static uint32_t unitSamples(int unit) {
+    return 401 + 37 * unit; // Odd for even units, even for odd ones
+}
+
+static void installUnit(int unit) {
+    std::mt19937 random(unit + 1);
+    uint32_t samples = unitSamples(unit);
+    ClipFileHeader header = { CLIP_FILE_MAGIC, samples };
+    std::vector<uint8_t> data((const uint8_t*)&header, (const uint8_t*)&header + sizeof(header));
+    for (uint32_t i = 0; i < (samples + 1) / 2; i++) {
+        data.push_back(random() & 0xFF);
+    }
+    File file = SPIFFS.open(announceUnitPath(unit), "w");
+    file.write(data.data(), data.size());
+    file.close();
+}
+
+// A word as it sounds on its own: its clip decoded from the start
+static std::vector<uint8_t> decodeUnit(int unit) {
+    ClipVoice voice;
+    startClipFile(voice, announceUnitPath(unit));
+    std::vector<uint8_t> samples(voice.sampleCount);
+    size_t done = 0;
+    while (size_t count = renderClip(voice, samples.data() + done, min<size_t>(256, samples.size() - done))) {
+        done += count;
+    }
+    closeClip(voice);
+    return samples;
+}
+
+static std::vector<uint8_t> expectedOutput(const std::vector<uint8_t>& units) {
+    std::vector<uint8_t> out;
+    for (uint8_t unit : units) {
+        if (unit == PAUSE) {
+            out.insert(out.end(), ANNOUNCE_PAUSE_SAMPLES, 128);
+            continue;
+        }
+        std::vector<uint8_t> word = decodeUnit(unit);
+        out.insert(out.end(), word.begin(), word.end());
+        if (out.size() & 1) {
+            out.push_back(128);
+        }
+    }
+    return out;
+}
+
+static std::vector<uint8_t> render(size_t runSamples, size_t stopAfter, uint64_t& cycles) {
+    std::vector<uint8_t> out;
+    std::vector<uint8_t> run(runSamples);
+    cycles = 0;
+    while (out.size() < stopAfter) {
+        uint32_t start = ESP.getCycleCount();
+        size_t count = renderAnnouncement(run.data(), runSamples);
+        cycles += ESP.getCycleCount() - start;
+        out.insert(out.end(), run.begin(), run.begin() + count);
+        if (count < runSamples) {
+            break;
+        }
+    }
+    return out;
+}
+
+static std::vector<uint8_t> words(std::initializer_list<const char*> names) {
+    std::vector<uint8_t> units;
+    for (const char* name : names) {
+        units.push_back(name ? announceUnitIndex(name) : PAUSE);
+    }
+    return units;
+}
+
+static bool check(const char* name, int level, const char* callsign, float distanceKm, size_t runSamples,
+                  const std::vector<uint8_t>& units) {
+    if (!prepareAnnouncement(level, callsign, distanceKm)) {
+        printf("%s: nothing to announce; FAILED\n", name);
+        return false;
+    }
+    uint64_t cycles;
+    std::vector<uint8_t> out = render(runSamples, SIZE_MAX, cycles);
+    std::vector<uint8_t> expected = expectedOutput(units);
+    size_t mismatch = 0;
+    while (mismatch < min(out.size(), expected.size()) && out[mismatch] == expected[mismatch]) {
+        mismatch++;
+    }
+    bool ok = out.size() == expected.size() && mismatch == out.size();
+    printf("%s: %zu words, %zu samples (expected %zu)", name, units.size(), out.size(), expected.size());
+    if (!ok) {
+        printf(", first difference at sample %zu", mismatch);
+    }
+    printf(", %.1f cycles/sample; %s\n", out.empty() ? 0.0 : (double)cycles / out.size(), ok ? "ok" : "FAILED");
+    return ok;
+}
+
+int main() {
+    SPIFFS.begin();
+    for (int unit = 0; unit < ANNOUNCE_UNIT_COUNT; unit++) {
+        installUnit(unit);
+    }
+
+    int failures = 0;
+    failures += !check("BAW12 at 4.249 km", 1, "BAW12 ", 4.249f, 128,
+                       words({ "alarm", nullptr, "bravo", "alpha", "whiskey", "1", "2", nullptr,
+                               "4", "point", "2", "kilometres" }));
+    failures += !check("ICAO24 at 12.96 km, level 3", 3, "3c6a4f", 12.96f, 126,
+                       words({ "detection", nullptr, "3", "charlie", "6", "alpha", "4", "foxtrot", nullptr,
+                               "1", "3", "point", "0", "kilometres" }));
+
+    SPIFFS.remove(announceUnitPath(announceUnitIndex("point")));
+    failures += !check("without \"point\"", 2, "DLH4", 0.5f, 128,
+                       words({ "warning", nullptr, "delta", "lima", "hotel", "4", nullptr,
+                               "0", "5", "kilometres" }));
+    installUnit(announceUnitIndex("point"));
+
+    // Stopped halfway through a word: the file is released and the next announcement is whole
+    prepareAnnouncement(1, "EZY77", 3.0f);
+    uint64_t cycles;
+    render(128, ANNOUNCE_PAUSE_SAMPLES + 1000, cycles);
+    stopAnnouncement();
+    uint8_t run[128];
+    bool silent = renderAnnouncement(run, sizeof(run)) == 0;
+    printf("stopped announcement: renders %s; %s\n", silent ? "nothing" : "on", silent ? "ok" : "FAILED");
+    failures += !silent;
+    failures += !check("after a stop", 1, "EZY77", 3.0f, 128,
+                       words({ "alarm", nullptr, "echo", "zulu", "yankee", "7", "7", nullptr,
+                               "3", "point", "0", "kilometres" }));
+    return failures ? 1 : 0;
+}
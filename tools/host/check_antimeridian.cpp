@@ -0,0 +1,96 @@
+// check_antimeridian.cpp
+// Host check for the scan geometry around the antimeridian and the poles: for site
+// layouts near +/-180 degrees, classifyPosition() must agree with a brute-force
+// wrapped-distance test on every random position, and the query box must stay within
+// the API's [-180, 180] / [-90, 90] ranges. Exits non-zero on any disagreement.
+//
+// Build and run from the repository root:
+//   g++ -std=gnu++17 -O2 -Itools/host/shim -Itools/host -I. -o /tmp/check_antimeridian
+//       tools/host/check_antimeridian.cpp tools/host/host_runtime.cpp scan_geometry.cpp geofence.cpp utils.cpp
+//   /tmp/check_antimeridian
+#include "host_runtime.h"
+#include "scan_geometry.h"
+#include <random>
+
+const int POSITIONS = 400000;
+
+static float wrapLongitude(float longitude) {
+    return longitude > 180.0f ? longitude - 360.0f : (longitude < -180.0f ? longitude + 360.0f : longitude);
+}
+
+static bool insideAnySite(const ScanGeometry& geometry, float latitude, float longitude) {
+    for (const SiteGeometry& site : geometry.sites) {
+        float dx = wrapLongitude(longitude - site.longitude) * site.kmPerDegLon;
+        float dy = (latitude - site.latitude) * geometry.kmPerDegLat;
+        if (dx * dx + dy * dy <= site.radiusSq[3]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Reads lamin/lamax/lomin/lomax back out of the query URL
+static bool queryInRange(const String& url) {
+    float laMin, laMax, loMin, loMax;
+    const char* query = strchr(url.c_str(), '?');
+    if (!query || sscanf(query, "?lamin=%f&lamax=%f&lomin=%f&lomax=%f", &laMin, &laMax, &loMin, &loMax) != 4) {
+        return false;
+    }
+    return laMin >= -90 && laMax <= 90 && laMin <= laMax && loMin >= -180 && loMax <= 180 && loMin <= loMax;
+}
+
+int main() {
+    struct Case {
+        const char* name;
+        float latitude, longitude;
+        int extraSites;
+        float spread; // Degrees of longitude the extra sites are scattered over
+    } cases[] = {
+        {"site at 179.9 E", -17.8f, 179.9f, 0, 0},
+        {"site at 179.95 W, four around it", -17.8f, -179.95f, 4, 1.5f},
+        {"65 N 179.5 E, ten around it", 65.0f, 179.5f, 10, 3.0f},
+        {"near the north pole", 89.9f, 10.0f, 0, 0},
+        {"far from the antimeridian", 15.36f, 75.02f, 10, 1.5f},
+        {"sites spread around the globe", 0.0f, 0.0f, 5, 170.0f},
+    };
+
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    int failures = 0;
+    for (const Case& c : cases) {
+        AppSettings settings = {};
+        settings.apiServer = "opensky-network.org";
+        settings.latitude = c.latitude;
+        settings.longitude = c.longitude;
+        settings.radiusLevel1 = 5;
+        settings.radiusLevel2 = 10;
+        settings.radiusLevel3 = 20;
+        settings.noFlightScanFreq = 60;
+        settings.flightPresentScanFreq = 10;
+        for (int i = 0; i < c.extraSites; i++) {
+            settings.sites.push_back({"Site", c.latitude + unit(rng), wrapLongitude(c.longitude + unit(rng) * c.spread),
+                                      3, 6, 10, SITE_ALARM_SOUND});
+        }
+        rebuildScanGeometry(settings);
+        const ScanGeometry& geometry = activeScanGeometry();
+
+        int hits = 0;
+        int mismatches = 0;
+        SiteMatch match;
+        for (int i = 0; i < POSITIONS; i++) {
+            float latitude = c.latitude + unit(rng) * 2.0f;
+            float longitude = wrapLongitude(c.longitude + unit(rng) * (c.spread + 3.0f));
+            if (latitude > 90.0f || latitude < -90.0f) {
+                continue;
+            }
+            bool inside = insideAnySite(geometry, latitude, longitude);
+            hits += inside;
+            mismatches += inside != (classifyPosition(geometry, latitude, longitude, 0, match) != 0);
+        }
+        bool queryOk = queryInRange(geometry.apiUrl);
+        printf("%-32s box lon [%8.2f, %8.2f]  %6d inside  %d mismatches  query %s\n", c.name,
+               geometry.lonMin, geometry.lonMax, hits, mismatches, queryOk ? "ok" : "OUT OF RANGE");
+        failures += mismatches != 0 || !queryOk;
+    }
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,250 @@
+// host_runtime.cpp
+// Backs the shim headers in shim/ for the host harnesses: simulated time, timer1,
+// Tickers, flash, RTC memory, the WiFi station and an in-memory SPIFFS. Build it
+// together with a harness and the firmware sources it tests; see the harness's header
+// comment for the command line.
+#include "host_runtime.h"
+#include <ESP8266WiFi.h>
+#include <FS.h>
+#include <Ticker.h>
+#include <coredecls.h>
+#include <lwip/netif.h>
+#include <sigma_delta.h>
+#include <stdarg.h>
+#include <vector>
+
+HardwareSerial Serial;
+EspClass ESP;
+fs::FS SPIFFS;
+ESP8266WiFiClass WiFi;
+netif* netif_list = nullptr;
+
+uint64_t hostMicros = 0;
+
+unsigned long millis() { return hostMicros / 1000; }
+unsigned long micros() { return hostMicros; }
+void delay(unsigned long ms) { hostMicros += ms * 1000ull; }
+void yield() {}
+uint8_t hostPinLevels[HOST_PIN_COUNT];
+uint32_t hostPinWrites = 0;
+
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t pin, uint8_t value) {
+    if (pin < HOST_PIN_COUNT) {
+        hostPinLevels[pin] = value;
+    }
+    hostPinWrites++;
+}
+
+size_t Print::printf(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int written = vfprintf(stderr, format, args);
+    va_end(args);
+    return written < 0 ? 0 : written;
+}
+
+// --- Cycle counter: the host TSC where there is one, so ISR costs read as host cycles ---
+uint32_t EspClass::getCycleCount() {
+#if defined(__x86_64__) || defined(__i386__)
+    return (uint32_t)__builtin_ia32_rdtsc();
+#else
+    return (uint32_t)(hostMicros * 80);
+#endif
+}
+
+// --- timer1 and the sigma-delta generator ---
+timercallback hostTimer1Callback = nullptr;
+bool hostTimer1Enabled = false;
+uint32_t hostTimer1Ticks = 0;
+volatile uint32_t GPSD = 0;
+
+void timer1_attachInterrupt(timercallback callback) { hostTimer1Callback = callback; }
+void timer1_detachInterrupt() { hostTimer1Callback = nullptr; }
+void timer1_enable(uint8_t, uint8_t, uint8_t) { hostTimer1Enabled = true; }
+void timer1_write(uint32_t ticks) { hostTimer1Ticks = ticks; }
+void timer1_disable() { hostTimer1Enabled = false; }
+uint32_t sigmaDeltaSetup(uint8_t, uint32_t frequency) { return frequency; }
+void sigmaDeltaAttachPin(uint8_t, uint8_t) {}
+
+// --- Ticker ---
+// Function-local, so it exists before any global Ticker in another file is constructed
+static std::vector<Ticker*>& tickers() {
+    static std::vector<Ticker*> all;
+    return all;
+}
+
+Ticker::Ticker() { tickers().push_back(this); }
+Ticker::~Ticker() { tickers().erase(std::find(tickers().begin(), tickers().end(), this)); }
+
+void Ticker::arm(uint32_t ms, callback_function_t callback, bool repeat) {
+    _callback = callback;
+    _periodMs = ms;
+    _dueMs = millis() + ms;
+    _repeat = repeat;
+}
+
+void Ticker::runIfDue(uint32_t nowMs) {
+    if (!_callback || (int32_t)(nowMs - _dueMs) < 0) {
+        return;
+    }
+    callback_function_t callback = _callback;
+    if (_repeat) {
+        _dueMs += _periodMs;
+    } else {
+        _callback = nullptr;
+    }
+    callback();
+}
+
+void runDueTickers() {
+    for (size_t i = 0; i < tickers().size(); i++) {
+        tickers()[i]->runIfDue(millis());
+    }
+}
+
+// --- RTC user memory: kept across a reset, but not across a power cycle ---
+static uint32_t rtcUserMemory[HOST_RTC_USER_WORDS];
+uint32_t* hostRtcUserMemory = rtcUserMemory;
+
+bool EspClass::rtcUserMemoryRead(uint32_t offset, uint32_t* data, size_t size) {
+    if (offset * 4 + size > HOST_RTC_USER_WORDS * 4) {
+        return false;
+    }
+    memcpy(data, hostRtcUserMemory + offset, size);
+    return true;
+}
+
+bool EspClass::rtcUserMemoryWrite(uint32_t offset, uint32_t* data, size_t size) {
+    if (offset * 4 + size > HOST_RTC_USER_WORDS * 4) {
+        return false;
+    }
+    memcpy(hostRtcUserMemory + offset, data, size);
+    return true;
+}
+
+// --- CRC-32 as in the core's crc32.cpp (polynomial 0x04C11DB7, MSB first, no final xor) ---
+uint32_t crc32(const void* data, size_t length, uint32_t crc) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    while (length--) {
+        uint8_t c = *bytes++;
+        for (uint32_t i = 0x80; i > 0; i >>= 1) {
+            bool bit = crc & 0x80000000;
+            if (c & i) {
+                bit = !bit;
+            }
+            crc <<= 1;
+            if (bit) {
+                crc ^= 0x04c11db7;
+            }
+        }
+    }
+    return crc;
+}
+
+// --- Flash: sparse map of 4 KB sectors, addressed as offsets from the start of flash ---
+#include <map>
+#include <array>
+
+long hostFlashOpsLeft = -1;
+static std::map<uint32_t, std::array<uint8_t, SPI_FLASH_SEC_SIZE>> flashSectors;
+
+static uint8_t* flashByte(uint32_t address) {
+    uint32_t sector = address / SPI_FLASH_SEC_SIZE;
+    auto found = flashSectors.find(sector);
+    if (found == flashSectors.end()) {
+        found = flashSectors.emplace(sector, std::array<uint8_t, SPI_FLASH_SEC_SIZE>()).first;
+        found->second.fill(0xFF);
+    }
+    return &found->second[address % SPI_FLASH_SEC_SIZE];
+}
+
+static void spendFlashOp() {
+    if (hostFlashOpsLeft == 0) {
+        throw HostPowerLoss();
+    }
+    if (hostFlashOpsLeft > 0) {
+        hostFlashOpsLeft--;
+    }
+}
+
+void hostFlashReset() {
+    flashSectors.clear();
+    hostFlashOpsLeft = -1;
+}
+
+bool EspClass::flashRead(uint32_t address, uint32_t* data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        ((uint8_t*)data)[i] = *flashByte(address + i);
+    }
+    return true;
+}
+
+bool EspClass::flashWrite(uint32_t address, uint32_t* data, size_t size) {
+    for (size_t i = 0; i < size; i += 4) {
+        spendFlashOp();
+        for (size_t k = 0; k < 4 && i + k < size; k++) {
+            *flashByte(address + i + k) &= ((uint8_t*)data)[i + k];
+        }
+    }
+    return true;
+}
+
+bool EspClass::flashEraseSector(uint32_t sector) {
+    for (uint32_t offset = 0; offset < SPI_FLASH_SEC_SIZE; offset += 256) {
+        spendFlashOp();
+        memset(flashByte(sector * SPI_FLASH_SEC_SIZE + offset), 0xFF, 256);
+    }
+    return true;
+}
+
+// --- In-memory SPIFFS ---
+namespace fs {
+
+size_t File::read(uint8_t* buffer, size_t length) {
+    size_t count = min(length, size() - _position);
+    memcpy(buffer, _data->data() + _position, count);
+    _position += count;
+    return count;
+}
+
+int File::read() {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+size_t File::write(const uint8_t* buffer, size_t length) {
+    if (!_data) {
+        return 0;
+    }
+    _data->insert(_data->end(), buffer, buffer + length);
+    _position = _data->size();
+    return length;
+}
+
+File FS::open(const String& path, const char* mode) {
+    FileData& data = _files[path.c_str()];
+    if (mode[0] == 'r') {
+        if (!data) {
+            _files.erase(path.c_str());
+            return File();
+        }
+        return File(data, false);
+    }
+    if (!data || mode[0] == 'w') {
+        data = std::make_shared<std::vector<uint8_t>>();
+    }
+    return File(data, true);
+}
+
+bool FS::rename(const String& from, const String& to) {
+    auto found = _files.find(from.c_str());
+    if (found == _files.end()) {
+        return false;
+    }
+    _files[to.c_str()] = found->second;
+    _files.erase(found);
+    return true;
+}
+
+} // namespace fs
@@ -0,0 +1,37 @@
+// host_runtime.h
+// Hooks the host harnesses use to drive and observe the simulated hardware
+// behind the shim headers in shim/.
+#ifndef HOST_RUNTIME_H
+#define HOST_RUNTIME_H
+
+#include <Arduino.h>
+
+// Simulated time: millis()/micros() return this, and nothing advances it but the harness
+extern uint64_t hostMicros;
+
+// timer1 state as last set by the firmware
+extern timercallback hostTimer1Callback;
+extern bool hostTimer1Enabled;
+extern uint32_t hostTimer1Ticks;
+
+// GPIO levels as last set by digitalWrite(), and the number of digitalWrite() calls
+const int HOST_PIN_COUNT = 17;
+extern uint8_t hostPinLevels[HOST_PIN_COUNT];
+extern uint32_t hostPinWrites;
+
+// RTC user memory (512 bytes), as 32-bit words. A harness may point this at memory that
+// outlives a simulated reset, e.g. shared with forked child processes.
+const int HOST_RTC_USER_WORDS = 128;
+extern uint32_t* hostRtcUserMemory;
+
+// Fires every armed Ticker that is due at the current hostMicros
+void runDueTickers();
+
+// Simulated flash, 0xFF when erased; writes can only clear bits, as on the chip.
+// hostFlashOpsLeft counts down one per 32-bit word written or 256 bytes erased; when it
+// reaches 0 the next operation throws HostPowerLoss. -1 disables the power cut.
+struct HostPowerLoss {};
+extern long hostFlashOpsLeft;
+void hostFlashReset();
+
+#endif // HOST_RUNTIME_H
@@ -0,0 +1,176 @@
+// render_audio.cpp
+// Host render of the audio engine: plays a built-in alarm clip through the real
+// timer1 interrupt handler and refill Ticker (audio_engine.cpp), captures every value
+// written to the sigma-delta register at 8 kHz, and saves it as an 8-bit WAV file.
+// Reports:
+// - whether the played samples match the decoded clip exactly
+// - the underrun count
+// - the largest step between consecutive output samples around the clip, including
+//   the idle level before and after it, where a speaker would click
+// - the same for a second play that audioEngineStop() cuts off halfway
+// It fails unless the clip plays in order, the output idles at mid-scale (128) on both
+// sides, and no step is larger than the clip's own largest step or the ramp step.
+//
+// The refill Ticker normally fires every AUDIO_REFILL_INTERVAL_MS. A larger interval
+// on the command line models a loop that holds the Ticker off; underruns appear once
+// it exceeds what one 512-sample half covers (64 ms).
+//
+// Build and run from the repository root:
+//   g++ -std=gnu++17 -O2 -Itools/host/shim -Itools/host -I. -o /tmp/render_audio
+//       tools/host/render_audio.cpp tools/host/host_runtime.cpp audio_engine.cpp clip_player.cpp
+//   /tmp/render_audio [level 1-3] [refill interval ms] [out.wav]
+#include "host_runtime.h"
+#include "audio_engine.h"
+#include "clip_player.h"
+#include <vector>
+
+Ticker audioTicker;
+
+void mixerStopAll() {} // clip_player.cpp stops the mixer before replacing a clip file
+
+static const uint32_t SAMPLE_US = 1000000 / AUDIO_SAMPLE_RATE;
+static const size_t IDLE_SAMPLES = 400; // Captured before and after the clip: 50 ms
+
+static ClipVoice voice;
+
+static size_t clipSource(uint8_t* dest, size_t maxSamples) {
+    return renderClip(voice, dest, maxSamples);
+}
+
+static void writeWav(const char* path, const std::vector<uint8_t>& samples) {
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        return;
+    }
+    uint32_t dataSize = samples.size(), riffSize = 36 + dataSize, fmtSize = 16;
+    uint32_t rate = AUDIO_SAMPLE_RATE, byteRate = AUDIO_SAMPLE_RATE;
+    uint16_t pcm = 1, channels = 1, blockAlign = 1, bits = 8;
+    fwrite("RIFF", 1, 4, file);
+    fwrite(&riffSize, 4, 1, file);
+    fwrite("WAVEfmt ", 1, 8, file);
+    fwrite(&fmtSize, 4, 1, file);
+    fwrite(&pcm, 2, 1, file);
+    fwrite(&channels, 2, 1, file);
+    fwrite(&rate, 4, 1, file);
+    fwrite(&byteRate, 4, 1, file);
+    fwrite(&blockAlign, 2, 1, file);
+    fwrite(&bits, 2, 1, file);
+    fwrite("data", 1, 4, file);
+    fwrite(&dataSize, 4, 1, file);
+    fwrite(samples.data(), 1, samples.size(), file);
+    fclose(file);
+}
+
+int main(int argc, char** argv) {
+    int level = argc > 1 ? atoi(argv[1]) : 1;
+    uint32_t refillMs = argc > 2 ? atoi(argv[2]) : AUDIO_REFILL_INTERVAL_MS;
+    const char* wavPath = argc > 3 ? argv[3] : "/tmp/render_audio.wav";
+
+    // Reference: the clip decoded straight through
+    std::vector<uint8_t> expected;
+    uint8_t chunk[AUDIO_BUFFER_SAMPLES];
+    startLevelClip(voice, level);
+    while (size_t count = renderClip(voice, chunk, sizeof(chunk))) {
+        expected.insert(expected.end(), chunk, chunk + count);
+    }
+
+    audioEngineBegin();
+    while (hostTimer1Enabled) { // Boot ramp up to mid-scale
+        hostMicros += SAMPLE_US;
+        hostTimer1Callback();
+    }
+    std::vector<uint8_t> output;
+    for (size_t i = 0; i < IDLE_SAMPLES; i++) {
+        output.push_back(GPSD & 0xFF);
+    }
+    size_t clipStart = output.size();
+    startLevelClip(voice, level);
+    audioEnginePlay(clipSource);
+    if (hostTimer1Ticks * 16 != 80000000 / AUDIO_SAMPLE_RATE) {
+        printf("timer1 reload %u ticks does not give %u Hz\n", hostTimer1Ticks, AUDIO_SAMPLE_RATE);
+        return 1;
+    }
+
+    // One timer1 interrupt per sample period; Tickers only get to run every refillMs
+    uint64_t nextTickerUs = hostMicros + refillMs * 1000ull;
+    size_t played = 0; // Interrupts that output a buffered sample or an underrun
+    size_t tail = 0;
+    while (tail < IDLE_SAMPLES && output.size() < expected.size() * 2 + 2 * IDLE_SAMPLES) {
+        hostMicros += SAMPLE_US;
+        if (hostTimer1Enabled) {
+            hostTimer1Callback();
+            played += hostTimer1Enabled; // The interrupt that finds the end stops the timer
+        } else {
+            tail++;
+        }
+        output.push_back(GPSD & 0xFF);
+        if (hostMicros >= nextTickerUs) {
+            runDueTickers();
+            nextTickerUs += refillMs * 1000ull;
+        }
+    }
+    writeWav(wavPath, output);
+
+    // The ramp from mid-scale to the first sample, and underrun samples, are inserted
+    // between clip samples, not substituted: skip over them
+    bool inOrder = true;
+    size_t skipped = 0;
+    size_t skippable = audioEngineUnderruns() + abs(expected[0] - 128) / AUDIO_RAMP_STEP + 1;
+    size_t position = clipStart;
+    for (uint8_t sample : expected) {
+        while (position < output.size() && output[position] != sample && skipped < skippable) {
+            position++;
+            skipped++;
+        }
+        if (position >= output.size() || output[position] != sample) {
+            inOrder = false;
+            break;
+        }
+        position++;
+    }
+    int largestStep = 0;
+    for (size_t i = 1; i < output.size(); i++) {
+        largestStep = max(largestStep, abs((int)output[i] - (int)output[i - 1]));
+    }
+    int clipStep = 0;
+    for (size_t i = 1; i < expected.size(); i++) {
+        clipStep = max(clipStep, abs((int)expected[i] - (int)expected[i - 1]));
+    }
+
+    printf("level %d clip: %zu samples (%.3f s), rendered %zu at a %u ms refill interval\n", level,
+           expected.size(), expected.size() / (double)AUDIO_SAMPLE_RATE, played, refillMs);
+    printf("clip samples played in order: %s, underruns: %u\n",
+           inOrder ? "yes" : "NO", audioEngineUnderruns());
+    printf("idle level before %u, after %u; largest step %d (within the clip itself: %d)\n",
+           output.front(), output.back(), largestStep, clipStep);
+    printf("wrote %s\n", wavPath);
+
+    // Cut off halfway: the output must ramp back to mid-scale, not jump
+    startLevelClip(voice, level);
+    audioEnginePlay(clipSource);
+    std::vector<uint8_t> stopped;
+    nextTickerUs = hostMicros + refillMs * 1000ull;
+    while (hostTimer1Enabled) {
+        hostMicros += SAMPLE_US;
+        hostTimer1Callback();
+        stopped.push_back(GPSD & 0xFF);
+        if (stopped.size() == expected.size() / 2) {
+            audioEngineStop();
+        }
+        if (hostMicros >= nextTickerUs) {
+            runDueTickers();
+            nextTickerUs += refillMs * 1000ull;
+        }
+    }
+    int stopStep = 0;
+    for (size_t i = 1; i < stopped.size(); i++) {
+        stopStep = max(stopStep, abs((int)stopped[i] - (int)stopped[i - 1]));
+    }
+    printf("stopped halfway: ended at %u after %zu samples; largest step %d\n",
+           stopped.back(), stopped.size(), stopStep);
+
+    int allowedStep = max<int>(clipStep, AUDIO_RAMP_STEP);
+    bool smooth = output.front() == 128 && output.back() == 128 && largestStep <= allowedStep &&
+                  stopped.back() == 128 && stopped.size() < expected.size() && stopStep <= allowedStep;
+    return inOrder && smooth ? 0 : 1;
+}
@@ -0,0 +1,153 @@
+// render_tone.cpp
+// Host render of the synthesized alarm beep patterns: renders each level's default
+// pattern (as in settings_manager.cpp) with the firmware's renderTone() in mix-chunk
+// sized runs, as the mixer does, and checks it sample by sample:
+// - the length is exactly beeps x (beep + gap)
+// - every gap is silent (mid-scale, 128)
+// - every beep starts and ends at mid-scale, and no step between two samples is larger
+//   than the oscillator's own largest step at full amplitude, so edges do not click
+// - the pitch, counted from zero crossings over the first and last 20 ms of each beep,
+//   is within 3% of what the sweep from startHz to endHz reaches mid-window (20 ms
+//   holds only tens of cycles, so the count is coarse)
+// It also reports renderTone()'s cost in cycles per sample (host TSC cycles; the device
+// figure is audio_mix_cycles_per_sample_max on /metrics). A level number on the command
+// line saves that level's pattern as an 8-bit WAV file for listening.
+//
+// Build and run from the repository root:
+//   g++ -std=gnu++17 -O2 -Itools/host/shim -Itools/host -I. -o /tmp/render_tone
+//       tools/host/render_tone.cpp tools/host/host_runtime.cpp tone_synth.cpp
+//   /tmp/render_tone [level 1-3 out.wav]
+#include "host_runtime.h"
+#include "tone_synth.h"
+#include <vector>
+
+static const AlarmSound DEFAULT_SOUNDS[3] = { // settings_manager.cpp defaults, levels 1-3
+    { ALARM_SOUND_TONE, 2000, 2600, 150, 80, 10, 100 },
+    { ALARM_SOUND_TONE, 1200, 1200, 300, 300, 4, 80 },
+    { ALARM_SOUND_TONE, 800, 800, 500, 700, 2, 60 }
+};
+
+static const size_t CHUNK_SAMPLES = 128;                     // As the mixer renders
+static const uint32_t PITCH_WINDOW = AUDIO_SAMPLE_RATE / 50; // 20 ms
+
+static void writeWav(const char* path, const std::vector<uint8_t>& samples) {
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        printf("cannot write %s\n", path);
+        return;
+    }
+    uint32_t dataSize = samples.size(), riffSize = 36 + dataSize, fmtSize = 16, rate = AUDIO_SAMPLE_RATE;
+    uint16_t format = 1, channels = 1, blockAlign = 1, bits = 8;
+    fwrite("RIFF", 1, 4, file); fwrite(&riffSize, 4, 1, file); fwrite("WAVEfmt ", 1, 8, file);
+    fwrite(&fmtSize, 4, 1, file); fwrite(&format, 2, 1, file); fwrite(&channels, 2, 1, file);
+    fwrite(&rate, 4, 1, file); fwrite(&rate, 4, 1, file); fwrite(&blockAlign, 2, 1, file);
+    fwrite(&bits, 2, 1, file); fwrite("data", 1, 4, file); fwrite(&dataSize, 4, 1, file);
+    fwrite(samples.data(), 1, samples.size(), file);
+    fclose(file);
+}
+
+// Frequency from upward zero crossings (through mid-scale) in samples [from, from + count)
+static double measureHz(const std::vector<uint8_t>& samples, size_t from, size_t count) {
+    size_t first = 0, last = 0, crossings = 0;
+    for (size_t i = from + 1; i < from + count; i++) {
+        if (samples[i - 1] < 128 && samples[i] >= 128) {
+            if (crossings++ == 0) {
+                first = i;
+            }
+            last = i;
+        }
+    }
+    return crossings > 1 ? (crossings - 1) * (double)AUDIO_SAMPLE_RATE / (last - first) : 0;
+}
+
+static bool within(double measured, double expected) {
+    return fabs(measured - expected) <= expected * 0.03;
+}
+
+static bool checkLevel(int level, std::vector<uint8_t>& samples) {
+    const AlarmSound& sound = DEFAULT_SOUNDS[level - 1];
+    ToneVoice voice;
+    startTone(voice, sound);
+
+    uint8_t chunk[CHUNK_SAMPLES];
+    uint64_t cycles = 0;
+    samples.clear();
+    while (true) {
+        uint32_t start = ESP.getCycleCount();
+        size_t count = renderTone(voice, chunk, CHUNK_SAMPLES);
+        cycles += ESP.getCycleCount() - start;
+        samples.insert(samples.end(), chunk, chunk + count);
+        if (count < CHUNK_SAMPLES) {
+            break;
+        }
+    }
+
+    size_t beep = (size_t)sound.beepMs * AUDIO_SAMPLE_RATE / 1000;
+    size_t period = beep + (size_t)sound.gapMs * AUDIO_SAMPLE_RATE / 1000;
+    bool ok = samples.size() == period * sound.beeps;
+    if (!ok) {
+        printf("level %d: %zu samples, expected %zu\n", level, samples.size(), period * sound.beeps);
+        return false;
+    }
+
+    // Largest step between two samples of a full-scale sine at the higher of the two
+    // frequencies: 2 x 127 x sin(pi f / rate), plus one for rounding
+    double maxHz = max(sound.startHz, sound.endHz);
+    int allowedStep = (int)ceil(2 * 127 * sin(M_PI * maxHz / AUDIO_SAMPLE_RATE)) + 1;
+    int largestStep = 0;
+    for (size_t i = 1; i < samples.size(); i++) {
+        largestStep = max(largestStep, abs(samples[i] - samples[i - 1]));
+    }
+
+    double startHz = 0, endHz = 0;
+    for (int n = 0; n < sound.beeps; n++) {
+        size_t begin = n * period;
+        if (samples[begin] != 128 || samples[begin + beep - 1] != 128) {
+            printf("level %d: beep %d does not start and end at mid-scale\n", level, n + 1);
+            ok = false;
+        }
+        for (size_t i = begin + beep; i < begin + period; i++) {
+            if (samples[i] != 128) {
+                printf("level %d: gap after beep %d is not silent\n", level, n + 1);
+                ok = false;
+                break;
+            }
+        }
+        startHz += measureHz(samples, begin, PITCH_WINDOW) / sound.beeps;
+        endHz += measureHz(samples, begin + beep - PITCH_WINDOW, PITCH_WINDOW) / sound.beeps;
+    }
+    // The windows are centered 10 ms into the sweep, so expect the pitch there
+    double sweepPerSample = (sound.endHz - sound.startHz) / (double)beep;
+    double expectStart = sound.startHz + sweepPerSample * PITCH_WINDOW / 2;
+    double expectEnd = sound.endHz - sweepPerSample * PITCH_WINDOW / 2;
+    if (!within(startHz, expectStart) || !within(endHz, expectEnd)) {
+        ok = false;
+    }
+    if (largestStep > allowedStep) {
+        ok = false;
+    }
+
+    printf("level %d: %u x %u/%u ms, %.3f s; pitch %.0f -> %.0f Hz (expected %.0f -> %.0f); "
+           "largest step %d (sine limit %d); %.1f cycles/sample; %s\n",
+           level, sound.beeps, sound.beepMs, sound.gapMs, samples.size() / (double)AUDIO_SAMPLE_RATE,
+           startHz, endHz, expectStart, expectEnd, largestStep, allowedStep,
+           (double)cycles / samples.size(), ok ? "ok" : "FAILED");
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    int failures = 0;
+    std::vector<uint8_t> samples;
+    for (int level = 1; level <= 3; level++) {
+        if (!checkLevel(level, samples)) {
+            failures++;
+        }
+    }
+    if (argc > 2) {
+        int level = constrain(atoi(argv[1]), 1, 3);
+        checkLevel(level, samples);
+        writeWav(argv[2], samples);
+        printf("level %d written to %s\n", level, argv[2]);
+    }
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,329 @@
+// replay_deltas.cpp
+// Host replay of OpenSky traffic through the firmware's live data path: each recorded
+// /states/all response is classified against a monitored site (classifyPosition() and
+// the alarm debounce, as flight_scanner.cpp does), stamped with stampFlightChanges(),
+// and encoded by response_cache.cpp. Reports, per update and in total, the bytes of the
+// full /getLiveData snapshot (JSON and CBOR) against the JSON delta a client that
+// applied the previous update receives (?since=N).
+//
+// Input is a capture with one /states/all response per line, as written by
+// tools/record_opensky.py. Without one, a synthetic busy-airport capture is replayed
+// instead: 25 aircraft on the ground (mostly parked, some taxiing) and 35 airborne
+// ones crossing the Level 3 box, for 180 scans 10 s apart. The JSON sizes come from
+// the ArduinoJson stand-in in tools/host/shim, which prints numbers as ArduinoJson 6
+// does on the device.
+//
+// Build and run from the repository root:
+//   g++ -std=gnu++17 -O2 -Itools/host/shim -Itools/host -I. -o /tmp/replay_deltas
+//       tools/host/replay_deltas.cpp tools/host/host_runtime.cpp response_cache.cpp flight_delta.cpp
+//       cbor_writer.cpp utils.cpp scan_geometry.cpp geofence.cpp alarm_debounce.cpp
+//   /tmp/replay_deltas [capture.jsonl] [site latitude] [site longitude] [-v]
+#include "host_runtime.h"
+#include "response_cache.h"
+#include "flight_delta.h"
+#include "scan_geometry.h"
+#include "alarm_debounce.h"
+#include <fstream>
+#include <random>
+#include <string>
+
+AppSettings currentSettings;
+std::vector<FlightData> currentFlights;
+std::vector<ScanHistoryEntry> scanHistory;
+int currentOverallAlarmLevel = 0;
+uint32_t scanSequence = 0;
+
+const uint32_t SCAN_MS = 10000;
+
+// One JSON value of a state row; nested arrays (the sensor list) are skipped
+struct RowValue {
+    bool null;
+    std::string text; // Strings, and the text of numbers and booleans
+};
+
+static void skipSpace(const std::string& s, size_t& i) {
+    while (i < s.size() && isspace((unsigned char)s[i])) {
+        i++;
+    }
+}
+
+static bool parseValue(const std::string& s, size_t& i, RowValue& value) {
+    skipSpace(s, i);
+    value.null = false;
+    value.text.clear();
+    if (i >= s.size()) {
+        return false;
+    }
+    if (s[i] == '"') {
+        for (i++; i < s.size() && s[i] != '"'; i++) {
+            if (s[i] == '\\' && i + 1 < s.size()) {
+                i++;
+            }
+            value.text += s[i];
+        }
+        i++;
+        return true;
+    }
+    if (s[i] == '[') { // Nested array: skipped, reported as null
+        int depth = 0;
+        do {
+            depth += s[i] == '[' ? 1 : s[i] == ']' ? -1 : 0;
+            i++;
+        } while (i < s.size() && depth > 0);
+        value.null = true;
+        return true;
+    }
+    size_t start = i;
+    while (i < s.size() && s[i] != ',' && s[i] != ']' && !isspace((unsigned char)s[i])) {
+        i++;
+    }
+    value.text = s.substr(start, i - start);
+    value.null = value.text == "null";
+    return i > start;
+}
+
+// Splits one /states/all response into its rows
+static bool parseCapture(const std::string& line, std::vector<std::vector<RowValue>>& rows) {
+    rows.clear();
+    size_t i = line.find("\"states\":");
+    if (i == std::string::npos) {
+        return false;
+    }
+    i += 9;
+    skipSpace(line, i);
+    if (line.compare(i, 4, "null") == 0) {
+        return true;
+    }
+    if (line[i++] != '[') {
+        return false;
+    }
+    for (;;) {
+        skipSpace(line, i);
+        if (line[i] == ']') {
+            return true;
+        }
+        if (line[i] == ',') {
+            i++;
+            skipSpace(line, i);
+        }
+        if (line[i++] != '[') {
+            return false;
+        }
+        rows.emplace_back();
+        for (;;) {
+            RowValue value;
+            if (!parseValue(line, i, value)) {
+                return false;
+            }
+            rows.back().push_back(value);
+            skipSpace(line, i);
+            if (line[i] == ']') {
+                i++;
+                break;
+            }
+            i++; // ','
+        }
+    }
+}
+
+static float number(const RowValue& value) {
+    return value.null ? 0 : atof(value.text.c_str());
+}
+
+// classifyStateRow() in flight_scanner.cpp, for a row from the capture
+static void classifyRow(const std::vector<RowValue>& row, const ScanGeometry& geometry, uint32_t nowMs,
+                        std::vector<FlightData>& flights) {
+    if (row.size() < 14 || row[5].null || row[6].null) {
+        return;
+    }
+    FlightData flight;
+    flight.latitude = number(row[6]);
+    flight.longitude = number(row[5]);
+    float altitude = 0;
+    if (row[8].text != "true") {
+        altitude = !row[13].null ? number(row[13]) : number(row[7]);
+    }
+    SiteMatch match;
+    int entryLevel = classifyPosition(geometry, flight.latitude, flight.longitude, altitude, match);
+    flight.proximity_level = debounceProximityLevel(row[0].text.c_str(), entryLevel, match, nowMs, geometry.alarmDwellMs);
+    if (flight.proximity_level == 0) {
+        return;
+    }
+    if (match.holdLevel == 0) {
+        match.distanceKm = siteDistanceKm(geometry, match.site, flight.latitude, flight.longitude);
+    }
+    flight.distance_km = match.distanceKm;
+    flight.site = geometry.sites[match.site].name;
+    flight.alarm_policy = geometry.sites[match.site].alarmPolicy;
+    flight.icao24 = row[0].text.c_str();
+    flight.callsign = row[1].text.c_str();
+    flight.callsign.trim();
+    flight.origin_country = row[2].text.c_str();
+    flight.altitude_baro = number(row[7]);
+    flight.velocity = number(row[9]);
+    flight.true_track = number(row[10]);
+    flights.push_back(flight);
+}
+
+// Synthetic capture around (lat, lon): see the header comment
+static void synthesizeCapture(float lat, float lon, std::vector<std::string>& lines) {
+    struct Aircraft {
+        char icao24[7];
+        char callsign[9];
+        double lat, lon, altitude, speed, track;
+        bool ground;
+    };
+    std::mt19937 rng(28);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    const double kmPerDegLat = 111.19, kmPerDegLon = 111.19 * cos(lat * PI / 180.0);
+    std::vector<Aircraft> aircraft;
+    auto spawn = [&](Aircraft& a, bool ground, bool atEdge) {
+        snprintf(a.icao24, sizeof(a.icao24), "%06x", (unsigned)(rng() & 0xFFFFFF));
+        snprintf(a.callsign, sizeof(a.callsign), "%s%-4u", ground ? "GND" : "AIC", (unsigned)(rng() % 9000 + 100));
+        a.ground = ground;
+        double bearing = unit(rng) * 2 * PI;
+        double km = ground ? unit(rng) * 3 : atEdge ? 28 : unit(rng) * 28;
+        a.lat = lat + km * cos(bearing) / kmPerDegLat;
+        a.lon = lon + km * sin(bearing) / kmPerDegLon;
+        a.altitude = ground ? 0 : 300 + unit(rng) * 10000;
+        a.speed = ground ? 0 : 80 + unit(rng) * 170;
+        // Airborne traffic heads roughly through the box
+        a.track = fmod((bearing * 180 / PI) + 180 + (unit(rng) - 0.5) * 90 + 360, 360);
+    };
+    for (int i = 0; i < 60; i++) {
+        aircraft.emplace_back();
+        spawn(aircraft.back(), i < 25, false);
+    }
+    for (int scan = 0; scan < 180; scan++) {
+        uint32_t time = 1700000000 + scan * SCAN_MS / 1000;
+        std::string line = "{\"time\":" + std::to_string(time) + ",\"states\":[";
+        for (size_t i = 0; i < aircraft.size(); i++) {
+            Aircraft& a = aircraft[i];
+            if (a.ground) {
+                bool taxiing = unit(rng) < 0.1;
+                a.speed = taxiing ? 5 + unit(rng) * 10 : 0;
+                if (taxiing) {
+                    a.track = unit(rng) * 360;
+                }
+            }
+            double km = a.speed * SCAN_MS / 1000 / 1000;
+            a.lat += km * cos(a.track * PI / 180) / kmPerDegLat;
+            a.lon += km * sin(a.track * PI / 180) / kmPerDegLon;
+            double dy = (a.lat - lat) * kmPerDegLat, dx = (a.lon - lon) * kmPerDegLon;
+            if (!a.ground && dx * dx + dy * dy > 30.0 * 30.0) {
+                spawn(a, false, true);
+            }
+            char row[256];
+            snprintf(row, sizeof(row),
+                     "%s[\"%s\",\"%-8s\",\"United Kingdom\",%u,%u,%.4f,%.4f,%s,%s,%.2f,%.2f,0,null,%s,\"7000\",false,0]",
+                     i ? "," : "", a.icao24, a.callsign, time, time, a.lon, a.lat,
+                     a.ground ? "null" : std::to_string((int)a.altitude).c_str(), a.ground ? "true" : "false",
+                     a.speed, a.track, a.ground ? "null" : std::to_string((int)a.altitude + 30).c_str());
+            line += row;
+        }
+        line += "]}";
+        lines.push_back(line);
+    }
+}
+
+int main(int argc, char** argv) {
+    bool verbose = argc > 1 && strcmp(argv[argc - 1], "-v") == 0;
+    if (verbose) {
+        argc--;
+    }
+    const char* capturePath = argc > 1 ? argv[1] : nullptr;
+    currentSettings.apiServer = "https://opensky-network.org/api/states/all";
+    currentSettings.latitude = argc > 2 ? atof(argv[2]) : 51.4700f;
+    currentSettings.longitude = argc > 3 ? atof(argv[3]) : -0.4543f;
+    currentSettings.radiusLevel1 = 5;
+    currentSettings.radiusLevel2 = 10;
+    currentSettings.radiusLevel3 = 20;
+    currentSettings.noFlightScanFreq = 60;
+    currentSettings.flightPresentScanFreq = 10;
+    currentSettings.alarmHysteresisPercent = 10;
+    currentSettings.alarmDwellSec = 30;
+    rebuildScanGeometry(currentSettings);
+
+    std::vector<std::string> lines;
+    if (capturePath) {
+        std::ifstream capture(capturePath);
+        for (std::string line; std::getline(capture, line);) {
+            if (!line.empty()) {
+                lines.push_back(line);
+            }
+        }
+        if (lines.empty()) {
+            printf("no responses in %s\n", capturePath);
+            return 1;
+        }
+    } else {
+        synthesizeCapture(currentSettings.latitude, currentSettings.longitude, lines);
+    }
+
+    if (verbose) {
+        printf("update  aircraft  upserts  removed  full JSON  full CBOR  delta JSON\n");
+    }
+    uint64_t fullJsonTotal = 0, fullCborTotal = 0, deltaTotal = 0, aircraftTotal = 0;
+    size_t updates = 0, deltas = 0, fullJsonFirst = 0;
+    std::vector<std::vector<RowValue>> rows;
+    for (size_t n = 0; n < lines.size(); n++) {
+        if (!parseCapture(lines[n], rows)) {
+            printf("response %zu: no \"states\" array\n", n + 1);
+            return 1;
+        }
+        uint32_t nowMs = 1000 + n * SCAN_MS;
+        std::vector<FlightData> flights;
+        for (const auto& row : rows) {
+            classifyRow(row, activeScanGeometry(), nowMs, flights);
+        }
+        pruneAlarmStates(nowMs);
+
+        uint32_t since = scanSequence;
+        scanSequence++;
+        stampFlightChanges(currentFlights, flights, scanSequence);
+        currentFlights = flights;
+        rebuildResponseCaches();
+        size_t fullJson = getLiveDataResponse()->body.length();
+        size_t fullCbor = getLiveDataCborResponse()->binaryBody.size();
+
+        size_t upserts = 0;
+        for (const FlightData& flight : currentFlights) {
+            upserts += flight.updated_seq > since;
+        }
+        std::vector<String> removed;
+        collectRemovedSince(since, removed);
+        String delta;
+        bool haveDelta = buildLiveDataDeltaJson(since, delta);
+        if (verbose) {
+            printf("%6zu  %8zu  %7zu  %7zu  %9zu  %9zu  %10s\n", n + 1, currentFlights.size(), upserts, removed.size(),
+                   fullJson, fullCbor, haveDelta ? std::to_string(delta.length()).c_str() : "-");
+        }
+        if (n == 0) {
+            fullJsonFirst = fullJson;
+            continue; // The first update is a full snapshot for every client
+        }
+        updates++;
+        aircraftTotal += currentFlights.size();
+        fullJsonTotal += fullJson;
+        fullCborTotal += fullCbor;
+        if (haveDelta) {
+            deltas++;
+            deltaTotal += delta.length();
+        } else {
+            deltaTotal += fullJson; // The client falls back to a full snapshot
+        }
+    }
+    if (updates == 0) {
+        printf("need at least two responses\n");
+        return 1;
+    }
+
+    printf("%s: %zu responses, %.1f aircraft listed per update (first snapshot %zu bytes)\n",
+           capturePath ? capturePath : "synthetic busy-airport traffic", lines.size(),
+           (double)aircraftTotal / updates, fullJsonFirst);
+    printf("bytes per update: full JSON %.0f, full CBOR %.0f, delta JSON %.0f (%.0f%% of full JSON); "
+           "%zu of %zu updates served as deltas\n",
+           (double)fullJsonTotal / updates, (double)fullCborTotal / updates, (double)deltaTotal / updates,
+           100.0 * deltaTotal / fullJsonTotal, deltas, updates);
+    return deltas == updates ? 0 : 1;
+}
@@ -0,0 +1,189 @@
+// Arduino.h (host shim)
+// Just enough of the ESP8266 Arduino core to compile the firmware's self-contained
+// modules (scan geometry, geofences, settings store, audio, WiFi) on a PC. Everything
+// the harnesses observe (timer1, the sigma-delta register, flash, RTC memory, Ticker,
+// the WiFi station) is backed by host_runtime.cpp and exposed through host_runtime.h.
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+
+using std::min;
+using std::max;
+
+typedef uint8_t byte;
+
+template <class T, class L, class H>
+T constrain(T value, L low, H high) { return value < low ? low : (value > high ? high : value); }
+
+#define PI 3.1415926535897932384626433832795
+#define PROGMEM
+#define IRAM_ATTR
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper*>(s))
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#define memcpy_P memcpy
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define D3 0
+#define D4 2
+
+#define SPI_FLASH_SEC_SIZE 4096
+
+class String {
+public:
+    String(const char* s = "") : _s(s ? s : "") {}
+    String(const __FlashStringHelper* s) : String(reinterpret_cast<const char*>(s)) {}
+    String(const std::string& s) : _s(s) {}
+    String(char c) : _s(1, c) {}
+    String(int v) : _s(std::to_string(v)) {}
+    String(unsigned v) : _s(std::to_string(v)) {}
+    String(long v) : _s(std::to_string(v)) {}
+    String(unsigned long v) : _s(std::to_string(v)) {}
+    String(float v, unsigned char decimals = 2) : String((double)v, decimals) {}
+    String(double v, unsigned char decimals = 2) {
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "%.*f", decimals, v);
+        _s = buffer;
+    }
+
+    const char* c_str() const { return _s.c_str(); }
+    unsigned length() const { return _s.size(); }
+    bool isEmpty() const { return _s.empty(); }
+    bool reserve(unsigned size) { _s.reserve(size); return true; }
+    char operator[](unsigned i) const { return _s[i]; }
+    bool concat(const char* s, unsigned n) { _s.append(s, n); return true; }
+    String& operator+=(const String& s) { _s += s._s; return *this; }
+    String& operator+=(const char* s) { _s += s; return *this; }
+    String& operator+=(char c) { _s += c; return *this; }
+    friend String operator+(const String& a, const String& b) { return String(a._s + b._s); }
+    friend String operator+(const String& a, const char* b) { return String(a._s + b); }
+    friend String operator+(const char* a, const String& b) { return String(a + b._s); }
+    bool operator==(const String& s) const { return _s == s._s; }
+    bool operator!=(const String& s) const { return _s != s._s; }
+    bool equalsIgnoreCase(const String& s) const {
+        return _s.size() == s._s.size() && strncasecmp(_s.c_str(), s._s.c_str(), _s.size()) == 0;
+    }
+    bool startsWith(const String& s) const { return _s.compare(0, s._s.size(), s._s) == 0; }
+    bool endsWith(const String& s) const {
+        return _s.size() >= s._s.size() && _s.compare(_s.size() - s._s.size(), s._s.size(), s._s) == 0;
+    }
+    String substring(unsigned from, unsigned to = ~0u) const {
+        return from >= _s.size() ? String() : String(_s.substr(from, to == ~0u ? std::string::npos : to - from));
+    }
+    long toInt() const { return atol(_s.c_str()); }
+    int indexOf(const String& s) const {
+        size_t at = _s.find(s._s);
+        return at == std::string::npos ? -1 : (int)at;
+    }
+    void trim() {
+        size_t first = _s.find_first_not_of(" \t\r\n");
+        size_t last = _s.find_last_not_of(" \t\r\n");
+        _s = first == std::string::npos ? std::string() : _s.substr(first, last - first + 1);
+    }
+
+private:
+    std::string _s;
+};
+
+class IPAddress {
+public:
+    IPAddress(uint32_t address = 0) : _address(address) {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _address(a | b << 8 | c << 16 | (uint32_t)d << 24) {}
+    operator uint32_t() const { return _address; }
+    String toString() const {
+        char text[16];
+        snprintf(text, sizeof(text), "%u.%u.%u.%u", _address & 0xFF, (_address >> 8) & 0xFF,
+                 (_address >> 16) & 0xFF, _address >> 24);
+        return text;
+    }
+
+private:
+    uint32_t _address; // First octet in the low byte, as on the device
+};
+
+// Serial output goes to stderr, so a harness's own report on stdout stays clean
+class Print {
+public:
+    size_t print(const String& s) { return fputs(s.c_str(), stderr), s.length(); }
+    size_t print(const char* s) { return print(String(s)); }
+    size_t print(const __FlashStringHelper* s) { return print(String(s)); }
+    size_t print(int v) { return print(String(v)); }
+    size_t print(unsigned v) { return print(String(v)); }
+    size_t print(long v) { return print(String(v)); }
+    size_t print(unsigned long v) { return print(String(v)); }
+    size_t print(double v, int decimals = 2) { return print(String(v, decimals)); }
+    size_t print(const IPAddress& v) { return print(v.toString()); }
+    template <class T> size_t println(const T& v) { return print(v) + print("\n"); }
+    size_t println(double v, int decimals) { return print(v, decimals) + print("\n"); }
+    size_t println() { return print("\n"); }
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class HardwareSerial : public Print {
+public:
+    void begin(unsigned long) {}
+};
+extern HardwareSerial Serial;
+
+class EspClass {
+public:
+    uint32_t getCycleCount();
+    uint32_t getFreeHeap() { return 40000; }
+    bool flashRead(uint32_t address, uint32_t* data, size_t size);
+    bool flashWrite(uint32_t address, uint32_t* data, size_t size);
+    bool flashEraseSector(uint32_t sector);
+    bool rtcUserMemoryRead(uint32_t offset, uint32_t* data, size_t size);
+    bool rtcUserMemoryWrite(uint32_t offset, uint32_t* data, size_t size);
+};
+extern EspClass ESP;
+
+inline size_t strlcpy(char* dest, const char* src, size_t size) {
+    size_t length = strlen(src);
+    if (size > 0) {
+        size_t count = min(length, size - 1);
+        memcpy(dest, src, count);
+        dest[count] = '\0';
+    }
+    return length;
+}
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+
+// timer1 and the sigma-delta generator register (esp8266_peri.h on the device)
+typedef void (*timercallback)(void);
+#define TIM_DIV1 0
+#define TIM_DIV16 1
+#define TIM_DIV256 3
+#define TIM_EDGE 0
+#define TIM_LEVEL 1
+#define TIM_SINGLE 0
+#define TIM_LOOP 1
+void timer1_attachInterrupt(timercallback callback);
+void timer1_detachInterrupt();
+void timer1_enable(uint8_t divider, uint8_t interruptType, uint8_t reload);
+void timer1_write(uint32_t ticks);
+void timer1_disable();
+extern volatile uint32_t GPSD;
+#define GPSDT 0
+
+#define noInterrupts()
+#define interrupts()
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,261 @@
+// Host stand-in for the part of ArduinoJson 6 that the response builders use:
+// building a document (objects, arrays, scalars) and serializeJson(). Parsing is
+// not provided. Members keep their insertion order, and numbers are printed the
+// way ArduinoJson 6 prints them on the ESP8266 (floats widened to double, at most
+// 9 decimal places less one per integral digit, trailing zeros dropped), so body
+// sizes match the device's. JSON_*_SIZE() are only used to size documents here.
+#ifndef HOST_ARDUINOJSON_H
+#define HOST_ARDUINOJSON_H
+
+#include "Arduino.h"
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#define JSON_ARRAY_SIZE(n) ((n) * 16)
+#define JSON_OBJECT_SIZE(n) ((n) * 16)
+
+struct HostJsonNode {
+    enum Type { NUL, BOOLEAN, SIGNED, UNSIGNED, FLOAT, TEXT, ARRAY, OBJECT } type = NUL;
+    bool boolean = false;
+    long long integer = 0;
+    unsigned long long uinteger = 0;
+    double real = 0;
+    std::string text;
+    std::vector<std::unique_ptr<HostJsonNode>> items;
+    std::vector<std::pair<std::string, std::unique_ptr<HostJsonNode>>> members;
+
+    HostJsonNode* asObject() {
+        if (type != OBJECT) {
+            clearTo(OBJECT);
+        }
+        return this;
+    }
+
+    HostJsonNode* asArray() {
+        if (type != ARRAY) {
+            clearTo(ARRAY);
+        }
+        return this;
+    }
+
+    HostJsonNode* member(const char* key) {
+        asObject();
+        for (auto& m : members) {
+            if (m.first == key) {
+                return m.second.get();
+            }
+        }
+        members.emplace_back(key, std::unique_ptr<HostJsonNode>(new HostJsonNode()));
+        return members.back().second.get();
+    }
+
+    HostJsonNode* append() {
+        asArray();
+        items.emplace_back(new HostJsonNode());
+        return items.back().get();
+    }
+
+    HostJsonNode& operator=(HostJsonNode&& other) = default;
+
+    void set(const char* value) { clearTo(TEXT); text = value ? value : ""; }
+    void set(const String& value) { clearTo(TEXT); text = value.c_str(); }
+    void set(bool value) { clearTo(BOOLEAN); boolean = value; }
+    void set(float value) { clearTo(FLOAT); real = value; }
+    void set(double value) { clearTo(FLOAT); real = value; }
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type set(T value) {
+        clearTo(SIGNED);
+        integer = value;
+    }
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value>::type set(T value) {
+        clearTo(UNSIGNED);
+        uinteger = value;
+    }
+
+private:
+    void clearTo(Type t) {
+        *this = HostJsonNode();
+        type = t;
+    }
+};
+
+class JsonArray;
+
+class JsonVariant {
+public:
+    explicit JsonVariant(HostJsonNode* node) : _node(node) {}
+    template <typename T>
+    JsonVariant& operator=(const T& value) {
+        _node->set(value);
+        return *this;
+    }
+    JsonVariant& operator=(const char* value) {
+        _node->set(value);
+        return *this;
+    }
+
+protected:
+    HostJsonNode* _node;
+};
+
+class JsonObject {
+public:
+    explicit JsonObject(HostJsonNode* node) : _node(node->asObject()) {}
+    JsonVariant operator[](const char* key) { return JsonVariant(_node->member(key)); }
+    inline JsonArray createNestedArray(const char* key);
+    JsonObject createNestedObject(const char* key) { return JsonObject(_node->member(key)); }
+
+private:
+    HostJsonNode* _node;
+};
+
+class JsonArray {
+public:
+    explicit JsonArray(HostJsonNode* node) : _node(node->asArray()) {}
+    JsonObject createNestedObject() { return JsonObject(_node->append()); }
+    template <typename T>
+    bool add(const T& value) {
+        _node->append()->set(value);
+        return true;
+    }
+    bool add(const char* value) {
+        _node->append()->set(value);
+        return true;
+    }
+
+private:
+    HostJsonNode* _node;
+};
+
+inline JsonArray JsonObject::createNestedArray(const char* key) {
+    return JsonArray(_node->member(key));
+}
+
+class JsonDocument {
+public:
+    JsonVariant operator[](const char* key) { return JsonVariant(_root.member(key)); }
+    JsonArray createNestedArray(const char* key) { return JsonArray(_root.member(key)); }
+    template <typename T>
+    T to() {
+        _root = HostJsonNode();
+        return T(&_root);
+    }
+    const HostJsonNode& root() const { return _root; }
+
+private:
+    HostJsonNode _root;
+};
+
+class DynamicJsonDocument : public JsonDocument {
+public:
+    explicit DynamicJsonDocument(size_t) {}
+};
+
+// ArduinoJson 6 FloatParts / TextFormatter::writeFloat for a double
+inline void hostJsonWriteFloat(std::string& out, double value) {
+    if (std::isnan(value) || std::isinf(value)) {
+        out += "null";
+        return;
+    }
+    if (value < 0) {
+        out += '-';
+        value = -value;
+    }
+    int exponent = 0;
+    if (value >= 1e7) {
+        while (value >= 10) { value /= 10; exponent++; }
+    } else if (value > 0 && value < 1e-5) {
+        while (value < 1) { value *= 10; exponent--; }
+    }
+    uint32_t maxDecimal = 1000000000;
+    int decimalPlaces = 9;
+    uint32_t integral = (uint32_t)value;
+    for (uint32_t tmp = integral; tmp >= 10; tmp /= 10) {
+        maxDecimal /= 10;
+        decimalPlaces--;
+    }
+    double remainder = (value - integral) * maxDecimal;
+    uint32_t decimal = (uint32_t)remainder;
+    remainder -= decimal;
+    decimal += (uint32_t)(remainder * 2);
+    if (decimal >= maxDecimal) {
+        decimal = 0;
+        integral++;
+        if (exponent && integral >= 10) {
+            exponent++;
+            integral = 1;
+        }
+    }
+    while (decimal % 10 == 0 && decimalPlaces > 0) {
+        decimal /= 10;
+        decimalPlaces--;
+    }
+    out += std::to_string(integral);
+    if (decimalPlaces) {
+        std::string digits = std::to_string(decimal);
+        out += '.';
+        out.append(decimalPlaces - digits.size(), '0');
+        out += digits;
+    }
+    if (exponent) {
+        out += 'e';
+        out += std::to_string(exponent);
+    }
+}
+
+inline void hostJsonWrite(std::string& out, const HostJsonNode& node) {
+    switch (node.type) {
+        case HostJsonNode::NUL: out += "null"; break;
+        case HostJsonNode::BOOLEAN: out += node.boolean ? "true" : "false"; break;
+        case HostJsonNode::SIGNED: out += std::to_string(node.integer); break;
+        case HostJsonNode::UNSIGNED: out += std::to_string(node.uinteger); break;
+        case HostJsonNode::FLOAT: hostJsonWriteFloat(out, node.real); break;
+        case HostJsonNode::TEXT:
+            out += '"';
+            for (char c : node.text) {
+                switch (c) {
+                    case '"': out += "\\\""; break;
+                    case '\\': out += "\\\\"; break;
+                    case '\b': out += "\\b"; break;
+                    case '\f': out += "\\f"; break;
+                    case '\n': out += "\\n"; break;
+                    case '\r': out += "\\r"; break;
+                    case '\t': out += "\\t"; break;
+                    default: out += c;
+                }
+            }
+            out += '"';
+            break;
+        case HostJsonNode::ARRAY:
+            out += '[';
+            for (size_t i = 0; i < node.items.size(); i++) {
+                if (i) out += ',';
+                hostJsonWrite(out, *node.items[i]);
+            }
+            out += ']';
+            break;
+        case HostJsonNode::OBJECT:
+            out += '{';
+            for (size_t i = 0; i < node.members.size(); i++) {
+                if (i) out += ',';
+                out += '"';
+                out += node.members[i].first;
+                out += "\":";
+                hostJsonWrite(out, *node.members[i].second);
+            }
+            out += '}';
+            break;
+    }
+}
+
+inline size_t serializeJson(const JsonDocument& doc, String& output) {
+    std::string out;
+    hostJsonWrite(out, doc.root());
+    output = out.c_str();
+    return out.size();
+}
+
+#endif // HOST_ARDUINOJSON_H
@@ -0,0 +1,14 @@
+// DNSServer.h (host shim): the captive portal DNS server answers nothing on the host
+#ifndef HOST_DNSSERVER_H
+#define HOST_DNSSERVER_H
+
+#include <Arduino.h>
+
+class DNSServer {
+public:
+    bool start(uint16_t, const String&, const IPAddress&) { return true; }
+    void stop() {}
+    void processNextRequest() {}
+};
+
+#endif // HOST_DNSSERVER_H
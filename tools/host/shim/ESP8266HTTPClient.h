@@ -0,0 +1,8 @@
+// ESP8266HTTPClient.h (host shim): flight_scanner.h includes it for the scan request;
+// nothing is fetched on the host
+#ifndef HOST_ESP8266HTTPCLIENT_H
+#define HOST_ESP8266HTTPCLIENT_H
+
+class HTTPClient;
+
+#endif // HOST_ESP8266HTTPCLIENT_H
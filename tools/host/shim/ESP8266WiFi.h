@@ -0,0 +1,156 @@
+// ESP8266WiFi.h (host shim)
+// The station, soft AP and sleep calls wifi_manager.cpp and power_manager.cpp make.
+// Nothing is transmitted: each call is recorded in WiFi.host, and the harness plays
+// the access point, answering an attempt with hostGotIP() or hostDisconnected(),
+// which run the registered event handlers as the SDK does.
+#ifndef HOST_ESP8266WIFI_H
+#define HOST_ESP8266WIFI_H
+
+#include <Arduino.h>
+#include <functional>
+#include <memory>
+
+enum WiFiMode_t { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 };
+
+enum WiFiSleepType_t { WIFI_NONE_SLEEP = 0, WIFI_LIGHT_SLEEP = 1, WIFI_MODEM_SLEEP = 2 };
+
+enum WiFiDisconnectReason {
+    WIFI_DISCONNECT_REASON_ASSOC_LEAVE = 8,
+    WIFI_DISCONNECT_REASON_BEACON_TIMEOUT = 200,
+    WIFI_DISCONNECT_REASON_NO_AP_FOUND = 201
+};
+
+struct WiFiEventStationModeGotIP {
+    IPAddress ip;
+    IPAddress mask;
+    IPAddress gw;
+};
+
+struct WiFiEventStationModeDisconnected {
+    String ssid;
+    uint8_t bssid[6];
+    WiFiDisconnectReason reason;
+};
+
+typedef std::shared_ptr<int> WiFiEventHandler;
+
+class ESP8266WiFiClass {
+public:
+    // What the firmware has asked for, and what the station has, for the harness
+    struct HostState {
+        WiFiMode_t mode = WIFI_OFF;
+        WiFiSleepType_t sleepType = WIFI_MODEM_SLEEP; // The core's default
+        uint8_t listenInterval = 0;
+        bool persistent = true;
+        bool autoReconnect = true;
+        bool softAP = false;
+        bool attempting = false;   // WiFi.begin() called and not yet answered
+        bool connected = false;
+        bool staticConfig = false; // WiFi.config() set an address
+        bool bssidGiven = false;   // The attempt named a channel and BSSID
+        uint8_t channel = 0;
+        uint8_t bssid[6] = {};
+        String ssid;
+        String password;
+        IPAddress ip, gateway, subnet, dns;
+        uint32_t begins = 0;
+        uint32_t ownDisconnects = 0; // Answered with WIFI_DISCONNECT_REASON_ASSOC_LEAVE
+    } host;
+
+    void persistent(bool enabled) { host.persistent = enabled; }
+    void setAutoReconnect(bool enabled) { host.autoReconnect = enabled; }
+    bool mode(WiFiMode_t mode) { host.mode = mode; return true; }
+    WiFiMode_t getMode() const { return host.mode; }
+    bool setSleepMode(WiFiSleepType_t type, uint8_t listenInterval = 0) {
+        host.sleepType = type;
+        host.listenInterval = listenInterval;
+        return true;
+    }
+    bool config(IPAddress ip, IPAddress gateway, IPAddress subnet, IPAddress dns = IPAddress()) {
+        host.staticConfig = (uint32_t)ip != 0;
+        host.ip = ip;
+        host.gateway = gateway;
+        host.subnet = subnet;
+        host.dns = dns;
+        return true;
+    }
+    int begin(const char* ssid, const char* password, int32_t channel = 0, const uint8_t* bssid = nullptr) {
+        host.ssid = ssid;
+        host.password = password;
+        host.bssidGiven = bssid != nullptr;
+        host.channel = channel;
+        if (bssid) {
+            memcpy(host.bssid, bssid, sizeof(host.bssid));
+        }
+        host.attempting = true;
+        host.connected = false;
+        host.begins++;
+        return 0;
+    }
+    bool disconnect(bool = false) {
+        if (host.attempting || host.connected) {
+            host.ownDisconnects++;
+            hostDisconnected(WIFI_DISCONNECT_REASON_ASSOC_LEAVE);
+        }
+        return true;
+    }
+
+    IPAddress localIP() const { return host.connected ? host.ip : IPAddress(); }
+    IPAddress gatewayIP() const { return host.gateway; }
+    IPAddress subnetMask() const { return host.subnet; }
+    IPAddress dnsIP() const { return host.dns; }
+    const uint8_t* BSSID() const { return host.bssid; }
+    int32_t channel() const { return host.channel; }
+    String SSID() const { return host.ssid; }
+    String psk() const { return host.password; }
+
+    bool softAP(const char*, const char*) { host.softAP = true; return true; }
+    bool softAPdisconnect(bool) { host.softAP = false; return true; }
+    IPAddress softAPIP() const { return IPAddress(192, 168, 4, 1); }
+
+    WiFiEventHandler onStationModeGotIP(std::function<void(const WiFiEventStationModeGotIP&)> handler) {
+        _gotIp = handler;
+        return std::make_shared<int>(0);
+    }
+    WiFiEventHandler onStationModeDisconnected(std::function<void(const WiFiEventStationModeDisconnected&)> handler) {
+        _disconnected = handler;
+        return std::make_shared<int>(0);
+    }
+
+    // Host only: the attempt succeeded. Without a static config the addresses are the
+    // DHCP lease; bssid and channel are the access point's.
+    void hostGotIP(IPAddress ip, IPAddress gateway, IPAddress subnet, IPAddress dns, const uint8_t* bssid,
+                   uint8_t channel) {
+        if (!host.staticConfig) {
+            host.ip = ip;
+            host.gateway = gateway;
+            host.subnet = subnet;
+            host.dns = dns;
+        }
+        memcpy(host.bssid, bssid, sizeof(host.bssid));
+        host.channel = channel;
+        host.attempting = false;
+        host.connected = true;
+        if (_gotIp) {
+            _gotIp({ host.ip, host.subnet, host.gateway });
+        }
+    }
+
+    // Host only: the attempt failed or the connection was lost
+    void hostDisconnected(WiFiDisconnectReason reason) {
+        host.attempting = false;
+        host.connected = false;
+        if (_disconnected) {
+            WiFiEventStationModeDisconnected event = { host.ssid, {}, reason };
+            _disconnected(event);
+        }
+    }
+
+private:
+    std::function<void(const WiFiEventStationModeGotIP&)> _gotIp;
+    std::function<void(const WiFiEventStationModeDisconnected&)> _disconnected;
+};
+
+extern ESP8266WiFiClass WiFi;
+
+#endif // HOST_ESP8266WIFI_H
@@ -0,0 +1,4 @@
+// ESPAsyncTCP.h (host shim): nothing the host harnesses use
+#ifndef HOST_ESPASYNCTCP_H
+#define HOST_ESPASYNCTCP_H
+#endif // HOST_ESPASYNCTCP_H
@@ -0,0 +1,38 @@
+// ESPAsyncWebServer.h (host shim): globals.h only declares the server objects,
+// response_cache.cpp needs the request/response calls of sendCachedResponse() to
+// compile, and power_manager.cpp counts event-stream clients. Nothing here serves
+// requests.
+#ifndef HOST_ESPASYNCWEBSERVER_H
+#define HOST_ESPASYNCWEBSERVER_H
+
+#include "Arduino.h"
+#include <functional>
+
+class AsyncWebServer;
+
+class AsyncEventSource {
+public:
+    explicit AsyncEventSource(const String&) {}
+    size_t count() const { return hostClients; }
+
+    size_t hostClients = 0; // Host only: connected dashboards
+};
+
+typedef std::function<size_t(uint8_t* buffer, size_t maxLen, size_t index)> AwsResponseFiller;
+
+class AsyncWebServerResponse {
+public:
+    void addHeader(const String&, const String&) {}
+};
+
+class AsyncWebServerRequest {
+public:
+    bool hasHeader(const char*) const { return false; }
+    String header(const char*) const { return String(); }
+    AsyncWebServerResponse* beginResponse(int) { return new AsyncWebServerResponse(); }
+    AsyncWebServerResponse* beginResponse(const String&, size_t, AwsResponseFiller) { return new AsyncWebServerResponse(); }
+    void send(int, const String&, const String&) {}
+    void send(AsyncWebServerResponse* response) { delete response; }
+};
+
+#endif // HOST_ESPASYNCWEBSERVER_H
@@ -0,0 +1,52 @@
+// FS.h (host shim)
+// An in-memory file system: files live in a map for the lifetime of the process.
+#ifndef HOST_FS_H
+#define HOST_FS_H
+
+#include <Arduino.h>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace fs {
+
+typedef std::shared_ptr<std::vector<uint8_t>> FileData;
+
+class File {
+public:
+    File() {}
+    File(FileData data, bool append) : _data(data), _position(append ? data->size() : 0) {}
+
+    explicit operator bool() const { return (bool)_data; }
+    size_t size() const { return _data ? _data->size() : 0; }
+    size_t position() const { return _position; }
+    bool seek(uint32_t position) { _position = min<size_t>(position, size()); return true; }
+    int available() { return size() - _position; }
+    size_t read(uint8_t* buffer, size_t length);
+    int read();
+    size_t write(const uint8_t* buffer, size_t length);
+    void close() { _data.reset(); _position = 0; }
+
+private:
+    FileData _data;
+    size_t _position = 0;
+};
+
+class FS {
+public:
+    bool begin() { return true; }
+    File open(const String& path, const char* mode);
+    bool exists(const String& path) const { return _files.count(path.c_str()) > 0; }
+    bool remove(const String& path) { return _files.erase(path.c_str()) > 0; }
+    bool rename(const String& from, const String& to);
+
+private:
+    std::map<std::string, FileData> _files;
+};
+
+} // namespace fs
+
+using fs::File;
+extern fs::FS SPIFFS;
+
+#endif // HOST_FS_H
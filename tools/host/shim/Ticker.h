@@ -0,0 +1,35 @@
+// Ticker.h (host shim)
+// Tickers only record their callback and period; a harness fires them itself
+// (runDueTickers() in host_runtime.h) between simulated timer1 interrupts.
+#ifndef HOST_TICKER_H
+#define HOST_TICKER_H
+
+#include <Arduino.h>
+#include <functional>
+
+class Ticker {
+public:
+    typedef std::function<void(void)> callback_function_t;
+
+    Ticker();
+    ~Ticker();
+    void attach_ms(uint32_t ms, callback_function_t callback) { arm(ms, callback, true); }
+    void attach(float seconds, callback_function_t callback) { arm((uint32_t)(seconds * 1000), callback, true); }
+    void once_ms(uint32_t ms, callback_function_t callback) { arm(ms, callback, false); }
+    void once(float seconds, callback_function_t callback) { arm((uint32_t)(seconds * 1000), callback, false); }
+    void detach() { _callback = nullptr; }
+    bool active() const { return (bool)_callback; }
+
+    // Host only: fires the callback if it is due at 'nowMs'
+    void runIfDue(uint32_t nowMs);
+
+private:
+    void arm(uint32_t ms, callback_function_t callback, bool repeat);
+
+    callback_function_t _callback;
+    uint32_t _periodMs = 0;
+    uint32_t _dueMs = 0;
+    bool _repeat = false;
+};
+
+#endif // HOST_TICKER_H
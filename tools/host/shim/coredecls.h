@@ -0,0 +1,10 @@
+// coredecls.h (host shim): the core's CRC-32, as wifi_manager.cpp uses it
+#ifndef HOST_COREDECLS_H
+#define HOST_COREDECLS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+uint32_t crc32(const void* data, size_t length, uint32_t crc = 0xffffffff);
+
+#endif // HOST_COREDECLS_H
@@ -0,0 +1,12 @@
+// lwip/dhcp.h (host shim): the DHCP client's granted lease
+#ifndef HOST_LWIP_DHCP_H
+#define HOST_LWIP_DHCP_H
+
+#include <stdint.h>
+#include "netif.h"
+
+struct dhcp {
+    uint32_t offered_t0_lease; // Seconds
+};
+
+#endif // HOST_LWIP_DHCP_H
@@ -0,0 +1,27 @@
+// lwip/netif.h (host shim): the interface list and address accessors wifi_manager.cpp
+// reads the DHCP lease through. A harness fills netif_list.
+#ifndef HOST_LWIP_NETIF_H
+#define HOST_LWIP_NETIF_H
+
+#include <stdint.h>
+
+struct ip4_addr {
+    uint32_t addr;
+};
+typedef struct ip4_addr ip4_addr_t;
+
+struct dhcp;
+
+struct netif {
+    struct netif* next;
+    ip4_addr_t ip_addr;
+    struct dhcp* dhcp; // nullptr while the address is static
+};
+
+extern struct netif* netif_list;
+
+#define netif_ip4_addr(n) ((const ip4_addr_t*)&(n)->ip_addr)
+#define ip4_addr_get_u32(a) ((a)->addr)
+#define netif_dhcp_data(n) ((struct dhcp*)(n)->dhcp)
+
+#endif // HOST_LWIP_NETIF_H
@@ -0,0 +1,10 @@
+// sigma_delta.h (host shim): the generator's output level is the GPSD register
+#ifndef HOST_SIGMA_DELTA_H
+#define HOST_SIGMA_DELTA_H
+
+#include <Arduino.h>
+
+uint32_t sigmaDeltaSetup(uint8_t channel, uint32_t frequency);
+void sigmaDeltaAttachPin(uint8_t pin, uint8_t channel = 0);
+
+#endif // HOST_SIGMA_DELTA_H
@@ -0,0 +1,133 @@
+// sim_alarm_debounce.cpp
+// Host simulation of the per-aircraft alarm debounce (alarm_debounce.cpp) fed by
+// classifyPosition(), as the scan does. Scripted cases check entry into a level at
+// the entry band, holding inside the exit band, the dwell before stepping down and
+// before dropping to no alarm, and that an aircraft missing from a scan or any
+// aircraft after a settings change starts over. A random walk around the Level 3
+// boundary then counts alarm level changes with and without the debounce.
+// Exits non-zero on any failed case.
+//
+// Build and run from the repository root:
+//   g++ -std=gnu++17 -O2 -Itools/host/shim -Itools/host -I. -o /tmp/sim_alarm_debounce
+//       tools/host/sim_alarm_debounce.cpp tools/host/host_runtime.cpp alarm_debounce.cpp scan_geometry.cpp geofence.cpp utils.cpp
+//   /tmp/sim_alarm_debounce
+#include "host_runtime.h"
+#include "alarm_debounce.h"
+#include <random>
+
+const float SITE_LAT = 15.36f;
+const float SITE_LON = 75.02f;
+const float KM_PER_DEG = 6371.0 * PI / 180.0;
+const uint32_t SCAN_MS = 10000;
+
+static int failures = 0;
+
+static void rebuild(float entryBandPercent, float exitBandPercent, int dwellSec) {
+    AppSettings settings = {};
+    settings.apiServer = "opensky-network.org";
+    settings.latitude = SITE_LAT;
+    settings.longitude = SITE_LON;
+    settings.radiusLevel1 = 5;
+    settings.radiusLevel2 = 10;
+    settings.radiusLevel3 = 20;
+    settings.noFlightScanFreq = 60;
+    settings.flightPresentScanFreq = 10;
+    settings.alarmEntryBandPercent = entryBandPercent;
+    settings.alarmHysteresisPercent = exitBandPercent;
+    settings.alarmDwellSec = dwellSec;
+    rebuildScanGeometry(settings);
+}
+
+// Position 'km' north-east of the site: along the diagonal the query box (the Level 3
+// exit circle's bounding box) still reports aircraft up to 31 km out, past every band
+static float diagonalLat(float km) {
+    return SITE_LAT + km * M_SQRT1_2 / KM_PER_DEG;
+}
+
+static float diagonalLon(float km) {
+    return SITE_LON + km * M_SQRT1_2 / (KM_PER_DEG * cos(SITE_LAT * PI / 180.0));
+}
+
+// One aircraft reported in the scan at 'nowMs', as classifyStateRow() does it
+static int report(const char* icao24, float km, uint32_t nowMs) {
+    const ScanGeometry& geometry = activeScanGeometry();
+    SiteMatch match;
+    int entryLevel = classifyPosition(geometry, diagonalLat(km), diagonalLon(km), 0, match);
+    return debounceProximityLevel(icao24, entryLevel, match, nowMs, geometry.alarmDwellMs);
+}
+
+// One scan that reports a single aircraft, then drops everyone it did not report
+static int scan(const char* icao24, float km, uint32_t nowMs) {
+    int level = report(icao24, km, nowMs);
+    pruneAlarmStates(nowMs);
+    return level;
+}
+
+static void expect(const char* name, int got, int want) {
+    printf("%-58s level %d  %s\n", name, got, got == want ? "ok" : "FAIL");
+    if (got != want) {
+        printf("    expected level %d\n", want);
+        failures++;
+    }
+}
+
+int main() {
+    // Level 3: 20 km nominal; 19 km with a 5% entry band, 22 km with a 10% exit band
+    rebuild(5, 10, 30);
+    uint32_t t = 1000;
+    expect("inside the nominal radius, outside the entry band", scan("a1", 19.5f, t), 0);
+    expect("inside the entry band", scan("a1", 18.8f, t += SCAN_MS), 3);
+    expect("back in the entry-exit gap", scan("a1", 19.5f, t += SCAN_MS), 3);
+    expect("in the exit band", scan("a1", 21.5f, t += SCAN_MS), 3);
+    expect("past every band within the dwell time", scan("a1", 24.0f, t += SCAN_MS / 2), 3);
+    expect("past every band after the dwell time", scan("a1", 24.0f, t += SCAN_MS), 0);
+    expect("released: the exit band alone does not alarm", scan("a1", 21.5f, t += SCAN_MS), 0);
+
+    resetAlarmStates();
+    t += SCAN_MS;
+    expect("escalation is immediate", scan("b1", 18.0f, t), 3);
+    expect("escalation is immediate", scan("b1", 4.0f, t += SCAN_MS), 1);
+    expect("step down held for the dwell time", scan("b1", 7.0f, t += SCAN_MS), 1);
+    expect("step down after the dwell time", scan("b1", 7.0f, t += 3 * SCAN_MS), 2);
+    expect("dropping to none held for the dwell time", scan("b1", 30.0f, t += SCAN_MS), 2);
+
+    resetAlarmStates();
+    t += SCAN_MS;
+    expect("level 1", scan("c1", 4.0f, t), 1);
+    pruneAlarmStates(t += SCAN_MS); // A scan without c1
+    expect("back after a missed scan: current level, not the old one", scan("c1", 5.2f, t += SCAN_MS), 2);
+
+    expect("level 1", scan("d1", 4.0f, t += SCAN_MS), 1);
+    rebuild(5, 10, 30);
+    resetAlarmStates(); // As applySettingsChange() does
+    expect("after a settings change: current level, not the old one", scan("d1", 5.2f, t += SCAN_MS), 2);
+
+    // Random walk across the Level 3 boundary: 1 h of scans every 10 s, +/-1 km steps
+    // between 17 and 24 km, counting changes of the level the alarm would announce
+    rebuild(0, 10, 30);
+    resetAlarmStates();
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> step(-1.0f, 1.0f);
+    float km = 20.0f;
+    int rawLevel = 0, debouncedLevel = 0, rawChanges = 0, debouncedChanges = 0;
+    uint32_t flapsBefore = getSuppressedFlapCount();
+    for (int i = 0; i < 360; i++) {
+        km = constrain(km + step(rng), 17.0f, 24.0f);
+        SiteMatch match;
+        int level = classifyPosition(activeScanGeometry(), diagonalLat(km), diagonalLon(km), 0, match);
+        rawChanges += level != rawLevel;
+        rawLevel = level;
+        level = scan("e1", km, t += SCAN_MS);
+        debouncedChanges += level != debouncedLevel;
+        debouncedLevel = level;
+    }
+    printf("boundary walk, 360 scans: %d level changes raw, %d debounced, %u held back\n",
+           rawChanges, debouncedChanges, getSuppressedFlapCount() - flapsBefore);
+    if (debouncedChanges >= rawChanges) {
+        printf("    the debounce did not reduce the level changes\n");
+        failures++;
+    }
+
+    printf("%s\n", failures ? "FAILED" : "all cases passed");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,158 @@
+// sim_led_patterns.cpp
+// Host simulation of the LED pattern engine (led_patterns.cpp): steps simulated time
+// 1 ms at a time, fires ledTicker when due, and records the built-in LED as the pin
+// shows it (active low). Checks, from the on/off run lengths:
+// - each layer alone: error solid on, level 1 100/100 ms, level 2 300/300 ms,
+//   level 3 1 s/1 s
+// - the priority stack: level 1 overrides level 2, an error overrides level 1,
+//   clearing the error falls back to level 1 and clearing that to level 2; a new top
+//   pattern starts lit at once
+// - the Ticker is detached whenever the LED is steady (off, or the error layer on top)
+// - the pin is written only when the LED changes
+//
+// Build and run from the repository root:
+//   g++ -std=gnu++17 -O2 -Itools/host/shim -Itools/host -I. -o /tmp/sim_led_patterns
+//       tools/host/sim_led_patterns.cpp tools/host/host_runtime.cpp led_patterns.cpp
+//   /tmp/sim_led_patterns
+#include "host_runtime.h"
+#include "led_patterns.h"
+#include <string>
+#include <vector>
+
+Ticker ledTicker;
+
+struct Run {
+    bool lit;
+    uint32_t ms;
+};
+
+static std::vector<bool> trace; // LED state during each simulated millisecond
+static uint32_t transitions = 0; // LED changes, counted wherever it can change
+static bool lastLit = false;
+static int failures = 0;
+
+static bool ledLit() {
+    return hostPinLevels[LED_BUILTIN_PIN] == LOW;
+}
+
+static void countChange() {
+    if (ledLit() != lastLit) {
+        lastLit = ledLit();
+        transitions++;
+    }
+}
+
+static void setLayer(LedLayer layer, bool active) {
+    ledSetLayer(LED_CHANNEL_BUILTIN, layer, active);
+    countChange();
+}
+
+static void runFor(uint32_t ms) {
+    for (uint32_t i = 0; i < ms; i++) {
+        trace.push_back(ledLit());
+        hostMicros += 1000;
+        runDueTickers();
+        countChange();
+    }
+}
+
+// Runs of the trace from 'from' on; the last one may be cut short
+static std::vector<Run> runsFrom(size_t from) {
+    std::vector<Run> runs;
+    for (size_t i = from; i < trace.size(); i++) {
+        if (runs.empty() || runs.back().lit != trace[i]) {
+            runs.push_back({ trace[i], 0 });
+        }
+        runs.back().ms++;
+    }
+    return runs;
+}
+
+static std::string describe(const std::vector<Run>& runs) {
+    std::string text;
+    for (const Run& run : runs) {
+        text += (text.empty() ? "" : " ") + std::string(run.lit ? "on " : "off ") + std::to_string(run.ms);
+    }
+    return text;
+}
+
+// Expects the LED to alternate onMs/offMs (offMs 0: steady on) for 'ms'. A pattern that
+// has just become the top one starts lit with a full on phase; one that was already
+// showing ('fromStart' false) may be anywhere in its current phase.
+static void expectPattern(const char* name, uint32_t onMs, uint32_t offMs, uint32_t ms, bool tickerActive,
+                          bool fromStart = true) {
+    size_t from = trace.size();
+    runFor(ms);
+    std::vector<Run> runs = runsFrom(from);
+    bool ok = !runs.empty() && ledTicker.active() == tickerActive && (runs[0].lit || !fromStart);
+    for (size_t i = 0; ok && i < runs.size(); i++) {
+        bool lit = offMs == 0 || (i % 2 == 0) == runs[0].lit;
+        uint32_t length = offMs == 0 ? ms : lit ? onMs : offMs;
+        bool partial = (i == runs.size() - 1) || (i == 0 && !fromStart);
+        ok = runs[i].lit == lit && (runs[i].ms == length || (partial && runs[i].ms < length));
+    }
+    printf("%-40s %-44s Ticker %-8s %s\n", name, describe(runs).substr(0, 44).c_str(),
+           ledTicker.active() ? "attached" : "detached", ok ? "ok" : "FAILED");
+    failures += !ok;
+}
+
+static void expectOff(const char* name) {
+    size_t from = trace.size();
+    runFor(500);
+    std::vector<Run> runs = runsFrom(from);
+    bool ok = runs.size() == 1 && !runs[0].lit && !ledTicker.active();
+    printf("%-40s %-44s Ticker %-8s %s\n", name, describe(runs).c_str(),
+           ledTicker.active() ? "attached" : "detached", ok ? "ok" : "FAILED");
+    failures += !ok;
+}
+
+int main() {
+    ledBegin();
+    uint32_t writesAtBegin = hostPinWrites;
+    bool offAtBegin = !ledLit() && hostPinLevels[LED_BUILTIN_PIN] == HIGH;
+    printf("%-40s %-44s %s\n", "ledBegin()", offAtBegin ? "off (pin high)" : "lit", offAtBegin ? "ok" : "FAILED");
+    failures += !offAtBegin;
+    expectOff("idle");
+
+    const LedLayer layers[] = { LED_LAYER_ERROR, LED_LAYER_LEVEL1, LED_LAYER_LEVEL2, LED_LAYER_LEVEL3 };
+    const char* const names[] = { "error alone", "level 1 alone", "level 2 alone", "level 3 alone" };
+    const uint32_t onMs[] = { 0, 100, 300, 1000 };
+    for (int i = 0; i < 4; i++) {
+        setLayer(layers[i], true);
+        expectPattern(names[i], onMs[i], onMs[i], 4150, i > 0);
+        setLayer(layers[i], false);
+        expectOff("  cleared");
+    }
+
+    setLayer(LED_LAYER_LEVEL2, true);
+    runFor(450); // Halfway through an off phase
+    setLayer(LED_LAYER_LEVEL1, true);
+    expectPattern("level 2, then level 1 added", 100, 100, 1050, true);
+    setLayer(LED_LAYER_LEVEL3, true);
+    expectPattern("  level 3 added (below level 1)", 100, 100, 1050, true, false);
+    setLayer(LED_LAYER_ERROR, true);
+    expectPattern("  error added", 0, 0, 1050, false);
+    setLayer(LED_LAYER_ERROR, false);
+    expectPattern("  error cleared: level 1", 100, 100, 1050, true);
+    setLayer(LED_LAYER_LEVEL1, false);
+    expectPattern("  level 1 cleared: level 2", 300, 300, 1950, true);
+    setLayer(LED_LAYER_LEVEL2, false);
+    expectPattern("  level 2 cleared: level 3", 1000, 1000, 2500, true);
+    // 500 ms into an on phase; setting the active layer again must not restart it
+    setLayer(LED_LAYER_LEVEL3, true);
+    size_t from = trace.size();
+    runFor(1600);
+    std::vector<Run> runs = runsFrom(from);
+    bool continued = runs.size() == 3 && runs[0].lit && runs[0].ms == 500 && runs[1].ms == 1000;
+    printf("%-40s %-44s Ticker %-8s %s\n", "  level 3 set again: no restart", describe(runs).c_str(),
+           ledTicker.active() ? "attached" : "detached", continued ? "ok" : "FAILED");
+    failures += !continued;
+    setLayer(LED_LAYER_LEVEL3, false);
+    expectOff("  all cleared");
+
+    bool writesOk = hostPinWrites - writesAtBegin == transitions;
+    printf("pin writes %u, LED changes %u: %s\n", hostPinWrites - writesAtBegin, transitions,
+           writesOk ? "ok" : "FAILED");
+    failures += !writesOk;
+    return failures ? 1 : 0;
+}
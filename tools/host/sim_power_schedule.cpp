@@ -0,0 +1,183 @@
+// sim_power_schedule.cpp
+// Host simulation of the power manager (power_manager.cpp) over one hour per scenario,
+// with loop() modelled as in FlightAlarm.ino: a due flight scan runs between
+// powerWake() and the next timer start, every pass then does LOOP_WORK_MS of work and
+// ends in powerIdle(), whose delay() lets simulated time pass. Scans are flagged by a
+// Ticker every SCAN_INTERVAL_S and take SCAN_MS, as the scan timer and a scan on the
+// device do. Scenarios:
+// 1. nothing to do: light sleep between scans
+// 2. a web request every 10 min: modem sleep for POWER_WEB_HOLD_MS after each
+// 3. a dashboard connected (an event-stream client): modem sleep between scans
+// 4. an alarm shown: modem sleep between scans
+// 5. station not connected: radio fully on, loop() never waits
+// Reports the time in each state and the firmware's two estimates (duty cycle and
+// average current). Those count every light-sleep wait as fully asleep, so they are
+// best cases, and so are the figures here. It fails if a scan starts later than one
+// loop() pass after it was flagged, if a scan runs with the radio in a sleep type, if a
+// wait uses a sleep type its state does not allow, or if a state's time is outside the
+// range the scenario implies.
+//
+// Build and run from the repository root:
+//   g++ -std=gnu++17 -O2 -Itools/host/shim -Itools/host -I. -o /tmp/sim_power_schedule
+//       tools/host/sim_power_schedule.cpp tools/host/host_runtime.cpp power_manager.cpp
+//   /tmp/sim_power_schedule
+#include "host_runtime.h"
+#include "power_manager.h"
+#include <ESP8266WiFi.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+int currentOverallAlarmLevel = 0;
+AsyncEventSource eventStream("/events");
+
+static const uint32_t SCAN_INTERVAL_S = 60;
+static const uint32_t SCAN_MS = 3000;
+static const uint32_t LOOP_WORK_MS = 1;
+static const uint32_t RUN_MS = 3600000;
+static const uint32_t WEB_REQUEST_EVERY_MS = 600000;
+
+// The scan timer, as in flight_scanner.cpp
+Ticker flightScanTicker;
+volatile bool flightScanDue = false;
+static uint32_t nextScanStartMs = 0;
+static uint32_t nextScanDelayMs = 0;
+
+static bool stationReady = true;
+static uint32_t scans = 0;
+static uint32_t latestScanStartMs = 0;
+static uint32_t badSleepTypes = 0;
+static uint32_t lastWebRequestMs = 0;
+
+static void requestFlightScan() {
+    flightScanDue = true;
+}
+
+static void startFlightScanTimer() {
+    flightScanTicker.once(SCAN_INTERVAL_S, requestFlightScan);
+    nextScanStartMs = millis();
+    nextScanDelayMs = SCAN_INTERVAL_S * 1000;
+}
+
+uint32_t msUntilNextScan() {
+    if (flightScanDue) {
+        return 0;
+    }
+    uint32_t elapsed = millis() - nextScanStartMs;
+    return (elapsed < nextScanDelayMs) ? nextScanDelayMs - elapsed : 0;
+}
+
+bool audioEngineBusy() {
+    return false;
+}
+
+bool wifiStationReady() {
+    return stationReady;
+}
+
+// One loop() pass
+static void loopPass() {
+    if (flightScanDue) {
+        flightScanDue = false;
+        latestScanStartMs = max<uint32_t>(latestScanStartMs, millis() - (nextScanStartMs + nextScanDelayMs));
+        powerWake();
+        if (WiFi.host.sleepType != WIFI_NONE_SLEEP) {
+            badSleepTypes++;
+        }
+        delay(SCAN_MS);
+        scans++;
+        startFlightScanTimer();
+    }
+    delay(LOOP_WORK_MS);
+    if (lastWebRequestMs != UINT32_MAX && millis() - lastWebRequestMs >= WEB_REQUEST_EVERY_MS) {
+        lastWebRequestMs = millis();
+        powerNoteWebActivity();
+    }
+    // powerIdle() must select the sleep type the device's work allows as it starts
+    bool webHeld = lastWebRequestMs != UINT32_MAX && millis() - lastWebRequestMs < POWER_WEB_HOLD_MS;
+    WiFiSleepType_t expected = !stationReady ? WIFI_NONE_SLEEP
+                             : (eventStream.count() > 0 || currentOverallAlarmLevel > 0 || webHeld) ? WIFI_MODEM_SLEEP
+                             : WIFI_LIGHT_SLEEP;
+    powerIdle();
+    if (WiFi.host.sleepType != expected) {
+        badSleepTypes++;
+    }
+    if (expected == WIFI_LIGHT_SLEEP && WiFi.host.listenInterval != POWER_LISTEN_INTERVAL) {
+        badSleepTypes++;
+    }
+    runDueTickers();
+}
+
+struct Scenario {
+    const char* name;
+    bool webRequests;
+    size_t dashboards;
+    int alarmLevel;
+    bool stationReady;
+    // Expected share of the hour in light sleep, in percent
+    double lightMinPercent;
+    double lightMaxPercent;
+};
+
+static int runScenario(const Scenario& scenario) {
+    lastWebRequestMs = UINT32_MAX;
+    if (scenario.webRequests) {
+        lastWebRequestMs = millis(); // The first one at boot
+        powerNoteWebActivity();
+    }
+    eventStream.hostClients = scenario.dashboards;
+    currentOverallAlarmLevel = scenario.alarmLevel;
+    stationReady = scenario.stationReady;
+    WiFi.mode(WIFI_STA);
+    startFlightScanTimer();
+    while (millis() < RUN_MS) {
+        loopPass();
+    }
+
+    uint64_t active = powerStateMs(POWER_ACTIVE);
+    uint64_t modem = powerStateMs(POWER_MODEM_SLEEP);
+    uint64_t light = powerStateMs(POWER_LIGHT_SLEEP);
+    uint64_t total = active + modem + light;
+    double lightPercent = light * 100.0 / total;
+    uint32_t expectedScans = RUN_MS / (SCAN_INTERVAL_S * 1000 + SCAN_MS);
+    bool ok = total >= RUN_MS && scans >= expectedScans && latestScanStartMs <= LOOP_WORK_MS &&
+              badSleepTypes == 0 && lightPercent >= scenario.lightMinPercent &&
+              lightPercent <= scenario.lightMaxPercent && active >= scans * SCAN_MS;
+    uint32_t duty = powerDutyCycleEstimatePermille();
+    uint32_t current = powerAverageCurrentUa();
+    printf("%s\n", scenario.name);
+    printf("  %u scans, latest start %u ms after its flag; active %.1f%%, modem sleep %.1f%%, light sleep %.1f%% "
+           "(expected %.1f-%.1f%%)\n",
+           scans, latestScanStartMs, active * 100.0 / total, modem * 100.0 / total, lightPercent,
+           scenario.lightMinPercent, scenario.lightMaxPercent);
+    if (badSleepTypes) {
+        printf("  %u passes with the wrong sleep type\n", badSleepTypes);
+    }
+    printf("  estimated duty cycle %u.%u%%, estimated average current %u.%02u mA (best cases) %s\n", duty / 10,
+           duty % 10, current / 1000, current % 1000 / 10, ok ? "ok" : "FAILED");
+    fflush(stdout);
+    return ok ? 0 : 1;
+}
+
+int main() {
+    // Each scenario from boot; light-sleep shares follow from 3 s scans every 63 s, 1 ms of
+    // work per pass (per second in light sleep) and, in 2, six 30 s holds in modem sleep
+    const Scenario scenarios[] = {
+        { "1. nothing to do", false, 0, 0, true, 94.0, 95.5 },
+        { "2. a web request every 10 min", true, 0, 0, true, 89.5, 91.0 },
+        { "3. dashboard connected", false, 1, 0, true, 0.0, 0.0 },
+        { "4. alarm shown", false, 0, 1, true, 0.0, 0.0 },
+        { "5. station not connected", false, 0, 0, false, 0.0, 0.0 },
+    };
+    int failures = 0;
+    for (const Scenario& scenario : scenarios) {
+        fflush(stdout);
+        pid_t child = fork(); // Fresh power_manager.cpp state per scenario
+        if (child == 0) {
+            _exit(runScenario(scenario));
+        }
+        int status = 0;
+        waitpid(child, &status, 0);
+        failures += WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+    }
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,247 @@
+// sim_wifi_reconnect.cpp
+// Host simulation of the WiFi connection manager (wifi_manager.cpp) against a fake
+// access point, with loop() modelled as one handleWifiConnection() call per simulated
+// millisecond. The access point answers an attempt that names its channel and BSSID
+// after CACHED_ASSOCIATION_MS, and a full one (scan, association, DHCP) after
+// FULL_ASSOCIATION_MS; a full attempt while it is down fails after SCAN_MS, and a
+// cached one naming the wrong channel gets no answer. DHCP leases last LEASE_S and are
+// renewed at half time while the station uses DHCP.
+//
+// Each boot runs in a forked child of a process that never ran the firmware, so RAM
+// starts fresh; RTC user memory and the access point live in a shared mapping and so
+// survive a reset. A power cycle fills RTC memory with garbage. Scenarios:
+// 1. Power-on: a full connect; a link drop then reconnects on the cached path; the
+//    cached (static) address goes back to DHCP before its lease runs out; the access
+//    point moving to another channel costs one failed cached attempt, then a full one.
+// 2. Reset with RTC memory intact: a cached connect.
+// 3. Power-on with the access point down until 45 s: the setup AP opens at 20 s, the
+//    station keeps retrying with backoff, connects, and the setup AP closes.
+// Reports every reconnect time and path, and the longest loop() stall: the most
+// simulated time and host time one handleWifiConnection() call took. It fails on a
+// wrong path or a time outside the expected range, on a static address used past its
+// lease, or if handleWifiConnection() ever lets simulated time pass (delay()).
+//
+// Build and run from the repository root:
+//   g++ -std=gnu++17 -O2 -Itools/host/shim -Itools/host -I. -o /tmp/sim_wifi_reconnect
+//       tools/host/sim_wifi_reconnect.cpp tools/host/host_runtime.cpp wifi_manager.cpp
+//   /tmp/sim_wifi_reconnect
+#include "host_runtime.h"
+#include "wifi_manager.h"
+#include <chrono>
+#include <lwip/dhcp.h>
+#include <random>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+AppSettings currentSettings;
+DNSServer dnsServer;
+const char* AP_SSID = "FlightAlarm-Setup";
+const char* AP_PASSWORD = "setup1234";
+
+static const uint32_t CACHED_ASSOCIATION_MS = 300;
+static const uint32_t FULL_ASSOCIATION_MS = 3500;
+static const uint32_t SCAN_MS = 2000;
+static const uint32_t LEASE_S = 900;
+static const uint8_t AP_BSSID[6] = { 0x02, 0x1a, 0x11, 0xf0, 0x42, 0x07 };
+
+// State that outlives a reset: RTC user memory and the access point (world time in ms)
+struct World {
+    uint32_t rtc[HOST_RTC_USER_WORDS];
+    uint64_t nowMs;
+    bool apUp;
+    uint8_t apChannel;
+    uint64_t leaseGrantedMs;
+    uint64_t staticPastLeaseMs; // Time the station used a static address whose lease had run out
+};
+static World* world;
+
+// Per boot
+static netif station = { nullptr, { 0 }, nullptr };
+static dhcp stationDhcp = { LEASE_S };
+static uint32_t seenBegins = 0;
+static uint32_t attemptStartMs = 0;
+static uint32_t lastConnectMs = 0;
+static bool connectRecorded = false;
+static uint32_t apOpenedMs = UINT32_MAX;
+static uint32_t apClosedMs = UINT32_MAX;
+static uint32_t longestStallMs = 0;
+static double longestCallUs = 0;
+static int failures = 0;
+
+void metricsRecordWifiConnect(uint32_t durationMs) {
+    lastConnectMs = durationMs;
+    connectRecorded = true;
+}
+
+// The access point's side of one simulated millisecond
+static void stepAccessPoint() {
+    ESP8266WiFiClass::HostState& host = WiFi.host;
+    if (host.begins != seenBegins) {
+        seenBegins = host.begins;
+        attemptStartMs = millis();
+    }
+    if (host.attempting) {
+        uint32_t elapsed = millis() - attemptStartMs;
+        bool rightChannel = host.channel == world->apChannel && memcmp(host.bssid, AP_BSSID, 6) == 0;
+        if (!world->apUp || (host.bssidGiven && !rightChannel)) {
+            if (!host.bssidGiven && elapsed >= SCAN_MS) {
+                WiFi.hostDisconnected(WIFI_DISCONNECT_REASON_NO_AP_FOUND);
+            }
+        } else if (elapsed >= (host.bssidGiven ? CACHED_ASSOCIATION_MS : FULL_ASSOCIATION_MS)) {
+            if (!host.staticConfig) {
+                world->leaseGrantedMs = world->nowMs;
+            }
+            station.ip_addr.addr = host.staticConfig ? (uint32_t)host.ip : (uint32_t)IPAddress(192, 168, 1, 57);
+            station.dhcp = host.staticConfig ? nullptr : &stationDhcp;
+            WiFi.hostGotIP(IPAddress(192, 168, 1, 57), IPAddress(192, 168, 1, 1), IPAddress(255, 255, 255, 0),
+                           IPAddress(192, 168, 1, 1), AP_BSSID, world->apChannel);
+        }
+    }
+    if (host.connected && !host.staticConfig && world->nowMs - world->leaseGrantedMs >= LEASE_S * 500ull) {
+        world->leaseGrantedMs = world->nowMs; // The DHCP client renews at half the lease
+    }
+    if (host.connected && host.staticConfig && world->nowMs >= world->leaseGrantedMs + LEASE_S * 1000ull) {
+        world->staticPastLeaseMs++;
+    }
+}
+
+// One loop() pass, then one millisecond passes
+static void step() {
+    stepAccessPoint();
+    uint64_t before = hostMicros;
+    auto start = std::chrono::steady_clock::now();
+    handleWifiConnection();
+    double callUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    longestCallUs = max(longestCallUs, callUs);
+    longestStallMs = max(longestStallMs, (uint32_t)((hostMicros - before) / 1000));
+    if (WiFi.host.softAP && apOpenedMs == UINT32_MAX) {
+        apOpenedMs = millis();
+    }
+    if (!WiFi.host.softAP && apOpenedMs != UINT32_MAX && apClosedMs == UINT32_MAX) {
+        apClosedMs = millis();
+    }
+    hostMicros += 1000;
+    world->nowMs++;
+}
+
+static void runFor(uint32_t ms) {
+    for (uint32_t i = 0; i < ms; i++) {
+        step();
+    }
+}
+
+// Runs until the next connection (at most 'limitMs') and checks its path and time
+static void expectConnect(const char* name, bool cached, uint32_t minMs, uint32_t maxMs, uint32_t limitMs = 120000) {
+    uint32_t cachedBefore = wifiConnectCount(true);
+    connectRecorded = false;
+    for (uint32_t i = 0; i < limitMs && !connectRecorded; i++) {
+        step();
+    }
+    bool wasCached = wifiConnectCount(true) != cachedBefore;
+    bool ok = connectRecorded && wasCached == cached && lastConnectMs >= minMs && lastConnectMs <= maxMs;
+    if (connectRecorded) {
+        printf("  %-50s %6u ms, %-6s (expected %s, %u-%u ms) %s\n", name, lastConnectMs, wasCached ? "cached" : "full",
+               cached ? "cached" : "full", minMs, maxMs, ok ? "ok" : "FAILED");
+    } else {
+        printf("  %-50s no connection within %u ms FAILED\n", name, limitMs);
+    }
+    failures += !ok;
+}
+
+static void linkDrop() {
+    station.ip_addr.addr = 0;
+    WiFi.hostDisconnected(WIFI_DISCONNECT_REASON_BEACON_TIMEOUT);
+}
+
+static void bootPowerOn() {
+    expectConnect("first connect", false, FULL_ASSOCIATION_MS, FULL_ASSOCIATION_MS + 10);
+    runFor(120000);
+    linkDrop();
+    expectConnect("link drop", true, CACHED_ASSOCIATION_MS, CACHED_ASSOCIATION_MS + 10);
+    // The cache holds half the lease as of its last refresh; DHCP must take over in time
+    expectConnect("cached address lease running out: back to DHCP", false, FULL_ASSOCIATION_MS,
+                  FULL_ASSOCIATION_MS + 10, LEASE_S * 1000);
+    runFor(120000);
+    world->apChannel = 11;
+    linkDrop();
+    expectConnect("link drop, access point moved to channel 11", false,
+                  WIFI_CACHED_TIMEOUT_MS + FULL_ASSOCIATION_MS, WIFI_CACHED_TIMEOUT_MS + FULL_ASSOCIATION_MS + 10);
+    runFor(120000);
+}
+
+static void bootReset() {
+    expectConnect("connect after reset", true, CACHED_ASSOCIATION_MS, CACHED_ASSOCIATION_MS + 10);
+    runFor(60000);
+}
+
+static void bootAccessPointDown() {
+    world->apUp = false;
+    runFor(45000);
+    world->apUp = true;
+    // Attempts at 0, 3, 7, 13, 23 and 41 s fail (backoff 1, 2, 4, 8, 16, then 30 s); 73 s succeeds
+    expectConnect("connect once the access point is back at 45 s", false, 45000,
+                  45000 + WIFI_BACKOFF_MAX_MS + SCAN_MS + FULL_ASSOCIATION_MS);
+    bool apOk = apOpenedMs == WIFI_AP_FALLBACK_MS && apClosedMs == millis() - 1; // Closed on connecting
+    printf("  %-50s opened at %u ms, closed at %u ms %s\n", "setup AP", apOpenedMs, apClosedMs, apOk ? "ok" : "FAILED");
+    failures += !apOk;
+}
+
+static int runBoot(const char* name, bool powerCycle, void (*scenario)()) {
+    printf("%s\n", name);
+    if (powerCycle) {
+        std::mt19937 random(world->nowMs);
+        for (uint32_t& word : world->rtc) {
+            word = random();
+        }
+    }
+    netif_list = &station;
+    currentSettings.ssid = "hangar";
+    currentSettings.password = "secret";
+    connectWiFi();
+    scenario();
+    bool settingsOk = !WiFi.host.persistent && !WiFi.host.autoReconnect;
+    bool stallOk = longestStallMs == 0;
+    printf("  longest handleWifiConnection(): %u ms simulated, %.1f us host %s\n", longestStallMs, longestCallUs,
+           stallOk ? "ok" : "FAILED");
+    if (!settingsOk) {
+        printf("  SDK auto-reconnect or persistent credentials left on FAILED\n");
+    }
+    failures += !stallOk + !settingsOk;
+    fflush(stdout);
+    return failures;
+}
+
+int main() {
+    world = (World*)mmap(nullptr, sizeof(World), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    world->apUp = true;
+    world->apChannel = 6;
+    hostRtcUserMemory = world->rtc;
+
+    struct Boot {
+        const char* name;
+        bool powerCycle;
+        void (*scenario)();
+    };
+    const Boot boots[] = {
+        { "1. power-on, access point up", true, bootPowerOn },
+        { "2. reset, RTC memory intact", false, bootReset },
+        { "3. power-on, access point down until 45 s", true, bootAccessPointDown },
+    };
+    int total = 0;
+    for (const Boot& boot : boots) {
+        fflush(stdout);
+        pid_t child = fork();
+        if (child == 0) {
+            _exit(runBoot(boot.name, boot.powerCycle, boot.scenario));
+        }
+        int status = 0;
+        waitpid(child, &status, 0);
+        total += WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+    }
+    bool leaseOk = world->staticPastLeaseMs == 0;
+    printf("static address used past its lease: %llu ms %s\n", (unsigned long long)world->staticPastLeaseMs,
+           leaseOk ? "ok" : "FAILED");
+    total += !leaseOk;
+    return total ? 1 : 0;
+}
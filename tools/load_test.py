@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+"""Load test for the device's web API, run from a PC on the same network.
+
+Simulates N dashboards polling /getLiveData and /getScanHistory the way the web
+UI does: each client keeps the last ETag per URL and revalidates with
+If-None-Match, so between scans the device should answer with bodyless 304s
+from its response cache. Reports requests per second, latency percentiles,
+the split of 200/304/error replies and the handler CPU time per request (from
+the device's /metrics) per route.
+
+By default the test runs twice: once against the response cache, and once with
+?nocache=1, which makes the device serialize the JSON afresh for every request
+(as it did before the cache) and without ETag revalidation. --mode picks one.
+
+--slow-clients adds connections that fetch the full scan history and read it
+a few bytes at a time, like a phone on a weak link. With the async server the
+polling dashboards' latency should not move while they are connected.
+
+Usage: python3 tools/load_test.py <device-ip> [--clients 8] [--seconds 60] [--interval 1.0]
+                                  [--slow-clients 0] [--slow-rate 256] [--mode both|cached|uncached]
+
+Only the Python standard library is needed.
+"""
+import argparse
+import http.client
+import re
+import socket
+import threading
+import time
+
+ROUTES = ["/getLiveData", "/getScanHistory"]
+
+
+class Stats:
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.latencies = {route: [] for route in ROUTES}
+        self.codes = {route: {} for route in ROUTES}
+        self.bytes = 0
+        self.slow_transfers = []
+
+    def record(self, route, code, latency, size):
+        with self.lock:
+            self.latencies[route].append(latency)
+            self.codes[route][code] = self.codes[route].get(code, 0) + 1
+            self.bytes += size
+
+
+def percentile(values, fraction):
+    if not values:
+        return 0.0
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(fraction * len(ordered)))]
+
+
+def scrape_handler_cpu(host, port):
+    """Per route: (handler CPU microseconds, requests) so far, from the device's /metrics."""
+    connection = http.client.HTTPConnection(host, port, timeout=10)
+    connection.request("GET", "/metrics")
+    text = connection.getresponse().read().decode()
+    connection.close()
+    totals = {}
+    for route in ROUTES:
+        label = {"/getLiveData": "live_data", "/getScanHistory": "scan_history"}[route]
+        cpu = re.search(r'^http_handler_cpu_microseconds_total\{route="%s"\} (\d+)' % label, text, re.M)
+        requests = re.search(r'^http_requests_total\{route="%s"\} (\d+)' % label, text, re.M)
+        totals[route] = (int(cpu.group(1)) if cpu else 0, int(requests.group(1)) if requests else 0)
+    return totals
+
+
+def poll(host, port, deadline, interval, cached, stats):
+    """One dashboard: a keep-alive-less poll of every route per interval, as the browser does."""
+    etags = {}
+    while time.monotonic() < deadline:
+        cycle_start = time.monotonic()
+        for route in ROUTES:
+            headers = {"Accept": "application/json"}
+            if cached and route in etags:
+                headers["If-None-Match"] = etags[route]
+            start = time.monotonic()
+            try:
+                connection = http.client.HTTPConnection(host, port, timeout=10)
+                connection.request("GET", route if cached else route + "?nocache=1", headers=headers)
+                response = connection.getresponse()
+                body = response.read()
+                code = response.status
+                if response.getheader("ETag"):
+                    etags[route] = response.getheader("ETag")
+                connection.close()
+            except (OSError, http.client.HTTPException) as error:
+                code, body = type(error).__name__, b""
+            stats.record(route, code, time.monotonic() - start, len(body))
+        time.sleep(max(0.0, interval - (time.monotonic() - cycle_start)))
+
+
+def trickle(host, port, deadline, rate, stats):
+    """One slow client: fetch the scan history and read it at `rate` bytes per second."""
+    chunk = max(1, rate // 10)
+    while time.monotonic() < deadline:
+        start = time.monotonic()
+        received = 0
+        try:
+            with socket.create_connection((host, port), timeout=30) as connection:
+                connection.sendall(("GET /getScanHistory HTTP/1.1\r\nHost: %s\r\n"
+                                    "Accept: application/json\r\nConnection: close\r\n\r\n" % host).encode())
+                while True:
+                    data = connection.recv(chunk)
+                    if not data:
+                        break
+                    received += len(data)
+                    time.sleep(0.1)
+        except OSError:
+            pass
+        with stats.lock:
+            stats.slow_transfers.append((received, time.monotonic() - start))
+
+
+def run(args, cached):
+    """One load test run; prints its report."""
+    stats = Stats()
+    before = scrape_handler_cpu(args.host, args.port)
+    deadline = time.monotonic() + args.seconds
+    threads = [threading.Thread(target=poll, args=(args.host, args.port, deadline, args.interval, cached, stats))
+               for _ in range(args.clients)]
+    threads += [threading.Thread(target=trickle, args=(args.host, args.port, deadline, args.slow_rate, stats))
+                for _ in range(args.slow_clients)]
+    start = time.monotonic()
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    elapsed = time.monotonic() - start
+    after = scrape_handler_cpu(args.host, args.port)
+
+    total = sum(len(values) for values in stats.latencies.values())
+    print("%s: %d clients, %.0f s: %d requests (%.1f/s), %d body bytes"
+          % ("cache on" if cached else "cache off (?nocache=1)", args.clients, elapsed, total, total / elapsed,
+             stats.bytes))
+    for route in ROUTES:
+        values = stats.latencies[route]
+        codes = ", ".join("%s: %d" % (code, count) for code, count in sorted(stats.codes[route].items(), key=str))
+        cpu = after[route][0] - before[route][0]
+        handled = after[route][1] - before[route][1]
+        print("%-16s p50 %6.1f ms  p95 %6.1f ms  max %6.1f ms  cpu %7.0f us/request  (%s)"
+              % (route, percentile(values, 0.5) * 1000, percentile(values, 0.95) * 1000,
+                 max(values, default=0) * 1000, cpu / max(handled, 1), codes))
+    if stats.slow_transfers:
+        received = sum(size for size, _ in stats.slow_transfers)
+        longest = max(duration for _, duration in stats.slow_transfers)
+        print("slow clients: %d transfers, %d bytes, longest %.1f s"
+              % (len(stats.slow_transfers), received, longest))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("host", help="device IP address or host name")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--clients", type=int, default=8, help="concurrent dashboards")
+    parser.add_argument("--seconds", type=float, default=60)
+    parser.add_argument("--interval", type=float, default=1.0, help="poll interval per dashboard (s)")
+    parser.add_argument("--slow-clients", type=int, default=0, help="clients that trickle-read the history")
+    parser.add_argument("--slow-rate", type=int, default=256, help="read rate of a slow client (bytes/s)")
+    parser.add_argument("--mode", choices=["both", "cached", "uncached"], default="both",
+                        help="run against the response cache, without it (?nocache=1), or both")
+    args = parser.parse_args()
+
+    if args.mode in ("both", "cached"):
+        run(args, True)
+    if args.mode in ("both", "uncached"):
+        run(args, False)
+
+
+if __name__ == "__main__":
+    main()
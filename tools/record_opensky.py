@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+"""Records OpenSky /states/all responses for a site, for tools/host/replay_deltas.cpp.
+
+Polls the same bounding box the device would query for one site (its Level 3
+radius widened by the exit band) every --interval seconds and appends each
+response, unchanged, as one line of the output file.
+
+Usage: python3 tools/record_opensky.py <latitude> <longitude> [--radius 22] [--interval 10]
+                                       [--count 180] [--out capture.jsonl] [--user U --password P]
+
+Anonymous access is limited to one update per 10 s and a daily credit budget;
+a registered account raises both. Only the Python standard library is needed.
+"""
+import argparse
+import base64
+import math
+import time
+import urllib.request
+
+API_URL = "https://opensky-network.org/api/states/all"
+KM_PER_DEG_LAT = 6371.0 * math.pi / 180.0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("latitude", type=float)
+    parser.add_argument("longitude", type=float)
+    parser.add_argument("--radius", type=float, default=22.0, help="box half-size (km)")
+    parser.add_argument("--interval", type=float, default=10.0, help="seconds between requests")
+    parser.add_argument("--count", type=int, default=180, help="responses to record")
+    parser.add_argument("--out", default="capture.jsonl")
+    parser.add_argument("--user")
+    parser.add_argument("--password")
+    args = parser.parse_args()
+
+    lat_span = args.radius / KM_PER_DEG_LAT
+    lon_span = args.radius / (KM_PER_DEG_LAT * math.cos(math.radians(args.latitude)))
+    url = "%s?lamin=%.4f&lamax=%.4f&lomin=%.4f&lomax=%.4f" % (
+        API_URL, args.latitude - lat_span, args.latitude + lat_span,
+        args.longitude - lon_span, args.longitude + lon_span)
+    headers = {}
+    if args.user:
+        token = base64.b64encode(("%s:%s" % (args.user, args.password or "")).encode()).decode()
+        headers["Authorization"] = "Basic " + token
+
+    with open(args.out, "a") as out:
+        for n in range(args.count):
+            started = time.monotonic()
+            try:
+                with urllib.request.urlopen(urllib.request.Request(url, headers=headers), timeout=20) as reply:
+                    body = reply.read().decode().replace("\n", "")
+                out.write(body + "\n")
+                out.flush()
+                print("%d/%d: %d bytes" % (n + 1, args.count, len(body)))
+            except OSError as error:
+                print("%d/%d: %s" % (n + 1, args.count, error))
+            time.sleep(max(0.0, args.interval - (time.monotonic() - started)))
+
+
+if __name__ == "__main__":
+    main()
@@ -3,13 +3,10 @@
 #define UTILS_H
 
 #include <Arduino.h>
-#include "globals.h" // For AppSettings and timeClient
+#include "globals.h" // For AppSettings and FlightData
 
 // Function declarations
 float degToRad(float deg);
-// --- FIX: Only declaration here ---
-float calculateDistance(float lat1, float lon1, float lat2, float lon2);
-int determineProximityLevel(float distance_km);
-String getTimestamp(); // This seems redundant with getCurrentFormattedTime in flight_scanner.cpp
+void countProximityLevels(const std::vector<FlightData>& flights, int levelCounts[4]);
 
 #endif // UTILS_H
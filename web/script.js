@@ -0,0 +1,1098 @@
+document.addEventListener('DOMContentLoaded', () => {
+    // --- DOM Element References ---
+    const liveDataTabBtn = document.getElementById('liveDataTabBtn');
+    const settingsTabBtn = document.getElementById('settingsTabBtn');
+    const liveDataTabContent = document.getElementById('liveDataTabContent');
+    const settingsTabContent = document.getElementById('settingsTabContent');
+
+    const currentOverallStatus = document.getElementById('currentOverallStatus').querySelector('p');
+    const level1CountCard = document.getElementById('level1CountCard').querySelector('p');
+    const level2CountCard = document.getElementById('level2CountCard').querySelector('p');
+    const level3CountCard = document.getElementById('level3CountCard').querySelector('p');
+    const totalFlightsCard = document.getElementById('totalFlightsCard').querySelector('p');
+    const currentFlightsTableBody = document.getElementById('currentFlightsTable').querySelector('tbody');
+    const scanHistoryTableBody = document.getElementById('scanHistoryTable').querySelector('tbody');
+
+    const saveSettingsBtn = document.getElementById('saveSettingsBtn');
+    const restoreDefaultsBtn = document.getElementById('restoreDefaultsBtn');
+    const rebootEspBtn = document.getElementById('rebootEspBtn');
+    const sitesList = document.getElementById('sitesList');
+    const addSiteBtn = document.getElementById('addSiteBtn');
+    const MAX_EXTRA_SITES = 15; // Matches MAX_EXTRA_SITES on the ESP
+
+    const statusModal = document.getElementById('statusModal');
+    const statusMessageText = document.getElementById('statusMessageText');
+    let statusTimeout; // To clear previous timeouts
+
+    const confirmActionModal = document.getElementById('confirmActionModal');
+    const confirmActionTitle = document.getElementById('confirmActionTitle');
+    const confirmActionMessage = document.getElementById('confirmActionMessage');
+    const confirmActionBtn = document.getElementById('confirmActionBtn');
+    const cancelActionBtn = document.getElementById('cancelActionBtn');
+
+    const scanDetailsModal = document.getElementById('scanDetailsModal');
+    const scanDetailsTableBody = document.getElementById('scanDetailsTableBody');
+    const scanDetailsTitle = document.getElementById('scanDetailsTitle');
+
+    // --- Tab Switching Logic ---
+    liveDataTabBtn.addEventListener('click', () => {
+        liveDataTabBtn.classList.add('active');
+        settingsTabBtn.classList.remove('active');
+        liveDataTabContent.classList.add('active');
+        settingsTabContent.classList.remove('active');
+        fetchLiveData(); // Fetch live data when tab is active
+        fetchScanHistory(); // Fetch scan history when tab is active
+        startLiveUpdates(); // Subscribe to pushed updates (polling as fallback)
+    });
+
+    settingsTabBtn.addEventListener('click', () => {
+        settingsTabBtn.classList.add('active');
+        liveDataTabBtn.classList.remove('active');
+        settingsTabContent.classList.add('active');
+        liveDataTabContent.classList.remove('active');
+        loadSettings(); // Load settings when settings tab is active
+        stopLiveUpdates(); // Stop updates when not on live data tab
+    });
+
+    // --- Status Message Display ---
+    function displayStatus(message, type = 'info', duration = 3000) {
+        clearTimeout(statusTimeout); // Clear any existing timeout
+        statusMessageText.textContent = message;
+        statusModal.className = `modal status-modal ${type}`; // Add type for styling
+        statusModal.style.display = 'block';
+        statusTimeout = setTimeout(() => {
+            statusModal.style.display = 'none';
+        }, duration);
+    }
+
+    // --- Confirmation Modal Logic ---
+    let pendingAction = null;
+
+    function showConfirmModal(title, message, actionCallback) {
+        confirmActionTitle.textContent = title;
+        confirmActionMessage.textContent = message;
+        confirmActionModal.style.display = 'block';
+        pendingAction = actionCallback; // Store the function to be called on confirmation
+    }
+
+    confirmActionBtn.addEventListener('click', () => {
+        confirmActionModal.style.display = 'none';
+        if (pendingAction) {
+            pendingAction();
+            pendingAction = null; // Clear pending action
+        }
+    });
+
+    cancelActionBtn.addEventListener('click', () => {
+        confirmActionModal.style.display = 'none';
+        pendingAction = null; // Clear pending action
+    });
+
+    window.addEventListener('click', (event) => {
+        if (event.target === confirmActionModal) {
+            confirmActionModal.style.display = 'none';
+            pendingAction = null;
+        }
+        if (event.target === scanDetailsModal) {
+            scanDetailsModal.style.display = 'none';
+        }
+        if (event.target === statusModal) {
+            statusModal.style.display = 'none';
+            clearTimeout(statusTimeout);
+        }
+    });
+
+    // --- SETTINGS TAB FUNCTIONS (AJAX/Fetch API Integration) ---
+
+    // Initial settings for UI before fetching from ESP (should match currentSettings defaults or be empty)
+    // NOTE: This DEFAULT_SETTINGS is for UI fallback. Actual defaults are on ESP.
+    const DEFAULT_FORM_SETTINGS = {
+        ssid: "",
+        password: "",
+        apiServer: "http://api.opensky-network.org/api/states/all",
+        apiKey: "",
+        latitude: 15.3582, // Example: Dharwad
+        longitude: 75.0210,
+        radiusLevel1: 30.0, // km
+        radiusLevel2: 50.0,
+        radiusLevel3: 70.0,
+        noFlightScanFreq: 60, // seconds
+        flightPresentScanFreq: 10, // seconds
+        soundWarning: true,
+        sites: [],
+        altitudeCeilingLevel1: 3000, // metres, 0 = no ceiling
+        altitudeCeilingLevel2: 6000,
+        altitudeCeilingLevel3: 0,
+        alarmEntryBandPercent: 0,
+        alarmHysteresisPercent: 10,
+        alarmDwellSec: 30,
+        alarmSounds: [
+            { source: 'tone', startHz: 2000, endHz: 2600, beepMs: 150, gapMs: 80, beeps: 10, volume: 100 },
+            { source: 'tone', startHz: 1200, endHz: 1200, beepMs: 300, gapMs: 300, beeps: 4, volume: 80 },
+            { source: 'tone', startHz: 800, endHz: 800, beepMs: 500, gapMs: 700, beeps: 2, volume: 60 }
+        ]
+    };
+
+    // --- ADDITIONAL MONITORED SITES EDITOR ---
+    function addSiteRow(site) {
+        if (sitesList.children.length >= MAX_EXTRA_SITES) {
+            displayStatus(`At most ${MAX_EXTRA_SITES} additional sites are supported.`, 'error');
+            return;
+        }
+        const row = document.createElement('div');
+        row.className = 'site-row';
+        row.innerHTML = `
+            <input type="text" class="site-name" maxlength="15" placeholder="Name">
+            <input type="number" class="site-lat" step="any" min="-90" max="90" placeholder="Latitude">
+            <input type="number" class="site-lon" step="any" min="-180" max="180" placeholder="Longitude">
+            <input type="number" class="site-r1" step="any" min="0.1" placeholder="L1 km">
+            <input type="number" class="site-r2" step="any" min="0.1" placeholder="L2 km">
+            <input type="number" class="site-r3" step="any" min="0.1" placeholder="L3 km">
+            <select class="site-alarm">
+                <option value="sound">LED + sound</option>
+                <option value="led">LED only</option>
+                <option value="none">No alarm</option>
+            </select>
+            <button type="button" class="remove-site">Remove</button>
+        `;
+        row.querySelector('.site-name').value = site.name || '';
+        row.querySelector('.site-lat').value = site.latitude ?? '';
+        row.querySelector('.site-lon').value = site.longitude ?? '';
+        row.querySelector('.site-r1').value = site.radiusLevel1 ?? '';
+        row.querySelector('.site-r2').value = site.radiusLevel2 ?? '';
+        row.querySelector('.site-r3').value = site.radiusLevel3 ?? '';
+        row.querySelector('.site-alarm').value = site.alarm || 'sound';
+        row.querySelector('.remove-site').addEventListener('click', () => row.remove());
+        sitesList.appendChild(row);
+    }
+
+    function populateSites(sites) {
+        sitesList.innerHTML = '';
+        (sites || []).forEach(addSiteRow);
+    }
+
+    // Reads the site rows; returns null (after flagging the bad row) if any is invalid
+    function collectSites() {
+        const sites = [];
+        for (const row of sitesList.children) {
+            const field = cls => row.querySelector(cls);
+            const site = {
+                name: field('.site-name').value.trim() || `Site ${sites.length + 1}`,
+                latitude: parseFloat(field('.site-lat').value),
+                longitude: parseFloat(field('.site-lon').value),
+                radiusLevel1: parseFloat(field('.site-r1').value),
+                radiusLevel2: parseFloat(field('.site-r2').value),
+                radiusLevel3: parseFloat(field('.site-r3').value),
+                alarm: field('.site-alarm').value
+            };
+            const valid = !isNaN(site.latitude) && Math.abs(site.latitude) <= 90 &&
+                          !isNaN(site.longitude) && Math.abs(site.longitude) <= 180 &&
+                          site.radiusLevel1 > 0 && site.radiusLevel2 > site.radiusLevel1 && site.radiusLevel3 > site.radiusLevel2;
+            row.querySelectorAll('input').forEach(input => input.classList.toggle('invalid', !valid));
+            if (!valid) {
+                displayStatus(`Invalid site "${site.name}": check coordinates and radii (L1 < L2 < L3).`, 'error');
+                return null;
+            }
+            sites.push(site);
+        }
+        return sites;
+    }
+
+    addSiteBtn.addEventListener('click', () => addSiteRow({}));
+
+    // --- POLYGON ZONES (GeoJSON -> compact binary, see geofence.h on the ESP) ---
+    const zonesFile = document.getElementById('zonesFile');
+    const zonesList = document.getElementById('zonesList');
+    const MAX_ZONES = 8;          // Matches MAX_GEOFENCE_ZONES
+    const MAX_ZONE_VERTICES = 512; // Matches MAX_GEOFENCE_VERTICES
+
+    // Turns a GeoJSON FeatureCollection (or single Feature) into zones of closed rings
+    function geoJsonToZones(geoJson) {
+        const features = geoJson.type === 'FeatureCollection' ? geoJson.features : [geoJson];
+        const zones = [];
+        features.forEach((feature, i) => {
+            const geometry = feature.geometry || {};
+            const polygons = geometry.type === 'Polygon' ? [geometry.coordinates]
+                           : geometry.type === 'MultiPolygon' ? geometry.coordinates : null;
+            if (!polygons) { return; } // Points, lines etc. are ignored
+            const props = feature.properties || {};
+            const rings = [];
+            polygons.forEach(polygon => polygon.forEach(ring => {
+                const points = ring.map(([lon, lat]) => [lat, lon]); // GeoJSON order is lon, lat
+                const first = points[0], last = points[points.length - 1];
+                if (first[0] !== last[0] || first[1] !== last[1]) { points.push(first); }
+                rings.push(points);
+            }));
+            zones.push({ name: String(props.name || `Zone ${i + 1}`).slice(0, 31), level: parseInt(props.level || 1), rings });
+        });
+        return zones;
+    }
+
+    function encodeZones(zones) {
+        const nameBytes = zones.map(zone => new TextEncoder().encode(zone.name));
+        let size = 8;
+        zones.forEach((zone, i) => {
+            size += 4 + nameBytes[i].length;
+            zone.rings.forEach(ring => { size += 2 + ring.length * 8; });
+        });
+        const view = new DataView(new ArrayBuffer(size));
+        let pos = 0;
+        [0x46, 0x5A, 0x4E, 0x31].forEach(b => view.setUint8(pos++, b)); // "FZN1"
+        view.setUint16(pos, zones.length, true); pos += 4;
+        zones.forEach((zone, i) => {
+            view.setUint8(pos++, zone.level);
+            view.setUint8(pos++, nameBytes[i].length);
+            view.setUint16(pos, zone.rings.length, true); pos += 2;
+            nameBytes[i].forEach(b => view.setUint8(pos++, b));
+            zone.rings.forEach(ring => {
+                view.setUint16(pos, ring.length, true); pos += 2;
+                ring.forEach(([lat, lon]) => {
+                    view.setFloat32(pos, lat, true); pos += 4;
+                    view.setFloat32(pos, lon, true); pos += 4;
+                });
+            });
+        });
+        return view.buffer;
+    }
+
+    function uploadZones(zones) {
+        displayStatus("Uploading zones...", 'info');
+        fetch('/uploadZones', { method: 'POST', headers: { 'Content-Type': 'application/octet-stream' }, body: encodeZones(zones) })
+            .then(response => response.text().then(text => {
+                if (!response.ok) { throw new Error(text); }
+                displayStatus("Zones applied: " + text, 'success', 5000);
+                loadZones();
+            }))
+            .catch(error => displayStatus("Zone upload failed: " + error.message, 'error', 6000));
+    }
+
+    function loadZones() {
+        fetch('/getZones')
+            .then(response => response.json())
+            .then(zones => {
+                zonesList.innerHTML = zones.length === 0 ? '<li>No polygon zones.</li>' : '';
+                zones.forEach(zone => {
+                    const item = document.createElement('li');
+                    item.textContent = `${zone.name}: Level ${zone.level}, ${zone.vertices} vertices`;
+                    zonesList.appendChild(item);
+                });
+            })
+            .catch(error => console.error("Error loading zones:", error));
+    }
+
+    document.getElementById('uploadZonesBtn').addEventListener('click', () => {
+        const file = zonesFile.files[0];
+        if (!file) { displayStatus("Choose a GeoJSON file first.", 'error'); return; }
+        file.text().then(text => {
+            const zones = geoJsonToZones(JSON.parse(text));
+            const vertices = zones.reduce((n, zone) => n + zone.rings.reduce((m, ring) => m + ring.length, 0), 0);
+            if (zones.length === 0) { throw new Error("no Polygon or MultiPolygon features found"); }
+            if (zones.length > MAX_ZONES) { throw new Error(`at most ${MAX_ZONES} zones are supported`); }
+            if (vertices > MAX_ZONE_VERTICES) { throw new Error(`${vertices} vertices, at most ${MAX_ZONE_VERTICES} are supported`); }
+            if (zones.some(zone => !(zone.level >= 1 && zone.level <= 3))) { throw new Error("properties.level must be 1, 2 or 3"); }
+            uploadZones(zones);
+        }).catch(error => displayStatus("Invalid GeoJSON: " + error.message, 'error', 6000));
+    });
+
+    document.getElementById('clearZonesBtn').addEventListener('click', () => {
+        showConfirmModal("Confirm Clear Zones", "Remove all polygon zones?", () => uploadZones([]));
+    });
+
+    // --- ALARM SOUNDS: tone pattern or clip per level (see AlarmSound on the ESP) ---
+    const soundsList = document.getElementById('soundsList');
+    for (let level = 1; level <= 3; level++) {
+        const row = document.createElement('div');
+        row.className = 'site-row';
+        row.innerHTML = `
+            <label>Level ${level}</label>
+            <select class="sound-source">
+                <option value="tone">Beep pattern</option>
+                <option value="clip">Sound clip</option>
+            </select>
+            <input type="number" class="sound-start" min="100" max="3800" title="Start frequency (Hz)" placeholder="Start Hz">
+            <input type="number" class="sound-end" min="100" max="3800" title="End frequency (Hz)" placeholder="End Hz">
+            <input type="number" class="sound-beep" min="20" max="2000" title="Beep length (ms)" placeholder="Beep ms">
+            <input type="number" class="sound-gap" min="0" max="2000" title="Gap between beeps (ms)" placeholder="Gap ms">
+            <input type="number" class="sound-beeps" min="1" max="20" title="Number of beeps" placeholder="Beeps">
+            <input type="number" class="sound-volume" min="0" max="100" title="Volume (%)" placeholder="Vol %">
+        `;
+        const toneInputs = row.querySelectorAll('input');
+        row.querySelector('.sound-source').addEventListener('change', event => {
+            toneInputs.forEach(input => { input.disabled = event.target.value !== 'tone'; });
+        });
+        soundsList.appendChild(row);
+    }
+
+    function populateSounds(sounds) {
+        (sounds || []).forEach((sound, i) => {
+            const row = soundsList.children[i];
+            if (!row) { return; }
+            row.querySelector('.sound-source').value = sound.source || 'tone';
+            row.querySelector('.sound-start').value = sound.startHz;
+            row.querySelector('.sound-end').value = sound.endHz;
+            row.querySelector('.sound-beep').value = sound.beepMs;
+            row.querySelector('.sound-gap').value = sound.gapMs;
+            row.querySelector('.sound-beeps').value = sound.beeps;
+            row.querySelector('.sound-volume').value = sound.volume;
+            row.querySelectorAll('input').forEach(input => { input.disabled = sound.source === 'clip'; });
+        });
+    }
+
+    function collectSounds() {
+        return Array.from(soundsList.children).map(row => ({
+            source: row.querySelector('.sound-source').value,
+            startHz: parseInt(row.querySelector('.sound-start').value),
+            endHz: parseInt(row.querySelector('.sound-end').value),
+            beepMs: parseInt(row.querySelector('.sound-beep').value),
+            gapMs: parseInt(row.querySelector('.sound-gap').value),
+            beeps: parseInt(row.querySelector('.sound-beeps').value),
+            volume: parseInt(row.querySelector('.sound-volume').value)
+        }));
+    }
+
+    // --- SOUND CLIPS (any audio file -> 8 kHz IMA-ADPCM, see clip_player.h on the ESP) ---
+    const clipsList = document.getElementById('clipsList');
+    const CLIP_SAMPLE_RATE = 8000;  // Matches AUDIO_SAMPLE_RATE
+    const MAX_CLIP_SECONDS = 16;    // Matches MAX_CLIP_SAMPLES
+    const IMA_STEPS = [7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66,
+        73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544,
+        598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+        3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818,
+        18500, 20350, 22385, 24623, 27086, 29794, 32767];
+    const IMA_INDEX = [-1, -1, -1, -1, 2, 4, 6, 8];
+
+    // Decodes an audio file and resamples it to mono 8 kHz, normalised to 90% of full scale
+    function fileToClipSamples(file) {
+        const AudioCtx = window.AudioContext || window.webkitAudioContext;
+        const context = new AudioCtx();
+        return file.arrayBuffer()
+            .then(data => context.decodeAudioData(data))
+            .then(buffer => {
+                context.close();
+                const length = Math.ceil(buffer.duration * CLIP_SAMPLE_RATE);
+                if (length > MAX_CLIP_SECONDS * CLIP_SAMPLE_RATE) { throw new Error(`longer than ${MAX_CLIP_SECONDS} seconds`); }
+                const offline = new OfflineAudioContext(1, length, CLIP_SAMPLE_RATE);
+                const source = offline.createBufferSource();
+                source.buffer = buffer;
+                source.connect(offline.destination);
+                source.start();
+                return offline.startRendering();
+            })
+            .then(rendered => {
+                const samples = rendered.getChannelData(0);
+                const peak = samples.reduce((max, s) => Math.max(max, Math.abs(s)), 0) || 1;
+                return samples.map(s => s * 0.9 / peak);
+            });
+    }
+
+    // Header ("FAC1", sample count) plus 4-bit IMA-ADPCM, low nibble first
+    function encodeClip(samples) {
+        const view = new DataView(new ArrayBuffer(8 + Math.ceil(samples.length / 2)));
+        [0x46, 0x41, 0x43, 0x31].forEach((b, i) => view.setUint8(i, b)); // "FAC1"
+        view.setUint32(4, samples.length, true);
+        let predictor = 0, index = 0;
+        samples.forEach((s, n) => {
+            const target = Math.round(s * 32767);
+            let best = null;
+            for (let code = 0; code < 16; code++) { // Same decoder step as imaDecode() on the ESP
+                const step = IMA_STEPS[index];
+                let diff = step >> 3;
+                if (code & 1) { diff += step >> 2; }
+                if (code & 2) { diff += step >> 1; }
+                if (code & 4) { diff += step; }
+                const p = Math.max(-32768, Math.min(32767, code & 8 ? predictor - diff : predictor + diff));
+                if (!best || Math.abs(p - target) < best.err) { best = { err: Math.abs(p - target), code, p }; }
+            }
+            predictor = best.p;
+            index = Math.max(0, Math.min(88, index + IMA_INDEX[best.code & 7]));
+            const pos = 8 + (n >> 1);
+            view.setUint8(pos, view.getUint8(pos) | (n & 1 ? best.code << 4 : best.code));
+        });
+        return view.buffer;
+    }
+
+    function clipRequest(url, okMessage) {
+        return fetch(url, { method: 'POST' })
+            .then(response => response.text().then(text => {
+                if (!response.ok) { throw new Error(text); }
+                if (okMessage) { displayStatus(okMessage, 'success'); }
+                loadClips();
+            }))
+            .catch(error => displayStatus(error.message, 'error', 6000));
+    }
+
+    function loadClips() {
+        fetch('/getClips')
+            .then(response => response.json())
+            .then(clips => {
+                clipsList.innerHTML = '';
+                clips.forEach(clip => {
+                    const row = document.createElement('div');
+                    row.className = 'form-group site-row';
+                    row.innerHTML = `
+                        <label>Level ${clip.level}: ${clip.custom ? `uploaded sound (${clip.seconds.toFixed(1)} s)` : 'built-in sound'}</label>
+                        <input type="file" accept="audio/*">
+                        <div class="button-group site-add">
+                            <button type="button" class="default clip-upload">Upload</button>
+                            <button type="button" class="default clip-play">Play</button>
+                            <button type="button" class="default clip-restore"${clip.custom ? '' : ' disabled'}>Restore Built-in</button>
+                        </div>`;
+                    row.querySelector('.clip-upload').addEventListener('click', () => {
+                        const file = row.querySelector('input[type=file]').files[0];
+                        if (!file) { displayStatus("Choose an audio file first.", 'error'); return; }
+                        displayStatus("Converting sound...", 'info');
+                        fileToClipSamples(file)
+                            .then(samples => {
+                                displayStatus("Uploading sound...", 'info');
+                                return fetch(`/uploadClip?level=${clip.level}`, { method: 'POST', headers: { 'Content-Type': 'application/octet-stream' }, body: encodeClip(samples) });
+                            })
+                            .then(response => response.text().then(text => {
+                                if (!response.ok) { throw new Error(text); }
+                                displayStatus(text, 'success', 5000);
+                                loadClips();
+                            }))
+                            .catch(error => displayStatus("Sound upload failed: " + error.message, 'error', 6000));
+                    });
+                    row.querySelector('.clip-play').addEventListener('click', () => clipRequest(`/playClip?level=${clip.level}`));
+                    row.querySelector('.clip-restore').addEventListener('click', () => clipRequest(`/deleteClip?level=${clip.level}`, "Built-in sound restored."));
+                    clipsList.appendChild(row);
+                });
+            })
+            .catch(error => console.error("Error loading clips:", error));
+    }
+
+    // --- ANNOUNCEMENT WORDS (one clip per word, see announcer.h on the ESP) ---
+    const voiceUnitsStatus = document.getElementById('voiceUnitsStatus');
+
+    // Drops leading and trailing near-silence, so concatenated words run together
+    function trimSilence(samples) {
+        const loud = s => Math.abs(s) > 0.02;
+        const start = samples.findIndex(loud);
+        if (start < 0) { return samples; }
+        let end = samples.length;
+        while (!loud(samples[end - 1])) { end--; }
+        return samples.slice(start, end);
+    }
+
+    function loadVoiceUnits() {
+        fetch('/getVoiceUnits')
+            .then(response => response.json())
+            .then(units => {
+                const missing = units.filter(unit => !unit.installed).map(unit => unit.name);
+                voiceUnitsStatus.textContent = `${units.length - missing.length} of ${units.length} words uploaded.` +
+                    (missing.length ? ` Missing: ${missing.join(', ')}.` : '');
+            })
+            .catch(error => console.error("Error loading announcement words:", error));
+    }
+
+    document.getElementById('uploadVoiceUnitsBtn').addEventListener('click', () => {
+        const files = Array.from(document.getElementById('voiceUnitFiles').files);
+        if (files.length === 0) { displayStatus("Choose one or more word recordings first.", 'error'); return; }
+        let stored = 0;
+        files.reduce((previous, file) => previous.then(() => {
+            const word = file.name.replace(/\.[^.]*$/, '').toLowerCase();
+            displayStatus(`Uploading "${word}" (${stored + 1} of ${files.length})...`, 'info');
+            return fileToClipSamples(file)
+                .then(samples => fetch(`/uploadClip?unit=${encodeURIComponent(word)}`, { method: 'POST', headers: { 'Content-Type': 'application/octet-stream' }, body: encodeClip(trimSilence(samples)) }))
+                .then(response => response.text().then(text => {
+                    if (!response.ok) { throw new Error(`${word}: ${text}`); }
+                    stored++;
+                }));
+        }), Promise.resolve())
+            .then(() => displayStatus(`${stored} word(s) uploaded.`, 'success', 5000))
+            .catch(error => displayStatus("Word upload failed: " + error.message, 'error', 6000))
+            .then(loadVoiceUnits);
+    });
+
+    // Populate form with default JS values if loading from ESP fails
+    function populateFormWithDefaults() {
+        document.getElementById('ssid').value = DEFAULT_FORM_SETTINGS.ssid;
+        document.getElementById('password').value = DEFAULT_FORM_SETTINGS.password;
+        document.getElementById('apiServer').value = DEFAULT_FORM_SETTINGS.apiServer;
+        document.getElementById('apiKey').value = DEFAULT_FORM_SETTINGS.apiKey;
+        document.getElementById('latitude').value = DEFAULT_FORM_SETTINGS.latitude;
+        document.getElementById('longitude').value = DEFAULT_FORM_SETTINGS.longitude;
+        document.getElementById('radiusLevel1').value = DEFAULT_FORM_SETTINGS.radiusLevel1;
+        document.getElementById('radiusLevel2').value = DEFAULT_FORM_SETTINGS.radiusLevel2;
+        document.getElementById('radiusLevel3').value = DEFAULT_FORM_SETTINGS.radiusLevel3;
+        document.getElementById('noFlightScanFreq').value = DEFAULT_FORM_SETTINGS.noFlightScanFreq;
+        document.getElementById('flightPresentScanFreq').value = DEFAULT_FORM_SETTINGS.flightPresentScanFreq;
+        document.getElementById('soundWarning').checked = DEFAULT_FORM_SETTINGS.soundWarning;
+        document.getElementById('altitudeCeilingLevel1').value = DEFAULT_FORM_SETTINGS.altitudeCeilingLevel1;
+        document.getElementById('altitudeCeilingLevel2').value = DEFAULT_FORM_SETTINGS.altitudeCeilingLevel2;
+        document.getElementById('altitudeCeilingLevel3').value = DEFAULT_FORM_SETTINGS.altitudeCeilingLevel3;
+        document.getElementById('alarmEntryBandPercent').value = DEFAULT_FORM_SETTINGS.alarmEntryBandPercent;
+        document.getElementById('alarmHysteresisPercent').value = DEFAULT_FORM_SETTINGS.alarmHysteresisPercent;
+        document.getElementById('alarmDwellSec').value = DEFAULT_FORM_SETTINGS.alarmDwellSec;
+        populateSites(DEFAULT_FORM_SETTINGS.sites);
+        populateSounds(DEFAULT_FORM_SETTINGS.alarmSounds);
+        displayStatus("Loaded default UI values.", 'info', 3000);
+    }
+
+    // --- FETCH SETTINGS FROM ESP8266 ---
+    function loadSettings() {
+        displayStatus("Loading settings from ESP...", 'info');
+        fetch('/getSettings')
+            .then(response => {
+                if (!response.ok) {
+                    throw new Error(`HTTP error! status: ${response.status}`);
+                }
+                return response.json();
+            })
+            .then(data => {
+                // Populate form fields with data from ESP8266
+                document.getElementById('ssid').value = data.ssid || '';
+                document.getElementById('password').value = data.password || '';
+                document.getElementById('apiServer').value = data.apiServer || '';
+                document.getElementById('apiKey').value = data.apiKey || '';
+                document.getElementById('latitude').value = data.latitude || 0;
+                document.getElementById('longitude').value = data.longitude || 0;
+                document.getElementById('radiusLevel1').value = data.radiusLevel1 || 0;
+                document.getElementById('radiusLevel2').value = data.radiusLevel2 || 0;
+                document.getElementById('radiusLevel3').value = data.radiusLevel3 || 0;
+                document.getElementById('noFlightScanFreq').value = data.noFlightScanFreq || 0;
+                document.getElementById('flightPresentScanFreq').value = data.flightPresentScanFreq || 0;
+                document.getElementById('soundWarning').checked = data.soundWarning || false;
+                document.getElementById('altitudeCeilingLevel1').value = data.altitudeCeilingLevel1 || 0;
+                document.getElementById('altitudeCeilingLevel2').value = data.altitudeCeilingLevel2 || 0;
+                document.getElementById('altitudeCeilingLevel3').value = data.altitudeCeilingLevel3 || 0;
+                document.getElementById('alarmEntryBandPercent').value = data.alarmEntryBandPercent || 0;
+                document.getElementById('alarmHysteresisPercent').value = data.alarmHysteresisPercent || 0;
+                document.getElementById('alarmDwellSec').value = data.alarmDwellSec || 0;
+                populateSites(data.sites);
+                populateSounds(data.alarmSounds);
+                loadZones();
+                loadClips();
+                loadVoiceUnits();
+
+                displayStatus("Settings loaded successfully!", 'success');
+            })
+            .catch(error => {
+                console.error("Error loading settings:", error);
+                displayStatus("Failed to load settings: " + error.message, 'error', 5000);
+                // Fallback to default UI if fetch fails
+                populateFormWithDefaults();
+            });
+    }
+
+    // --- SAVE SETTINGS TO ESP8266 ---
+    saveSettingsBtn.addEventListener('click', (event) => {
+        event.preventDefault(); // Prevent default form submission
+        // Basic validation (can be expanded)
+        const latitude = parseFloat(document.getElementById('latitude').value);
+        const longitude = parseFloat(document.getElementById('longitude').value);
+        const radius1 = parseFloat(document.getElementById('radiusLevel1').value);
+        const radius2 = parseFloat(document.getElementById('radiusLevel2').value);
+        const radius3 = parseFloat(document.getElementById('radiusLevel3').value);
+
+        if (isNaN(latitude) || latitude < -90 || latitude > 90) { displayStatus("Invalid Latitude!", 'error'); return; }
+        if (isNaN(longitude) || longitude < -180 || longitude > 180) { displayStatus("Invalid Longitude!", 'error'); return; }
+        if (isNaN(radius1) || radius1 < 1) { displayStatus("Invalid Level 1 Radius!", 'error'); return; }
+        if (isNaN(radius2) || radius2 < 1 || radius2 <= radius1) { displayStatus("Invalid Level 2 Radius! Must be > Level 1.", 'error'); return; }
+        if (isNaN(radius3) || radius3 < 1 || radius3 <= radius2) { displayStatus("Invalid Level 3 Radius! Must be > Level 2.", 'error'); return; }
+        const sites = collectSites();
+        if (sites === null) { return; }
+        
+        const settings = {
+            ssid: document.getElementById('ssid').value,
+            password: document.getElementById('password').value,
+            apiServer: document.getElementById('apiServer').value, // This will always send "opensky" if using select
+            apiKey: document.getElementById('apiKey').value,
+            latitude: latitude,
+            longitude: longitude,
+            radiusLevel1: radius1,
+            radiusLevel2: radius2,
+            radiusLevel3: radius3,
+            noFlightScanFreq: parseInt(document.getElementById('noFlightScanFreq').value),
+            flightPresentScanFreq: parseInt(document.getElementById('flightPresentScanFreq').value),
+            soundWarning: document.getElementById('soundWarning').checked,
+            sites: sites,
+            alarmSounds: collectSounds(),
+            altitudeCeilingLevel1: parseFloat(document.getElementById('altitudeCeilingLevel1').value) || 0,
+            altitudeCeilingLevel2: parseFloat(document.getElementById('altitudeCeilingLevel2').value) || 0,
+            altitudeCeilingLevel3: parseFloat(document.getElementById('altitudeCeilingLevel3').value) || 0,
+            alarmEntryBandPercent: parseFloat(document.getElementById('alarmEntryBandPercent').value) || 0,
+            alarmHysteresisPercent: parseFloat(document.getElementById('alarmHysteresisPercent').value) || 0,
+            alarmDwellSec: parseInt(document.getElementById('alarmDwellSec').value) || 0
+        };
+
+        displayStatus("Saving settings...", 'info');
+        fetch('/saveSettings', {
+            method: 'POST',
+            headers: {
+                'Content-Type': 'application/json'
+            },
+            body: JSON.stringify(settings)
+        })
+        .then(response => {
+            if (!response.ok) {
+                throw new Error(`HTTP error! status: ${response.status}`);
+            }
+            return response.text();
+        })
+        .then(data => {
+            displayStatus("Settings saved: " + data, 'success', 5000);
+        })
+        .catch(error => {
+            console.error("Error saving settings:", error);
+            displayStatus("Failed to save settings: " + error.message, 'error', 5000);
+        });
+    });
+
+    // --- RESTORE DEFAULTS ON ESP8266 ---
+    restoreDefaultsBtn.addEventListener('click', () => {
+        showConfirmModal(
+            "Confirm Restore Defaults",
+            "Are you sure you want to restore default settings? They take effect immediately.",
+            performRestoreDefaults
+        );
+    });
+
+    function performRestoreDefaults() {
+        displayStatus("Sending restore defaults request...", 'info');
+        fetch('/restoreDefaults')
+            .then(response => {
+                if (!response.ok) {
+                    throw new Error(`HTTP error! status: ${response.status}`);
+                }
+                return response.text();
+            })
+            .then(data => {
+                displayStatus("Defaults restored on ESP: " + data, 'success', 6000);
+                loadSettings(); // Fetch the newly restored defaults to update UI
+            })
+            .catch(error => {
+                console.error("Error restoring defaults:", error);
+                displayStatus("Failed to restore defaults: " + error.message, 'error', 5000);
+            });
+    }
+
+    // --- REBOOT ESP8266 ---
+    rebootEspBtn.addEventListener('click', () => {
+        showConfirmModal(
+            "Confirm Reboot ESP",
+            "Are you sure you want to reboot the ESP8266? The device will become temporarily unavailable.",
+            performRebootEsp
+        );
+    });
+
+    function performRebootEsp() {
+        displayStatus("Sending reboot command...", 'info');
+        fetch('/rebootESP')
+            .then(response => {
+                if (!response.ok) {
+                    throw new Error(`HTTP error! status: ${response.status}`);
+                }
+                return response.text();
+            })
+            .then(data => {
+                displayStatus("ESP is rebooting... Page will disconnect. " + data, 'success', 10000);
+                setTimeout(() => {
+                    window.location.reload(); // Attempt to reload after a delay
+                }, 7000); // Give ESP time to reboot (adjust if needed)
+            })
+            .catch(error => {
+                console.error("Error rebooting ESP:", error);
+                displayStatus("Failed to reboot ESP: " + error.message, 'error', 5000);
+            });
+    }
+
+    // --- LIVE DATA TAB FUNCTIONS (AJAX/Fetch API Integration) ---
+
+    let liveDataInterval; // Variable to hold the interval timer
+
+    function startLiveDataUpdateInterval() {
+        if (!liveDataInterval) { // Prevent multiple intervals
+            // Poll every 5 seconds. The ESP answers with an ETag, so polls between
+            // scans are revalidated by the browser and come back as 304 with no body.
+            liveDataInterval = setInterval(() => {
+                fetchLiveData();
+                fetchScanHistory();
+            }, 5000);
+        }
+    }
+
+    function stopLiveDataUpdateInterval() {
+        if (liveDataInterval) {
+            clearInterval(liveDataInterval);
+            liveDataInterval = null;
+        }
+    }
+
+    // --- Server-Sent Events (/events) ---
+    // The ESP pushes a small "scan" event after every scan and an "alarm" event on
+    // every alarm-level change. Polling is only used while the stream is down.
+    let eventSource = null;
+
+    function startLiveUpdates() {
+        if (!window.EventSource) {
+            startLiveDataUpdateInterval();
+            return;
+        }
+        if (eventSource) return;
+
+        eventSource = new EventSource('/events');
+        eventSource.onopen = () => {
+            stopLiveDataUpdateInterval();
+        };
+        eventSource.onerror = () => {
+            // EventSource reconnects by itself; keep the dashboard fresh meanwhile
+            startLiveDataUpdateInterval();
+            if (eventSource.readyState === EventSource.CLOSED) {
+                // Refused (e.g. all stream slots busy): poll, and try again later
+                eventSource = null;
+                setTimeout(() => {
+                    if (liveDataTabContent.classList.contains('active')) startLiveUpdates();
+                }, 30000);
+            }
+        };
+        eventSource.addEventListener('scan', (event) => {
+            const update = JSON.parse(event.data);
+            if (update.resync || update.since !== lastSeq) {
+                fetchLiveData(); // Missed an update: catch up over HTTP
+            } else {
+                applyLiveUpdate(update);
+            }
+            fetchScanHistory();
+        });
+        eventSource.addEventListener('alarm', (event) => {
+            const alarm = JSON.parse(event.data);
+            currentOverallStatus.className = `status-card-text ${getOverallStatusClass(alarm.level)}`;
+        });
+    }
+
+    function stopLiveUpdates() {
+        if (eventSource) {
+            eventSource.close();
+            eventSource = null;
+        }
+        stopLiveDataUpdateInterval();
+    }
+
+    // Flights known to the page, keyed by icao24, and the scan sequence they reflect.
+    // Updates carry only the aircraft added/changed ("upserts") and removed since lastSeq.
+    const liveFlights = new Map();
+    let lastSeq = 0;
+
+    function applyLiveUpdate(data) {
+        if (data.full) {
+            liveFlights.clear();
+            (data.currentFlights || []).forEach(flight => liveFlights.set(flight.icao24, flight));
+        } else {
+            // Removals first: an aircraft that left and came back is listed as an upsert
+            (data.removed || []).forEach(icao24 => liveFlights.delete(icao24));
+            (data.upserts || []).forEach(flight => liveFlights.set(flight.icao24, flight));
+        }
+        lastSeq = data.seq;
+        data.currentFlights = Array.from(liveFlights.values());
+        updateLiveDataUI(data);
+    }
+
+    // --- Compact binary (CBOR) responses ---
+    // Live data and history are requested as CBOR: flights arrive as rows of
+    // fixed-point integers plus a schema/scale sent once per response, and are
+    // expanded back into the same objects the JSON endpoints return.
+    const API_FETCH_OPTIONS = { cache: 'no-cache', headers: { 'Accept': 'application/cbor, application/json' } };
+
+    function decodeCbor(buffer) {
+        const view = new DataView(buffer);
+        const utf8 = new TextDecoder();
+        let offset = 0;
+
+        function readArgument(info) {
+            if (info < 24) return info;
+            if (info === 24) { offset += 1; return view.getUint8(offset - 1); }
+            if (info === 25) { offset += 2; return view.getUint16(offset - 2); }
+            if (info === 26) { offset += 4; return view.getUint32(offset - 4); }
+            throw new Error(`Unsupported CBOR argument size: ${info}`);
+        }
+
+        function readItem() {
+            const initial = view.getUint8(offset++);
+            const major = initial >> 5;
+            const info = initial & 0x1f;
+            switch (major) {
+                case 0: return readArgument(info);
+                case 1: return -1 - readArgument(info);
+                case 3: {
+                    const length = readArgument(info);
+                    const text = utf8.decode(new Uint8Array(buffer, offset, length));
+                    offset += length;
+                    return text;
+                }
+                case 4: {
+                    const items = new Array(readArgument(info));
+                    for (let i = 0; i < items.length; i++) items[i] = readItem();
+                    return items;
+                }
+                case 5: {
+                    const map = {};
+                    const count = readArgument(info);
+                    for (let i = 0; i < count; i++) {
+                        const key = readItem();
+                        map[key] = readItem();
+                    }
+                    return map;
+                }
+                case 7:
+                    if (info === 20) return false;
+                    if (info === 21) return true;
+                    if (info === 22) return null;
+                    break;
+            }
+            throw new Error(`Unsupported CBOR item: major ${major}, info ${info}`);
+        }
+
+        return readItem();
+    }
+
+    // Turn schema rows back into flight objects (scale 0 = string column)
+    function expandFlightRows(rows, schema, scale) {
+        return (rows || []).map(row => {
+            const flight = {};
+            schema.forEach((name, i) => {
+                flight[name] = scale[i] ? row[i] / scale[i] : row[i];
+            });
+            return flight;
+        });
+    }
+
+    function readApiResponse(response) {
+        if (!response.ok) {
+            throw new Error(`HTTP error! status: ${response.status}`);
+        }
+        const contentType = response.headers.get('Content-Type') || '';
+        if (!contentType.includes('application/cbor')) {
+            return response.json();
+        }
+        return response.arrayBuffer().then(buffer => {
+            const data = decodeCbor(buffer);
+            if (data.history) {
+                return data.history.map(entry => {
+                    entry.flights_at_scan = expandFlightRows(entry.flights_at_scan, data.schema, data.scale);
+                    return entry;
+                });
+            }
+            data.currentFlights = expandFlightRows(data.currentFlights, data.schema, data.scale);
+            return data;
+        });
+    }
+
+    // Fetch live flight data from ESP8266 (a delta once we hold a snapshot)
+    function fetchLiveData() {
+        // console.log("Fetching live data...");
+        const url = lastSeq > 0 ? `/getLiveData?since=${lastSeq}` : '/getLiveData';
+        fetch(url, API_FETCH_OPTIONS)
+            .then(readApiResponse)
+            .then(data => {
+                applyLiveUpdate(data);
+            })
+            .catch(error => {
+                console.error("Error fetching live data:", error);
+                // displayStatus("Failed to get live data: " + error.message, 'error', 3000); // Don't spam status
+            });
+    }
+
+    // Update the UI with fetched live data
+    function updateLiveDataUI(data) {
+        currentOverallStatus.textContent = data.overallStatus || "ALL CLEAR";
+        updateStatusCards(data.overallLevel, data.level1Count, data.level2Count, data.level3Count, data.totalFlights);
+
+        currentFlightsTableBody.innerHTML = ''; // Clear previous entries
+        if (data.currentFlights && data.currentFlights.length > 0) {
+            data.currentFlights.forEach(flight => {
+                const row = currentFlightsTableBody.insertRow();
+                row.className = `proximity-level-${flight.proximity_level}`; // Apply class for styling
+                row.innerHTML = `
+                    <td>${flight.icao24}</td>
+                    <td>${flight.callsign || 'N/A'}</td>
+                    <td>${Math.round(flight.altitude_baro)}</td>
+                    <td>${Math.round(flight.velocity * 3.6)}</td> <td>${getDirectionArrow(flight.true_track)} ${Math.round(flight.true_track)}°</td>
+                    <td>${flight.origin_country || 'N/A'} &rarr; N/A</td>
+                    <td>Level ${flight.proximity_level}${siteLabel(flight)}</td>
+                    <td>${flight.distance_km.toFixed(2)}</td>
+                `;
+            });
+        } else {
+            currentFlightsTableBody.innerHTML = '<tr class="no-data"><td colspan="8">No flights currently detected within monitoring radius.</td></tr>';
+        }
+    }
+
+    // Update the status class and per-level count cards
+    function updateStatusCards(level, level1Count, level2Count, level3Count, totalFlights) {
+        currentOverallStatus.className = `status-card-text ${getOverallStatusClass(level)}`;
+        level1CountCard.textContent = `${level1Count} Flights`;
+        level2CountCard.textContent = `${level2Count} Flights`;
+        level3CountCard.textContent = `${level3Count} Flights`;
+        totalFlightsCard.textContent = `${totalFlights} Flights`;
+    }
+
+    // Helper for overall status class
+    function getOverallStatusClass(level) {
+        switch (level) {
+            case 1: return 'level-1-alarm';
+            case 2: return 'level-2-warning';
+            case 3: return 'level-3-detection';
+            default: return 'all-clear';
+        }
+    }
+
+
+    // Fetch scan history from ESP8266
+    function fetchScanHistory() {
+        // console.log("Fetching scan history...");
+        fetch('/getScanHistory', API_FETCH_OPTIONS)
+            .then(readApiResponse)
+            .then(data => {
+                updateScanHistoryUI(data);
+            })
+            .catch(error => {
+                console.error("Error fetching scan history:", error);
+                // displayStatus("Failed to get scan history: " + error.message, 'error', 3000); // Don't spam status
+            });
+    }
+
+    // History timestamps are UTC epoch seconds; 0 means the device clock was not set yet
+    function formatTimestamp(ts) {
+        return ts ? new Date(ts * 1000).toLocaleString() : 'Clock not set';
+    }
+
+    // Update the UI with fetched scan history
+    function updateScanHistoryUI(history) {
+        scanHistoryTableBody.innerHTML = ''; // Clear previous entries
+        if (history && history.length > 0) {
+            history.forEach((entry, index) => {
+                const row = scanHistoryTableBody.insertRow();
+                row.innerHTML = `
+                    <td>${formatTimestamp(entry.timestamp)}</td>
+                    <td>${entry.level1}</td>
+                    <td>${entry.level2}</td>
+                    <td>${entry.level3}</td>
+                    <td>${entry.total}</td>
+                    <td>${entry.status}</td>
+                `;
+                // Add click event for scan details modal
+                row.addEventListener('click', () => showScanDetails(entry));
+                row.style.cursor = 'pointer'; // Indicate it's clickable
+            });
+        } else {
+            scanHistoryTableBody.innerHTML = '<tr class="no-data"><td colspan="6">No scan history available yet.</td></tr>';
+        }
+    }
+
+    // Show details for a specific scan entry in a modal
+    function showScanDetails(entry) {
+        scanDetailsTitle.textContent = `Scan Details: ${formatTimestamp(entry.timestamp)} (${entry.status})`;
+        scanDetailsTableBody.innerHTML = ''; // Clear previous modal entries
+
+        if (entry.flights_at_scan && entry.flights_at_scan.length > 0) {
+            entry.flights_at_scan.forEach(flight => {
+                const row = scanDetailsTableBody.insertRow();
+                row.className = `proximity-level-${flight.proximity_level}`;
+                row.innerHTML = `
+                    <td>${flight.icao24}</td>
+                    <td>${flight.callsign || 'N/A'}</td>
+                    <td>${Math.round(flight.altitude_baro)}</td>
+                    <td>${Math.round(flight.velocity * 3.6)}</td>
+                    <td>${getDirectionArrow(flight.true_track)} ${Math.round(flight.true_track)}°</td>
+                    <td>${flight.origin_country || 'N/A'} &rarr; N/A</td>
+                    <td>Level ${flight.proximity_level}${siteLabel(flight)}</td>
+                    <td>${flight.distance_km.toFixed(2)}</td>
+                `;
+            });
+        } else {
+            scanDetailsTableBody.innerHTML = '<tr class="no-data"><td colspan="8">No flights detected in this scan.</td></tr>';
+        }
+        scanDetailsModal.style.display = 'block';
+    }
+
+
+    // Helper: " (site)" suffix for flights matched against an additional site
+    function siteLabel(flight) {
+        return flight.site && flight.site !== 'Home' ? ` (${flight.site})` : '';
+    }
+
+    // Helper function to get direction arrow
+    function getDirectionArrow(degrees) {
+        if (degrees >= 337.5 || degrees < 22.5) return '↑'; // N
+        if (degrees >= 22.5 && degrees < 67.5) return '↗'; // NE
+        if (degrees >= 67.5 && degrees < 112.5) return '→'; // E
+        if (degrees >= 112.5 && degrees < 157.5) return '↘'; // SE
+        if (degrees >= 157.5 && degrees < 202.5) return '↓'; // S
+        if (degrees >= 202.5 && degrees < 247.5) return '↙'; // SW
+        if (degrees >= 247.5 && degrees < 292.5) return '←'; // W
+        if (degrees >= 292.5 && degrees < 337.5) return '↖'; // NW
+        return '';
+    }
+
+    // --- Sorting Table Columns (for Live Data & Scan Details Modals) ---
+    function setupTableSorting(tableId, isModal = false) {
+        const table = document.getElementById(tableId);
+        if (!table) return;
+
+        const headers = table.querySelectorAll('.sortable');
+        headers.forEach(header => {
+            header.addEventListener('click', () => {
+                const key = header.dataset.sortKey;
+                let order = header.dataset.sortOrder === 'asc' ? 'desc' : 'asc';
+
+                // Reset other headers
+                headers.forEach(h => {
+                    if (h !== header) {
+                        h.dataset.sortOrder = '';
+                        h.querySelector('.sort-indicator').innerHTML = '<span class="arrow-up"></span><span class="arrow-down"></span>';
+                    }
+                });
+
+                header.dataset.sortOrder = order;
+                const indicator = header.querySelector('.sort-indicator');
+                indicator.innerHTML = order === 'asc' ? '▲' : '▼'; // Use simple arrows for now
+
+                const tbody = table.querySelector('tbody');
+                const rows = Array.from(tbody.rows);
+
+                const sortedRows = rows.sort((a, b) => {
+                    const aVal = isModal ? getCellValueModal(a, key) : getCellValue(a, key);
+                    const bVal = isModal ? getCellValueModal(b, key) : getCellValue(b, key);
+
+                    if (typeof aVal === 'number' && typeof bVal === 'number') {
+                        return order === 'asc' ? aVal - bVal : bVal - aVal;
+                    }
+                    return order === 'asc' ? aVal.localeCompare(bVal) : bVal.localeCompare(aVal);
+                });
+
+                tbody.innerHTML = '';
+                sortedRows.forEach(row => tbody.appendChild(row));
+            });
+        });
+    }
+
+    // Helper to get cell value for live data table (based on column index)
+    function getCellValue(row, key) {
+        switch (key) {
+            case 'altitude_baro': return parseFloat(row.cells[2].textContent);
+            case 'velocity': return parseFloat(row.cells[3].textContent);
+            case 'distance_km': return parseFloat(row.cells[7].textContent);
+            default: return row.cells[0].textContent; // Default to first column for string sort
+        }
+    }
+
+    // Helper to get cell value for modal table (based on column index, assumes same order)
+    function getCellValueModal(row, key) {
+        switch (key) {
+            case 'altitude_baro': return parseFloat(row.cells[2].textContent);
+            case 'velocity': return parseFloat(row.cells[3].textContent);
+            case 'distance_km': return parseFloat(row.cells[7].textContent);
+            default: return row.cells[0].textContent;
+        }
+    }
+
+    // Initialize sorting for main live data table
+    setupTableSorting('currentFlightsTable');
+    // Initialize sorting for modal live data table
+    setupTableSorting('scanDetailsFlightsTable', true);
+
+
+    // Initial setup: activate Live Data tab and start fetching
+    liveDataTabBtn.click(); // Simulate click on Live Data tab to load content
+});
@@ -0,0 +1,956 @@
+// web_assets.h
+// GENERATED by tools/build_web_assets.py from web/ -- do not edit by hand.
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+struct WebAsset {
+    const char* uri;
+    const char* mimeType;
+    const char* etag;  // Quoted content hash
+    const uint8_t* data;  // gzip body in PROGMEM
+    size_t length;
+    bool immutable;       // Referenced with a versioned URL, so it can be cached forever
+};
+
+static const uint8_t webAsset_index_html[] PROGMEM = {
+0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe5, 0x5a, 0xeb, 0x72, 0xdb, 0x36,
+0x16, 0xfe, 0x9f, 0xa7, 0xc0, 0x72, 0x66, 0x13, 0x7b, 0x37, 0xba, 0xc7, 0x4d, 0xda, 0x58, 0xda,
+0x71, 0x7c, 0xd9, 0x74, 0xd7, 0x49, 0x3c, 0xb5, 0xdb, 0x4e, 0xf7, 0x4f, 0x07, 0x22, 0x21, 0x0b,
+0x15, 0x49, 0xb0, 0x04, 0x28, 0x47, 0x7d, 0x80, 0x7d, 0x80, 0x7d, 0xc4, 0x7d, 0x92, 0xfd, 0x70,
+0x00, 0x5e, 0x24, 0xd1, 0xb6, 0x1c, 0x37, 0x99, 0xe9, 0xec, 0x4c, 0x26, 0x32, 0x0f, 0x80, 0x83,
+0x73, 0x3e, 0x9c, 0x2b, 0xc8, 0xc3, 0x3f, 0x9d, 0x7c, 0x38, 0xbe, 0xfa, 0xe9, 0xe2, 0x94, 0xcd,
+0x4d, 0x12, 0x4f, 0x9e, 0x1c, 0xda, 0x1f, 0x16, 0xf3, 0xf4, 0x7a, 0x1c, 0x88, 0x34, 0xb0, 0x04,
+0xc1, 0x23, 0xfc, 0x24, 0xc2, 0x70, 0x16, 0xce, 0x79, 0xae, 0x85, 0x19, 0x07, 0xdf, 0x5f, 0x9d,
+0x75, 0x5e, 0x05, 0x25, 0x39, 0xe5, 0x89, 0x18, 0x07, 0x4b, 0x29, 0x6e, 0x32, 0x95, 0x9b, 0x80,
+0x85, 0x2a, 0x35, 0x22, 0xc5, 0xb4, 0x1b, 0x19, 0x99, 0xf9, 0x38, 0x12, 0x4b, 0x19, 0x8a, 0x0e,
+0x3d, 0x3c, 0x67, 0x32, 0x95, 0x46, 0xf2, 0xb8, 0xa3, 0x43, 0x1e, 0x8b, 0xf1, 0xa0, 0xdb, 0xb7,
+0x6c, 0x8c, 0x34, 0xb1, 0x98, 0x9c, 0xc5, 0xf2, 0x7a, 0x6e, 0xd8, 0x45, 0xae, 0x3e, 0xca, 0x44,
+0x9a, 0x15, 0x3b, 0x8a, 0x79, 0x9e, 0x1c, 0xf6, 0xdc, 0xe8, 0x93, 0xc3, 0x58, 0xa6, 0x0b, 0x96,
+0x8b, 0x78, 0x1c, 0x68, 0xb3, 0x8a, 0x85, 0x9e, 0x0b, 0x81, 0xdd, 0xe6, 0xb9, 0x98, 0x8d, 0x83,
+0x1e, 0x91, 0xba, 0xa1, 0xd6, 0x7f, 0x5b, 0x8e, 0x5f, 0xbd, 0x14, 0x83, 0xe1, 0xb0, 0x2f, 0x5e,
+0xf6, 0xfb, 0x07, 0xfd, 0xd1, 0x2b, 0x92, 0xb4, 0xe7, 0x15, 0x99, 0xaa, 0x68, 0xe5, 0xd5, 0x12,
+0xb9, 0xfd, 0x63, 0x70, 0xeb, 0xbe, 0x18, 0xf2, 0xeb, 0x68, 0x66, 0xca, 0x97, 0x76, 0x7d, 0x61,
+0x8c, 0x4a, 0x99, 0x8c, 0xc6, 0x41, 0x2c, 0x97, 0xe2, 0x84, 0x1b, 0x7e, 0xc5, 0xa7, 0x6f, 0x4c,
+0x0a, 0xbd, 0x63, 0xae, 0xf5, 0x38, 0xe0, 0xa1, 0xc1, 0x40, 0x30, 0x39, 0xc7, 0xff, 0xcc, 0x8e,
+0x1f, 0xf6, 0xdc, 0xa2, 0xf5, 0xd5, 0x00, 0xd2, 0xc8, 0xf4, 0x5a, 0xfb, 0xd5, 0x93, 0x4b, 0xff,
+0xdc, 0x98, 0xdd, 0x73, 0x5b, 0x26, 0x5c, 0xda, 0xa7, 0x48, 0x2e, 0x37, 0xb7, 0x3d, 0x76, 0x48,
+0x57, 0x5b, 0x1b, 0x3e, 0xed, 0x78, 0xf4, 0x59, 0x29, 0x06, 0x54, 0x1c, 0x3a, 0x59, 0xbc, 0x9e,
+0x4e, 0x24, 0x10, 0x31, 0x32, 0x9a, 0x1c, 0x17, 0x79, 0x6e, 0xa7, 0xd7, 0xda, 0x5f, 0x1a, 0x6e,
+0x0a, 0x88, 0x81, 0x41, 0xb7, 0xa9, 0x67, 0xae, 0x89, 0xde, 0xd1, 0x45, 0x92, 0xf0, 0x7c, 0x15,
+0xb4, 0x0e, 0x86, 0x3c, 0x8f, 0x02, 0x92, 0x32, 0x74, 0x7c, 0x3f, 0x2c, 0x45, 0xce, 0xe3, 0xd8,
+0xf1, 0x24, 0x61, 0x5e, 0x4c, 0x3c, 0xad, 0xde, 0xe8, 0x05, 0xe8, 0xd9, 0xe4, 0xe8, 0xfc, 0x9c,
+0x1d, 0x9f, 0x9f, 0x1e, 0x7d, 0x77, 0xd8, 0xcb, 0xac, 0xf2, 0xe0, 0x7e, 0xcf, 0x1e, 0xb1, 0x58,
+0x8a, 0x78, 0x70, 0xac, 0x8a, 0xd4, 0x1c, 0x5b, 0xa2, 0x63, 0x7f, 0x6e, 0xa9, 0x6c, 0xc0, 0xf6,
+0xe8, 0x18, 0xf7, 0x2b, 0xfe, 0x7d, 0x0f, 0x80, 0x7e, 0x18, 0xff, 0x61, 0x3b, 0xff, 0x21, 0xdb,
+0xfb, 0x91, 0xe7, 0x29, 0x4e, 0xec, 0xd1, 0x3b, 0x8c, 0xda, 0x77, 0x18, 0xb1, 0xbd, 0x13, 0x61,
+0x04, 0x8e, 0x51, 0xa5, 0x8f, 0xd9, 0xc3, 0x28, 0xc3, 0x63, 0xbf, 0xa8, 0xb1, 0xc9, 0x95, 0x25,
+0x97, 0xcc, 0xe0, 0x96, 0xec, 0x28, 0x17, 0xfc, 0x9e, 0x6d, 0xfc, 0x0f, 0x2c, 0xa3, 0x5c, 0xe7,
+0xcd, 0x27, 0x5e, 0x31, 0x27, 0xab, 0x88, 0x1a, 0x86, 0xd3, 0xb0, 0x83, 0x72, 0x7f, 0x18, 0x27,
+0xac, 0x59, 0xe4, 0xe4, 0xf5, 0x7c, 0x1a, 0x8b, 0x96, 0x49, 0x57, 0x96, 0x4e, 0x13, 0xbc, 0xcf,
+0x9a, 0x9c, 0x1e, 0x4a, 0x47, 0x3d, 0x56, 0x91, 0x40, 0x54, 0x98, 0x3b, 0xe2, 0x87, 0x0c, 0xd6,
+0x64, 0x54, 0x5e, 0x51, 0x2a, 0x20, 0x10, 0x8c, 0x88, 0x13, 0x8b, 0x60, 0xf1, 0x1d, 0xfb, 0xd8,
+0x59, 0x88, 0x15, 0x1c, 0x34, 0x46, 0x44, 0x29, 0x22, 0xf1, 0xf3, 0x94, 0xe7, 0xaa, 0x39, 0xaa,
+0x72, 0x78, 0x3a, 0xc6, 0x75, 0x18, 0x4c, 0x8e, 0xfc, 0x24, 0xb6, 0x97, 0xec, 0xb3, 0x43, 0x9d,
+0xf1, 0xb4, 0xc9, 0xb7, 0x23, 0xd3, 0x48, 0x86, 0x76, 0xdb, 0x60, 0xb2, 0x36, 0xc8, 0xf3, 0x5c,
+0xdd, 0x74, 0x8a, 0x0c, 0xe4, 0x9e, 0xa5, 0xb7, 0x8d, 0x46, 0xea, 0x26, 0xad, 0xc7, 0xcb, 0x9f,
+0x5d, 0xa5, 0x87, 0x69, 0xa8, 0x10, 0x7e, 0xda, 0x22, 0x38, 0x82, 0x48, 0x26, 0x44, 0xc4, 0xf6,
+0x16, 0x49, 0x6f, 0xfe, 0x45, 0xa5, 0x9e, 0x9c, 0xc8, 0xdc, 0x59, 0x6a, 0xe3, 0x60, 0x72, 0x79,
+0x0d, 0xb3, 0xfa, 0xef, 0xbf, 0xff, 0x03, 0xdb, 0xd0, 0xa6, 0x1e, 0xa8, 0x43, 0x0d, 0x19, 0xfa,
+0xee, 0xaa, 0x47, 0x12, 0xc6, 0x9d, 0x86, 0xe2, 0xe7, 0x45, 0xd2, 0xaa, 0xfd, 0x89, 0x1f, 0xb7,
+0x00, 0x7c, 0x41, 0xf5, 0x7b, 0x64, 0x9f, 0xbd, 0xca, 0x5a, 0x7d, 0x8a, 0x31, 0x79, 0xc9, 0x21,
+0x55, 0x1d, 0x2b, 0x2d, 0x96, 0x9b, 0x08, 0xd9, 0x31, 0xb6, 0x8b, 0xc7, 0x01, 0xd2, 0xd2, 0x7b,
+0xc5, 0x66, 0xde, 0x91, 0xc2, 0xca, 0x91, 0x22, 0xef, 0x48, 0xec, 0x46, 0x9a, 0x39, 0x00, 0x4c,
+0x14, 0x52, 0xa6, 0xca, 0x11, 0x69, 0x58, 0xce, 0x23, 0x59, 0xe8, 0x2e, 0xf6, 0x8a, 0x26, 0xd5,
+0xb6, 0x7e, 0xbb, 0x1e, 0x61, 0xb6, 0xe6, 0xa4, 0xe7, 0x5c, 0x1b, 0x36, 0xe8, 0xb3, 0xcb, 0x10,
+0xda, 0xbc, 0x05, 0x38, 0x2a, 0x5f, 0x6d, 0xb8, 0x27, 0xd2, 0x70, 0xea, 0x47, 0x6e, 0xf1, 0xcd,
+0xc6, 0x8c, 0x5b, 0x1d, 0xf3, 0x4a, 0x26, 0x38, 0x61, 0x9e, 0x64, 0xf5, 0x21, 0x9f, 0x0f, 0x18,
+0x85, 0xb5, 0x06, 0x65, 0xb8, 0x45, 0x19, 0x6d, 0x52, 0xd6, 0x82, 0x52, 0x4d, 0x2e, 0x33, 0xc5,
+0x63, 0xe0, 0xfe, 0x8a, 0xe0, 0xb6, 0xda, 0xb0, 0xb9, 0x53, 0x87, 0xf1, 0x25, 0x97, 0x31, 0x29,
+0xba, 0x12, 0x66, 0x37, 0x54, 0x1b, 0xf1, 0x76, 0x23, 0x89, 0xdf, 0x91, 0x8b, 0x7d, 0x12, 0xbe,
+0x5c, 0x69, 0x23, 0x12, 0x56, 0x27, 0x7a, 0xca, 0xc1, 0x33, 0x95, 0x27, 0x6b, 0xbc, 0xce, 0x40,
+0x08, 0xdc, 0x01, 0xfe, 0x28, 0xcf, 0x24, 0x20, 0x4a, 0x67, 0xf2, 0xba, 0x40, 0x90, 0x23, 0xf7,
+0xda, 0x4c, 0xcb, 0x76, 0x7d, 0xe7, 0x3a, 0x57, 0xd6, 0x7c, 0x51, 0x23, 0xf1, 0x29, 0x52, 0x07,
+0x68, 0xe0, 0xa7, 0x25, 0x62, 0x3d, 0xb1, 0xb8, 0xbc, 0xfc, 0xf6, 0xe4, 0x9b, 0xc3, 0x1e, 0x0d,
+0x62, 0x92, 0x4c, 0xb3, 0xc2, 0x30, 0xb3, 0xca, 0x50, 0xb6, 0x19, 0xf1, 0xd1, 0xb8, 0x3c, 0x41,
+0xf3, 0x7d, 0x31, 0xe7, 0xfe, 0x5e, 0xf2, 0xb8, 0xc0, 0xc3, 0xbb, 0xd5, 0x5b, 0x95, 0x88, 0xf7,
+0xc2, 0xdc, 0xa8, 0x7c, 0x11, 0xa0, 0x02, 0xfb, 0xb5, 0x80, 0xb7, 0x47, 0xad, 0xd9, 0xe7, 0x56,
+0x69, 0x32, 0x0c, 0x63, 0x7d, 0x29, 0xd1, 0x85, 0x7f, 0xbc, 0x45, 0xaa, 0x6a, 0x36, 0x49, 0x56,
+0x3f, 0x39, 0xe9, 0xea, 0x67, 0x2f, 0xe1, 0x4a, 0x15, 0xf9, 0x8d, 0x9c, 0xc9, 0x7a, 0x60, 0x5b,
+0x48, 0xe0, 0x76, 0x74, 0xf1, 0x2d, 0xd0, 0xcf, 0x51, 0x7e, 0x34, 0x0f, 0x61, 0x57, 0x3c, 0x79,
+0x26, 0xdd, 0xe2, 0xa0, 0xc1, 0xa8, 0x21, 0xbf, 0x16, 0x31, 0xfc, 0x96, 0x04, 0xae, 0xa7, 0x7a,
+0x89, 0x1b, 0x6b, 0x9f, 0x1c, 0xaa, 0xcc, 0x9e, 0x64, 0x29, 0xbb, 0xca, 0x44, 0xaa, 0x17, 0x08,
+0xe7, 0x6e, 0x3d, 0x44, 0x46, 0x46, 0x4b, 0x2f, 0x17, 0x2b, 0xe6, 0x11, 0x3f, 0xec, 0xb9, 0x05,
+0x56, 0x15, 0x37, 0xe7, 0x61, 0xc8, 0x63, 0xef, 0x7f, 0x8a, 0x95, 0x13, 0x1a, 0x7f, 0xb0, 0xbd,
+0x0f, 0xc4, 0x8e, 0xd3, 0x30, 0x3b, 0xcb, 0x85, 0x60, 0xe5, 0x8e, 0x47, 0x61, 0x28, 0xb4, 0xde,
+0xbf, 0xd7, 0x54, 0x3c, 0xcb, 0x5a, 0x39, 0x7a, 0xf2, 0x0a, 0x05, 0x6b, 0x98, 0xff, 0x84, 0xa3,
+0x61, 0xe7, 0x2a, 0x24, 0xeb, 0x65, 0x4f, 0xd9, 0xbb, 0x3a, 0x9a, 0x7d, 0x47, 0xd1, 0xec, 0x01,
+0x27, 0x10, 0x73, 0x97, 0x93, 0x03, 0xcf, 0x95, 0x97, 0x29, 0x3a, 0x12, 0xd7, 0x50, 0xe3, 0x56,
+0xc1, 0xd3, 0x22, 0x99, 0xda, 0xb3, 0xa0, 0x8a, 0xab, 0xe4, 0xe1, 0x85, 0xaf, 0x9f, 0xe1, 0x9c,
+0x19, 0x94, 0x49, 0xa1, 0x49, 0x22, 0x11, 0x30, 0x3a, 0x5f, 0xf7, 0xf1, 0x17, 0xff, 0x38, 0x0e,
+0xec, 0x1f, 0x5e, 0xb9, 0xc1, 0x41, 0x77, 0x74, 0xf0, 0x6a, 0x58, 0x1b, 0xd8, 0x13, 0xea, 0x4e,
+0xc6, 0xc1, 0x0f, 0x76, 0x9c, 0x25, 0x05, 0x22, 0xee, 0x54, 0xe0, 0x9f, 0xb9, 0x11, 0x22, 0x65,
+0xe0, 0xc1, 0x78, 0x1a, 0x31, 0xfc, 0x78, 0x19, 0x37, 0xea, 0x66, 0x81, 0xe4, 0x92, 0x77, 0x10,
+0x3d, 0x35, 0xbf, 0x16, 0x4e, 0x42, 0x22, 0x9d, 0x57, 0xaa, 0xb6, 0x44, 0x9e, 0x7b, 0x71, 0x52,
+0xe9, 0xf5, 0x1a, 0x50, 0xe5, 0xf3, 0xc3, 0x90, 0xaa, 0xb8, 0x94, 0x50, 0xd5, 0x84, 0x2d, 0xac,
+0x06, 0xaf, 0x4a, 0xb0, 0xe8, 0x2f, 0x8f, 0xd6, 0xcb, 0x83, 0x6e, 0x7f, 0x38, 0xe8, 0xef, 0x8c,
+0x16, 0xd6, 0x12, 0x5c, 0xf6, 0xf7, 0x81, 0x78, 0xd5, 0x2a, 0x7f, 0x02, 0x60, 0x2e, 0xaf, 0x52,
+0x35, 0x32, 0x08, 0xaa, 0x06, 0xc2, 0xd9, 0xa7, 0x2d, 0x26, 0x6c, 0xdb, 0x8a, 0xc4, 0x98, 0x28,
+0x6d, 0x76, 0x41, 0x6e, 0x8d, 0x9d, 0x07, 0x6f, 0x9d, 0xe6, 0xf1, 0x19, 0xf5, 0x3d, 0x7e, 0x83,
+0x12, 0xbc, 0x7e, 0x7f, 0x67, 0xb4, 0x06, 0x0e, 0x2a, 0xac, 0x60, 0x8b, 0xa4, 0xcb, 0xde, 0xf9,
+0x61, 0x34, 0xc6, 0x9a, 0x99, 0x39, 0xd2, 0x9c, 0x6f, 0x54, 0xba, 0x3b, 0x42, 0xe8, 0xd4, 0x1d,
+0x3c, 0x16, 0xc0, 0x61, 0x50, 0x75, 0x48, 0x4d, 0x00, 0x13, 0x19, 0x45, 0xb1, 0x78, 0x20, 0x7a,
+0xc3, 0x16, 0xf4, 0x86, 0x15, 0x7a, 0x07, 0x5f, 0x00, 0xbd, 0x11, 0x4d, 0x83, 0x25, 0x72, 0x83,
+0xac, 0xd1, 0x18, 0x18, 0x3c, 0x0c, 0xd6, 0xe1, 0x63, 0x61, 0x1d, 0x05, 0x55, 0x5b, 0xd8, 0x84,
+0x55, 0x15, 0xe6, 0x93, 0xec, 0x72, 0xd4, 0x82, 0xec, 0xa8, 0xf6, 0xdb, 0xcf, 0x80, 0x6c, 0x0b,
+0x86, 0x0f, 0x34, 0xcd, 0xd1, 0x16, 0x86, 0x36, 0xa7, 0x47, 0x91, 0xf4, 0xe9, 0xcc, 0xa7, 0x16,
+0x54, 0xce, 0x97, 0xd2, 0x88, 0x32, 0xb1, 0x64, 0x6b, 0x28, 0xa3, 0xa0, 0x46, 0x39, 0x76, 0xca,
+0xc3, 0x39, 0xd3, 0x98, 0xc4, 0xe6, 0x1c, 0xbd, 0x2f, 0xca, 0x6f, 0x54, 0xf7, 0x54, 0x5d, 0x4b,
+0x12, 0x9e, 0xdb, 0x9b, 0x83, 0x2e, 0x3b, 0x8a, 0x63, 0x9a, 0xa5, 0x99, 0x9e, 0xf3, 0x5c, 0x30,
+0x95, 0x0a, 0x66, 0xb3, 0xe8, 0xaf, 0x85, 0x40, 0xf5, 0x88, 0xbe, 0xd3, 0x95, 0x93, 0x7b, 0x45,
+0xc6, 0x8c, 0x62, 0x83, 0x03, 0x37, 0x79, 0xbf, 0xeb, 0x7a, 0xe6, 0xaa, 0x46, 0xb4, 0xc4, 0x73,
+0x94, 0x9c, 0x41, 0xeb, 0xe1, 0xbb, 0xdb, 0x1e, 0x77, 0xfc, 0xc4, 0xa0, 0xc3, 0x23, 0xea, 0xd1,
+0xfd, 0x5d, 0x91, 0x3b, 0x46, 0xf7, 0xe0, 0xb3, 0x6f, 0x14, 0x59, 0x05, 0x9b, 0x77, 0x4e, 0x91,
+0x98, 0xf1, 0x22, 0xc6, 0x0e, 0x80, 0x83, 0xb4, 0x6f, 0xde, 0x22, 0x55, 0x58, 0x5d, 0xa8, 0x78,
+0x75, 0x0d, 0x96, 0xff, 0x82, 0x22, 0x77, 0xc1, 0xf3, 0x7d, 0x16, 0x2b, 0x0e, 0x14, 0xd8, 0xdf,
+0x85, 0xfa, 0xc7, 0xe5, 0x87, 0xf7, 0x6c, 0x26, 0x51, 0x23, 0xab, 0x19, 0xf3, 0x0c, 0x7a, 0xef,
+0xb0, 0x97, 0x2c, 0xb9, 0xcd, 0x70, 0xae, 0x45, 0x0e, 0x90, 0xf6, 0x44, 0xf7, 0xba, 0xcb, 0x78,
+0x96, 0xe5, 0xca, 0xe2, 0x1b, 0xaa, 0x3c, 0x97, 0x91, 0xca, 0x01, 0x08, 0x23, 0xc0, 0xfd, 0xc4,
+0x67, 0x9a, 0x1d, 0x86, 0x68, 0xe1, 0x27, 0x98, 0x07, 0x0c, 0x8d, 0x14, 0xba, 0x1b, 0xbb, 0x46,
+0x90, 0xc8, 0x6c, 0x6f, 0xd0, 0x19, 0xed, 0xa3, 0x1c, 0x32, 0xee, 0x68, 0xe8, 0x30, 0x18, 0xcd,
+0xa0, 0xc3, 0xd9, 0x5a, 0x6c, 0x0d, 0xb9, 0x5c, 0x6b, 0x17, 0x90, 0x1b, 0x74, 0x9d, 0x96, 0xcc,
+0x9e, 0x1b, 0x44, 0x8a, 0x25, 0xcc, 0x42, 0x26, 0x89, 0x88, 0x24, 0xac, 0x30, 0x5e, 0xbd, 0x66,
+0x05, 0x29, 0x49, 0x5d, 0x95, 0xc8, 0x62, 0x1e, 0xda, 0xb9, 0x38, 0xef, 0xdf, 0xec, 0xaa, 0xc6,
+0x09, 0xb6, 0xba, 0x68, 0xd3, 0xc1, 0x2c, 0x36, 0xee, 0x5c, 0x68, 0xe9, 0x19, 0x3d, 0x72, 0x14,
+0x52, 0x99, 0x19, 0x07, 0xdd, 0x6b, 0xa1, 0x7e, 0xd1, 0x2a, 0x7d, 0xde, 0xa5, 0xff, 0x49, 0x10,
+0x57, 0x0a, 0xf5, 0x30, 0xf2, 0xd7, 0x2d, 0xa2, 0x25, 0x34, 0xcc, 0xa4, 0x88, 0x6b, 0xc6, 0x64,
+0x41, 0x2d, 0x87, 0x75, 0xd8, 0x2b, 0xe2, 0xc7, 0x5a, 0x94, 0xc3, 0x82, 0x00, 0x6b, 0xb5, 0x2a,
+0x6f, 0x10, 0xde, 0x6e, 0x36, 0x6f, 0x33, 0xb7, 0xf9, 0x85, 0xb1, 0xe0, 0xf9, 0xed, 0xec, 0x8e,
+0xed, 0xf0, 0x16, 0xb7, 0x86, 0x4f, 0xd3, 0x89, 0x5f, 0xa2, 0x35, 0x8c, 0xee, 0xf5, 0x62, 0x67,
+0x17, 0x38, 0xc0, 0x95, 0x66, 0x02, 0x0d, 0x33, 0x9c, 0x92, 0x33, 0xbd, 0x4a, 0xf1, 0x97, 0x96,
+0xbf, 0xe1, 0xd0, 0xa7, 0x42, 0x64, 0x2c, 0xe3, 0x06, 0xb1, 0x07, 0xae, 0x9a, 0x49, 0x63, 0x5d,
+0x1f, 0x81, 0x2a, 0xd3, 0x6c, 0x96, 0xab, 0x04, 0xa5, 0x0c, 0xcf, 0x8d, 0xf5, 0x5f, 0x91, 0x56,
+0x2d, 0xb7, 0xb0, 0x9c, 0xed, 0xc2, 0x7d, 0xa6, 0x88, 0x9f, 0x15, 0x05, 0x12, 0xc8, 0xac, 0xcb,
+0x2e, 0xf9, 0xd2, 0xf7, 0xe6, 0x08, 0x65, 0xf0, 0x0a, 0xda, 0xb2, 0xec, 0xdd, 0x60, 0x56, 0x5a,
+0xb0, 0x0b, 0x48, 0x63, 0x39, 0xce, 0xad, 0x9a, 0x76, 0x92, 0xa6, 0x35, 0xc4, 0x65, 0x33, 0x38,
+0x90, 0x92, 0x1b, 0xd1, 0xa1, 0x4d, 0xd9, 0xcb, 0x4a, 0x04, 0xfd, 0x4d, 0x69, 0xb1, 0x90, 0x8c,
+0xd4, 0x87, 0x47, 0x4d, 0x0b, 0x19, 0xdb, 0x0b, 0x0e, 0x9a, 0xe1, 0xa4, 0xb3, 0x4d, 0x91, 0x8b,
+0x6b, 0x02, 0xae, 0x48, 0x96, 0xee, 0x3d, 0x94, 0xe9, 0x4c, 0x2d, 0x10, 0xa9, 0x79, 0x9a, 0x82,
+0x6b, 0x28, 0x12, 0xf4, 0xa8, 0x70, 0xd2, 0xa3, 0x14, 0x2d, 0x71, 0x11, 0x49, 0xe5, 0xfc, 0xdd,
+0x0a, 0x3e, 0xcd, 0xd5, 0x8d, 0x86, 0x7e, 0x36, 0xcc, 0x59, 0x8c, 0x99, 0x6d, 0x48, 0xa0, 0xa5,
+0x44, 0x9f, 0xa3, 0xed, 0x45, 0x3f, 0x5a, 0x1a, 0x7b, 0x55, 0x01, 0x65, 0x5f, 0xb1, 0xc5, 0xdb,
+0xdf, 0xec, 0x65, 0x85, 0x22, 0x2f, 0x0d, 0x55, 0x92, 0x21, 0x28, 0x68, 0x3a, 0x01, 0xe8, 0x21,
+0xbc, 0xc3, 0x61, 0x1b, 0xc3, 0x6c, 0xc2, 0x62, 0x83, 0xaf, 0x00, 0x1b, 0x58, 0x44, 0x7a, 0x03,
+0x13, 0x52, 0x72, 0x07, 0x48, 0x8e, 0x1a, 0xe2, 0x03, 0x14, 0x3e, 0x73, 0xe9, 0x45, 0x94, 0x19,
+0xda, 0x47, 0x0e, 0x82, 0xf8, 0x39, 0x0d, 0xa4, 0x38, 0x10, 0x81, 0xad, 0xb9, 0xcc, 0xc3, 0x1c,
+0xf3, 0x01, 0x5c, 0x08, 0xa7, 0xd7, 0xf2, 0x3a, 0x25, 0xa1, 0xcb, 0x0b, 0x26, 0x8a, 0x1a, 0x1e,
+0xa4, 0xbd, 0x80, 0xd8, 0x3c, 0x07, 0x16, 0x7c, 0x09, 0xdd, 0xe2, 0x6c, 0xce, 0xd9, 0xcd, 0x5c,
+0xea, 0x05, 0x7a, 0x29, 0x9b, 0x11, 0xd0, 0xa4, 0x3d, 0x47, 0xba, 0x06, 0xd8, 0x99, 0x82, 0x5c,
+0xf6, 0x99, 0x2d, 0x64, 0x8c, 0x96, 0xd9, 0x60, 0xb3, 0x60, 0xdf, 0x99, 0x99, 0x3b, 0x04, 0x6b,
+0x39, 0xf8, 0xd1, 0x30, 0x23, 0xd7, 0x2d, 0x56, 0x67, 0xa3, 0x29, 0x1f, 0x47, 0x0d, 0x2d, 0x68,
+0xa2, 0x3f, 0x32, 0x17, 0xf3, 0x68, 0xef, 0xee, 0x0d, 0x5f, 0xfa, 0x68, 0xf7, 0xdc, 0xd3, 0x5f,
+0x76, 0x93, 0x6c, 0xe4, 0x69, 0xfb, 0xcf, 0x81, 0x2a, 0x5d, 0xb0, 0x33, 0x6e, 0x20, 0x1f, 0x94,
+0x91, 0x33, 0x6b, 0x0b, 0x2c, 0x96, 0x0b, 0x81, 0x74, 0x2c, 0xd1, 0xdb, 0xc3, 0x14, 0x1c, 0x77,
+0xd2, 0x73, 0x21, 0xb3, 0x4c, 0x44, 0x9f, 0x16, 0xf3, 0x96, 0x4a, 0x86, 0xe2, 0x7b, 0xe4, 0x5d,
+0x1b, 0xf7, 0x74, 0x1d, 0xf8, 0xc8, 0x8e, 0x7a, 0x7f, 0x41, 0xf9, 0x60, 0x53, 0x45, 0xd6, 0xbc,
+0x42, 0xc9, 0xd6, 0x17, 0x6a, 0xff, 0x6e, 0xa0, 0x35, 0xb4, 0x65, 0xbf, 0x4f, 0x64, 0xfb, 0xa1,
+0xda, 0xec, 0xae, 0xf0, 0xf6, 0xa3, 0x85, 0xe4, 0x96, 0x80, 0xe4, 0x3b, 0xcd, 0x63, 0x21, 0xe3,
+0xc6, 0xb5, 0x41, 0xab, 0x55, 0x7a, 0xdb, 0x62, 0x7c, 0xaa, 0x96, 0x4d, 0x17, 0x0d, 0xdd, 0x5a,
+0xc2, 0xdc, 0x50, 0x31, 0x84, 0xd3, 0xd6, 0xde, 0x2e, 0x3f, 0x1a, 0x1f, 0xc9, 0x50, 0xd0, 0xb1,
+0x3d, 0x04, 0x1d, 0x98, 0x24, 0x95, 0x32, 0x8e, 0x8b, 0x9d, 0x84, 0x9d, 0xc8, 0x4b, 0x29, 0x99,
+0x69, 0x8a, 0x58, 0x4b, 0x5b, 0x87, 0x50, 0x1d, 0x63, 0xad, 0xd7, 0xa6, 0x89, 0x2e, 0xeb, 0xb3,
+0x31, 0x83, 0x0f, 0xfa, 0xdd, 0xee, 0x3b, 0xd5, 0xe6, 0x3d, 0x81, 0x57, 0xd2, 0xeb, 0xb8, 0xd9,
+0x0d, 0x79, 0xb2, 0xbd, 0x0f, 0xdf, 0xa1, 0xd4, 0x6c, 0x67, 0x56, 0x5e, 0x18, 0xb4, 0x0f, 0x56,
+0x4d, 0x51, 0xbf, 0x2c, 0x3f, 0xfb, 0x65, 0xa7, 0x89, 0x6a, 0x32, 0x78, 0xe0, 0xad, 0x47, 0xcb,
+0x1e, 0x8d, 0xd6, 0xe4, 0xf1, 0xda, 0x0c, 0xef, 0xd2, 0xa6, 0x6e, 0x52, 0xbe, 0xfa, 0x6c, 0xda,
+0x34, 0x3a, 0x82, 0xc7, 0x6b, 0x33, 0xba, 0x4b, 0x9b, 0xba, 0x31, 0xb8, 0x47, 0x15, 0x38, 0x85,
+0xbd, 0x6b, 0xb6, 0x6f, 0xc5, 0xd8, 0x53, 0xe6, 0xd3, 0xf8, 0xc3, 0x6f, 0xda, 0x52, 0xe5, 0x6e,
+0x80, 0x2d, 0xaf, 0x33, 0x34, 0x1d, 0x74, 0x73, 0xeb, 0x5f, 0xfe, 0xd0, 0x5d, 0xb6, 0x25, 0x16,
+0x22, 0x0d, 0x57, 0x6c, 0xcf, 0xa7, 0x90, 0x5d, 0xf4, 0xde, 0x62, 0xeb, 0x55, 0xde, 0xa6, 0x57,
+0x67, 0x57, 0xb6, 0x41, 0x2d, 0xcd, 0xcf, 0x3b, 0x99, 0xca, 0xa4, 0x48, 0x6c, 0xd1, 0xa8, 0x6e,
+0xe0, 0xa8, 0xb3, 0x4a, 0x26, 0x64, 0xc6, 0x41, 0xbf, 0xca, 0x6d, 0x3b, 0xb6, 0x38, 0xef, 0xb7,
+0x74, 0xfe, 0x84, 0x7e, 0xd1, 0xbd, 0x4c, 0xb8, 0x40, 0xda, 0x41, 0x4a, 0xac, 0x39, 0x55, 0x2f,
+0xb8, 0x89, 0xfe, 0x18, 0x08, 0xdb, 0x37, 0xf0, 0x38, 0xde, 0x32, 0x58, 0xde, 0x9c, 0x7d, 0x41,
+0x30, 0xcf, 0xda, 0x71, 0xf8, 0x04, 0x44, 0x29, 0xf7, 0x9f, 0xa6, 0x26, 0x5f, 0xbd, 0x41, 0x88,
+0xbd, 0x10, 0x79, 0x48, 0xf7, 0xf9, 0xce, 0xb4, 0x89, 0xce, 0xec, 0x00, 0xdb, 0xfb, 0xf3, 0x6e,
+0x9e, 0xd7, 0xc6, 0xad, 0xf2, 0xbc, 0xd6, 0xc1, 0x6d, 0xcf, 0xa3, 0x8e, 0xfc, 0xa0, 0x76, 0xc1,
+0xa0, 0x44, 0xf1, 0x28, 0xad, 0x2a, 0x1b, 0x54, 0xb3, 0xa8, 0x23, 0x74, 0x99, 0x7e, 0x50, 0x08,
+0xc4, 0x2b, 0x5f, 0x0d, 0x50, 0xe9, 0x86, 0x32, 0x57, 0x23, 0x37, 0xa3, 0xcc, 0x95, 0xa9, 0x96,
+0x91, 0xcf, 0x30, 0x3e, 0x53, 0xb9, 0x3b, 0x01, 0x5b, 0xfa, 0x96, 0x59, 0x24, 0xf8, 0x04, 0xd4,
+0xde, 0xda, 0xd7, 0x1d, 0x38, 0x02, 0xa9, 0x37, 0x61, 0xfb, 0x08, 0x19, 0x1e, 0x8a, 0xda, 0x36,
+0xb7, 0x26, 0x6c, 0x2d, 0xa3, 0x9b, 0x66, 0xb7, 0x2b, 0x70, 0xe8, 0x4d, 0x96, 0x62, 0x17, 0xe0,
+0xa6, 0x62, 0x05, 0x9b, 0xfc, 0x0c, 0xc0, 0x9d, 0xdc, 0x88, 0x38, 0xbe, 0x14, 0x61, 0x30, 0x29,
+0xdd, 0xc2, 0xe1, 0x46, 0xf4, 0x07, 0xb9, 0xeb, 0x3a, 0xbb, 0x26, 0x60, 0x35, 0x71, 0xf3, 0x2a,
+0xb2, 0xc4, 0x09, 0x89, 0xab, 0xc6, 0xc7, 0x83, 0x01, 0xd5, 0xe7, 0x22, 0x8e, 0x6c, 0x65, 0x09,
+0x98, 0x50, 0x48, 0x13, 0x1a, 0xf6, 0x5e, 0xb8, 0x2c, 0xf2, 0x2d, 0x1a, 0xbe, 0xec, 0x36, 0xb6,
+0xc5, 0xb2, 0xaf, 0x4d, 0x77, 0x02, 0xa1, 0xa9, 0x42, 0x38, 0x17, 0xe1, 0x62, 0xaa, 0x3e, 0x06,
+0x75, 0x8b, 0xe4, 0xbf, 0xb5, 0xa8, 0xde, 0x4f, 0xad, 0xd1, 0x68, 0x3e, 0xbd, 0xeb, 0x69, 0xbe,
+0xfe, 0x6a, 0x4e, 0x99, 0x9c, 0xa6, 0xf4, 0x9e, 0xcf, 0x75, 0x51, 0x9e, 0x5a, 0xe3, 0x77, 0xf7,
+0xad, 0xcc, 0x9d, 0x05, 0xa6, 0xed, 0x27, 0xa0, 0xf8, 0x89, 0xab, 0x25, 0xdb, 0xeb, 0xcb, 0xef,
+0xdc, 0x1c, 0x56, 0x4e, 0xda, 0xa5, 0x85, 0xce, 0xc5, 0x54, 0x29, 0x73, 0xaa, 0xb3, 0x26, 0x47,
+0x47, 0xb4, 0x0c, 0xed, 0x2f, 0x3b, 0xbd, 0xbc, 0xb8, 0x8d, 0x95, 0x2e, 0xa6, 0x89, 0x2c, 0x5f,
+0xec, 0xc1, 0xa0, 0xcb, 0x2c, 0xec, 0x3e, 0x35, 0x02, 0x81, 0xb5, 0x7d, 0x6f, 0xe4, 0xc3, 0xa3,
+0x3d, 0x99, 0xc6, 0xa3, 0xff, 0xfe, 0x68, 0x86, 0x2d, 0xe9, 0x43, 0xa8, 0x6c, 0xf2, 0x34, 0x54,
+0xd9, 0xea, 0x35, 0x1b, 0xf6, 0x87, 0x07, 0xac, 0xfd, 0xeb, 0x29, 0xe6, 0x5e, 0x76, 0xfa, 0xaf,
+0x47, 0xaa, 0xa5, 0x55, 0xdb, 0x4b, 0x35, 0xff, 0x3b, 0x15, 0xf1, 0xb8, 0x52, 0x2e, 0xb1, 0x4f,
+0xcc, 0x7f, 0xbe, 0x42, 0x0f, 0x1b, 0xd1, 0x9e, 0x68, 0xcd, 0x77, 0xaa, 0x59, 0x93, 0x97, 0x4b,
+0x02, 0x57, 0xf6, 0x1d, 0xd5, 0xa4, 0xed, 0xa3, 0x95, 0xaa, 0xbb, 0xb4, 0xaf, 0x53, 0xf3, 0xe4,
+0x88, 0xbe, 0x56, 0x68, 0x91, 0xe0, 0xbe, 0x4d, 0xe7, 0xa3, 0x6d, 0x36, 0x57, 0xd6, 0x4d, 0xec,
+0xb6, 0xbe, 0x2b, 0xd8, 0xde, 0xc7, 0xa7, 0xa8, 0xed, 0x96, 0xc6, 0xf1, 0x77, 0x47, 0xa0, 0x83,
+0xf5, 0x4f, 0xc4, 0xd6, 0x58, 0xd0, 0xc9, 0xfd, 0xd4, 0x76, 0xff, 0x42, 0x53, 0x6d, 0xdb, 0x1a,
+0xd7, 0x33, 0x4b, 0xf6, 0x8e, 0x1e, 0x4c, 0x8e, 0xe9, 0xb7, 0xe5, 0xac, 0xdb, 0x5f, 0x6b, 0x63,
+0xd9, 0x89, 0x30, 0x5c, 0xc6, 0xfa, 0x0e, 0x84, 0xda, 0x66, 0x6e, 0xbe, 0x05, 0xdf, 0x82, 0xaf,
+0xf9, 0x65, 0x85, 0x1f, 0x8c, 0x95, 0x46, 0xf2, 0x46, 0x8c, 0x8d, 0x65, 0xb8, 0x80, 0xdb, 0xa8,
+0xb0, 0xb0, 0x2d, 0x7d, 0xf7, 0x5a, 0x98, 0xd3, 0x98, 0xba, 0xfb, 0x37, 0xab, 0x6f, 0xa3, 0xbd,
+0x67, 0x9b, 0x7b, 0x3d, 0xdb, 0xef, 0xba, 0xaf, 0xfe, 0xd0, 0xb6, 0xdb, 0xcb, 0x89, 0xf1, 0xb3,
+0x14, 0x1d, 0xd0, 0xb3, 0xd7, 0xc1, 0xe4, 0xa9, 0xb1, 0x1f, 0x24, 0xbc, 0xf6, 0x9f, 0x69, 0x54,
+0x67, 0xd6, 0x60, 0xe0, 0x4f, 0x8c, 0x4a, 0x21, 0x4f, 0xda, 0x2e, 0x50, 0xfd, 0xd9, 0xa8, 0x68,
+0xb5, 0xfd, 0x49, 0x84, 0x5f, 0xf4, 0x79, 0x3e, 0x59, 0xf2, 0xe6, 0xff, 0x87, 0xfe, 0x70, 0xe9,
+0x16, 0x1d, 0xfe, 0x7f, 0x3e, 0x5f, 0xba, 0x05, 0x80, 0x3f, 0xd0, 0x47, 0x4c, 0x5b, 0x4e, 0x63,
+0xd5, 0x7a, 0xe3, 0xdd, 0xe1, 0xd6, 0x4f, 0x64, 0x76, 0x08, 0x6e, 0xbf, 0xa7, 0xaf, 0x1f, 0xdb,
+0xf0, 0x71, 0x5f, 0x60, 0xd3, 0x61, 0x2e, 0x33, 0xc3, 0x74, 0x1e, 0xda, 0x4f, 0x85, 0xe9, 0xa1,
+0xfb, 0x8b, 0xfd, 0x54, 0x78, 0x36, 0xfd, 0xba, 0xff, 0xf2, 0x85, 0xe0, 0xfd, 0xc1, 0x8b, 0x97,
+0xc3, 0x28, 0xa2, 0x57, 0x4c, 0x6e, 0xdc, 0x2e, 0x2e, 0x35, 0x74, 0x1f, 0x47, 0xff, 0x0f, 0xd9,
+0x67, 0x17, 0x13, 0x2d, 0x2d, 0x00, 0x00,
+};
+
+static const uint8_t webAsset_script_js[] PROGMEM = {
+0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x7d, 0xdb, 0x72, 0xdb, 0x48,
+0x92, 0xe8, 0x3b, 0xbf, 0xa2, 0xcc, 0xf0, 0x36, 0xc1, 0x11, 0x05, 0x91, 0xa0, 0x2e, 0x94, 0x2c,
+0xc9, 0x21, 0xcb, 0xf2, 0x58, 0x67, 0x7d, 0x0b, 0x49, 0xdd, 0x33, 0xb1, 0x3a, 0x3a, 0x16, 0x44,
+0x42, 0x12, 0xc6, 0x20, 0xc0, 0x01, 0x40, 0xcb, 0x6a, 0x2d, 0x5f, 0xcf, 0xf3, 0x5e, 0x22, 0xe6,
+0x9c, 0xfd, 0x8b, 0x8d, 0xf3, 0x7c, 0x9e, 0xf6, 0x53, 0xe6, 0x4b, 0x36, 0x33, 0xeb, 0x82, 0x02,
+0x50, 0x04, 0x40, 0x77, 0xf7, 0xc6, 0x3e, 0x4c, 0x47, 0xc8, 0x4d, 0x54, 0x65, 0x66, 0x65, 0x65,
+0x65, 0x55, 0x66, 0x65, 0xdd, 0x26, 0xd1, 0x78, 0x3e, 0xf5, 0xc2, 0xd4, 0x76, 0x27, 0x93, 0x93,
+0xaf, 0xf0, 0xe3, 0x9d, 0x9f, 0xa4, 0x5e, 0xe8, 0xc5, 0x56, 0xe7, 0xf5, 0xc7, 0xf7, 0xc7, 0x51,
+0x98, 0x62, 0x5a, 0xe4, 0x4e, 0xbc, 0x49, 0xa7, 0xc7, 0xac, 0x2e, 0x3b, 0x38, 0x64, 0x4f, 0xad,
+0x71, 0x14, 0x26, 0x29, 0x0b, 0xfc, 0xaf, 0xde, 0x6b, 0x37, 0x75, 0x2f, 0xdc, 0x9b, 0x57, 0x69,
+0xc8, 0x0e, 0xd8, 0x44, 0x12, 0xbb, 0xf3, 0xd2, 0x93, 0xc0, 0xc3, 0x9f, 0xaf, 0x1e, 0x4f, 0x27,
+0x56, 0x27, 0x0f, 0xd9, 0xe9, 0xbe, 0x10, 0x14, 0x12, 0x2f, 0x4d, 0xfd, 0xf0, 0x2e, 0xa9, 0xa7,
+0x90, 0x87, 0xcc, 0x28, 0x68, 0x94, 0x05, 0xb3, 0x0d, 0xf9, 0x10, 0xd0, 0x46, 0x5e, 0x1a, 0x50,
+0x2a, 0x43, 0x67, 0x94, 0xc6, 0xf3, 0x38, 0x86, 0x84, 0x8f, 0x5f, 0xbd, 0xd8, 0x0d, 0x82, 0xf3,
+0xd4, 0x4d, 0xe7, 0x49, 0x15, 0x2d, 0x13, 0x7c, 0xa7, 0x6b, 0xff, 0x79, 0xee, 0xc5, 0x8f, 0xe7,
+0x5e, 0xe0, 0x8d, 0xd3, 0x08, 0x9a, 0x63, 0xa6, 0x55, 0xda, 0xfb, 0xea, 0x05, 0x83, 0xe3, 0x68,
+0x1e, 0xa6, 0xc7, 0x6e, 0x3c, 0xa9, 0xac, 0x71, 0x1e, 0xb4, 0x9e, 0xac, 0xd3, 0x9c, 0xac, 0xb3,
+0x02, 0xd9, 0x61, 0x73, 0xb2, 0xc3, 0x66, 0x64, 0xd3, 0x28, 0x75, 0x83, 0x37, 0x81, 0x7f, 0x77,
+0x9f, 0x26, 0x75, 0x74, 0x8b, 0xb0, 0x95, 0x84, 0x45, 0x73, 0x08, 0x70, 0x68, 0xe0, 0xc0, 0x7b,
+0x15, 0x4d, 0x1e, 0x1b, 0xb4, 0xa0, 0x8e, 0x52, 0x2e, 0x22, 0xbd, 0x01, 0x2a, 0x9a, 0xbe, 0x8d,
+0xdd, 0xf0, 0x2d, 0x74, 0xb6, 0x28, 0x7e, 0x6c, 0x54, 0x46, 0x11, 0xbe, 0xbe, 0x00, 0xf7, 0xab,
+0x77, 0x2e, 0xd4, 0xb4, 0xae, 0x77, 0xe5, 0x41, 0x33, 0x1a, 0xb1, 0x87, 0x05, 0x7a, 0xaf, 0xbd,
+0x5b, 0x77, 0x1e, 0xa4, 0x75, 0x64, 0xca, 0xd0, 0x3a, 0xa5, 0x9b, 0x28, 0x4a, 0x4f, 0x92, 0x59,
+0x2d, 0x8d, 0x0c, 0x4e, 0xab, 0x8b, 0x9f, 0x7a, 0x09, 0x0e, 0x4d, 0x95, 0xb5, 0x90, 0x40, 0x19,
+0x1e, 0x8c, 0x6a, 0xe7, 0x90, 0x5a, 0x53, 0x66, 0x06, 0x95, 0x61, 0xbe, 0x3f, 0xfa, 0xe3, 0xe7,
+0x93, 0x3f, 0x5e, 0x9c, 0x1d, 0x7d, 0x3e, 0x3f, 0xbd, 0x38, 0x39, 0x07, 0xf4, 0xc1, 0x96, 0xe2,
+0x86, 0xba, 0xe8, 0xfb, 0x68, 0xe2, 0x06, 0x95, 0xfc, 0x64, 0x60, 0x5a, 0x4d, 0x78, 0xa2, 0x97,
+0x24, 0xee, 0x9d, 0x77, 0xe1, 0x7d, 0x4b, 0x1b, 0x50, 0xc8, 0x80, 0x91, 0x4e, 0xe0, 0x49, 0x2a,
+0x17, 0xfe, 0xd4, 0x8b, 0xe6, 0xa9, 0x52, 0xdc, 0x28, 0xbc, 0xf5, 0xe3, 0xe9, 0xd1, 0x38, 0xf5,
+0xa3, 0xb0, 0x96, 0xbb, 0x32, 0xb4, 0xd6, 0x05, 0xf4, 0xbc, 0x0b, 0x3f, 0x0d, 0xbc, 0xc6, 0x94,
+0x08, 0x7a, 0x09, 0x25, 0x51, 0x91, 0xe6, 0x5c, 0x71, 0xf8, 0x25, 0xd4, 0x6a, 0x1a, 0xb5, 0x08,
+0xab, 0x51, 0x71, 0xc3, 0xb1, 0x17, 0x34, 0x23, 0x92, 0x07, 0xcd, 0xf7, 0xde, 0xd7, 0x5e, 0xea,
+0xfa, 0x41, 0x03, 0x3d, 0x28, 0xc0, 0x1a, 0xa9, 0x34, 0x1e, 0x03, 0x8a, 0xf0, 0x66, 0x6a, 0x75,
+0x6d, 0x56, 0x84, 0x25, 0xc5, 0xca, 0x59, 0x69, 0x83, 0x47, 0x30, 0x0e, 0xfc, 0xf1, 0x17, 0xcd,
+0x0d, 0x28, 0x20, 0x8c, 0x03, 0x37, 0xa1, 0xfe, 0x87, 0xa8, 0xd0, 0xab, 0x40, 0x6a, 0x5f, 0x89,
+0x70, 0xde, 0x78, 0x6b, 0x70, 0xb1, 0x37, 0x8d, 0xbe, 0x7a, 0x3a, 0x68, 0xd9, 0x42, 0x37, 0x22,
+0x5b, 0x86, 0x2d, 0x93, 0xbe, 0xf5, 0xd2, 0xf1, 0xfd, 0x3b, 0x41, 0xdf, 0x92, 0x09, 0xe7, 0xd9,
+0xb0, 0x8a, 0x69, 0xd0, 0xb1, 0xe2, 0x14, 0x81, 0x7e, 0x9c, 0x4d, 0x5c, 0x18, 0x4e, 0x30, 0x6d,
+0x51, 0xae, 0x42, 0xbd, 0x6c, 0x96, 0xd6, 0xb9, 0x50, 0x89, 0xa5, 0x32, 0x2c, 0x57, 0xa0, 0xb2,
+0xbe, 0xcb, 0xc9, 0x36, 0x91, 0x4d, 0x00, 0x1e, 0x9e, 0x34, 0x00, 0x5c, 0x0c, 0xd1, 0xcc, 0x20,
+0x85, 0xdb, 0x79, 0x48, 0x5d, 0x81, 0x4d, 0xfc, 0x64, 0x16, 0xb8, 0x8f, 0xdc, 0x57, 0xb1, 0xa6,
+0xbc, 0x9f, 0xf6, 0x58, 0xfa, 0x38, 0x43, 0xad, 0xeb, 0xf8, 0xe1, 0x6d, 0x04, 0xb2, 0x98, 0xcc,
+0x63, 0x97, 0xc0, 0x0f, 0xd8, 0xb0, 0xdf, 0xef, 0x77, 0xd1, 0x73, 0x0c, 0x3c, 0x37, 0x16, 0xe3,
+0x96, 0x95, 0x1b, 0xc5, 0xb8, 0xf0, 0xf3, 0xc3, 0x9d, 0x9d, 0xc2, 0x3f, 0x99, 0x37, 0x26, 0xca,
+0x51, 0x80, 0xd8, 0x99, 0x78, 0xb5, 0x3e, 0xb8, 0x53, 0x2c, 0xf8, 0x7a, 0x4a, 0x7d, 0x91, 0x67,
+0xaf, 0xf3, 0x8f, 0xe7, 0x4f, 0xc8, 0xd5, 0xe2, 0x3a, 0x8f, 0x95, 0xa4, 0x8f, 0x81, 0x67, 0x8b,
+0x6a, 0x20, 0xcb, 0x37, 0x41, 0x04, 0xed, 0x27, 0x81, 0x04, 0x4f, 0x90, 0x01, 0x42, 0x97, 0xec,
+0xaa, 0xa6, 0xad, 0xa2, 0x13, 0x46, 0xa1, 0x07, 0x64, 0x16, 0x59, 0xed, 0x51, 0x76, 0x34, 0x68,
+0xcf, 0xbc, 0x70, 0x02, 0x02, 0xe6, 0xa3, 0x09, 0xc0, 0x86, 0xf3, 0x20, 0xd0, 0x64, 0x9a, 0xdc,
+0x47, 0x0f, 0xc7, 0x7c, 0xd0, 0x22, 0xda, 0x56, 0x8a, 0x1d, 0xb3, 0xc7, 0x94, 0x74, 0x5d, 0x82,
+0x3b, 0x06, 0x1f, 0xf1, 0xc6, 0x1d, 0x7f, 0xe9, 0x72, 0x3f, 0xbc, 0x30, 0xf2, 0x16, 0x24, 0x46,
+0x24, 0x5e, 0xb4, 0x4c, 0xa3, 0xea, 0x32, 0xd9, 0x96, 0xed, 0xc2, 0x72, 0x61, 0x15, 0x6b, 0x94,
+0xe7, 0x10, 0xeb, 0x5d, 0x1c, 0x85, 0x1b, 0xf4, 0x9c, 0x26, 0x0c, 0x08, 0x29, 0xfb, 0xb7, 0xcc,
+0xca, 0xf1, 0x80, 0x42, 0xc9, 0x25, 0xa0, 0xe6, 0x9a, 0xe5, 0xbe, 0x20, 0x8d, 0x2e, 0x0c, 0xf0,
+0xbf, 0x2e, 0x7b, 0x4b, 0x0a, 0x86, 0x62, 0x1f, 0xfc, 0x70, 0x12, 0x3d, 0x54, 0x95, 0xe6, 0x61,
+0xba, 0x28, 0x12, 0xab, 0x49, 0xdf, 0x36, 0x8c, 0x4e, 0x30, 0x92, 0xb3, 0x83, 0x83, 0x03, 0x83,
+0xb5, 0xef, 0xfe, 0x2a, 0xdc, 0x99, 0x4b, 0x2b, 0xda, 0x30, 0x2c, 0xab, 0x98, 0xb6, 0xbc, 0x33,
+0x2c, 0xa1, 0x99, 0xf5, 0xa3, 0x6e, 0xc3, 0x6e, 0x55, 0x39, 0x7c, 0x88, 0x16, 0x25, 0x5b, 0xf8,
+0xfa, 0xe4, 0xcd, 0xd1, 0x8f, 0xef, 0x2e, 0x3e, 0xbf, 0xf9, 0x78, 0xf6, 0xfe, 0xf3, 0xf9, 0xc9,
+0xc5, 0xc5, 0xe9, 0x87, 0xdf, 0xa3, 0x13, 0x07, 0xc5, 0x24, 0xfe, 0x64, 0x8f, 0xb5, 0xdb, 0xbd,
+0xd6, 0x0c, 0x06, 0x8e, 0x87, 0x28, 0x16, 0x5f, 0xee, 0xcc, 0x3f, 0xf7, 0x62, 0x98, 0x83, 0xc1,
+0xe7, 0x7d, 0x9a, 0xce, 0xf6, 0x36, 0x36, 0x20, 0xc9, 0x8e, 0x40, 0x4c, 0xc9, 0x97, 0xc7, 0xf5,
+0xd0, 0x4b, 0x01, 0xf6, 0x8b, 0x1d, 0xc5, 0x77, 0x98, 0xbe, 0x81, 0x85, 0x7b, 0xc9, 0x06, 0xa8,
+0x3a, 0xc7, 0xfd, 0x7b, 0xef, 0x91, 0xd3, 0x09, 0xa0, 0xd3, 0xa7, 0xf3, 0x89, 0xb7, 0x07, 0x0e,
+0xa3, 0x3d, 0xdc, 0x1a, 0x39, 0x90, 0x14, 0x85, 0x77, 0x22, 0x6d, 0x67, 0xcb, 0xee, 0x3b, 0x83,
+0x7e, 0xaf, 0x15, 0xbb, 0x13, 0x7f, 0x9e, 0xbc, 0xa3, 0xe9, 0xd9, 0x1e, 0x0c, 0x8f, 0x76, 0x3e,
+0xcd, 0xd9, 0x63, 0x5b, 0xc5, 0xb4, 0x21, 0xa0, 0x53, 0x5a, 0x18, 0xf1, 0x99, 0x06, 0xda, 0xae,
+0x37, 0xb1, 0xf7, 0xe7, 0x3d, 0xb6, 0x0d, 0xa9, 0xb7, 0x94, 0xf6, 0x09, 0x9c, 0x70, 0x90, 0x73,
+0x96, 0x85, 0x85, 0x25, 0x30, 0xa3, 0x9a, 0xfc, 0xc1, 0x8d, 0x43, 0x68, 0xef, 0x3d, 0x96, 0xc6,
+0x73, 0x0f, 0xd2, 0xd0, 0x5b, 0xde, 0x63, 0x97, 0x57, 0xc0, 0x7e, 0xc0, 0x59, 0x3e, 0xf6, 0xfc,
+0x00, 0x20, 0x32, 0xa6, 0xfa, 0x7d, 0x73, 0xa6, 0x83, 0x25, 0x2e, 0xcb, 0x04, 0x36, 0x29, 0xc7,
+0x8d, 0xa7, 0x27, 0x61, 0x1a, 0x3f, 0xbe, 0x72, 0xc3, 0xc9, 0x27, 0x2f, 0x1e, 0x03, 0x57, 0x59,
+0xce, 0xdb, 0x47, 0xd0, 0x78, 0x60, 0xd5, 0x4f, 0x54, 0xd6, 0x40, 0xe6, 0xbd, 0x7e, 0xf0, 0x60,
+0x1a, 0xec, 0x8d, 0x91, 0x03, 0x91, 0x74, 0x8e, 0x15, 0x40, 0x6e, 0x5b, 0x4f, 0x0c, 0x2a, 0x03,
+0x18, 0x7b, 0x0c, 0x66, 0x75, 0xa0, 0x13, 0x3d, 0x46, 0x26, 0xfb, 0xed, 0xcf, 0x7b, 0xcc, 0x41,
+0x96, 0x18, 0x68, 0x35, 0x7d, 0x6c, 0xe3, 0xc7, 0x8d, 0xe7, 0xcd, 0xde, 0x27, 0xd8, 0x14, 0xf0,
+0x71, 0xe7, 0xd2, 0xef, 0x91, 0x48, 0x4f, 0xa8, 0x48, 0xf6, 0x35, 0x0a, 0xc0, 0x45, 0xc2, 0xdf,
+0x7d, 0xb6, 0xe8, 0x55, 0xd1, 0x1f, 0x38, 0x1a, 0x7d, 0xfe, 0x21, 0xe9, 0x0f, 0xfb, 0x19, 0xfd,
+0x61, 0x3f, 0x2b, 0x60, 0x33, 0xa3, 0x3f, 0xaa, 0x23, 0x3f, 0xd2, 0xa8, 0x8f, 0x74, 0xe2, 0x5b,
+0x1a, 0xf1, 0x1d, 0x8d, 0xb8, 0x93, 0x11, 0xdf, 0x06, 0xe2, 0xad, 0xab, 0xd6, 0x42, 0x33, 0x27,
+0x62, 0x52, 0x73, 0x16, 0x3d, 0x58, 0xd8, 0xd4, 0x5d, 0x31, 0x8e, 0xa8, 0x49, 0x92, 0x3d, 0xbe,
+0xf7, 0x83, 0x09, 0x4c, 0x5b, 0xed, 0xc0, 0x0b, 0xef, 0xd2, 0x7b, 0x76, 0x78, 0x50, 0x9c, 0xf4,
+0x20, 0x4e, 0xde, 0xd2, 0x5f, 0x1f, 0xa5, 0x6c, 0x1a, 0x41, 0xff, 0x7a, 0xfe, 0x54, 0x80, 0x5d,
+0x60, 0x81, 0x3e, 0x96, 0x8c, 0x06, 0x18, 0x0b, 0x61, 0x6e, 0xec, 0xb1, 0x64, 0x3e, 0x9b, 0x45,
+0x71, 0xea, 0x4d, 0xec, 0xeb, 0x1e, 0xeb, 0x78, 0x71, 0x1c, 0xc5, 0xe8, 0x6f, 0xc4, 0x5e, 0x3a,
+0x8f, 0x43, 0x61, 0x20, 0x70, 0x76, 0x18, 0x3d, 0xe8, 0xde, 0xea, 0x38, 0xf6, 0xa0, 0x77, 0x09,
+0x87, 0xd5, 0xea, 0x4c, 0xfc, 0xaf, 0x84, 0x04, 0x23, 0xa6, 0x6e, 0xed, 0x69, 0xc2, 0xb7, 0x0e,
+0xa9, 0x1d, 0x9e, 0xe7, 0x87, 0x30, 0x84, 0xbe, 0xbd, 0x78, 0xff, 0x0e, 0x3d, 0x81, 0x16, 0xd3,
+0xfe, 0xdb, 0xf7, 0xc3, 0x19, 0x58, 0x73, 0x74, 0x04, 0x0e, 0xda, 0x68, 0xf7, 0xda, 0x8c, 0x08,
+0x1d, 0xb4, 0x89, 0x44, 0x08, 0xf4, 0xda, 0x6c, 0xea, 0x7e, 0xe3, 0x92, 0x38, 0x68, 0x0f, 0xb6,
+0xda, 0x0c, 0x6a, 0x3d, 0xf6, 0xee, 0xa3, 0x60, 0xe2, 0xc5, 0x07, 0x6d, 0x2c, 0xb1, 0x7d, 0xb8,
+0x9c, 0x66, 0x38, 0x9f, 0xde, 0x78, 0x71, 0x9e, 0x2a, 0x0c, 0x04, 0x6d, 0x68, 0x5d, 0x6f, 0x76,
+0xd0, 0x76, 0xc3, 0x47, 0xa0, 0xef, 0x87, 0x07, 0xed, 0xf5, 0xdd, 0x3e, 0x95, 0x74, 0xd0, 0xc6,
+0x1f, 0xb9, 0x32, 0xde, 0x89, 0x81, 0x63, 0xe5, 0x72, 0xa2, 0xd0, 0x50, 0xce, 0x60, 0x24, 0x0b,
+0xa2, 0x5f, 0xf9, 0x92, 0xe4, 0x78, 0xb4, 0x6a, 0x51, 0xf1, 0xa0, 0x5c, 0x52, 0xdf, 0x1e, 0x14,
+0xc9, 0x0f, 0xd8, 0x97, 0xe9, 0xca, 0xa4, 0x9d, 0x46, 0xa4, 0x9d, 0xef, 0x21, 0x3d, 0x6c, 0x44,
+0x7a, 0x68, 0x20, 0x9d, 0x50, 0x70, 0x25, 0x47, 0x8d, 0xc6, 0xa3, 0x02, 0x1c, 0xc1, 0x46, 0x33,
+0xea, 0x77, 0x5f, 0xdd, 0x60, 0x0e, 0x8c, 0xd0, 0x90, 0xdb, 0x3e, 0x7c, 0x77, 0xf2, 0x9a, 0xad,
+0x31, 0xfa, 0xd8, 0xdf, 0xe0, 0x10, 0xb5, 0xa8, 0x81, 0x27, 0x10, 0xa3, 0x30, 0x78, 0x6c, 0x8c,
+0x85, 0x16, 0xb2, 0x7d, 0xf8, 0x21, 0x62, 0xc4, 0xa0, 0x19, 0x6d, 0x7f, 0x83, 0x57, 0xa8, 0x90,
+0x7a, 0x33, 0x4f, 0x61, 0x30, 0x12, 0x12, 0xe4, 0x1f, 0x4a, 0x82, 0x7c, 0xae, 0xb0, 0x8e, 0x55,
+0x6f, 0x1f, 0x9e, 0xd1, 0xc7, 0xfe, 0x06, 0x87, 0xc9, 0xa8, 0x5c, 0xf3, 0x0e, 0x58, 0x88, 0x47,
+0xd9, 0xaa, 0x73, 0x75, 0xba, 0x36, 0x71, 0x89, 0xfe, 0x34, 0xa4, 0xd9, 0x98, 0xc6, 0xfe, 0xf1,
+0x1f, 0x59, 0xa7, 0x53, 0x81, 0x08, 0xfd, 0xa7, 0x88, 0x27, 0x6d, 0x2b, 0x7b, 0xf9, 0xb2, 0x06,
+0x37, 0x0a, 0x4b, 0xb8, 0x52, 0xe9, 0x6b, 0x91, 0xe3, 0x41, 0x11, 0x57, 0x37, 0xd6, 0xf5, 0xe8,
+0x4e, 0x05, 0xba, 0x53, 0x8f, 0x3e, 0xac, 0x40, 0x1f, 0xd6, 0xa2, 0x53, 0xeb, 0x17, 0x29, 0x50,
+0x22, 0x09, 0x9c, 0x34, 0x71, 0x09, 0xbe, 0xd6, 0xd4, 0x40, 0xa0, 0xce, 0x13, 0x46, 0x0a, 0x62,
+0x22, 0xd9, 0xc5, 0xb9, 0x9b, 0xb2, 0x2b, 0xee, 0x0c, 0x3d, 0xcb, 0x63, 0xb4, 0x2e, 0x16, 0x00,
+0x91, 0x63, 0xa6, 0xac, 0xd2, 0x2c, 0x9a, 0xcd, 0xa1, 0x15, 0x3d, 0x34, 0x4d, 0x09, 0x37, 0x46,
+0xe4, 0xfb, 0x29, 0x6c, 0x7d, 0x10, 0xc7, 0x8a, 0x72, 0x18, 0xe4, 0xfd, 0xf2, 0xaa, 0x6b, 0xdf,
+0x46, 0xf1, 0x89, 0x3b, 0xbe, 0xb7, 0x32, 0xe3, 0x96, 0x27, 0x3f, 0x8e, 0x02, 0xac, 0x0e, 0xa7,
+0xde, 0x55, 0x2b, 0x15, 0x9c, 0xc6, 0x01, 0x90, 0x00, 0x03, 0x19, 0xc5, 0xcc, 0xca, 0xac, 0x4e,
+0x74, 0xcb, 0xca, 0x26, 0x31, 0xc3, 0xbc, 0xf5, 0xbd, 0x00, 0x43, 0xcb, 0xe3, 0x20, 0x91, 0x95,
+0xce, 0x8b, 0x0d, 0x32, 0x72, 0x51, 0x4a, 0xf2, 0x31, 0x51, 0xbf, 0xf7, 0x38, 0xae, 0xa9, 0x1b,
+0xd8, 0x69, 0xec, 0x4f, 0x81, 0x3d, 0xa8, 0xd4, 0x35, 0xb2, 0x0a, 0xd6, 0x94, 0x78, 0x90, 0x96,
+0x78, 0x8d, 0x0d, 0x16, 0xd7, 0xba, 0x27, 0x39, 0x73, 0xe3, 0xc4, 0x7b, 0x03, 0x93, 0xf4, 0xd4,
+0xca, 0x11, 0xd5, 0xba, 0x48, 0x37, 0xe7, 0x66, 0x2e, 0x45, 0xc8, 0xfa, 0x45, 0xb7, 0xe8, 0x83,
+0x2e, 0xc3, 0xc9, 0xba, 0x43, 0xb7, 0xe8, 0xa2, 0x2e, 0x45, 0x71, 0xcc, 0x28, 0xc3, 0x0a, 0x94,
+0xa1, 0x86, 0x42, 0xfa, 0x5a, 0x10, 0x60, 0x4e, 0xb1, 0xd1, 0xd3, 0xe1, 0x32, 0x87, 0x4f, 0x1f,
+0x1b, 0xe8, 0x99, 0x0f, 0x6e, 0xc1, 0x07, 0x2b, 0x37, 0x4c, 0x74, 0xd9, 0x0f, 0x3f, 0xb0, 0xf7,
+0x6e, 0x7a, 0x6f, 0xbb, 0x37, 0x49, 0x31, 0x6b, 0xff, 0x80, 0xed, 0xf6, 0x01, 0xa0, 0x95, 0xc3,
+0x94, 0x22, 0x34, 0xa1, 0x66, 0x79, 0x80, 0x0b, 0x56, 0x15, 0x91, 0xcb, 0xc3, 0xc3, 0x21, 0xc3,
+0x0c, 0x43, 0xc7, 0x3f, 0x34, 0x8c, 0x25, 0x06, 0xc0, 0xa1, 0x01, 0xd0, 0x31, 0x74, 0xd8, 0xa3,
+0x20, 0xb0, 0x3a, 0x64, 0xfa, 0x3a, 0x59, 0xbf, 0xe0, 0xa6, 0x10, 0x14, 0x95, 0x7e, 0x68, 0x21,
+0x9f, 0x34, 0xba, 0xbb, 0x0b, 0x3c, 0x44, 0x20, 0x81, 0x41, 0x2f, 0x7e, 0x46, 0x3f, 0xb0, 0xeb,
+0xa2, 0x5b, 0x28, 0xbe, 0xca, 0x0e, 0xdf, 0x29, 0x47, 0xe0, 0xba, 0xdd, 0xe6, 0x8a, 0x4a, 0xe3,
+0xf7, 0xa2, 0xbd, 0xc7, 0xc6, 0xf7, 0xde, 0xf8, 0x0b, 0x74, 0x3a, 0x98, 0x44, 0xf9, 0xa1, 0x4b,
+0x3e, 0x5f, 0x38, 0x61, 0xc8, 0xb8, 0xcf, 0x2c, 0x70, 0x03, 0xf6, 0x19, 0x18, 0x6c, 0xf8, 0x67,
+0xd8, 0x35, 0xb9, 0x7f, 0x6a, 0xc6, 0xc9, 0x95, 0x7f, 0x36, 0x4f, 0xee, 0xb9, 0xab, 0x8a, 0x69,
+0x02, 0x84, 0xb2, 0xf0, 0x3b, 0x8b, 0xd1, 0xd7, 0x8e, 0x4c, 0x9a, 0xe7, 0xfb, 0xb4, 0xe8, 0xaa,
+0xde, 0xf9, 0x33, 0x18, 0xc8, 0xe4, 0x8d, 0x5f, 0x1d, 0x17, 0x55, 0x40, 0x9d, 0x3c, 0x5e, 0xdd,
+0xda, 0x83, 0x02, 0xca, 0xaf, 0x20, 0xfc, 0xc3, 0xc7, 0x0f, 0xb4, 0x76, 0x30, 0x2a, 0x26, 0x7e,
+0xfe, 0xe9, 0xe4, 0xec, 0xe2, 0xf4, 0x98, 0x32, 0xb7, 0x06, 0x8e, 0xe6, 0xb7, 0xdf, 0x79, 0xd1,
+0xff, 0x48, 0xa2, 0xf0, 0x22, 0xfa, 0x07, 0x24, 0x69, 0x89, 0x4f, 0x6d, 0x44, 0x02, 0xd7, 0x78,
+0x1e, 0xd3, 0x70, 0x26, 0xf2, 0x6c, 0x1e, 0x76, 0x83, 0x19, 0x75, 0xe7, 0x0d, 0xcf, 0x3c, 0xe6,
+0xc3, 0x20, 0x90, 0xeb, 0xb0, 0x97, 0x0a, 0x4c, 0x61, 0xc2, 0x3c, 0x4a, 0xa4, 0x5d, 0xe5, 0x2a,
+0x29, 0x47, 0x48, 0x01, 0xa7, 0xb4, 0xca, 0x12, 0x29, 0x3d, 0xe6, 0xe7, 0x16, 0x80, 0x81, 0xc8,
+0xd4, 0x83, 0x19, 0x1e, 0xe0, 0x09, 0x08, 0x5b, 0x25, 0xc1, 0xd8, 0xf6, 0xa4, 0x3a, 0xe9, 0x2c,
+0x0a, 0x1e, 0xef, 0xe0, 0x17, 0xe7, 0x99, 0x00, 0x34, 0xa6, 0x3f, 0xf1, 0x5c, 0x64, 0xf5, 0x52,
+0x65, 0x6b, 0x4a, 0x75, 0xd5, 0xda, 0x33, 0xa1, 0xbd, 0x9f, 0xc3, 0xe4, 0x53, 0xc3, 0x35, 0xa1,
+0x42, 0x55, 0xb9, 0x92, 0x91, 0x8e, 0x4b, 0x36, 0x40, 0x98, 0x4c, 0xcc, 0x40, 0x98, 0x9c, 0x81,
+0xcc, 0xe2, 0x68, 0x96, 0x68, 0x15, 0xc1, 0x6f, 0x2f, 0x4e, 0x7d, 0x6e, 0x7b, 0xb2, 0xaa, 0xc4,
+0x18, 0x22, 0x15, 0x82, 0x92, 0xf4, 0x94, 0xa0, 0x44, 0x02, 0xca, 0x48, 0xfc, 0x54, 0x59, 0x88,
+0xa7, 0xcb, 0x6e, 0x16, 0xf9, 0x61, 0x8a, 0x84, 0x30, 0xc3, 0x9e, 0xba, 0x33, 0xcb, 0xba, 0x84,
+0x11, 0xa6, 0xc7, 0x60, 0x84, 0xba, 0x22, 0x29, 0x5f, 0xc2, 0x2f, 0xf8, 0x84, 0x46, 0x52, 0x2a,
+0x75, 0xeb, 0xc7, 0xa4, 0x86, 0x1c, 0xf9, 0xb2, 0x7f, 0x85, 0xe0, 0x7a, 0x0a, 0xff, 0x9f, 0xb4,
+0x23, 0xeb, 0x6c, 0x70, 0xc5, 0xab, 0x4e, 0x88, 0x00, 0xcf, 0x9e, 0x81, 0xe4, 0x10, 0x05, 0x7f,
+0x43, 0xbd, 0x78, 0xfa, 0x40, 0x4b, 0x1f, 0x5c, 0xa1, 0x74, 0x04, 0x1d, 0xea, 0x92, 0x04, 0xd3,
+0x45, 0x49, 0x51, 0xdd, 0x79, 0x22, 0x07, 0xa0, 0xb0, 0x30, 0xfc, 0x43, 0xda, 0xc3, 0x33, 0x9e,
+0x18, 0x37, 0x7e, 0xe7, 0x29, 0x42, 0x5b, 0x24, 0x56, 0xe5, 0xef, 0x5d, 0xa3, 0x4e, 0x83, 0xb5,
+0xf3, 0xb9, 0x89, 0xeb, 0xda, 0x09, 0x74, 0x5c, 0xcf, 0x82, 0x29, 0xed, 0x70, 0xd0, 0xed, 0xf1,
+0x95, 0x62, 0x61, 0x22, 0x4e, 0x61, 0xe2, 0xc7, 0x91, 0x29, 0x15, 0xb1, 0x11, 0x84, 0x8b, 0x7f,
+0x21, 0xe2, 0xd1, 0x62, 0x90, 0xa0, 0xe2, 0x73, 0x7e, 0x80, 0x17, 0x8e, 0xa3, 0x89, 0xc7, 0x7b,
+0x10, 0xe5, 0x66, 0xfd, 0x07, 0x79, 0x79, 0xf5, 0xc8, 0xfd, 0x01, 0xce, 0x37, 0x0a, 0x1f, 0x7f,
+0xa1, 0xd0, 0x43, 0xef, 0x81, 0x61, 0xe4, 0xf9, 0x84, 0x08, 0xc4, 0x56, 0xd7, 0xe6, 0xa4, 0x08,
+0x80, 0xea, 0xd1, 0x95, 0x4b, 0x70, 0xfe, 0xcf, 0x1e, 0xef, 0xd9, 0x9c, 0x8a, 0xea, 0x2c, 0xf8,
+0x99, 0xf5, 0x14, 0x02, 0x5b, 0x3b, 0x60, 0x9b, 0x50, 0x65, 0x55, 0xf4, 0xa5, 0x7f, 0x25, 0xda,
+0x88, 0x63, 0xdb, 0x5c, 0xb2, 0x25, 0x5d, 0x61, 0x12, 0xdb, 0x01, 0x6c, 0x52, 0x14, 0xd1, 0xb2,
+0xbf, 0x83, 0x72, 0x95, 0x14, 0x84, 0x21, 0xf4, 0x3d, 0x9c, 0x43, 0x63, 0x05, 0x30, 0xf0, 0xff,
+0x13, 0x7c, 0x5a, 0xf8, 0x71, 0x14, 0xc7, 0xee, 0xe3, 0xab, 0xf9, 0xed, 0x2d, 0xd4, 0x06, 0xc9,
+0x49, 0xfe, 0x67, 0x11, 0x4a, 0xa0, 0xff, 0xa2, 0x75, 0xd9, 0xff, 0xb6, 0xb9, 0xdd, 0x63, 0xfd,
+0x6f, 0x5b, 0x47, 0xf8, 0xef, 0xe6, 0x09, 0xfe, 0x3b, 0x1c, 0x5c, 0x29, 0x76, 0x6e, 0x90, 0x17,
+0x24, 0x6f, 0x27, 0x5e, 0xfa, 0x23, 0xb4, 0xfb, 0x08, 0x9a, 0x3f, 0x59, 0x5b, 0xeb, 0xb1, 0x1b,
+0x24, 0xa6, 0xe7, 0x0c, 0xb6, 0x31, 0xab, 0x27, 0x04, 0xcb, 0x99, 0xed, 0x51, 0xc0, 0x09, 0x14,
+0x08, 0x4b, 0x44, 0x49, 0xd4, 0x48, 0xcc, 0x58, 0x12, 0x49, 0x89, 0x34, 0xa1, 0x50, 0xa2, 0x82,
+0x30, 0x08, 0xb7, 0x82, 0x39, 0x21, 0x71, 0x33, 0x87, 0x30, 0x1c, 0xe7, 0xa8, 0x35, 0x14, 0x44,
+0x55, 0x4b, 0x1a, 0x19, 0xd1, 0x5a, 0xd4, 0xc0, 0x02, 0xe5, 0x2a, 0x19, 0x69, 0xa3, 0x41, 0x9e,
+0x20, 0xf9, 0x52, 0x43, 0x87, 0x53, 0x24, 0xa0, 0x92, 0xb8, 0xcd, 0xa0, 0x38, 0xd8, 0x94, 0x40,
+0xa5, 0x4e, 0x69, 0xbd, 0x8b, 0xb0, 0x6f, 0x48, 0x81, 0x72, 0x7d, 0x6c, 0x3e, 0xc3, 0x55, 0xa3,
+0x42, 0x1f, 0xcb, 0x7b, 0x0f, 0xed, 0x1f, 0x09, 0x06, 0x85, 0xc0, 0x9b, 0xdc, 0xb6, 0xdb, 0x3d,
+0xb1, 0x3c, 0x24, 0x17, 0xe0, 0xac, 0xce, 0x86, 0x46, 0x09, 0x8c, 0xf8, 0x13, 0x83, 0x61, 0xfc,
+0x3e, 0x9a, 0xec, 0x81, 0x65, 0xf8, 0x78, 0x7e, 0x01, 0x29, 0xf7, 0x9e, 0x0b, 0x7d, 0x31, 0xd9,
+0x83, 0xac, 0x8e, 0x58, 0xb1, 0x58, 0xbf, 0x00, 0x3b, 0xd0, 0x01, 0x10, 0x98, 0x6d, 0xc0, 0x18,
+0x42, 0x0b, 0x2d, 0x1b, 0xd1, 0x38, 0xf5, 0xd2, 0xf5, 0x24, 0x8d, 0x3d, 0x77, 0xda, 0x61, 0x0b,
+0x68, 0x96, 0x68, 0xf2, 0xb8, 0x67, 0x1a, 0x0c, 0x16, 0xdd, 0x96, 0x9d, 0xde, 0x7b, 0xa1, 0x05,
+0x66, 0x6e, 0x06, 0xdd, 0x87, 0xfa, 0xbe, 0xfc, 0x4d, 0x2b, 0x23, 0xd0, 0xf3, 0x09, 0x20, 0xa5,
+0x25, 0x7a, 0x19, 0x85, 0x7f, 0xa6, 0x60, 0x22, 0x5c, 0x80, 0x61, 0xe9, 0x3d, 0xce, 0x21, 0xb0,
+0x9b, 0x9d, 0xa0, 0x6f, 0x43, 0xd0, 0x34, 0x54, 0x16, 0xe4, 0x40, 0x85, 0x33, 0xe2, 0xd5, 0xc3,
+0x78, 0x33, 0x74, 0x67, 0x04, 0x05, 0x59, 0x24, 0xf3, 0xf1, 0xd8, 0x4b, 0xb0, 0xde, 0x5b, 0xb8,
+0x44, 0xc6, 0x97, 0xe2, 0x38, 0xaf, 0x7c, 0x74, 0x6d, 0xd9, 0x50, 0x3b, 0x10, 0x13, 0x39, 0x4f,
+0xc8, 0x89, 0x81, 0xb4, 0x68, 0x0b, 0x76, 0xeb, 0x82, 0xe7, 0x22, 0xe8, 0x13, 0xbc, 0xad, 0x16,
+0x8f, 0x84, 0xf3, 0xd5, 0xa3, 0xc0, 0x6d, 0x37, 0x3f, 0x6b, 0xd2, 0x8a, 0x84, 0x7a, 0xca, 0x56,
+0x01, 0x17, 0x87, 0x37, 0x49, 0xa5, 0xac, 0xfe, 0x94, 0xe0, 0x22, 0x8b, 0x04, 0x11, 0x6e, 0x04,
+0x8a, 0x4b, 0x79, 0x44, 0xb9, 0x29, 0x9d, 0x3e, 0x30, 0x90, 0x19, 0xef, 0x83, 0xe5, 0xee, 0xec,
+0x07, 0x3e, 0x46, 0x2e, 0xa4, 0xf9, 0xe4, 0x40, 0xfb, 0x1b, 0x90, 0xda, 0x01, 0x0b, 0x8e, 0xd3,
+0xc0, 0xfc, 0x88, 0x21, 0x47, 0x6b, 0x39, 0xa6, 0x83, 0xb7, 0x37, 0xad, 0x88, 0x1f, 0x06, 0x3e,
+0x6a, 0x1b, 0x02, 0x15, 0x16, 0xbd, 0xae, 0x9f, 0x3f, 0xa9, 0x71, 0x7d, 0xb1, 0xc7, 0xc8, 0xd7,
+0x66, 0x22, 0x8d, 0x06, 0x1b, 0xd0, 0x21, 0xf1, 0xf9, 0x15, 0x9d, 0x01, 0x68, 0xa9, 0x05, 0x93,
+0xbf, 0xae, 0x5f, 0x68, 0x75, 0xd4, 0x27, 0xbd, 0x58, 0x90, 0xea, 0x46, 0xa5, 0xe6, 0x43, 0x8e,
+0xa3, 0xc0, 0xb3, 0x29, 0xc1, 0x6a, 0x93, 0xde, 0xb0, 0x5c, 0x2f, 0xd9, 0x83, 0x3e, 0x42, 0xb9,
+0xbc, 0x99, 0x96, 0xfa, 0x9c, 0x5a, 0xb7, 0xa1, 0xbd, 0x09, 0xcd, 0x16, 0xaf, 0xc8, 0x8d, 0x20,
+0x27, 0x58, 0xf9, 0xba, 0x36, 0x26, 0xa0, 0x3b, 0x21, 0xfc, 0x24, 0xfc, 0x44, 0xed, 0x2e, 0x68,
+0xda, 0xf1, 0x7d, 0x14, 0x41, 0xeb, 0xbb, 0xec, 0xf7, 0xe0, 0x3c, 0x9e, 0x7f, 0xfc, 0xc0, 0xe9,
+0x90, 0x7b, 0x40, 0xdd, 0x5a, 0xba, 0xf7, 0x9a, 0x6f, 0x85, 0x10, 0x4b, 0xba, 0x53, 0xde, 0xef,
+0x2c, 0x78, 0xbd, 0x48, 0xde, 0x26, 0x3f, 0x80, 0x77, 0xa9, 0xcc, 0xca, 0x09, 0xe1, 0x2b, 0x55,
+0x8a, 0xbd, 0xc9, 0x1c, 0x5c, 0x08, 0x2b, 0xe4, 0xe3, 0x3a, 0xd5, 0x33, 0x04, 0xf5, 0xd7, 0x06,
+0x63, 0x09, 0x32, 0xe5, 0x23, 0x2e, 0x81, 0x4c, 0xf3, 0x06, 0x15, 0x4c, 0x5e, 0x17, 0xff, 0xb8,
+0x00, 0xca, 0x4a, 0x6a, 0xea, 0xeb, 0xed, 0x30, 0x62, 0xc2, 0xfd, 0x64, 0xd0, 0x84, 0xba, 0x3b,
+0x9a, 0x39, 0xe9, 0xb7, 0x14, 0x06, 0xa4, 0x21, 0xa1, 0x44, 0xf9, 0x30, 0x9b, 0x22, 0x98, 0xe8,
+0x5f, 0xbb, 0xb9, 0x58, 0x3b, 0xc1, 0x2d, 0x84, 0xc0, 0x72, 0xa1, 0xf5, 0x6b, 0x45, 0x5e, 0x49,
+0xe7, 0xb0, 0x3c, 0xd1, 0x30, 0x16, 0xf1, 0xfc, 0xa9, 0xac, 0xd7, 0x3d, 0x56, 0x2e, 0x58, 0x51,
+0x59, 0x2c, 0x2b, 0x9a, 0xd7, 0x2c, 0x01, 0x17, 0x5c, 0xf5, 0xce, 0x67, 0x56, 0xd6, 0x91, 0x70,
+0x75, 0x81, 0xa6, 0xbb, 0x5a, 0x12, 0xcc, 0xa2, 0x87, 0xdd, 0xae, 0x51, 0xb4, 0x99, 0xf7, 0x2d,
+0x60, 0xa7, 0x73, 0xe0, 0xe7, 0xc6, 0x63, 0x83, 0x1e, 0xf8, 0x42, 0x20, 0xed, 0x21, 0x97, 0x69,
+0xd9, 0x06, 0x61, 0x9f, 0xab, 0x19, 0x31, 0xe5, 0x94, 0x56, 0xa8, 0x71, 0xc3, 0xe1, 0x12, 0xfe,
+0x96, 0x6f, 0x13, 0xc2, 0x65, 0xc9, 0x95, 0x3a, 0x62, 0x69, 0xb1, 0xbf, 0x2d, 0xbe, 0xd8, 0x31,
+0xd2, 0x62, 0x44, 0x0c, 0x3a, 0x55, 0x9b, 0x87, 0x5c, 0x99, 0x1b, 0x04, 0xf9, 0xe1, 0xf1, 0x65,
+0x5b, 0x12, 0xd3, 0x65, 0x70, 0x79, 0xd5, 0xcd, 0x39, 0x85, 0x14, 0xee, 0xab, 0xdf, 0x38, 0xa7,
+0xa0, 0xc8, 0x2a, 0x63, 0x80, 0x0c, 0x3d, 0x44, 0x2e, 0x79, 0x68, 0xb7, 0x17, 0x2c, 0x6b, 0x30,
+0xf1, 0x7b, 0x6d, 0x2d, 0xf3, 0xa8, 0x7f, 0xeb, 0xc5, 0x9b, 0xc0, 0xbd, 0xf1, 0x82, 0x43, 0x39,
+0x38, 0xf3, 0x71, 0x19, 0x8c, 0x03, 0xa5, 0x56, 0x86, 0xeb, 0xb1, 0x5a, 0xeb, 0x7c, 0xbd, 0xad,
+0x3e, 0x60, 0x9f, 0x52, 0xfc, 0xfc, 0x95, 0xe7, 0xcd, 0x60, 0x02, 0x92, 0xa6, 0x5e, 0x1c, 0x36,
+0x0e, 0xbd, 0x43, 0xe3, 0xce, 0xda, 0x87, 0xb4, 0x46, 0xc9, 0xf0, 0xf7, 0x4a, 0xc1, 0xf7, 0xaa,
+0xd5, 0x0b, 0x5e, 0x01, 0x5c, 0x20, 0x14, 0xcb, 0x16, 0x83, 0xbe, 0x5c, 0xd5, 0x19, 0x8e, 0xf0,
+0x27, 0xed, 0xef, 0x38, 0x68, 0x9f, 0x23, 0x08, 0xbb, 0x8d, 0xbd, 0x3f, 0xcf, 0xc1, 0xd9, 0x79,
+0x64, 0xd6, 0xdb, 0x9f, 0xbb, 0x85, 0xe5, 0x0d, 0x0e, 0xf2, 0xf6, 0xe7, 0xf6, 0xaa, 0xc5, 0x83,
+0x59, 0xab, 0x2e, 0xfc, 0x04, 0x6a, 0x5d, 0x59, 0x34, 0x02, 0x7c, 0x47, 0xc1, 0xb8, 0xca, 0x29,
+0x4a, 0x76, 0x64, 0xc1, 0xb8, 0xc4, 0xab, 0x0a, 0xa6, 0xb6, 0x12, 0x63, 0xa9, 0x35, 0x4d, 0x8a,
+0xc5, 0x52, 0xf6, 0x34, 0x59, 0xb9, 0xdc, 0x3b, 0x57, 0x16, 0x6b, 0x2c, 0xf5, 0xf7, 0xee, 0x0c,
+0x06, 0xa2, 0xf4, 0xc1, 0xf3, 0x42, 0xbe, 0x10, 0x6b, 0x2a, 0x1b, 0x81, 0xbe, 0xa3, 0x68, 0xa2,
+0x27, 0xa5, 0xad, 0x0a, 0x57, 0x45, 0x7f, 0x20, 0x1c, 0x0c, 0x59, 0x0b, 0xc0, 0x52, 0x7d, 0x57,
+0x2f, 0x92, 0xaf, 0x20, 0x17, 0x2a, 0x3c, 0xd0, 0xea, 0xfb, 0x13, 0x01, 0x30, 0xeb, 0xef, 0x8a,
+0x75, 0x84, 0x0c, 0xf6, 0x77, 0xed, 0xdc, 0x22, 0x90, 0xdc, 0x99, 0x1d, 0xc2, 0xf4, 0x1d, 0xca,
+0xa5, 0xf0, 0x46, 0x55, 0xdc, 0x72, 0xc9, 0x3a, 0x86, 0xd6, 0x6f, 0xcd, 0x83, 0xe9, 0xbd, 0x1b,
+0xde, 0xe1, 0xda, 0x39, 0x6d, 0x29, 0xe1, 0x03, 0x6a, 0x56, 0x68, 0x39, 0x18, 0xfa, 0x24, 0xc2,
+0xa1, 0x60, 0x07, 0x70, 0xd7, 0x24, 0x86, 0x8b, 0xf5, 0xcd, 0x28, 0x62, 0xad, 0x04, 0x43, 0x20,
+0x7c, 0x51, 0x3e, 0x9b, 0x5a, 0x67, 0x23, 0x63, 0xc3, 0x65, 0x0d, 0x82, 0xb7, 0x38, 0x1a, 0x8e,
+0x90, 0xe2, 0x67, 0x71, 0xfd, 0x82, 0x27, 0x17, 0xe3, 0x69, 0x7c, 0x20, 0xd5, 0xca, 0x94, 0xeb,
+0x11, 0x30, 0x09, 0x15, 0xae, 0x19, 0x96, 0x9c, 0x8b, 0x5e, 0x35, 0x10, 0xa0, 0x5a, 0x0a, 0xc2,
+0x64, 0x9b, 0x27, 0xd3, 0x62, 0x10, 0xaf, 0x6c, 0x15, 0x09, 0x1c, 0x34, 0xca, 0x14, 0xf8, 0x8e,
+0x85, 0x2a, 0x44, 0x90, 0x54, 0x09, 0x8d, 0xb6, 0x36, 0x54, 0x21, 0xa1, 0x52, 0x97, 0xb0, 0xf8,
+0x26, 0x88, 0x2a, 0x34, 0xe8, 0xaf, 0x25, 0x2c, 0xda, 0x2d, 0x51, 0x57, 0x56, 0x62, 0x2c, 0xac,
+0x12, 0x8d, 0xf7, 0x96, 0x12, 0x1e, 0x4f, 0x5e, 0x39, 0x48, 0x6f, 0xd0, 0xcb, 0x5c, 0x1b, 0x51,
+0x98, 0x13, 0x0d, 0x8a, 0xa6, 0x91, 0x86, 0xc5, 0x2e, 0xae, 0x73, 0xa8, 0x6d, 0x62, 0xc6, 0x4e,
+0x21, 0x1f, 0xfb, 0x36, 0x8e, 0xa6, 0x96, 0x41, 0x99, 0xba, 0x14, 0xf0, 0x22, 0x5d, 0x3b, 0x64,
+0xd6, 0x53, 0x4b, 0x6e, 0x48, 0x69, 0xaa, 0x49, 0xbd, 0x96, 0xda, 0xb2, 0xa2, 0x22, 0x75, 0x0d,
+0x55, 0xa8, 0xdb, 0x6b, 0x89, 0x0d, 0x2e, 0x0d, 0x30, 0x35, 0x1d, 0x02, 0x3c, 0xb9, 0x19, 0xa6,
+0x01, 0xa2, 0xae, 0x47, 0x80, 0x29, 0x76, 0xce, 0x34, 0x40, 0xd4, 0x34, 0x49, 0x94, 0xd8, 0xbc,
+0xc0, 0x44, 0xc3, 0x94, 0xbb, 0x72, 0x1a, 0xa0, 0xe6, 0x15, 0xaa, 0xcb, 0xc3, 0xa9, 0x32, 0x26,
+0x8d, 0x4d, 0x5f, 0xeb, 0xbc, 0x29, 0xa0, 0x6c, 0xe5, 0xe1, 0xf8, 0xdd, 0xe9, 0xa7, 0xcf, 0xe7,
+0x47, 0xef, 0x3f, 0xbd, 0x3b, 0xf9, 0x7c, 0x76, 0x74, 0x71, 0x82, 0x61, 0x4a, 0x30, 0x61, 0xfa,
+0x1a, 0x04, 0x07, 0x39, 0x39, 0xfe, 0xf8, 0xe1, 0x35, 0x9d, 0x6d, 0xd8, 0x96, 0x99, 0xa7, 0xef,
+0x8f, 0x3e, 0x9f, 0x5f, 0x9c, 0x7c, 0xc2, 0xd4, 0xcb, 0x9d, 0x1e, 0x1b, 0xf5, 0xd8, 0x6e, 0x8f,
+0x36, 0x4a, 0x0d, 0xc0, 0xf7, 0x1e, 0x38, 0xf0, 0x37, 0x84, 0xbf, 0x4d, 0xf8, 0xdb, 0x86, 0x3f,
+0x80, 0x18, 0x40, 0xbe, 0x83, 0x7e, 0x39, 0xa4, 0x3b, 0x5b, 0xf0, 0x37, 0xc2, 0x70, 0x2e, 0xfc,
+0x01, 0xcc, 0x10, 0xf2, 0x37, 0xe1, 0xf7, 0xe6, 0x16, 0xc6, 0x37, 0xe0, 0x6f, 0x0b, 0x3d, 0x6a,
+0xf8, 0xdb, 0xee, 0xb5, 0x76, 0x00, 0x1e, 0xf7, 0x62, 0x8d, 0xb0, 0x08, 0xa4, 0xd3, 0xc7, 0x7f,
+0x06, 0x23, 0x2c, 0x01, 0x8b, 0xdb, 0xc4, 0x72, 0xb6, 0x30, 0x0d, 0x21, 0x07, 0xbb, 0x90, 0xe6,
+0xf4, 0xb1, 0x2c, 0xcc, 0x75, 0xb6, 0xb0, 0xb4, 0x1d, 0xf8, 0x1c, 0x22, 0xda, 0x10, 0x0b, 0x1a,
+0xee, 0x60, 0x49, 0x7d, 0x20, 0xb0, 0xb9, 0x09, 0x19, 0x9b, 0xbb, 0xc0, 0xc0, 0xd6, 0xe6, 0x66,
+0xaf, 0xb5, 0xb5, 0x0b, 0x69, 0xdb, 0x5b, 0xf0, 0xcf, 0x8e, 0x03, 0x69, 0x3b, 0xbb, 0xc0, 0xf9,
+0x68, 0x07, 0xfe, 0xd9, 0xdd, 0x46, 0xca, 0xfd, 0x6d, 0xaa, 0xdd, 0x36, 0xd6, 0xc7, 0x19, 0x61,
+0x0d, 0x37, 0xa9, 0xae, 0x5b, 0x5b, 0xf8, 0x7b, 0x87, 0xd8, 0x1a, 0xed, 0x8c, 0xb0, 0x78, 0x84,
+0x71, 0x9c, 0x1d, 0x48, 0x77, 0x36, 0x77, 0x91, 0x97, 0x9d, 0x4d, 0x62, 0x01, 0xc9, 0x0e, 0x87,
+0xce, 0x4e, 0xaf, 0x35, 0xdc, 0x46, 0x6a, 0x9b, 0x7d, 0x67, 0x1b, 0xd9, 0x40, 0x59, 0x6c, 0x8e,
+0x90, 0xaf, 0xad, 0x21, 0x96, 0xbf, 0x35, 0x42, 0xa6, 0xb6, 0x37, 0x47, 0xc8, 0xc6, 0x60, 0x08,
+0x74, 0x76, 0x46, 0x28, 0x9b, 0xd1, 0x36, 0x56, 0x6a, 0x77, 0x73, 0x97, 0xf8, 0x01, 0x3c, 0x64,
+0x08, 0x10, 0x91, 0xa3, 0xed, 0xe1, 0x16, 0x8a, 0x64, 0x84, 0xe5, 0x0d, 0xb6, 0x9c, 0x11, 0xfe,
+0x6f, 0x7b, 0x04, 0x72, 0x6a, 0x0d, 0x46, 0xb4, 0x35, 0xcc, 0xe9, 0x0f, 0x51, 0xb6, 0x8e, 0x33,
+0x1c, 0xa1, 0xf8, 0x37, 0xb7, 0xa9, 0x25, 0x76, 0xfa, 0x23, 0x64, 0x76, 0x77, 0x07, 0x4b, 0x04,
+0xd6, 0xb6, 0x77, 0xae, 0xf4, 0x36, 0x3e, 0xfd, 0xf0, 0xfa, 0xe4, 0x8f, 0xd8, 0xc6, 0xeb, 0xc0,
+0x9c, 0xfe, 0x07, 0x45, 0x23, 0x8b, 0xc0, 0xd3, 0x95, 0xb6, 0x2a, 0x85, 0x13, 0xf9, 0x8b, 0xe8,
+0x18, 0x74, 0xed, 0xdc, 0x9d, 0xce, 0x02, 0x98, 0x6a, 0x88, 0x20, 0x81, 0x20, 0x79, 0x34, 0x9f,
+0xf8, 0xd1, 0x71, 0xfa, 0x0d, 0x28, 0x8a, 0xbd, 0xad, 0x3c, 0x05, 0x43, 0x2d, 0x30, 0xe3, 0x07,
+0x6b, 0x23, 0x92, 0x1f, 0xbc, 0x9b, 0x2f, 0x7e, 0xaa, 0x67, 0x6a, 0x87, 0x3b, 0x78, 0x74, 0x80,
+0x26, 0x82, 0x92, 0xa0, 0x95, 0x05, 0x22, 0x29, 0x98, 0xe0, 0x6a, 0xe1, 0x6c, 0x19, 0x75, 0x9a,
+0xb8, 0xa9, 0x2b, 0x42, 0x2b, 0x48, 0xc1, 0x9e, 0x78, 0x18, 0xf0, 0x23, 0x0a, 0xb4, 0xd7, 0x1f,
+0xf3, 0x55, 0x88, 0x8a, 0x47, 0x32, 0x95, 0xd9, 0x25, 0x84, 0x71, 0x10, 0x25, 0x9e, 0xa5, 0x9d,
+0x58, 0xe3, 0x33, 0x7f, 0xbe, 0x00, 0x3c, 0xf6, 0xfc, 0x40, 0x60, 0xd9, 0x6a, 0x47, 0xfb, 0xef,
+0x4a, 0x9d, 0x4c, 0xc4, 0x0e, 0x72, 0x73, 0xfb, 0x5c, 0x2f, 0x33, 0xa0, 0x98, 0xa6, 0xe4, 0xb8,
+0xcc, 0x0c, 0xfc, 0xa5, 0xe0, 0xe3, 0x88, 0x09, 0xb8, 0x4e, 0x65, 0xc1, 0x12, 0xa8, 0x1c, 0x0c,
+0xe9, 0x7c, 0xe6, 0xcd, 0xf9, 0x8d, 0x6e, 0x6f, 0x03, 0x1f, 0xe7, 0xdc, 0x44, 0xe7, 0x23, 0xff,
+0xd2, 0x45, 0x6c, 0x0d, 0x7a, 0x4c, 0x06, 0x3a, 0x0c, 0x7c, 0xab, 0xb9, 0x22, 0x19, 0x1d, 0x49,
+0x4e, 0x4c, 0xe4, 0xb8, 0xac, 0xcf, 0x29, 0xd3, 0xe2, 0x2e, 0x11, 0xfc, 0xb2, 0xa5, 0x18, 0x99,
+0x8c, 0x0c, 0x8b, 0x74, 0xa0, 0x15, 0xc2, 0x10, 0x67, 0x49, 0x22, 0x13, 0x2f, 0x49, 0x71, 0x2d,
+0x8e, 0x6f, 0x84, 0x17, 0x40, 0x64, 0x14, 0xb4, 0x96, 0x95, 0xc0, 0x94, 0x7e, 0x06, 0x03, 0xbf,
+0x47, 0x8b, 0x47, 0x22, 0x80, 0x26, 0x82, 0x8f, 0x98, 0x8a, 0x36, 0x32, 0xf3, 0x97, 0x12, 0xae,
+0x8a, 0xe8, 0x65, 0x8a, 0x5c, 0x1c, 0x1d, 0x8f, 0x41, 0x72, 0xa1, 0x17, 0x50, 0xcb, 0xf7, 0x55,
+0xed, 0x66, 0x9e, 0xfb, 0x05, 0xed, 0x2b, 0x47, 0xc9, 0x62, 0x42, 0xee, 0xb7, 0x1e, 0x4b, 0xc8,
+0x0b, 0xa3, 0xc6, 0x86, 0x6f, 0x9e, 0x96, 0xad, 0xfd, 0x77, 0x29, 0x32, 0x44, 0x0b, 0x50, 0x8a,
+0x61, 0x49, 0x06, 0x2d, 0x29, 0xc5, 0x3b, 0x13, 0x68, 0xde, 0xbe, 0xbd, 0xcb, 0x36, 0xa8, 0xa0,
+0xb2, 0xad, 0xe6, 0x31, 0x68, 0xec, 0x3f, 0x96, 0xc0, 0xcd, 0xfa, 0x4e, 0x93, 0x95, 0x9b, 0x11,
+0x5b, 0xd3, 0xb4, 0x51, 0x16, 0x2f, 0x94, 0x6d, 0x83, 0x39, 0x5d, 0xb4, 0x1b, 0x6a, 0x25, 0x07,
+0x87, 0x5c, 0xf8, 0x77, 0x58, 0x5c, 0xc9, 0xb1, 0x6e, 0xa4, 0xcb, 0x99, 0x5f, 0xc5, 0xf0, 0x0d,
+0x4b, 0x39, 0x43, 0xc7, 0x82, 0x71, 0x20, 0x5f, 0x92, 0x5c, 0x30, 0xe0, 0x0b, 0x48, 0x20, 0x43,
+0x1f, 0x8d, 0x19, 0x2e, 0x23, 0x01, 0x5d, 0x68, 0x81, 0x6f, 0x7c, 0x45, 0x49, 0x22, 0x65, 0xde,
+0x6e, 0x8f, 0x85, 0x39, 0x4f, 0x57, 0xee, 0x02, 0xe7, 0x75, 0x8a, 0xd1, 0x14, 0x5a, 0x28, 0x42,
+0x1a, 0xa7, 0x04, 0xfd, 0x1b, 0x8f, 0x0c, 0x9f, 0x38, 0x25, 0x21, 0x83, 0x12, 0x28, 0x46, 0x2a,
+0x85, 0xff, 0xda, 0x47, 0xd3, 0x45, 0x3f, 0xf5, 0x88, 0x04, 0xee, 0xf6, 0x03, 0x20, 0x65, 0xcb,
+0x2e, 0x89, 0xb9, 0x2b, 0x4e, 0x77, 0xe2, 0xdf, 0xde, 0xa2, 0x26, 0x20, 0xcc, 0xe1, 0x21, 0x1b,
+0xf2, 0x7e, 0x4b, 0xd4, 0x7e, 0x60, 0x03, 0x1e, 0xf7, 0x04, 0x88, 0xb5, 0x0c, 0xc4, 0x91, 0x41,
+0x2e, 0x01, 0xe4, 0x98, 0x80, 0x06, 0x05, 0xa0, 0xcd, 0x22, 0x90, 0xb6, 0xd6, 0x2c, 0x2b, 0x8e,
+0xda, 0xb6, 0x8e, 0x75, 0x1e, 0x09, 0x85, 0x83, 0x59, 0x98, 0x45, 0x32, 0xe8, 0x31, 0x41, 0x66,
+0xc4, 0x5e, 0x6a, 0x92, 0x5e, 0xe7, 0x14, 0xf7, 0xb4, 0xa4, 0x35, 0x4a, 0x52, 0xfb, 0x38, 0x48,
+0x6a, 0xa0, 0xab, 0x4a, 0x7f, 0x67, 0x80, 0xc4, 0xc5, 0xdd, 0x05, 0x69, 0x61, 0x36, 0x86, 0x9e,
+0x91, 0x39, 0x21, 0xe0, 0x27, 0x8c, 0x7d, 0xed, 0x19, 0x11, 0x38, 0x17, 0x3d, 0x60, 0x78, 0x81,
+0xdc, 0x2f, 0x5a, 0x7a, 0x9b, 0x13, 0xa9, 0x19, 0x14, 0x2b, 0x1a, 0x5e, 0xd5, 0xa8, 0xaf, 0x55,
+0x06, 0x8d, 0x3b, 0x07, 0x58, 0xcb, 0xcc, 0xce, 0x25, 0xa1, 0x8a, 0x0a, 0xee, 0x5c, 0x65, 0xd1,
+0x5d, 0xbe, 0x26, 0x89, 0xba, 0x6e, 0x85, 0x24, 0x53, 0xd3, 0x62, 0x5f, 0x8f, 0x2b, 0xef, 0x9d,
+0x96, 0x04, 0xbd, 0x13, 0x31, 0xa0, 0xf9, 0x40, 0x5a, 0x19, 0xf1, 0xfd, 0x7d, 0xb6, 0x09, 0xb2,
+0x52, 0x09, 0xdd, 0x66, 0x0b, 0x5b, 0xe8, 0x51, 0x9d, 0x61, 0x3c, 0x23, 0x49, 0xad, 0x79, 0x1c,
+0xf4, 0x58, 0xf4, 0x45, 0x9c, 0x99, 0xd1, 0x7c, 0x6c, 0xbe, 0x4a, 0x42, 0xd9, 0xc5, 0x05, 0xab,
+0xdf, 0x7e, 0x75, 0x09, 0x81, 0x75, 0xa6, 0x0a, 0x11, 0x4e, 0x95, 0xa5, 0xad, 0x2f, 0x11, 0x1e,
+0x06, 0x0a, 0x71, 0x0c, 0x6a, 0xb8, 0xb6, 0xb4, 0xe2, 0x12, 0x92, 0xa0, 0x9c, 0x5f, 0x42, 0xa2,
+0xc4, 0x55, 0x96, 0x90, 0xc8, 0x9f, 0x15, 0x63, 0x85, 0x74, 0x6d, 0x4b, 0xbb, 0x02, 0x29, 0x47,
+0x8d, 0x2f, 0xf8, 0x55, 0x9e, 0x47, 0xaf, 0x1a, 0x90, 0x04, 0x6a, 0xd3, 0xf5, 0x3b, 0x18, 0x8b,
+0x66, 0xac, 0x71, 0x6c, 0xb2, 0x22, 0x4e, 0x89, 0x4c, 0x89, 0x45, 0xa4, 0x3d, 0xf9, 0x39, 0x9e,
+0x27, 0x69, 0x34, 0x05, 0x1d, 0xbd, 0xe6, 0x41, 0x5b, 0x30, 0x67, 0x34, 0x0d, 0x60, 0x96, 0x00,
+0x10, 0xc6, 0xdd, 0x4e, 0xa3, 0x37, 0xfe, 0x37, 0x6f, 0x62, 0x0d, 0xba, 0x60, 0xf0, 0xbb, 0xd7,
+0xb8, 0x08, 0x76, 0x33, 0xf7, 0x83, 0x74, 0xdd, 0x0f, 0x39, 0x46, 0xc7, 0x1c, 0x01, 0x5d, 0x1a,
+0xfb, 0x41, 0xdf, 0xa9, 0xcd, 0x5c, 0xd0, 0x85, 0x59, 0x7a, 0xd0, 0x76, 0xd1, 0x37, 0xd8, 0xf8,
+0x5d, 0xbb, 0x02, 0x19, 0xa4, 0x24, 0x03, 0x45, 0x7c, 0xb7, 0xaf, 0x2e, 0x1a, 0x77, 0x32, 0xa9,
+0xc0, 0xad, 0xdd, 0x53, 0x3c, 0xe1, 0x07, 0xc4, 0xa9, 0xa3, 0xad, 0x73, 0x49, 0xb4, 0x0f, 0xf9,
+0x52, 0x71, 0x79, 0x6f, 0xf1, 0x2f, 0xa3, 0x8e, 0xda, 0xdc, 0x3e, 0xfc, 0x04, 0xff, 0xfe, 0xda,
+0x94, 0xc5, 0x61, 0xf7, 0x76, 0xb1, 0x69, 0x3b, 0xb4, 0x64, 0xc9, 0xe4, 0x9c, 0xbe, 0xb3, 0x38,
+0x3c, 0xe3, 0x90, 0xec, 0x95, 0x68, 0xc1, 0x7a, 0x4e, 0xf6, 0x37, 0x40, 0xfc, 0x87, 0x4b, 0x76,
+0x55, 0x6b, 0x52, 0x5b, 0x7d, 0xcd, 0xcf, 0x40, 0x90, 0xd4, 0xe4, 0x92, 0x2a, 0x8c, 0x40, 0x57,
+0x18, 0xa9, 0x58, 0x69, 0x3d, 0x30, 0x64, 0xa4, 0x4f, 0x0d, 0x96, 0x03, 0x8b, 0x04, 0xa2, 0x90,
+0x16, 0x9d, 0xc2, 0x3b, 0x11, 0xf7, 0x28, 0x6c, 0x0f, 0x30, 0xcf, 0x39, 0xc4, 0x38, 0xa1, 0x9c,
+0xbf, 0xc3, 0xaa, 0x6d, 0x07, 0x26, 0xba, 0xb9, 0x11, 0xfc, 0x5a, 0xec, 0x3e, 0xc0, 0x62, 0x5e,
+0x52, 0x77, 0x3d, 0xc8, 0xf5, 0xdd, 0xeb, 0xdf, 0x6c, 0x43, 0x42, 0xde, 0x19, 0x5c, 0xe4, 0x9d,
+0xdd, 0xff, 0x8a, 0x5d, 0x09, 0x55, 0x3b, 0x10, 0x56, 0xb0, 0x12, 0x6d, 0xbe, 0xf0, 0xf1, 0x3d,
+0x5b, 0x10, 0xba, 0x15, 0x1a, 0x8e, 0x25, 0x34, 0xd0, 0x6f, 0xdd, 0x58, 0x5f, 0x6f, 0x20, 0xd2,
+0xd2, 0x96, 0xec, 0x56, 0x15, 0x27, 0xba, 0xf3, 0xca, 0x25, 0x4e, 0x80, 0x4e, 0xea, 0x55, 0x68,
+0x4f, 0xfb, 0x55, 0x6e, 0xe0, 0x96, 0x57, 0x6a, 0x4c, 0xec, 0x36, 0xf9, 0x3d, 0xca, 0xc4, 0x19,
+0xe2, 0xcb, 0xdf, 0xb1, 0x81, 0x80, 0xe8, 0x15, 0x36, 0x10, 0x88, 0x59, 0x46, 0xe4, 0x8f, 0xbd,
+0x1f, 0x43, 0x3f, 0x4d, 0xea, 0x6f, 0xa4, 0x29, 0xc2, 0x76, 0xf4, 0xb3, 0xdf, 0xb8, 0x79, 0xfd,
+0x1c, 0x1a, 0x39, 0x84, 0xf9, 0x53, 0x69, 0x2e, 0x13, 0x44, 0x73, 0x0a, 0x63, 0xaa, 0x09, 0x15,
+0x9f, 0x42, 0xe1, 0xae, 0x68, 0xbb, 0xef, 0x68, 0x97, 0x60, 0xc4, 0xa9, 0x36, 0x1b, 0xbb, 0x05,
+0x17, 0xf1, 0x14, 0xbd, 0x44, 0x0b, 0xf1, 0x85, 0x2b, 0xcb, 0x81, 0xf6, 0xf9, 0xe2, 0x7b, 0x7e,
+0xde, 0x45, 0xbe, 0x0c, 0xb8, 0xf2, 0x20, 0x30, 0x8d, 0x8a, 0xdc, 0x51, 0xf7, 0x70, 0x8f, 0x03,
+0x91, 0xf5, 0x0c, 0x69, 0x49, 0x0e, 0x2f, 0x11, 0x14, 0xf7, 0x43, 0xd2, 0x7a, 0x33, 0x7c, 0xac,
+0xaf, 0x53, 0xf4, 0x3c, 0x3f, 0x9d, 0xe3, 0xdb, 0x11, 0xa9, 0x60, 0x3a, 0x8a, 0x57, 0xf6, 0x71,
+0x7e, 0x52, 0x92, 0x29, 0x3a, 0x3a, 0x59, 0xce, 0x2a, 0xde, 0xce, 0x1c, 0x11, 0xf4, 0x71, 0x7a,
+0xea, 0x27, 0x09, 0x6d, 0x1a, 0x63, 0x94, 0x85, 0x43, 0x71, 0x0a, 0x3a, 0x88, 0x1f, 0xb4, 0xa6,
+0x8e, 0x3f, 0xc0, 0x21, 0x01, 0x1e, 0x03, 0xe8, 0x67, 0x3c, 0x96, 0x2b, 0x33, 0x29, 0x8f, 0xf6,
+0x28, 0x82, 0xdb, 0x5c, 0x68, 0xc2, 0xf2, 0xce, 0x17, 0x4e, 0x5f, 0x6d, 0x15, 0x15, 0x05, 0x8b,
+0x84, 0x05, 0xae, 0x32, 0xe5, 0x61, 0x16, 0x0c, 0x0f, 0xcb, 0x26, 0x4c, 0xba, 0x2e, 0xf6, 0x35,
+0x5b, 0x6b, 0x59, 0x79, 0x34, 0x74, 0x6d, 0xd8, 0x7b, 0x9e, 0x84, 0x5e, 0x8f, 0xcc, 0xfd, 0x53,
+0x04, 0x73, 0x01, 0xe8, 0x41, 0x9d, 0xee, 0xc2, 0x26, 0x6f, 0xa6, 0xf3, 0x1d, 0xba, 0x0d, 0xd3,
+0x7a, 0xe8, 0x41, 0x63, 0xd2, 0x53, 0xce, 0xcb, 0x6a, 0x3b, 0x65, 0xb2, 0x16, 0x5a, 0x7d, 0xbb,
+0x0c, 0x76, 0x17, 0x2d, 0xac, 0x5e, 0xdf, 0x73, 0x70, 0x5f, 0x4d, 0x22, 0x4d, 0x69, 0x57, 0xee,
+0xc2, 0x0d, 0x0c, 0xfb, 0x4a, 0xcc, 0x56, 0x15, 0xf7, 0x50, 0x40, 0xdd, 0xa7, 0xe8, 0x38, 0x60,
+0x5d, 0x41, 0x81, 0xc6, 0xb4, 0xad, 0xf9, 0x2e, 0xa9, 0xb6, 0xb1, 0xfc, 0x7a, 0x98, 0x88, 0x42,
+0x25, 0x38, 0x19, 0xe7, 0x85, 0xca, 0x78, 0x07, 0x4c, 0xe0, 0xbe, 0xfa, 0xd1, 0x1c, 0x26, 0x51,
+0xdc, 0xa8, 0xe3, 0x4e, 0x65, 0x91, 0xc4, 0x15, 0x32, 0x5f, 0x75, 0x2a, 0xf9, 0x80, 0x47, 0xde,
+0x50, 0xb1, 0x80, 0x0e, 0xad, 0x01, 0x5a, 0x1b, 0xff, 0xd3, 0xbe, 0xfc, 0x5f, 0xf6, 0xd5, 0xef,
+0x9e, 0x6f, 0xf4, 0xb0, 0x31, 0xc1, 0x61, 0x7d, 0x17, 0x3d, 0x78, 0xf1, 0xb1, 0xcb, 0xe3, 0x68,
+0x85, 0x43, 0x04, 0x99, 0x3d, 0x06, 0x77, 0x09, 0x69, 0x2e, 0xda, 0xe8, 0xf2, 0x0a, 0x36, 0x71,
+0x2f, 0x30, 0x57, 0x37, 0x5d, 0x40, 0x8b, 0x2e, 0x98, 0xed, 0x6b, 0x83, 0xd9, 0x6e, 0xea, 0x15,
+0x18, 0xec, 0x3b, 0xaa, 0x33, 0x0c, 0xd0, 0xdc, 0xfe, 0xfe, 0x78, 0x76, 0x7a, 0x1c, 0x4d, 0xa1,
+0x53, 0xe2, 0xac, 0x00, 0x99, 0xea, 0xfe, 0xd6, 0xc6, 0xde, 0x34, 0x72, 0xa2, 0xe5, 0xff, 0x8d,
+0xcc, 0xfe, 0xb5, 0x90, 0x35, 0x76, 0x44, 0xc4, 0x5c, 0xf0, 0x98, 0x21, 0x97, 0xfa, 0xda, 0x9a,
+0xd8, 0xbb, 0xbd, 0x80, 0x59, 0xfe, 0x27, 0xd0, 0x69, 0x3f, 0xc1, 0xd6, 0x85, 0xde, 0x47, 0x07,
+0xba, 0x5a, 0xba, 0x36, 0x14, 0x5a, 0x53, 0x36, 0x1c, 0x1f, 0x10, 0x70, 0x74, 0xcf, 0x86, 0x84,
+0xb2, 0x3f, 0x51, 0xeb, 0x3e, 0xfc, 0x01, 0x75, 0x6c, 0x65, 0xef, 0x41, 0x30, 0x98, 0xef, 0xd7,
+0xc5, 0x6b, 0x4a, 0xe4, 0xb2, 0xec, 0x1b, 0x98, 0xda, 0xfd, 0xc1, 0x4f, 0xef, 0xe5, 0xcd, 0x54,
+0x34, 0x76, 0x2f, 0xdf, 0x0e, 0x93, 0xf8, 0xfa, 0xea, 0xa5, 0xf1, 0x2a, 0x01, 0x1b, 0x81, 0x2a,
+0x76, 0x04, 0xc9, 0xbb, 0x05, 0x6a, 0xe9, 0x48, 0xc0, 0x0a, 0x5a, 0xea, 0x66, 0x82, 0x5a, 0x62,
+0x0a, 0xb2, 0x9a, 0xda, 0xdf, 0x7b, 0x8f, 0x4d, 0x48, 0x01, 0x58, 0x05, 0x1d, 0x79, 0x92, 0xaa,
+0x96, 0x92, 0x04, 0xac, 0xa2, 0x25, 0x8f, 0x56, 0xd5, 0x13, 0x93, 0x90, 0x15, 0xd4, 0xf4, 0x13,
+0x56, 0xb5, 0x04, 0x75, 0xe0, 0x66, 0x34, 0x9d, 0x55, 0x68, 0x3a, 0xcd, 0x68, 0x0e, 0x57, 0xa1,
+0x39, 0xac, 0xa0, 0x59, 0xbc, 0x1a, 0xa2, 0x96, 0x6e, 0x11, 0xa1, 0x82, 0xb6, 0xf1, 0x82, 0x89,
+0xda, 0x02, 0x8c, 0x58, 0x15, 0xa5, 0xe8, 0x77, 0x55, 0x00, 0x71, 0x3a, 0x62, 0x46, 0xb6, 0x6c,
+0x49, 0x3f, 0xd4, 0xc0, 0xab, 0xb4, 0xde, 0x74, 0xc5, 0x45, 0x7d, 0x27, 0x30, 0x61, 0xad, 0x58,
+0x8a, 0xf3, 0x5d, 0xa5, 0x38, 0x2b, 0x96, 0x32, 0xfc, 0xae, 0x52, 0x86, 0x95, 0xa5, 0x18, 0x2e,
+0xf0, 0x68, 0x50, 0x8a, 0x01, 0xab, 0xae, 0x94, 0xd2, 0x65, 0x20, 0xcd, 0x8a, 0x29, 0xa1, 0xd5,
+0x95, 0x23, 0x2f, 0x16, 0x69, 0x46, 0x5e, 0x42, 0xe3, 0x39, 0x2f, 0xfd, 0xd0, 0xf2, 0x12, 0x3d,
+0xa4, 0xa3, 0xcc, 0x1a, 0x2c, 0xdf, 0x95, 0x51, 0x41, 0x9f, 0x43, 0x94, 0x9c, 0xa5, 0x36, 0xbf,
+0x6d, 0x95, 0xc9, 0x60, 0xd3, 0x8f, 0xa7, 0x7c, 0x9b, 0x61, 0x92, 0xc5, 0x30, 0x7a, 0xfc, 0x3a,
+0xad, 0xd2, 0xe4, 0x24, 0xbb, 0xc1, 0xab, 0x1c, 0x12, 0x79, 0x27, 0x03, 0x22, 0x02, 0x86, 0xa1,
+0x1f, 0xcb, 0x4e, 0xce, 0x3f, 0x2d, 0x39, 0x93, 0x01, 0x02, 0x94, 0xe4, 0x8c, 0xf3, 0x19, 0xa3,
+0x0b, 0xd2, 0x2a, 0xb9, 0x20, 0x6f, 0x2f, 0x2e, 0x3e, 0x71, 0x4b, 0xfe, 0x4c, 0xdc, 0xf7, 0x83,
+0xde, 0x88, 0xc2, 0xe2, 0x49, 0xe8, 0x98, 0x64, 0x47, 0x3e, 0x0b, 0x33, 0x25, 0x2d, 0x2c, 0x22,
+0xd7, 0x79, 0x9b, 0xdb, 0x6e, 0xc4, 0x20, 0x53, 0x2d, 0x6f, 0x1b, 0x58, 0xc5, 0x60, 0x13, 0xb2,
+0x4c, 0xaf, 0x25, 0x60, 0xb2, 0xd2, 0x44, 0x41, 0x65, 0x34, 0x21, 0x91, 0x37, 0xcd, 0x12, 0x1f,
+0x52, 0x6b, 0x91, 0x0d, 0xf6, 0x98, 0xd0, 0xd5, 0x9d, 0x09, 0x40, 0xa0, 0xbf, 0xa2, 0x0d, 0xe6,
+0x04, 0xd4, 0xc5, 0x09, 0x35, 0x14, 0x96, 0xd8, 0x5d, 0x22, 0x92, 0x3b, 0xf5, 0xdc, 0x9c, 0x8e,
+0x53, 0x41, 0xc7, 0x59, 0x81, 0xce, 0xb0, 0x82, 0xce, 0xb0, 0x8e, 0x4e, 0x85, 0x4d, 0x25, 0x5a,
+0xc5, 0xfc, 0x3a, 0x7a, 0x75, 0x76, 0x94, 0x88, 0x1a, 0x81, 0xea, 0x28, 0x2f, 0xb5, 0x9d, 0xbc,
+0x1f, 0x68, 0xb9, 0x74, 0xf8, 0xd3, 0x0d, 0x12, 0xef, 0x17, 0xd8, 0x4c, 0xae, 0x9d, 0x26, 0xa0,
+0x3a, 0x3e, 0xeb, 0xec, 0xe4, 0x52, 0xca, 0xce, 0xf7, 0x50, 0x1e, 0x36, 0xa1, 0x3c, 0xac, 0xa7,
+0x5c, 0x6d, 0x0f, 0x05, 0x65, 0x03, 0x50, 0x23, 0xca, 0x55, 0x36, 0x30, 0x23, 0x5d, 0x82, 0x6a,
+0x44, 0xdb, 0x60, 0xf7, 0x32, 0x92, 0x32, 0x53, 0x50, 0xca, 0xdb, 0x3a, 0xae, 0x37, 0x66, 0xd3,
+0x96, 0x91, 0x50, 0x96, 0x2c, 0x77, 0x76, 0x2d, 0x17, 0x46, 0x2e, 0xc6, 0xce, 0x4a, 0x56, 0x4f,
+0x1a, 0x1b, 0x26, 0xd7, 0xc5, 0xf8, 0x2c, 0xf2, 0x76, 0x1e, 0x04, 0x8f, 0xcf, 0xda, 0xb9, 0x85,
+0x4c, 0x53, 0xe0, 0x88, 0x07, 0x2c, 0x96, 0x86, 0x8e, 0xa4, 0xd5, 0xcb, 0x02, 0x46, 0x25, 0x06,
+0xde, 0xd0, 0xd4, 0x93, 0xa5, 0x11, 0x21, 0x65, 0x18, 0x95, 0x73, 0x51, 0x11, 0x31, 0x5f, 0x3e,
+0xcf, 0x94, 0x1b, 0x41, 0x0a, 0x37, 0x2c, 0x37, 0xbd, 0xf9, 0x8f, 0x6f, 0x53, 0xc6, 0x08, 0x0d,
+0xfc, 0x5f, 0x50, 0xd5, 0xf6, 0x29, 0xc9, 0xa1, 0xfd, 0x40, 0xbf, 0x56, 0xa3, 0xb1, 0x85, 0xc8,
+0xe8, 0xa8, 0x11, 0xbe, 0x21, 0xa1, 0xa2, 0xa9, 0xc8, 0x6e, 0x79, 0xa6, 0x61, 0x75, 0xd0, 0x90,
+0x8e, 0xc9, 0x60, 0x14, 0x48, 0x39, 0xab, 0x93, 0x72, 0x96, 0x90, 0x1a, 0xae, 0x4e, 0x6a, 0xa8,
+0x91, 0x42, 0x77, 0x87, 0xdf, 0x14, 0x92, 0xdd, 0x21, 0x02, 0x5d, 0x46, 0xb5, 0xc1, 0x3e, 0x5b,
+0xdf, 0xed, 0xe7, 0x52, 0x0e, 0xd9, 0xae, 0x29, 0xc0, 0x27, 0x8f, 0x1f, 0xc9, 0xfb, 0xbe, 0x9e,
+0x2d, 0x09, 0xe4, 0x69, 0x05, 0x66, 0x37, 0x8f, 0x20, 0x7d, 0xd5, 0x5a, 0x50, 0x24, 0x5e, 0x43,
+0x92, 0x4b, 0x3b, 0xc4, 0x9b, 0x49, 0xaa, 0x4a, 0x95, 0x90, 0xf5, 0xc5, 0x8a, 0xc6, 0xa4, 0x42,
+0x65, 0xc3, 0xee, 0xcb, 0x1d, 0x32, 0x66, 0xe2, 0xb4, 0xf6, 0x3d, 0x60, 0x67, 0x04, 0xdd, 0xb4,
+0x04, 0x47, 0x2b, 0x01, 0xaf, 0x0b, 0x19, 0xe4, 0x3e, 0x0f, 0x98, 0xe2, 0xa3, 0xa6, 0x5c, 0x47,
+0x96, 0xcb, 0xde, 0x8b, 0xd3, 0x62, 0x87, 0x92, 0x23, 0xbb, 0x21, 0x2b, 0x43, 0x8d, 0x95, 0x61,
+0x9e, 0x95, 0x61, 0xc6, 0x8a, 0x53, 0xcb, 0xca, 0x70, 0x29, 0x2b, 0xce, 0x32, 0x56, 0xf2, 0x37,
+0x15, 0xe5, 0x2f, 0x32, 0x7a, 0x91, 0x5d, 0xdd, 0x47, 0x71, 0x63, 0xdc, 0x13, 0x65, 0xba, 0xc4,
+0x42, 0x39, 0xf7, 0xd9, 0x45, 0x97, 0x8d, 0x3c, 0x65, 0xfd, 0x2e, 0xcc, 0xc6, 0x1e, 0x72, 0xee,
+0xca, 0xcc, 0xe6, 0x6e, 0x71, 0x76, 0x5b, 0x66, 0x43, 0x3f, 0x58, 0xbf, 0x08, 0x49, 0xfe, 0xca,
+0x5d, 0x76, 0xa4, 0x7e, 0x16, 0x6f, 0x34, 0x12, 0x8a, 0x53, 0xbc, 0xb5, 0x48, 0x34, 0x62, 0xf1,
+0x66, 0x22, 0xd1, 0xcc, 0xa6, 0xeb, 0x35, 0xd5, 0x46, 0xee, 0x95, 0x7d, 0xc4, 0xee, 0xd2, 0x7b,
+0x39, 0xeb, 0x69, 0x56, 0xfa, 0x89, 0xdd, 0xe2, 0xad, 0x9e, 0x2b, 0x3a, 0x85, 0xea, 0x02, 0x50,
+0xfa, 0x5f, 0xe1, 0x9a, 0xcd, 0xc2, 0xc9, 0x82, 0xa5, 0x37, 0x84, 0x36, 0x19, 0x4e, 0x2b, 0xbd,
+0x48, 0xea, 0x6e, 0xcb, 0x2f, 0x19, 0xfd, 0x5e, 0xfa, 0x4e, 0x13, 0xfa, 0xc3, 0xef, 0xa7, 0x3f,
+0x2c, 0xd3, 0x37, 0xde, 0x76, 0xda, 0x8c, 0x7e, 0x85, 0x5f, 0x99, 0xa3, 0x6f, 0xb8, 0x33, 0xb5,
+0x71, 0x01, 0x4b, 0xdd, 0xcb, 0x5c, 0x09, 0xd9, 0xcd, 0xab, 0xf5, 0xda, 0x69, 0xf4, 0x2c, 0x39,
+0x35, 0xbc, 0x9d, 0xab, 0xe8, 0xde, 0xb9, 0x5f, 0x75, 0x3f, 0x6c, 0x49, 0xd0, 0x41, 0xf7, 0x92,
+0xf0, 0x26, 0x88, 0x56, 0x61, 0x2d, 0xa6, 0x95, 0xad, 0xc5, 0xb4, 0x2a, 0xd7, 0x62, 0x30, 0x74,
+0xd0, 0x69, 0x2d, 0x7a, 0x2d, 0xbe, 0x06, 0x43, 0xc7, 0xc9, 0x13, 0xba, 0x91, 0xc6, 0xbf, 0x7d,
+0xb4, 0x24, 0x17, 0x5d, 0xf3, 0x8e, 0x8b, 0xff, 0x82, 0xd0, 0x06, 0x5f, 0xd4, 0x31, 0x87, 0x36,
+0x96, 0xf8, 0xc5, 0x28, 0x1b, 0xb1, 0x32, 0x82, 0xc0, 0xa6, 0x8d, 0x1b, 0xcd, 0xfd, 0xe2, 0x24,
+0xdf, 0x1c, 0x8d, 0xdc, 0x62, 0x64, 0x60, 0x35, 0xb7, 0x38, 0xbb, 0x48, 0xa4, 0xf8, 0x2e, 0xc8,
+0xf7, 0x9c, 0x90, 0x6e, 0xa9, 0x23, 0xd2, 0x72, 0x43, 0x95, 0x24, 0xd8, 0xee, 0xb5, 0xda, 0x47,
+0xf0, 0xfd, 0x18, 0xcd, 0x61, 0xde, 0x20, 0x7e, 0x3c, 0xb8, 0x21, 0x1e, 0x45, 0x94, 0xfb, 0x2d,
+0x54, 0x3c, 0x4d, 0xd6, 0xe0, 0x25, 0xbb, 0xb8, 0xf7, 0x1e, 0x59, 0xea, 0x7e, 0xf1, 0x98, 0x77,
+0x7b, 0x8b, 0xe7, 0x86, 0xfd, 0xe9, 0xd4, 0x9b, 0xf8, 0xe0, 0xc7, 0x07, 0x8f, 0x36, 0xde, 0x0f,
+0xed, 0xc5, 0xb8, 0x27, 0xf0, 0x2c, 0xcf, 0x7d, 0xab, 0xb4, 0xc8, 0x64, 0x04, 0x33, 0xc5, 0xe0,
+0xce, 0xf9, 0x8d, 0xdb, 0x45, 0x96, 0x12, 0x16, 0xf3, 0xed, 0x24, 0x4b, 0x7a, 0x45, 0x41, 0x7c,
+0x9d, 0xff, 0xf6, 0x3a, 0xfb, 0x3a, 0xab, 0x97, 0x58, 0xe2, 0x05, 0x31, 0x9d, 0x9c, 0x7f, 0x5a,
+0xa2, 0xbd, 0xdb, 0xd9, 0xb6, 0x23, 0xfd, 0x0d, 0x82, 0xe6, 0xda, 0xcc, 0x8b, 0x41, 0xc9, 0x4a,
+0x89, 0x36, 0x52, 0xe8, 0x62, 0x33, 0x34, 0xd7, 0xe9, 0x96, 0xfe, 0x4a, 0xcd, 0x2f, 0xd5, 0x65,
+0xa4, 0x84, 0xd2, 0xa9, 0xd1, 0x62, 0x02, 0x03, 0xb9, 0x23, 0xe8, 0xc8, 0xd9, 0xde, 0x26, 0xfd,
+0x05, 0xde, 0xbf, 0xc2, 0xa4, 0x9a, 0x3d, 0xf8, 0x41, 0x00, 0x5e, 0xe6, 0x38, 0x9a, 0x7a, 0x2c,
+0xf5, 0xa6, 0xb3, 0x28, 0x76, 0x63, 0x3f, 0x78, 0x64, 0xf3, 0xd0, 0xfd, 0x0a, 0xf5, 0xc5, 0x9d,
+0x88, 0x39, 0x8d, 0x16, 0xdc, 0x2f, 0xd7, 0x65, 0x01, 0x50, 0xad, 0xc5, 0xc4, 0x12, 0x94, 0x39,
+0x75, 0xcb, 0x7b, 0xf7, 0x94, 0xee, 0x12, 0xa5, 0xf3, 0x4f, 0xff, 0xfd, 0xb5, 0x16, 0x98, 0x64,
+0x7e, 0x22, 0xaa, 0x85, 0x9b, 0x56, 0x6c, 0x9b, 0x7d, 0xc2, 0xe7, 0x6a, 0x48, 0xb8, 0x00, 0x2c,
+0x8e, 0xb6, 0xd8, 0x66, 0x2d, 0x1e, 0xf4, 0xb9, 0x82, 0x18, 0x1e, 0x8c, 0x10, 0x47, 0x9f, 0x82,
+0x88, 0x5b, 0x27, 0x3b, 0xf6, 0x50, 0xd7, 0x89, 0xab, 0x1e, 0xde, 0xe8, 0xdd, 0x5f, 0x51, 0xdb,
+0x05, 0x83, 0xd4, 0xa5, 0x9a, 0x29, 0xba, 0xd4, 0xb1, 0x15, 0x54, 0x9c, 0x6e, 0x80, 0x10, 0xaf,
+0x88, 0x80, 0x23, 0x00, 0x3e, 0xbc, 0x9b, 0x7b, 0xad, 0x42, 0x3e, 0x94, 0x82, 0xf9, 0xfc, 0x99,
+0x10, 0x09, 0x65, 0xc9, 0xbb, 0xc6, 0x9f, 0x15, 0xf1, 0xbb, 0xda, 0xa3, 0x31, 0x32, 0x8d, 0xbf,
+0xb1, 0xa1, 0x70, 0xa5, 0xcc, 0x1a, 0xbd, 0xd6, 0xb2, 0xc8, 0x78, 0xd6, 0xd7, 0x42, 0xe4, 0xeb,
+0x25, 0x15, 0xac, 0x99, 0x38, 0xa3, 0x5b, 0x3c, 0x14, 0x64, 0x09, 0xe2, 0x85, 0x89, 0x75, 0xf5,
+0x96, 0x04, 0xdf, 0x8f, 0x86, 0xc3, 0xc0, 0xb9, 0x3c, 0x47, 0x55, 0x7c, 0xdf, 0xa3, 0xf4, 0xb4,
+0x8c, 0x14, 0x93, 0xd0, 0x8f, 0x93, 0x0c, 0x5b, 0xbc, 0x87, 0xb0, 0x5c, 0xc2, 0xfa, 0x15, 0xea,
+0xea, 0x71, 0x05, 0x89, 0x2b, 0xb3, 0x0a, 0xec, 0x60, 0x87, 0xca, 0x52, 0xa0, 0x73, 0x52, 0x3e,
+0x45, 0xd4, 0x34, 0x48, 0x3b, 0x0a, 0xf1, 0xcd, 0x03, 0x40, 0xc8, 0xde, 0x3b, 0x59, 0x2e, 0xce,
+0x17, 0xe8, 0xeb, 0xe5, 0xb1, 0x85, 0xfe, 0x6a, 0xe8, 0x95, 0xf5, 0x28, 0x70, 0x0f, 0x9d, 0xc3,
+0x9d, 0x90, 0x0e, 0xf3, 0xf3, 0xcf, 0x1a, 0xc7, 0xf6, 0xf1, 0xbb, 0x8f, 0xe7, 0x27, 0xaf, 0xbb,
+0x32, 0x2e, 0x56, 0x10, 0xb4, 0xa1, 0xe3, 0xe9, 0x2d, 0x6d, 0x7c, 0x09, 0x07, 0x0f, 0x00, 0xba,
+0x7e, 0x98, 0x64, 0x6f, 0xe1, 0x74, 0x99, 0xf1, 0x09, 0x20, 0xbe, 0xe4, 0x26, 0x34, 0x2d, 0x5f,
+0xe3, 0xf2, 0xf0, 0x8f, 0x0f, 0x63, 0x14, 0x23, 0x79, 0x7c, 0x82, 0x3e, 0x27, 0x92, 0xc0, 0xb2,
+0x76, 0xc1, 0x11, 0x8f, 0xf1, 0xd1, 0x19, 0x45, 0x2e, 0x0d, 0x0e, 0x84, 0x9b, 0x71, 0x1e, 0x43,
+0x0a, 0xcb, 0x8a, 0x84, 0xc4, 0x0f, 0xc7, 0x9e, 0xba, 0xa9, 0xf1, 0xdc, 0xfb, 0x73, 0xd7, 0xd4,
+0x4f, 0x16, 0xcc, 0x0b, 0x60, 0x74, 0x7d, 0x6a, 0xa1, 0x3f, 0xfc, 0x98, 0xd5, 0x43, 0x90, 0xe5,
+0xab, 0x86, 0xa6, 0xbe, 0xd4, 0xad, 0xab, 0x16, 0xbf, 0x81, 0xd7, 0x58, 0x2f, 0x7e, 0xc1, 0xf4,
+0xf2, 0x6a, 0x99, 0x9e, 0x38, 0xcc, 0xbf, 0xdc, 0x23, 0xde, 0xec, 0x19, 0xbb, 0xf1, 0x64, 0x9d,
+0xb6, 0x39, 0x3d, 0x7f, 0x82, 0x19, 0x47, 0x0e, 0xe1, 0x18, 0xe1, 0x2d, 0x2a, 0x4a, 0x5c, 0x05,
+0x88, 0xaf, 0xfa, 0x14, 0x0e, 0xda, 0x95, 0x5e, 0x2e, 0xd2, 0xdf, 0x4f, 0xc9, 0x3a, 0x97, 0x5e,
+0x53, 0x75, 0xfa, 0xd3, 0xa4, 0x55, 0x8b, 0x3a, 0xf5, 0xd7, 0x1e, 0xa2, 0x14, 0xef, 0xff, 0x89,
+0xbe, 0xf6, 0xde, 0x9d, 0x59, 0xe2, 0x28, 0x9b, 0x68, 0x2f, 0xb1, 0x21, 0x4f, 0xbd, 0xd0, 0x50,
+0x68, 0x20, 0x92, 0x95, 0x60, 0x97, 0xaf, 0x01, 0xf1, 0x30, 0x4f, 0x4b, 0xa3, 0x6d, 0xd3, 0x20,
+0x85, 0x74, 0x39, 0x48, 0xfe, 0xe5, 0xc1, 0xe2, 0x35, 0x13, 0x3c, 0x82, 0x80, 0x0d, 0xa5, 0x93,
+0x80, 0x8e, 0x22, 0x72, 0x6c, 0x98, 0x2f, 0x45, 0x78, 0x76, 0x99, 0x7f, 0x76, 0x75, 0xf5, 0xe1,
+0xf4, 0xf9, 0x0d, 0xdf, 0x93, 0x22, 0x61, 0x8e, 0x57, 0x24, 0xcc, 0xf7, 0x42, 0x8b, 0xcc, 0xae,
+0xe2, 0x71, 0x3e, 0x4b, 0xbc, 0xf8, 0xd7, 0x61, 0xae, 0x95, 0x49, 0x92, 0x2f, 0x4d, 0xd0, 0x56,
+0x12, 0x83, 0x20, 0x72, 0xbb, 0x35, 0x75, 0xfa, 0x7c, 0x2d, 0x9d, 0xae, 0x2c, 0xe7, 0x1d, 0x42,
+0x35, 0xed, 0xa9, 0x25, 0x94, 0x55, 0x36, 0xe9, 0xd1, 0xa7, 0xd3, 0xcf, 0x6f, 0x4e, 0x2e, 0x8e,
+0xdf, 0x7e, 0xfe, 0xf8, 0xe9, 0xe2, 0xf4, 0xe3, 0x07, 0x7a, 0x3f, 0x86, 0x8d, 0x81, 0x77, 0x7c,
+0xbe, 0x23, 0x8c, 0xd6, 0xe9, 0x67, 0x61, 0x87, 0xe0, 0x11, 0x1d, 0xb1, 0x29, 0xce, 0x47, 0xc7,
+0x37, 0x51, 0xdc, 0x63, 0xa5, 0x19, 0x2a, 0x5b, 0x30, 0xfd, 0xc9, 0x0e, 0x7e, 0x6e, 0xf9, 0x18,
+0x60, 0xc5, 0x79, 0xe3, 0xea, 0x33, 0xa2, 0x02, 0x46, 0x46, 0xb9, 0xe7, 0xe9, 0xed, 0x48, 0x80,
+0xe0, 0x0d, 0xa6, 0xaf, 0x3d, 0x71, 0x83, 0x29, 0x57, 0xc1, 0xe8, 0xf6, 0x36, 0xa1, 0x13, 0x97,
+0xba, 0x06, 0xe2, 0x58, 0x7b, 0x14, 0xdf, 0xd1, 0x04, 0xdf, 0x42, 0xd7, 0x4d, 0xaa, 0x1f, 0xfe,
+0x66, 0xfb, 0x0c, 0x5a, 0x51, 0xee, 0xbc, 0xc6, 0x94, 0x17, 0x59, 0x1e, 0x0e, 0xcd, 0x0e, 0x1d,
+0x71, 0x14, 0x84, 0xd7, 0xe8, 0x9e, 0x28, 0xfd, 0x64, 0x9d, 0x3a, 0xa0, 0x27, 0x20, 0xd6, 0xf1,
+0x38, 0x9f, 0x8c, 0xb9, 0x2a, 0x1a, 0x5b, 0x79, 0x1a, 0x8e, 0x91, 0xc6, 0x60, 0x3b, 0x23, 0xe2,
+0x18, 0x88, 0x6c, 0xe7, 0x89, 0x6c, 0x1a, 0x89, 0x0c, 0x9d, 0x8c, 0xc8, 0x26, 0x11, 0x29, 0x39,
+0x9a, 0x3f, 0x86, 0xea, 0x66, 0x33, 0x76, 0xfc, 0xea, 0xe3, 0x19, 0x73, 0x85, 0x70, 0xe8, 0x22,
+0x56, 0x74, 0x3a, 0xb1, 0x4c, 0xe1, 0x69, 0xe6, 0xa4, 0x78, 0x0a, 0x5e, 0xb7, 0x76, 0xe1, 0xbc,
+0x1f, 0xfa, 0xa9, 0x4f, 0x0e, 0x82, 0x49, 0x14, 0x6b, 0x6b, 0xaa, 0xd1, 0xa6, 0xee, 0x9f, 0xc8,
+0x58, 0x4a, 0x84, 0xc3, 0x43, 0xa6, 0x9e, 0x99, 0xe4, 0xf5, 0x53, 0x59, 0x3f, 0xb0, 0xfe, 0xb7,
+0xc1, 0x2d, 0xd8, 0xb9, 0x07, 0x1f, 0x46, 0x6f, 0x66, 0x11, 0x2a, 0x15, 0xe9, 0x42, 0x87, 0xed,
+0xef, 0x31, 0xe5, 0xfa, 0x16, 0x1b, 0xf5, 0x05, 0x07, 0x19, 0x28, 0x90, 0xf5, 0x01, 0xc8, 0x60,
+0x29, 0xdc, 0x70, 0x2f, 0xdb, 0xce, 0x2f, 0x4f, 0xc2, 0x1b, 0x81, 0xf9, 0x51, 0x5e, 0x7e, 0x66,
+0x1f, 0xb5, 0x4f, 0x1c, 0xbc, 0xa7, 0xc3, 0xcb, 0x54, 0x5f, 0xea, 0x83, 0x42, 0x4f, 0x7b, 0xa2,
+0x81, 0xe4, 0x49, 0x74, 0xec, 0x81, 0x59, 0x93, 0xc9, 0xbd, 0xfb, 0x82, 0x41, 0x7e, 0x2f, 0xc0,
+0x82, 0xf3, 0xb3, 0xb9, 0x97, 0xbb, 0xe8, 0x51, 0x8e, 0xaf, 0x9c, 0x78, 0x99, 0x31, 0xfd, 0x0a,
+0x33, 0x9f, 0x1f, 0x15, 0xf6, 0x41, 0x97, 0x09, 0x55, 0x9e, 0x11, 0x60, 0x3e, 0x1e, 0x17, 0xa6,
+0xa4, 0x4b, 0xff, 0x4a, 0xd4, 0x8f, 0xb7, 0xa1, 0xe2, 0x81, 0x72, 0x15, 0x13, 0x5b, 0x19, 0x13,
+0x53, 0x17, 0x0f, 0xf0, 0x66, 0x57, 0x42, 0x8f, 0xf1, 0xbd, 0xda, 0x25, 0x32, 0x32, 0x71, 0x42,
+0xf0, 0x82, 0x05, 0x49, 0xf3, 0x8b, 0xf7, 0x58, 0xe0, 0x02, 0x4a, 0xb9, 0x84, 0xd4, 0x22, 0x73,
+0x6a, 0x86, 0x03, 0xf9, 0x8a, 0xb9, 0x9d, 0xbd, 0x42, 0x87, 0xe8, 0xab, 0x7e, 0x2b, 0x16, 0xf9,
+0xf3, 0xd9, 0x03, 0x95, 0x8d, 0xe7, 0xb9, 0x8b, 0xb9, 0x8e, 0xca, 0xe5, 0x26, 0xf0, 0x06, 0xca,
+0xa7, 0xc7, 0xdc, 0xea, 0xfb, 0x0b, 0xca, 0x6c, 0x4f, 0x28, 0xf5, 0xf3, 0x27, 0xfa, 0xff, 0xa2,
+0xc7, 0x15, 0x39, 0xd7, 0x77, 0x34, 0x55, 0xcd, 0x2a, 0x96, 0x1d, 0x96, 0xff, 0x36, 0x83, 0x19,
+0x25, 0x1f, 0xb1, 0xcf, 0xa2, 0x87, 0x04, 0xcf, 0xc3, 0x24, 0x3d, 0x96, 0xc0, 0x68, 0x3b, 0x75,
+0xf1, 0xff, 0x6e, 0xa0, 0x1f, 0xc5, 0xa5, 0x6c, 0x69, 0x5d, 0xb4, 0xbb, 0x6d, 0xd4, 0xfe, 0x7d,
+0x61, 0x68, 0xa8, 0xc9, 0x38, 0x91, 0xec, 0x68, 0x3a, 0xee, 0x6a, 0xcf, 0xee, 0x61, 0xe2, 0xa0,
+0x97, 0x98, 0x88, 0x82, 0xa7, 0x92, 0x50, 0x41, 0x5e, 0xe2, 0xc1, 0x39, 0xfc, 0xb1, 0x91, 0xa5,
+0xed, 0x89, 0xb4, 0xdc, 0x99, 0x62, 0x4e, 0xa0, 0xe4, 0x95, 0x90, 0x6a, 0xcc, 0xfc, 0x33, 0x31,
+0x2b, 0x55, 0x93, 0xe0, 0xee, 0x6f, 0x31, 0x05, 0xd6, 0xae, 0xd3, 0x08, 0xd3, 0x0b, 0xfe, 0x24,
+0xa3, 0x82, 0x14, 0xb6, 0x0a, 0x87, 0x24, 0x2b, 0x1f, 0x42, 0xed, 0xca, 0x2d, 0x46, 0xc4, 0x90,
+0x86, 0x6e, 0x83, 0xdf, 0x19, 0xcc, 0x27, 0x1e, 0x7a, 0xc9, 0x05, 0x9b, 0x86, 0xfe, 0xf2, 0xd3,
+0xf2, 0x8d, 0x5b, 0xa5, 0x9c, 0xdc, 0xed, 0x1d, 0xc6, 0xfb, 0x38, 0x80, 0x73, 0x3e, 0x43, 0x37,
+0x58, 0xc3, 0x17, 0x99, 0x6b, 0x74, 0xcf, 0x1d, 0x57, 0xad, 0x74, 0x3d, 0x99, 0xb4, 0xc0, 0x0b,
+0xe9, 0x6a, 0x7a, 0x5a, 0x46, 0xc7, 0x9f, 0x62, 0x4b, 0x4d, 0xf2, 0xd9, 0x4d, 0x3f, 0xa3, 0x87,
+0x8e, 0xb7, 0x80, 0x15, 0x15, 0xcd, 0x08, 0xd8, 0x13, 0xbe, 0x86, 0x50, 0x3f, 0xf1, 0x81, 0x3a,
+0xa8, 0x9a, 0x9d, 0xf0, 0x64, 0xab, 0x9b, 0xfd, 0x91, 0x52, 0x59, 0x06, 0xb0, 0x06, 0x25, 0x61,
+0x5a, 0x49, 0xbd, 0x0a, 0x93, 0x80, 0x6c, 0xba, 0x11, 0xa3, 0x09, 0x92, 0x3e, 0xd3, 0x21, 0x5d,
+0xb6, 0x7b, 0x8d, 0x5b, 0xfb, 0x24, 0xec, 0x4b, 0x9a, 0x53, 0x1c, 0x3c, 0x7f, 0x12, 0x30, 0x0b,
+0x3a, 0x9c, 0xa3, 0x43, 0x74, 0x64, 0x2c, 0x87, 0x8e, 0xba, 0x97, 0x5c, 0xa2, 0x2c, 0xaa, 0x93,
+0x53, 0xf0, 0x72, 0xb0, 0xc5, 0xe8, 0xec, 0xae, 0x12, 0xf6, 0x20, 0x2e, 0x30, 0xea, 0x81, 0xde,
+0x1c, 0x89, 0x41, 0x8f, 0x7d, 0x14, 0x04, 0x62, 0x76, 0xed, 0x90, 0xb4, 0x69, 0x22, 0x92, 0x3f,
+0x1a, 0x45, 0x52, 0x8f, 0x72, 0x8f, 0xb7, 0x43, 0xc7, 0x68, 0x1f, 0xbd, 0x7b, 0xc7, 0x8e, 0xdf,
+0x9d, 0x1c, 0x9d, 0xb5, 0xa5, 0xe7, 0x28, 0x66, 0x25, 0x30, 0x63, 0x11, 0x8d, 0x29, 0x90, 0x68,
+0x89, 0x48, 0xb4, 0x9e, 0xf6, 0xfe, 0xba, 0x9e, 0xe2, 0x94, 0x52, 0x86, 0x7a, 0x8a, 0xfe, 0x5e,
+0x79, 0x36, 0x7b, 0x2a, 0xbe, 0x48, 0x5e, 0x3a, 0x15, 0xaf, 0x7a, 0x47, 0x41, 0xf9, 0x7e, 0xf8,
+0x81, 0x19, 0x92, 0xb3, 0x6b, 0x68, 0xe9, 0x65, 0x56, 0x13, 0x44, 0xd9, 0x55, 0xcf, 0x1f, 0xb1,
+0x5f, 0xce, 0x18, 0x7a, 0xfc, 0xf8, 0x00, 0x87, 0xe1, 0xa0, 0xfd, 0xf5, 0x2c, 0x8e, 0xbe, 0xf9,
+0x53, 0x3f, 0x7d, 0x5c, 0xa7, 0x9a, 0xaf, 0x3f, 0x7f, 0x12, 0x0e, 0xbf, 0xca, 0xf8, 0x2c, 0x4e,
+0x4f, 0x36, 0x3d, 0x7e, 0xbf, 0x9f, 0x4e, 0x0e, 0x15, 0x15, 0x3e, 0x6d, 0x58, 0xec, 0x6f, 0x40,
+0x62, 0x3d, 0x34, 0xf4, 0xae, 0x20, 0xf1, 0xef, 0x42, 0x1a, 0xfc, 0x3e, 0x6c, 0x1c, 0x75, 0x6a,
+0x11, 0xb5, 0x2b, 0x4b, 0x04, 0x0d, 0xb9, 0x44, 0xf8, 0xf9, 0xc6, 0x8d, 0xa3, 0xee, 0x77, 0x10,
+0x80, 0xca, 0x46, 0x63, 0xa8, 0x37, 0xde, 0x80, 0x62, 0x6f, 0x0b, 0x0a, 0x02, 0x1a, 0xfa, 0xe2,
+0x6b, 0x3f, 0xe6, 0xaf, 0x79, 0x80, 0xcb, 0x03, 0x32, 0x15, 0x48, 0x68, 0xba, 0x3f, 0xa7, 0x31,
+0x3e, 0x05, 0xbb, 0x60, 0x26, 0xaa, 0x3a, 0xc0, 0x7f, 0xfc, 0x7b, 0x43, 0x79, 0x44, 0xb1, 0x7f,
+0xe7, 0x87, 0x9f, 0xc9, 0x47, 0xe1, 0xcf, 0x78, 0x70, 0xa9, 0xb0, 0x1f, 0x62, 0x18, 0xbc, 0x5f,
+0x30, 0xf8, 0xa8, 0xa6, 0x24, 0xef, 0x3f, 0x58, 0xd2, 0xa6, 0xfc, 0x05, 0x99, 0x77, 0x78, 0x75,
+0x81, 0xe0, 0xb3, 0xdb, 0xb4, 0xa9, 0x26, 0x30, 0xb8, 0xe3, 0x73, 0xad, 0x9f, 0xbf, 0x4c, 0xd5,
+0x05, 0x09, 0xce, 0x32, 0x6c, 0x19, 0x19, 0x90, 0xd3, 0xd9, 0x46, 0x7d, 0x68, 0x3f, 0x8d, 0xe5,
+0x59, 0x7f, 0x98, 0xde, 0x61, 0x8f, 0x68, 0x1f, 0x02, 0x0b, 0xb8, 0x1e, 0x9e, 0xc0, 0xe8, 0x7d,
+0xd0, 0x1e, 0xd1, 0x0b, 0x6b, 0xc2, 0x3e, 0x48, 0xf5, 0x0f, 0x1e, 0xc1, 0x56, 0xa5, 0xd0, 0x42,
+0xe0, 0x05, 0x81, 0x6f, 0x0e, 0x83, 0x14, 0x9b, 0x46, 0xe0, 0xb4, 0xf3, 0x25, 0x09, 0xbe, 0xad,
+0xc0, 0x26, 0x2e, 0xe1, 0x9f, 0xf8, 0xb0, 0x53, 0x88, 0x56, 0x96, 0x07, 0x93, 0x80, 0x0f, 0x20,
+0xb9, 0xb1, 0x23, 0x37, 0x6c, 0xe4, 0x46, 0x8c, 0xdc, 0x60, 0xb1, 0x6c, 0x88, 0xfb, 0xbe, 0x58,
+0x4b, 0x16, 0x65, 0xd1, 0x78, 0x41, 0x1e, 0xcb, 0xa7, 0x49, 0x35, 0x80, 0x05, 0x13, 0xdc, 0x48,
+0x3c, 0xa7, 0x0e, 0xcf, 0x31, 0xe3, 0x0d, 0xeb, 0xf0, 0x86, 0x25, 0x3c, 0x5d, 0x18, 0x66, 0x44,
+0x1d, 0x42, 0xc7, 0x5c, 0xe8, 0x4f, 0xf0, 0x2c, 0x17, 0x06, 0x06, 0x34, 0xc5, 0x04, 0x4c, 0x25,
+0x14, 0x66, 0x57, 0x1d, 0x3e, 0xac, 0x0d, 0xc4, 0x93, 0x55, 0x62, 0x56, 0xe5, 0x14, 0xf3, 0x9d,
+0xf5, 0x07, 0xb1, 0x29, 0x23, 0x9b, 0x77, 0xe5, 0x21, 0x86, 0xeb, 0x5c, 0xaf, 0xf0, 0x1d, 0x9f,
+0x17, 0x2d, 0xb1, 0x4c, 0x95, 0x01, 0x01, 0x7f, 0xeb, 0x14, 0x0e, 0x2a, 0x6a, 0x54, 0x39, 0xbc,
+0x97, 0x3f, 0xaa, 0xac, 0x65, 0x75, 0x7e, 0x89, 0x4d, 0x17, 0x9a, 0x9b, 0x51, 0xd3, 0x62, 0x28,
+0xab, 0xdb, 0x75, 0xf2, 0xc9, 0x84, 0x03, 0x57, 0x61, 0xda, 0x71, 0x7d, 0xca, 0xa5, 0x48, 0x2f,
+0xa8, 0xf1, 0x74, 0x66, 0x71, 0xa5, 0x97, 0xd3, 0x99, 0x04, 0x3c, 0x1c, 0x11, 0x24, 0xf1, 0x20,
+0x0b, 0x06, 0x54, 0x5c, 0x97, 0xe1, 0xe7, 0x53, 0xd1, 0x91, 0x12, 0xcf, 0xd2, 0x74, 0xd1, 0xcd,
+0x39, 0xc6, 0x57, 0xac, 0x59, 0x18, 0xd1, 0x9a, 0x70, 0xc7, 0xe0, 0x3f, 0xe4, 0x6b, 0xa6, 0xb9,
+0x9c, 0x49, 0x96, 0x51, 0x6d, 0x8d, 0x05, 0x0e, 0x5a, 0x60, 0xe9, 0x9a, 0xe6, 0xad, 0xae, 0x4c,
+0x55, 0xf3, 0x11, 0xf2, 0x24, 0xc5, 0x9d, 0x49, 0xa6, 0xcb, 0x61, 0xcd, 0x25, 0x17, 0xcc, 0x6d,
+0x63, 0x8b, 0x59, 0x90, 0x25, 0x77, 0x7f, 0x53, 0xf9, 0x5d, 0x3f, 0x32, 0x73, 0x04, 0xde, 0xf7,
+0x57, 0x01, 0x76, 0x56, 0x01, 0x1e, 0x36, 0x04, 0xa6, 0x9e, 0xdd, 0x10, 0x56, 0x4c, 0x98, 0x96,
+0xda, 0x8e, 0xb8, 0xfa, 0x75, 0x6e, 0x6a, 0x19, 0x5c, 0xd5, 0x3d, 0xcf, 0xde, 0xc0, 0xe6, 0xd2,
+0x93, 0x97, 0x4c, 0xf0, 0x17, 0xac, 0x61, 0x2c, 0x4e, 0x28, 0xbe, 0xd3, 0xa1, 0x07, 0x93, 0x3c,
+0xea, 0xaa, 0xba, 0x59, 0xaa, 0xd7, 0xa4, 0x5a, 0x9b, 0xb4, 0x4d, 0x36, 0x49, 0xef, 0x3d, 0x4c,
+0x2d, 0xfa, 0xb2, 0x47, 0x2f, 0xad, 0x30, 0x3d, 0xe6, 0x1a, 0xe4, 0x9f, 0xf6, 0x36, 0x3d, 0x2b,
+0x7f, 0x8d, 0x48, 0x4c, 0x00, 0xe0, 0x44, 0xb4, 0x56, 0x91, 0xf0, 0xb8, 0x77, 0x4e, 0xf2, 0xdd,
+0xeb, 0x17, 0xb9, 0x52, 0x2a, 0xbb, 0x91, 0x79, 0xfe, 0x06, 0x9d, 0xca, 0x98, 0x51, 0xe8, 0x62,
+0x66, 0x98, 0x3a, 0xd7, 0x76, 0x09, 0x6f, 0x7f, 0xf3, 0x6b, 0x7f, 0xb1, 0x5f, 0x5b, 0x41, 0xe1,
+0x6f, 0xbe, 0xee, 0xaf, 0xe2, 0xeb, 0xd6, 0xf7, 0xab, 0x15, 0x1d, 0x5d, 0xe5, 0xde, 0x82, 0x6b,
+0x0b, 0xfe, 0x6d, 0x42, 0xbd, 0xa3, 0x38, 0xae, 0x68, 0xa5, 0xd2, 0x26, 0x17, 0x31, 0x04, 0x8a,
+0x5d, 0x09, 0x58, 0xea, 0x0d, 0x1a, 0xdc, 0xbc, 0xa1, 0x2d, 0x09, 0x48, 0xbb, 0x61, 0x8f, 0x4b,
+0x82, 0x1e, 0x9e, 0x84, 0xae, 0xae, 0x7f, 0xd2, 0x55, 0xed, 0x6f, 0xa3, 0xa9, 0xd7, 0xa1, 0x0b,
+0x47, 0x2c, 0x25, 0x36, 0xcc, 0x5d, 0xf0, 0xfb, 0xd2, 0x3a, 0x45, 0x97, 0xae, 0xa0, 0x59, 0x13,
+0xef, 0x2e, 0xf6, 0xf8, 0xd5, 0x35, 0x34, 0x6f, 0xe6, 0x9f, 0xf8, 0x4e, 0xc9, 0x70, 0xb8, 0x63,
+0x6f, 0xa1, 0x36, 0xc8, 0xb4, 0x7d, 0xe6, 0x38, 0xf6, 0x96, 0x8a, 0x8a, 0x76, 0xfe, 0xfa, 0xbf,
+0xff, 0x59, 0xce, 0xb6, 0x33, 0x2c, 0x04, 0xa1, 0x99, 0xb6, 0x42, 0xda, 0xde, 0xc9, 0x23, 0xfd,
+0x9f, 0x32, 0x12, 0x82, 0xe4, 0x91, 0x06, 0x83, 0x42, 0x51, 0xff, 0x52, 0xc6, 0x22, 0x98, 0x02,
+0xda, 0x56, 0xa1, 0xb0, 0xff, 0x6b, 0x40, 0xdb, 0x2a, 0x95, 0xe6, 0xf4, 0x0b, 0xa5, 0xfd, 0xab,
+0xa1, 0x62, 0xfd, 0x52, 0x69, 0xce, 0x66, 0xa1, 0xb4, 0x7f, 0x33, 0xa0, 0x6d, 0x96, 0x4b, 0xdb,
+0x2d, 0x94, 0xf6, 0x4f, 0x06, 0xb4, 0xdd, 0x52, 0x69, 0xd4, 0x1e, 0x3a, 0xda, 0x5f, 0x3a, 0x2a,
+0x1c, 0x56, 0x68, 0x66, 0x70, 0xe4, 0xe6, 0x33, 0xd2, 0xf9, 0xf3, 0x88, 0x2e, 0x16, 0xb3, 0x52,
+0xfc, 0x38, 0xc5, 0xab, 0xf6, 0xb9, 0x56, 0xe2, 0x6d, 0x26, 0x18, 0x12, 0xef, 0x6a, 0x77, 0x91,
+0xde, 0x54, 0xbe, 0x09, 0x2a, 0x28, 0xc8, 0x0b, 0x36, 0xe9, 0x33, 0xdb, 0x63, 0xc1, 0x69, 0x88,
+0xa8, 0x2a, 0x50, 0xa1, 0x6c, 0xc3, 0x25, 0xf0, 0x36, 0xf8, 0x01, 0x94, 0x87, 0xdb, 0x2d, 0x64,
+0x10, 0x56, 0x1a, 0x21, 0xfe, 0xcd, 0x8d, 0x10, 0xff, 0xdd, 0xf8, 0x72, 0x1a, 0xbe, 0x70, 0x20,
+0x90, 0xb0, 0x23, 0x83, 0x08, 0xa8, 0x2c, 0xba, 0xbd, 0x81, 0x56, 0xfe, 0x62, 0xa2, 0x6d, 0x82,
+0xf9, 0xc8, 0xb3, 0xb0, 0x37, 0xb9, 0xc9, 0x18, 0x3b, 0x53, 0x67, 0xe2, 0xe1, 0x8f, 0x3d, 0x9e,
+0x60, 0xe0, 0x34, 0xdb, 0x58, 0x71, 0x4f, 0xdd, 0x90, 0x03, 0x90, 0x2b, 0x6b, 0x22, 0x4d, 0x0d,
+0x74, 0x6f, 0xb8, 0xfc, 0x3c, 0xc6, 0x2b, 0xb1, 0x26, 0x18, 0x4b, 0xc6, 0x28, 0x72, 0x61, 0x74,
+0xc2, 0x31, 0x48, 0x8e, 0x4f, 0x2e, 0xf6, 0xd6, 0xf5, 0xf9, 0x0c, 0x06, 0xa8, 0x0d, 0x4c, 0x3f,
+0x34, 0xe4, 0x4e, 0xa2, 0x87, 0x50, 0xe5, 0x73, 0x27, 0x47, 0x49, 0xd9, 0xc8, 0x15, 0xc9, 0x24,
+0x5b, 0x67, 0x13, 0x7c, 0x64, 0x42, 0xaa, 0xe3, 0x97, 0x6e, 0x3d, 0xe5, 0x1f, 0x39, 0xd6, 0xa3,
+0xb2, 0x40, 0xff, 0xfa, 0x97, 0xff, 0x47, 0xf2, 0xfc, 0xeb, 0x5f, 0xfe, 0x7f, 0x47, 0xad, 0x99,
+0xe1, 0xb6, 0x64, 0xb3, 0xb2, 0x58, 0x1d, 0xca, 0xcc, 0x2e, 0x73, 0xa7, 0xc5, 0x8d, 0xdc, 0x72,
+0x36, 0x01, 0xd8, 0x98, 0xae, 0xdd, 0xdd, 0x8c, 0x6b, 0x30, 0x67, 0x1c, 0x14, 0x73, 0x88, 0x63,
+0xcb, 0x72, 0xf1, 0x62, 0xdf, 0xdc, 0x46, 0x8d, 0x9f, 0xa8, 0x0b, 0xc8, 0xce, 0x80, 0xaf, 0xa6,
+0xa6, 0xc7, 0x5e, 0x10, 0xfc, 0x84, 0xcb, 0xe2, 0x7c, 0x6f, 0x22, 0xe0, 0x80, 0x52, 0xe1, 0x0c,
+0x49, 0xcf, 0x93, 0xc9, 0xb2, 0xc4, 0x9b, 0x7a, 0x42, 0x37, 0x66, 0x42, 0x37, 0x92, 0x10, 0x2a,
+0x11, 0x5e, 0x3b, 0x18, 0xdd, 0x0a, 0xb6, 0x50, 0x6c, 0xfc, 0x91, 0x92, 0x0e, 0x8e, 0x00, 0x22,
+0xef, 0xa6, 0x98, 0xa7, 0xd9, 0x88, 0xb2, 0xbc, 0x89, 0xd2, 0x3a, 0x47, 0xda, 0xe3, 0xff, 0x5b,
+0xa7, 0x44, 0x6d, 0x39, 0xc2, 0x8c, 0x45, 0xfb, 0xf3, 0x02, 0x0f, 0xef, 0x04, 0x72, 0x63, 0x60,
+0xf3, 0x27, 0xdc, 0x15, 0xc6, 0x49, 0x14, 0xb2, 0x10, 0x5a, 0x4c, 0x4c, 0x79, 0x5b, 0x14, 0x7d,
+0xd6, 0xac, 0x39, 0xb2, 0x97, 0x20, 0xf9, 0x9a, 0x14, 0x87, 0x2f, 0xde, 0xf5, 0xa6, 0xed, 0x95,
+0xce, 0xdb, 0xac, 0x4c, 0x6a, 0x00, 0x26, 0xc4, 0x99, 0x05, 0x20, 0xc4, 0x27, 0x05, 0x0f, 0x3a,
+0x39, 0x67, 0xad, 0xa3, 0xa2, 0x04, 0xda, 0x09, 0x01, 0x72, 0x58, 0x81, 0x60, 0x72, 0xe9, 0x5c,
+0xe9, 0x0e, 0xbd, 0x5c, 0xf7, 0xed, 0x48, 0x77, 0xad, 0x06, 0x7b, 0x68, 0xc6, 0xd6, 0x5c, 0x96,
+0x1a, 0x02, 0x3b, 0x45, 0x02, 0xc5, 0xd0, 0x46, 0x06, 0xda, 0xcf, 0x81, 0x16, 0xa6, 0x2f, 0x65,
+0x95, 0xfb, 0x9b, 0x94, 0x94, 0x94, 0xca, 0xa6, 0xb0, 0x63, 0x88, 0x81, 0x76, 0xf8, 0x8e, 0xd5,
+0x22, 0xa4, 0xe6, 0xcb, 0xe5, 0xa0, 0xb3, 0x0b, 0xc0, 0xb3, 0x5d, 0x75, 0xb8, 0x05, 0x9a, 0x6c,
+0x93, 0xdc, 0x45, 0xf6, 0x9f, 0x47, 0x8b, 0x6d, 0x26, 0x54, 0x98, 0x00, 0x00,
+};
+
+static const uint8_t webAsset_style_css[] PROGMEM = {
+0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x59, 0x5b, 0x8f, 0xe2, 0x36,
+0x14, 0x7e, 0xe7, 0x57, 0x44, 0xbb, 0x5a, 0x69, 0x46, 0x22, 0x28, 0x09, 0x04, 0x02, 0xa8, 0x55,
+0x2b, 0xf5, 0xa5, 0x0f, 0xfd, 0x01, 0x55, 0xb5, 0x0f, 0x8e, 0xe3, 0x80, 0x3b, 0x26, 0x8e, 0x12,
+0x67, 0x66, 0xd8, 0xd5, 0xfe, 0xf7, 0x1e, 0xdb, 0xb9, 0x38, 0x8e, 0xc3, 0x30, 0xdd, 0xad, 0xd4,
+0x45, 0x9d, 0x42, 0xf0, 0x39, 0x3e, 0xd7, 0xef, 0x5c, 0x48, 0x79, 0x76, 0xf5, 0xbe, 0x2e, 0x72,
+0x5e, 0x08, 0x3f, 0x47, 0x17, 0xca, 0xae, 0x07, 0xef, 0xd7, 0x8a, 0x22, 0xb6, 0xf4, 0x6a, 0x54,
+0xd4, 0x7e, 0x4d, 0x2a, 0x9a, 0x1f, 0x17, 0x17, 0x54, 0x9d, 0x68, 0x71, 0xf0, 0x82, 0xe3, 0xa2,
+0x44, 0x59, 0x46, 0x8b, 0x93, 0x7a, 0x9f, 0x22, 0xfc, 0x74, 0xaa, 0x78, 0x53, 0x64, 0x3e, 0xe6,
+0x8c, 0x57, 0x07, 0xef, 0x63, 0x1e, 0xe4, 0x51, 0x1e, 0x1f, 0x17, 0xdd, 0xe7, 0xf5, 0x7a, 0x7d,
+0x5c, 0x64, 0xb4, 0x2e, 0x19, 0x02, 0xd6, 0x39, 0x23, 0xaf, 0xc7, 0x85, 0xfc, 0xeb, 0x67, 0xb4,
+0x22, 0x58, 0x50, 0x0e, 0x5c, 0xe1, 0x6c, 0x73, 0x29, 0xe0, 0x16, 0x5a, 0xf8, 0x67, 0x42, 0x4f,
+0x67, 0x71, 0xf0, 0xc2, 0x20, 0x78, 0x3e, 0x1f, 0x17, 0xdf, 0x16, 0x67, 0x82, 0x32, 0x52, 0x81,
+0x8c, 0x8e, 0xcb, 0x22, 0xbc, 0x26, 0x71, 0x30, 0x5c, 0x46, 0x30, 0x5c, 0x1f, 0x1a, 0x32, 0x86,
+0x71, 0xf9, 0xea, 0x45, 0x41, 0x09, 0x97, 0x0a, 0xf2, 0x2a, 0x7c, 0xc4, 0xe8, 0x49, 0x5e, 0x48,
+0x0a, 0x41, 0x2a, 0x90, 0x9f, 0xbf, 0xfa, 0xf5, 0x19, 0x65, 0xfc, 0x05, 0xd4, 0xf1, 0x22, 0x38,
+0xbb, 0x81, 0xff, 0xaa, 0x53, 0x8a, 0x1e, 0x82, 0xa5, 0x7a, 0xad, 0xc2, 0x47, 0x29, 0x44, 0x81,
+0x9e, 0xdd, 0x12, 0xac, 0x37, 0x9b, 0x7d, 0x4c, 0xcc, 0x1b, 0xe1, 0x32, 0x69, 0x1a, 0xd7, 0x75,
+0x9a, 0x4f, 0xda, 0x08, 0xc1, 0x8b, 0x39, 0x76, 0xfb, 0x24, 0x4b, 0x7b, 0x85, 0x5e, 0xce, 0x54,
+0x10, 0x29, 0x66, 0x05, 0x26, 0x38, 0x78, 0x05, 0x2f, 0x26, 0x57, 0x69, 0xe5, 0x7a, 0xff, 0x78,
+0xb1, 0xfc, 0xa8, 0x09, 0xfc, 0x0a, 0x65, 0xb4, 0xa9, 0x0f, 0xfa, 0x19, 0x6e, 0xaa, 0x5a, 0xf2,
+0x2c, 0x39, 0xd5, 0xd2, 0x28, 0x9f, 0xd7, 0xf4, 0x0b, 0x01, 0x4e, 0x5b, 0x65, 0xa1, 0x0a, 0x3c,
+0x4e, 0xb5, 0x4b, 0x6c, 0xd9, 0xbc, 0x60, 0xb5, 0xae, 0x3d, 0x82, 0x6a, 0x32, 0x56, 0xe3, 0x70,
+0xe6, 0xcf, 0xb3, 0xde, 0xd9, 0x27, 0x41, 0xba, 0x1f, 0x9f, 0x5f, 0x21, 0xf0, 0xf9, 0x33, 0x71,
+0x13, 0x84, 0x28, 0xc5, 0x7b, 0x2c, 0x09, 0x2e, 0x88, 0x4a, 0x0b, 0xa9, 0x40, 0x81, 0x43, 0xe0,
+0x1e, 0xd3, 0xab, 0x9d, 0xce, 0xaf, 0xfe, 0x0b, 0xcd, 0xc4, 0x59, 0x05, 0xcb, 0xc8, 0x0c, 0xf2,
+0x80, 0x87, 0x1a, 0xc1, 0xdd, 0x21, 0xaa, 0xfe, 0x4d, 0xac, 0x94, 0x68, 0xcb, 0x99, 0x11, 0x21,
+0xa3, 0x21, 0x71, 0x47, 0xc4, 0x4a, 0xa0, 0x14, 0x38, 0x82, 0x29, 0x0b, 0x01, 0x92, 0xf6, 0x11,
+0xae, 0x7d, 0x34, 0xfe, 0x7e, 0x50, 0xba, 0x3f, 0x96, 0x32, 0x8e, 0x9f, 0x54, 0x78, 0x47, 0xf0,
+0xd8, 0x8e, 0xe7, 0x56, 0xb2, 0x94, 0x83, 0xc9, 0x2e, 0x07, 0x15, 0x98, 0x35, 0x67, 0x34, 0x83,
+0x08, 0x27, 0x43, 0x04, 0xf4, 0xdf, 0x87, 0x86, 0xf2, 0xbe, 0xe0, 0xa5, 0xca, 0x4d, 0x60, 0xbd,
+0x36, 0x58, 0x77, 0x81, 0x6a, 0x9e, 0x8a, 0x62, 0x83, 0xae, 0x67, 0xa6, 0x1e, 0x82, 0x02, 0xb5,
+0x40, 0xa2, 0x01, 0x04, 0x68, 0x2e, 0x70, 0xe2, 0x6a, 0x0a, 0xaf, 0xb3, 0xf8, 0xef, 0xa6, 0x16,
+0x34, 0xbf, 0x76, 0x4a, 0x1e, 0xbc, 0xba, 0x44, 0x98, 0xf8, 0x48, 0x19, 0xbb, 0x4d, 0xf2, 0x97,
+0x0a, 0xc1, 0x3d, 0xf2, 0xef, 0xe4, 0x1e, 0xed, 0xc4, 0x93, 0xfc, 0xde, 0xbe, 0x12, 0xa3, 0x2a,
+0x73, 0x47, 0xc8, 0xad, 0x04, 0x77, 0xb9, 0xd3, 0x95, 0x85, 0x52, 0x30, 0x15, 0x4f, 0x12, 0x6e,
+0xba, 0x00, 0x8a, 0x83, 0xa9, 0xf7, 0x9d, 0x78, 0x10, 0xc4, 0x8f, 0xef, 0xc9, 0x94, 0x91, 0x4a,
+0xe7, 0x0d, 0x68, 0x65, 0xb9, 0xc9, 0xb2, 0x8a, 0x4e, 0xd5, 0x56, 0xdb, 0x38, 0x8e, 0x47, 0x69,
+0x1a, 0xac, 0xf6, 0xe4, 0x32, 0xe1, 0x5a, 0xf6, 0x4c, 0x15, 0x43, 0x33, 0xad, 0x57, 0x89, 0x3c,
+0xaf, 0x9e, 0xbc, 0xb4, 0xb8, 0x9a, 0x72, 0x96, 0x1d, 0x27, 0x01, 0x37, 0x66, 0xb9, 0x62, 0xe4,
+0x99, 0x30, 0x3f, 0xf4, 0xbe, 0x7a, 0xae, 0xf4, 0x49, 0xb2, 0x5d, 0x86, 0x8e, 0x5e, 0xf7, 0x79,
+0x17, 0x85, 0x38, 0xda, 0x1c, 0xbd, 0x0e, 0xa5, 0xc2, 0x21, 0x5a, 0xf3, 0x18, 0x6f, 0x71, 0x7a,
+0xf4, 0x9c, 0xec, 0xa3, 0x19, 0xf6, 0x39, 0x21, 0xa9, 0xc1, 0x3e, 0x89, 0xb7, 0x9b, 0x60, 0x86,
+0x7d, 0x9e, 0xe5, 0x3b, 0x32, 0xc3, 0x7e, 0xed, 0x66, 0x9f, 0x85, 0x10, 0x43, 0xe1, 0xc0, 0x3e,
+0xc0, 0xf1, 0x66, 0x1b, 0x38, 0xd9, 0xa7, 0x84, 0xc4, 0x64, 0x2a, 0x3d, 0x62, 0xcc, 0xc7, 0x8c,
+0xa0, 0x6a, 0xe6, 0x82, 0x0d, 0xc9, 0x4c, 0xf3, 0x84, 0x71, 0xbc, 0x9b, 0x31, 0x0f, 0x18, 0xdf,
+0x65, 0x1e, 0x52, 0x55, 0xbc, 0xfa, 0x81, 0xb6, 0xff, 0xe5, 0x89, 0x5c, 0xf3, 0x0a, 0x5d, 0x48,
+0xed, 0x95, 0x0d, 0xab, 0x25, 0x0e, 0x05, 0x9f, 0x24, 0xff, 0x51, 0xb4, 0xeb, 0x97, 0x8a, 0xf5,
+0x28, 0x0a, 0x96, 0x5e, 0xbc, 0x5e, 0x7a, 0xdb, 0xfd, 0x12, 0x82, 0x6e, 0xf7, 0x28, 0xb9, 0xec,
+0x66, 0x68, 0x54, 0x15, 0x72, 0x90, 0x29, 0x22, 0x00, 0xe6, 0x77, 0xdc, 0xa4, 0x48, 0xdc, 0xa1,
+0xb8, 0x4a, 0x19, 0x2d, 0x9e, 0x40, 0x72, 0x54, 0xd0, 0x0b, 0xd2, 0x99, 0xa7, 0x95, 0x09, 0x57,
+0x71, 0xed, 0xd1, 0x22, 0xa7, 0x85, 0xaa, 0x95, 0xdf, 0x16, 0x00, 0xbc, 0x4c, 0xea, 0x38, 0xd4,
+0x86, 0x4f, 0x3d, 0x38, 0x80, 0xdd, 0x18, 0x2a, 0x6b, 0xa2, 0x7a, 0x0e, 0xf5, 0xce, 0x42, 0x44,
+0x05, 0x03, 0xae, 0x94, 0xd3, 0x5c, 0x85, 0xec, 0x46, 0xe0, 0xef, 0xed, 0x66, 0x60, 0x5c, 0xbd,
+0x47, 0xf5, 0x7a, 0x0c, 0x49, 0x8c, 0xe4, 0xe2, 0x16, 0xda, 0x0f, 0xe9, 0xd9, 0x5e, 0x9f, 0xca,
+0x76, 0x4d, 0x48, 0x70, 0xb4, 0xb8, 0x5a, 0x3c, 0x8c, 0x38, 0xc8, 0x32, 0xc8, 0x77, 0xa8, 0xd1,
+0x82, 0x62, 0xc4, 0xba, 0x8b, 0x41, 0xd9, 0x09, 0xd7, 0xea, 0x50, 0x88, 0xb3, 0x8f, 0xcf, 0x94,
+0x65, 0x0f, 0x60, 0xf4, 0xe2, 0xd1, 0xad, 0x64, 0xbe, 0x97, 0x2f, 0x07, 0xf5, 0x8d, 0x4e, 0x00,
+0x40, 0x1b, 0x5e, 0x8e, 0x1e, 0x04, 0x9c, 0x5d, 0x70, 0x3f, 0x43, 0x02, 0x01, 0xa1, 0x0b, 0xac,
+0xad, 0x9a, 0xdf, 0xc7, 0xfd, 0x6e, 0xd7, 0xb9, 0x49, 0x5c, 0x19, 0xf8, 0x89, 0x0a, 0x20, 0xc4,
+0xa6, 0xa3, 0x56, 0x70, 0x93, 0x7a, 0xbf, 0x9c, 0x3e, 0xf2, 0x2f, 0x3c, 0x43, 0x4c, 0x56, 0x47,
+0x5b, 0xa0, 0x92, 0x77, 0xb8, 0x5e, 0x11, 0x86, 0x64, 0xd5, 0x1e, 0xca, 0x6d, 0xa5, 0x11, 0x54,
+0x57, 0x4d, 0xe5, 0x5c, 0x5f, 0x95, 0x3c, 0x59, 0xf4, 0x75, 0x89, 0x73, 0xdc, 0xee, 0xa9, 0x77,
+0x3e, 0x2d, 0x32, 0xb0, 0xbf, 0xe0, 0xd5, 0xbc, 0x34, 0xd6, 0x41, 0xe9, 0xe3, 0x5e, 0x18, 0x94,
+0x82, 0x37, 0x1b, 0x19, 0x4d, 0xad, 0x10, 0xba, 0xba, 0xc9, 0x90, 0x8d, 0x65, 0x78, 0xab, 0x82,
+0x94, 0xf3, 0x0a, 0x5c, 0xaf, 0xde, 0x82, 0xe8, 0xe4, 0xcf, 0x07, 0x1f, 0xbe, 0x7b, 0xbc, 0xbb,
+0xfb, 0x86, 0x04, 0x23, 0x7d, 0xfb, 0x1d, 0xcc, 0x28, 0x83, 0x00, 0x9b, 0x5e, 0xfc, 0xa6, 0xbc,
+0xa1, 0xc6, 0x8d, 0x23, 0xdd, 0x97, 0x00, 0x04, 0xc5, 0x9b, 0x1c, 0xe4, 0xa1, 0x21, 0x8d, 0x41,
+0x20, 0x43, 0xb6, 0x36, 0xdc, 0x65, 0xfe, 0xa8, 0x9a, 0xd9, 0x06, 0xbb, 0xd2, 0xbd, 0x44, 0x15,
+0x04, 0xcf, 0xd0, 0x0f, 0x68, 0xa2, 0x99, 0x43, 0x1c, 0x1c, 0x48, 0xc5, 0x55, 0x26, 0xfa, 0x66,
+0x5c, 0xd7, 0xdb, 0x6f, 0xe0, 0x8b, 0x68, 0x28, 0xe7, 0xdf, 0x67, 0x11, 0x99, 0x1c, 0xe3, 0x3c,
+0x1d, 0xa4, 0x6a, 0xc1, 0xc2, 0x6e, 0xc6, 0x74, 0x63, 0xf4, 0x43, 0x0c, 0xd9, 0x5e, 0xad, 0x83,
+0xc6, 0xbe, 0xd7, 0x71, 0xc7, 0x0a, 0xd5, 0xf8, 0x0e, 0xf5, 0xc6, 0xc7, 0xe0, 0x9e, 0xde, 0xa4,
+0xa1, 0x9b, 0x6d, 0x46, 0x06, 0x82, 0x9b, 0xf2, 0x4f, 0x4e, 0xde, 0xc1, 0x1c, 0xdd, 0xcb, 0xfb,
+0xed, 0x83, 0xa3, 0xeb, 0x6f, 0x19, 0x60, 0x7c, 0xce, 0x14, 0x12, 0x62, 0x47, 0x61, 0x5c, 0x07,
+0x37, 0xd6, 0x94, 0x30, 0xe4, 0x77, 0x4e, 0x5f, 0x09, 0xc0, 0xf4, 0x17, 0x99, 0xfe, 0xaa, 0x3b,
+0x85, 0x81, 0x06, 0x32, 0x52, 0x85, 0x77, 0xd0, 0x26, 0x3a, 0xfc, 0x7f, 0x54, 0xd2, 0x8c, 0x49,
+0x19, 0x3e, 0x49, 0xf0, 0xcd, 0x99, 0x2c, 0xb0, 0x73, 0x73, 0xcf, 0xa8, 0x8d, 0xdd, 0x3e, 0x3a,
+0x1a, 0xf8, 0x0e, 0x74, 0x15, 0x06, 0xfb, 0x10, 0x17, 0x97, 0xda, 0x1c, 0x5e, 0xb5, 0x1a, 0xc6,
+0xd0, 0xe3, 0x42, 0x7a, 0x22, 0x5f, 0x06, 0x6e, 0xaf, 0x5d, 0xbd, 0xb9, 0xae, 0x59, 0xad, 0x36,
+0x7b, 0x29, 0xbe, 0x31, 0xcc, 0x6d, 0x83, 0x3b, 0xe7, 0xf5, 0xae, 0xf5, 0x1f, 0x6b, 0xb6, 0x01,
+0xcd, 0x8c, 0x26, 0x21, 0x47, 0x19, 0xf9, 0xbd, 0x18, 0x9a, 0x72, 0x9f, 0x37, 0x42, 0x2a, 0x63,
+0x34, 0x45, 0xed, 0x11, 0x18, 0x37, 0x2b, 0x7e, 0x81, 0x6e, 0x65, 0x70, 0xdf, 0xd1, 0x9b, 0x01,
+0x56, 0x79, 0xad, 0xea, 0x56, 0x04, 0x37, 0x09, 0xc2, 0x39, 0x82, 0xbe, 0xb5, 0x19, 0x9b, 0x50,
+0x4d, 0x68, 0xd6, 0x40, 0x60, 0xb7, 0xe6, 0xa3, 0x7e, 0x7e, 0xdb, 0xf6, 0xff, 0x63, 0x36, 0x65,
+0xb7, 0xc1, 0xe9, 0x8e, 0x85, 0xf2, 0x98, 0x3d, 0x6f, 0x4d, 0x47, 0x8b, 0x9e, 0x91, 0x9e, 0xcd,
+0xeb, 0x1f, 0xb8, 0x9a, 0x90, 0x4d, 0x8c, 0x39, 0x5e, 0x1e, 0xda, 0x4e, 0xf1, 0xbf, 0xdf, 0x4d,
+0x38, 0x55, 0xba, 0x6f, 0x4d, 0xe1, 0x24, 0x5d, 0x61, 0x54, 0x60, 0xc2, 0xdc, 0xb4, 0x5b, 0xbc,
+0x8b, 0x77, 0xd9, 0x5b, 0xb4, 0xb7, 0x6e, 0x8f, 0xd1, 0x36, 0xda, 0x26, 0xe6, 0x04, 0xd6, 0x62,
+0xf7, 0x3d, 0xc9, 0x26, 0xb7, 0x18, 0x43, 0x87, 0x64, 0xac, 0x7e, 0x3a, 0x87, 0x4c, 0xd7, 0x19,
+0xca, 0x33, 0xe3, 0x7d, 0x86, 0x9c, 0x68, 0x8d, 0xfc, 0x5b, 0xeb, 0x59, 0xf8, 0xce, 0xae, 0x61,
+0x0e, 0x2b, 0x46, 0xca, 0xdc, 0x1a, 0x51, 0xc3, 0x99, 0x11, 0xd5, 0xe2, 0xb1, 0x82, 0x16, 0x9f,
+0x4f, 0xac, 0xe2, 0xb9, 0x8b, 0xda, 0xc7, 0x7c, 0xbd, 0xc7, 0x61, 0x64, 0x4e, 0x56, 0x9a, 0x49,
+0xdd, 0x60, 0x4c, 0xea, 0xfa, 0x6e, 0x3e, 0x51, 0x82, 0x76, 0x9b, 0x78, 0xca, 0x47, 0x8f, 0x68,
+0xf7, 0x72, 0xc9, 0xf0, 0x3a, 0xd6, 0x5c, 0x3e, 0xd6, 0x10, 0x11, 0xbf, 0x11, 0x81, 0x28, 0xab,
+0xff, 0x70, 0xfb, 0x79, 0x3a, 0x1f, 0xd8, 0x7b, 0xaf, 0x61, 0x6d, 0xb1, 0x09, 0xfa, 0x27, 0x5d,
+0x35, 0x88, 0xb4, 0xf7, 0x2a, 0xa2, 0xed, 0x0b, 0xd9, 0x7f, 0x9e, 0x16, 0x07, 0xc3, 0xdb, 0xfb,
+0xe0, 0xf9, 0x45, 0x3f, 0xe8, 0x38, 0xec, 0xd5, 0xe2, 0xd5, 0xd5, 0x7b, 0xb6, 0xed, 0x96, 0x6a,
+0x38, 0x6f, 0xb6, 0x9e, 0xaa, 0xf3, 0x5c, 0x7a, 0x6d, 0xff, 0xe9, 0x52, 0x5b, 0x21, 0x9f, 0x0b,
+0xe2, 0x3b, 0x28, 0x38, 0x55, 0x28, 0x75, 0x93, 0x76, 0x99, 0xa6, 0x37, 0xd7, 0xa6, 0xe4, 0x30,
+0xe0, 0xe0, 0x07, 0x35, 0x72, 0xfa, 0xb2, 0x2a, 0x4a, 0x88, 0xee, 0x55, 0xf7, 0xaf, 0x83, 0xf2,
+0x8e, 0x3d, 0x94, 0x73, 0x9c, 0x1a, 0xcd, 0x51, 0x6a, 0xf3, 0xe6, 0x02, 0x2f, 0x57, 0x62, 0x62,
+0xf9, 0x72, 0x8b, 0xdf, 0x8d, 0xa7, 0x93, 0x75, 0xdd, 0x7c, 0x6c, 0x30, 0xae, 0x86, 0x76, 0x97,
+0x4b, 0x14, 0xb9, 0x96, 0xb9, 0x1b, 0x4f, 0xec, 0x11, 0x36, 0x4a, 0xfa, 0x07, 0xd6, 0x12, 0xc8,
+0x46, 0xdd, 0x4e, 0x7c, 0x84, 0xd0, 0xdb, 0x02, 0xf5, 0xa0, 0x66, 0x95, 0x94, 0x9c, 0x73, 0xa1,
+0x9e, 0xff, 0xbb, 0x71, 0xce, 0x9c, 0xba, 0x4d, 0x13, 0x69, 0xdf, 0x41, 0x1e, 0xca, 0x50, 0x93,
+0x3b, 0xe1, 0x66, 0x00, 0x95, 0xe9, 0xee, 0xd2, 0x38, 0xc4, 0x50, 0x4a, 0x98, 0x63, 0xf5, 0xea,
+0x5a, 0xbc, 0xdd, 0xd8, 0x94, 0x75, 0x05, 0xd3, 0xe0, 0x4c, 0x8b, 0xb2, 0x11, 0x7f, 0x89, 0x6b,
+0x49, 0x7e, 0xfa, 0x20, 0x95, 0xfd, 0xf0, 0x79, 0x39, 0xfb, 0x7d, 0x89, 0xea, 0xfa, 0x05, 0x82,
+0xe7, 0xd6, 0x99, 0xa2, 0xb9, 0xa4, 0xa4, 0xb2, 0x4f, 0xd4, 0x84, 0x01, 0xe6, 0x0e, 0x83, 0x90,
+0x19, 0xe4, 0x51, 0xa4, 0x62, 0xfc, 0xed, 0xe0, 0xc5, 0x18, 0x4f, 0x82, 0x77, 0x63, 0xc5, 0x49,
+0xd8, 0xf6, 0x16, 0x33, 0xd2, 0xe1, 0x33, 0xc1, 0x4f, 0x50, 0x4f, 0x3e, 0x7c, 0x1e, 0xec, 0x5e,
+0x75, 0x1d, 0xe8, 0xd4, 0xec, 0x8a, 0x14, 0x40, 0xfb, 0x19, 0x49, 0x01, 0xbe, 0x1a, 0x0b, 0x18,
+0xbd, 0x25, 0xd3, 0x90, 0x28, 0x89, 0x14, 0x96, 0xfa, 0xd0, 0x88, 0xd5, 0xe8, 0x44, 0x8c, 0x78,
+0xea, 0x8e, 0x8c, 0xe2, 0x22, 0x89, 0xed, 0xc0, 0x88, 0x47, 0xc5, 0xaa, 0x5f, 0xbf, 0xeb, 0x02,
+0x6c, 0x07, 0x8a, 0xa2, 0x58, 0xcf, 0xf6, 0x97, 0x36, 0xdd, 0xad, 0x7e, 0xa8, 0x2d, 0x0d, 0xff,
+0xff, 0x7e, 0xc8, 0xa1, 0x91, 0xce, 0xdd, 0x43, 0xc1, 0xc5, 0xc3, 0x01, 0x4c, 0x27, 0x11, 0x29,
+0x9b, 0x59, 0xf7, 0x44, 0x61, 0x92, 0xac, 0x93, 0x59, 0x46, 0x1d, 0xb5, 0x9b, 0x18, 0xab, 0x7f,
+0x83, 0x3e, 0x70, 0x21, 0x98, 0x1c, 0xd0, 0x98, 0x64, 0x73, 0x1c, 0x61, 0x9a, 0xca, 0x51, 0xc3,
+0xc4, 0x9b, 0xfd, 0xd6, 0x0d, 0xda, 0x77, 0xa8, 0x67, 0xb4, 0x5f, 0x2e, 0x86, 0x15, 0x49, 0x01,
+0xce, 0xdc, 0xa4, 0x46, 0x08, 0xcf, 0x93, 0xbe, 0x43, 0x14, 0x9c, 0x44, 0xea, 0xc7, 0xd2, 0x2e,
+0x8f, 0xce, 0x54, 0xf5, 0x03, 0xbd, 0xea, 0xdb, 0xed, 0xdc, 0x8f, 0x01, 0x72, 0x13, 0x05, 0xc3,
+0xe7, 0xf4, 0x27, 0x9a, 0xc9, 0x6f, 0x30, 0xce, 0x6e, 0x4d, 0xfd, 0x06, 0x93, 0x38, 0xaa, 0xa0,
+0x8d, 0xae, 0x73, 0xe8, 0xa2, 0x56, 0x8c, 0x2e, 0x74, 0x31, 0x85, 0x53, 0x80, 0xb0, 0x34, 0x1e,
+0xf4, 0xc0, 0xd6, 0xdf, 0x9a, 0x7c, 0x07, 0x7a, 0x81, 0x39, 0x62, 0xdb, 0x1e, 0x3f, 0x77, 0xe0,
+0xef, 0x19, 0x3d, 0xd3, 0x56, 0x6a, 0xe1, 0x4d, 0x91, 0xde, 0x9b, 0x08, 0xab, 0x3f, 0x16, 0x30,
+0x23, 0x02, 0x87, 0x6e, 0xf4, 0x56, 0x85, 0x6b, 0x7a, 0xd6, 0x82, 0xf0, 0x81, 0x60, 0xef, 0x3e,
+0x3f, 0x20, 0xa3, 0xe7, 0x46, 0xc6, 0x11, 0x49, 0x1f, 0x52, 0x17, 0x88, 0x26, 0x5f, 0x3e, 0xbe,
+0x1d, 0x92, 0x77, 0x61, 0x52, 0xd2, 0x4e, 0x03, 0x6e, 0xd3, 0xba, 0x56, 0xb5, 0x66, 0x98, 0x6b,
+0xe1, 0x80, 0x97, 0x05, 0xae, 0x73, 0x4b, 0xee, 0x59, 0xf2, 0x1e, 0x63, 0x8d, 0x01, 0xe1, 0xdb,
+0xe2, 0x1f, 0x99, 0x2a, 0x9d, 0x13, 0x98, 0x20, 0x00, 0x00,
+};
+
+static const WebAsset WEB_ASSETS[] = {
+    { "/index.html", "text/html", "\"1e718c3e3f046c20\"", webAsset_index_html, sizeof(webAsset_index_html), false },
+    { "/script.js", "application/javascript", "\"fb9074ea01472dd3\"", webAsset_script_js, sizeof(webAsset_script_js), true },
+    { "/style.css", "text/css", "\"87e1220e70050388\"", webAsset_style_css, sizeof(webAsset_style_css), true },
+};
+static const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);
+
+#endif // WEB_ASSETS_H
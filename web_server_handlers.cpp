@@ -1,160 +1,368 @@
 // web_server_handlers.cpp
 #include "web_server_handlers.h"
 #include "globals.h"        // For 'server' object and currentSettings
-#include "settings_manager.h" // For saveSettings() and resetAppSettingsToDefaults()
+#include "settings_manager.h" // For staging settings changes and the JSON format
+#include "response_cache.h"   // For the pre-serialized live data / history payloads
+#include "static_assets.h"    // For serving the web UI from the not-found handler
+#include "metrics.h"          // For request counters/latency
+#include "geofence.h"         // For polygon zone upload
+#include "clip_player.h"      // For alarm clip upload
+#include "announcer.h"        // For announcement word clips
+#include "alarm_manager.h"    // For sound preview
+#include "power_manager.h"    // For keeping loop() responsive during an upload
 
 // --- API Handler Implementations ---
 
 // Handle GET request for current settings
-void handleGetSettings() {
+void handleGetSettings(AsyncWebServerRequest* request) {
+    metricsTrackRequest(request, ROUTE_SETTINGS);
     Serial.println(F("Received /getSettings request."));
-    DynamicJsonDocument doc(512); // Adjust size as needed
-
-    doc["ssid"] = currentSettings.ssid;
-    doc["password"] = currentSettings.password;
-    doc["apiServer"] = currentSettings.apiServer;
-    doc["apiKey"] = currentSettings.apiKey;
-    doc["latitude"] = currentSettings.latitude;
-    doc["longitude"] = currentSettings.longitude;
-    doc["radiusLevel1"] = currentSettings.radiusLevel1;
-    doc["radiusLevel2"] = currentSettings.radiusLevel2;
-    doc["radiusLevel3"] = currentSettings.radiusLevel3;
-    doc["noFlightScanFreq"] = currentSettings.noFlightScanFreq;
-    doc["flightPresentScanFreq"] = currentSettings.flightPresentScanFreq;
-    doc["soundWarning"] = currentSettings.soundWarning;
+    DynamicJsonDocument doc(SETTINGS_JSON_CAPACITY);
+
+    settingsToJson(currentSettings, doc);
 
     String responseJson;
     serializeJson(doc, responseJson);
-    server.send(200, "application/json", responseJson);
+    request->send(200, "application/json", responseJson);
     Serial.println(F("Sent settings JSON."));
 }
 
-// Handle POST request to save settings
-void handleSaveSettings() {
+// Collects a POST body as it arrives (possibly in several chunks), up to maxSize bytes.
+// The buffer lives in request->_tempObject, which the server frees with the request;
+// it stays null if the body is too large or memory runs out.
+static void collectRequestBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total, size_t maxSize) {
+    if (total > maxSize) {
+        return; // Rejected in the request handler (no body collected)
+    }
+    if (index == 0) {
+        request->_tempObject = malloc(total + 1);
+        if (!request->_tempObject) {
+            return;
+        }
+    }
+    if (request->_tempObject) {
+        memcpy((uint8_t*)request->_tempObject + index, data, len);
+        if (index + len == total) {
+            ((char*)request->_tempObject)[total] = '\0';
+        }
+    }
+}
+
+void handleSaveSettingsBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
+    const size_t MAX_SETTINGS_BODY = 3072; // Room for a full list of monitored sites
+    collectRequestBody(request, data, len, index, total, MAX_SETTINGS_BODY);
+}
+
+// Handle POST request to save settings (runs after the whole body was collected)
+void handleSaveSettings(AsyncWebServerRequest* request) {
+    metricsTrackRequest(request, ROUTE_SETTINGS);
     Serial.println(F("Received /saveSettings POST request."));
-    if (server.hasArg("plain")) {
-        String body = server.arg("plain");
+    if (request->_tempObject) {
+        const char* body = (const char*)request->_tempObject;
         Serial.print(F("Request body: "));
         Serial.println(body);
 
-        DynamicJsonDocument doc(512);
+        DynamicJsonDocument doc(SETTINGS_JSON_CAPACITY);
         DeserializationError error = deserializeJson(doc, body);
 
         if (error) {
             Serial.print(F("deserializeJson() failed: "));
             Serial.println(error.f_str());
-            server.send(400, "text/plain", "Invalid JSON data");
+            request->send(400, "text/plain", "Invalid JSON data");
             return;
         }
 
-        currentSettings.ssid = doc["ssid"].as<String>();
-        currentSettings.password = doc["password"].as<String>();
-        currentSettings.apiServer = doc["apiServer"].as<String>();
-        currentSettings.apiKey = doc["apiKey"].as<String>();
-        currentSettings.latitude = doc["latitude"].as<float>();
-        currentSettings.longitude = doc["longitude"].as<float>();
-        currentSettings.radiusLevel1 = doc["radiusLevel1"].as<float>();
-        currentSettings.radiusLevel2 = doc["radiusLevel2"].as<float>();
-        currentSettings.radiusLevel3 = doc["radiusLevel3"].as<float>();
-        currentSettings.noFlightScanFreq = doc["noFlightScanFreq"].as<int>();
-        currentSettings.flightPresentScanFreq = doc["flightPresentScanFreq"].as<int>();
-        currentSettings.soundWarning = doc["soundWarning"].as<bool>();
-
-        if (saveSettings()) {
-            Serial.println(F("Settings saved to SPIFFS."));
-            server.send(200, "text/plain", "Settings saved successfully!");
-        } else {
-            Serial.println(F("Failed to save settings to SPIFFS."));
-            server.send(500, "text/plain", "Failed to save settings to SPIFFS.");
-        }
+        // loop() stores and applies them: no flash write here, and a scan that is
+        // waiting on the network keeps reading unchanged settings
+        AppSettings settings = settingsForEdit();
+        settingsFromJson(doc, settings);
+        stageSettings(settings);
+        request->send(200, "text/plain", "Settings saved and applied.");
     } else {
-        Serial.println(F("No plain argument in POST request."));
-        server.send(400, "text/plain", "No data in request body.");
+        Serial.println(F("No body in POST request (missing or too large)."));
+        request->send(400, "text/plain", "No data in request body.");
     }
 }
 
 // Handle request to restore default settings
-void handleRestoreDefaults() {
+void handleRestoreDefaults(AsyncWebServerRequest* request) {
+    metricsTrackRequest(request, ROUTE_SETTINGS);
     Serial.println(F("Received /restoreDefaults request."));
-    if (resetAppSettingsToDefaults()) {
-        if (saveSettings()) {
-            Serial.println(F("Default settings restored and saved to SPIFFS."));
-            server.send(200, "text/plain", "Default settings restored. Reboot ESP to apply.");
-        } else {
-            Serial.println(F("Failed to save default settings to SPIFFS."));
-            server.send(500, "text/plain", "Failed to save default settings.");
+    stageDefaultSettings(); // Stored and applied by loop()
+    request->send(200, "text/plain", "Default settings restored and applied.");
+}
+
+// POST /uploadZones: binary zone list built by the web UI from a GeoJSON file (see geofence.h).
+// The zones are indexed here and take effect at once; loop() stores them through the
+// same path as a settings change.
+void handleUploadZonesBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
+    collectRequestBody(request, data, len, index, total, MAX_GEOFENCE_UPLOAD);
+}
+
+void handleUploadZones(AsyncWebServerRequest* request) {
+    metricsTrackRequest(request, ROUTE_SETTINGS);
+    if (!request->_tempObject) {
+        request->send(400, "text/plain", "Missing or too large zone upload.");
+        return;
+    }
+    size_t length = request->contentLength();
+    String message;
+    if (!importGeofences((const uint8_t*)request->_tempObject, length, message)) {
+        Serial.print(F("Zone upload rejected: "));
+        Serial.println(message);
+        request->send(400, "text/plain", message);
+        return;
+    }
+    Serial.print(F("Zones uploaded: "));
+    Serial.println(message);
+    settingsChangePending = true;
+    request->send(200, "text/plain", message);
+}
+
+// GET /getZones: names, levels and sizes of the current polygon zones
+void handleGetZones(AsyncWebServerRequest* request) {
+    metricsTrackRequest(request, ROUTE_SETTINGS);
+    GeofenceSetPtr set = currentGeofences();
+    DynamicJsonDocument doc(JSON_ARRAY_SIZE(set->zones.size()) + set->zones.size() * (JSON_OBJECT_SIZE(3) + 40));
+    JsonArray zones = doc.to<JsonArray>();
+    for (const GeofenceZone& zone : set->zones) {
+        JsonObject zoneObj = zones.createNestedObject();
+        zoneObj["name"] = zone.name;
+        zoneObj["level"] = zone.level;
+        zoneObj["vertices"] = zone.lat.size();
+    }
+    String responseJson;
+    serializeJson(doc, responseJson);
+    request->send(200, "application/json", responseJson);
+}
+
+static int clipLevelParam(AsyncWebServerRequest* request) {
+    return request->hasParam("level") ? request->getParam("level")->value().toInt() : 0;
+}
+
+// Clip file named by ?level=N (1-3) or ?unit=<announcement word>; empty if neither is valid
+static String clipUploadPath(AsyncWebServerRequest* request) {
+    if (request->hasParam("unit")) {
+        int unit = announceUnitIndex(request->getParam("unit")->value());
+        return unit < 0 ? String() : announceUnitPath(unit);
+    }
+    int level = clipLevelParam(request);
+    return level >= 1 && level <= 3 ? clipFilePath(level) : String();
+}
+
+// POST /uploadClip?level=N: a clip file (see clip_player.h) that replaces the built-in
+// clip for alarm level N. POST /uploadClip?unit=<word> stores a word for announcements.
+// Clips can be longer than free RAM, so the body is written to flash chunk by chunk
+// instead of being collected first. The network callbacks only queue the chunks;
+// serviceClipUpload() writes them from loop() and only then acknowledges them to TCP,
+// so the sender is held to one receive window and no flash write happens in a callback.
+// It also answers the request once the clip is in place. clip_player.cpp receives one
+// upload at a time: the request that started it owns it until it ends, and any other
+// upload meanwhile is answered with 409.
+static AsyncWebServerRequest* clipUploadRequest = nullptr;
+static String clipUploadTarget;  // Clip file being replaced
+static size_t clipUploadTotal = 0;
+static bool clipUploadOpened = false;   // beginClipUpload() has run
+static bool clipUploadReceived = false; // The whole body has arrived; answer once it is written
+static bool clipUploadAborted = false;  // The client went away; drop the upload
+static std::vector<std::vector<uint8_t>> clipUploadChunks; // Received, not yet written
+
+void handleUploadClipBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
+    if (index == 0 && clipUploadRequest == nullptr && !clipUploadAborted) {
+        String message;
+        if (!checkClipUpload(clipUploadPath(request), total, message)) {
+            return; // Answered with the reason by handleUploadClip()
         }
+        clipUploadRequest = request;
+        clipUploadTarget = clipUploadPath(request);
+        clipUploadTotal = total;
+        clipUploadOpened = false;
+        clipUploadReceived = false;
+        request->onDisconnect([request]() {
+            if (clipUploadRequest == request) { // Client went away before it was answered
+                clipUploadRequest = nullptr;
+                clipUploadAborted = true;
+            }
+        });
+    }
+    if (request == clipUploadRequest) {
+        clipUploadChunks.emplace_back(data, data + len);
+        request->client()->ackLater(); // Acknowledged once written
+        powerNoteWebActivity();        // Keeps loop() passes short until then
+    }
+}
+
+void handleUploadClip(AsyncWebServerRequest* request) {
+    metricsTrackRequest(request, ROUTE_SETTINGS);
+    if (request == clipUploadRequest) {
+        clipUploadReceived = true; // serviceClipUpload() answers
+        return;
+    }
+    String message;
+    if (clipUploadRequest != nullptr || clipUploadAborted) {
+        request->send(409, "text/plain", "Another sound upload is in progress; try again when it has finished.");
+    } else if (!checkClipUpload(clipUploadPath(request), request->contentLength(), message)) {
+        Serial.println("Clip upload rejected: " + message);
+        request->send(400, "text/plain", message);
     } else {
-        Serial.println(F("Failed to restore default settings in memory."));
-        server.send(500, "text/plain", "Failed to restore default settings in memory.");
+        request->send(500, "text/plain", "Upload could not be started.");
     }
 }
 
-// Handle request to reboot ESP
-void handleRebootESP() {
-    Serial.println(F("Received /rebootESP request. Restarting ESP..."));
-    server.send(200, "text/plain", "ESP is restarting...");
-    delay(100); // Give time for response to be sent
-    ESP.restart();
-}
-
-// Add implementations for handleGetLiveData() and handleGetScanHistory() here when ready
-
-void handleGetLiveData() {
-    Serial.println(F("Received /getLiveData request."));
-    DynamicJsonDocument doc(2048); // Adjust size based on expected flight data
-
-    doc["overallStatus"] = "ALL CLEAR"; // Placeholder
-    doc["overallLevel"] = 0; // Placeholder
-    doc["level1Count"] = 0; // Placeholder
-    doc["level2Count"] = 0; // Placeholder
-    doc["level3Count"] = 0; // Placeholder
-    doc["totalFlights"] = 0; // Placeholder
-
-    JsonArray flightsArray = doc.createNestedArray("currentFlights");
-    // Populate flightsArray with currentFlights data from globals.h
-    // Example:
-    // for (const FlightData& flight : currentFlights) {
-    //     JsonObject flightObj = flightsArray.add<JsonObject>();
-    //     flightObj["icao24"] = flight.icao24;
-    //     flightObj["callsign"] = flight.callsign;
-    //     flightObj["altitude_baro"] = flight.altitude_baro;
-    //     // ... add other flight data fields
-    // }
+/**
+ * @brief Writes queued clip upload chunks to the file system and answers the upload
+ * once it is complete. Call from loop().
+ */
+void serviceClipUpload() {
+    if (clipUploadAborted) {
+        clipUploadAborted = false;
+        clipUploadChunks.clear(); // Their connection is gone: nothing to acknowledge
+        if (clipUploadOpened) {
+            abortClipUpload();
+        }
+        clipUploadOpened = false;
+        Serial.println(F("Clip upload abandoned by the client."));
+        return;
+    }
+    if (clipUploadRequest == nullptr) {
+        return;
+    }
+    String message;
+    if (!clipUploadOpened) {
+        clipUploadOpened = true;
+        beginClipUpload(clipUploadTarget, clipUploadTotal, message); // On failure the writes are skipped and finishing reports it
+    }
+    for (const std::vector<uint8_t>& chunk : clipUploadChunks) {
+        writeClipUpload(chunk.data(), chunk.size());
+        clipUploadRequest->client()->ack(chunk.size());
+    }
+    clipUploadChunks.clear();
+    if (!clipUploadReceived) {
+        return;
+    }
+
+    AsyncWebServerRequest* request = clipUploadRequest;
+    clipUploadRequest = nullptr;
+    clipUploadOpened = false;
+    if (!finishClipUpload(message)) {
+        Serial.println("Clip upload rejected: " + message);
+        request->send(400, "text/plain", message);
+        return;
+    }
+    Serial.println(message);
+    request->send(200, "text/plain", message);
+}
 
+// POST /deleteClip?level=N: back to the built-in clip
+void handleDeleteClip(AsyncWebServerRequest* request) {
+    metricsTrackRequest(request, ROUTE_SETTINGS);
+    if (!deleteStoredClip(clipLevelParam(request))) {
+        request->send(404, "text/plain", "No uploaded clip for that level.");
+        return;
+    }
+    request->send(200, "text/plain", "Built-in clip restored.");
+}
+
+// POST /playClip?level=N: preview a level's sound, tone or clip (regardless of the sound warning setting)
+void handlePlayClip(AsyncWebServerRequest* request) {
+    metricsTrackRequest(request, ROUTE_SETTINGS);
+    int level = clipLevelParam(request);
+    if (level < 1 || level > 3) {
+        request->send(400, "text/plain", "Alarm level must be 1, 2 or 3.");
+        return;
+    }
+    playLevelSound(level);
+    request->send(200, "text/plain", "Playing.");
+}
+
+// GET /getClips: which levels use an uploaded clip, and its length
+void handleGetClips(AsyncWebServerRequest* request) {
+    metricsTrackRequest(request, ROUTE_SETTINGS);
+    StaticJsonDocument<JSON_ARRAY_SIZE(3) + 3 * JSON_OBJECT_SIZE(3)> doc;
+    JsonArray clips = doc.to<JsonArray>();
+    for (int level = 1; level <= 3; level++) {
+        uint32_t samples = storedClipSamples(level);
+        JsonObject clip = clips.createNestedObject();
+        clip["level"] = level;
+        clip["custom"] = samples != 0;
+        clip["seconds"] = samples / (float)AUDIO_SAMPLE_RATE;
+    }
     String responseJson;
     serializeJson(doc, responseJson);
-    server.send(200, "application/json", responseJson);
-    Serial.println("Sent live data JSON.");
-}
-
-void handleGetScanHistory() {
-    Serial.println(F("Received /getScanHistory request."));
-    DynamicJsonDocument doc(4096); // Adjust size based on expected history data (can be large)
-
-    JsonArray historyArray = doc.to<JsonArray>();
-    // Populate historyArray with scanHistory data from globals.h
-    // Example:
-    // for (const ScanHistoryEntry& entry : scanHistory) {
-    //     JsonObject entryObj = historyArray.add<JsonObject>();
-    //     entryObj["timestamp"] = entry.timestamp;
-    //     entryObj["level1"] = entry.level1;
-    //     entryObj["level2"] = entry.level2;
-    //     entryObj["level3"] = entry.level3;
-    //     entryObj["total"] = entry.total;
-    //     entryObj["status"] = entry.status;
-
-    //     JsonArray flightsAtScan = entryObj.createNestedArray("flights_at_scan");
-    //     for (const FlightData& flight : entry.flights_at_scan) {
-    //         JsonObject flightObj = flightsAtScan.add<JsonObject>();
-    //         flightObj["icao24"] = flight.icao24;
-    //         flightObj["callsign"] = flight.callsign;
-    //         // ... add other flight data fields
-    //     }
-    // }
+    request->send(200, "application/json", responseJson);
+}
 
+// GET /getVoiceUnits: the announcement words and which of them are uploaded
+void handleGetVoiceUnits(AsyncWebServerRequest* request) {
+    metricsTrackRequest(request, ROUTE_SETTINGS);
+    StaticJsonDocument<JSON_ARRAY_SIZE(ANNOUNCE_UNIT_COUNT) + ANNOUNCE_UNIT_COUNT * JSON_OBJECT_SIZE(2)> doc;
+    JsonArray units = doc.to<JsonArray>();
+    for (int i = 0; i < ANNOUNCE_UNIT_COUNT; i++) {
+        JsonObject unit = units.createNestedObject();
+        unit["name"] = ANNOUNCE_UNIT_NAMES[i];
+        unit["installed"] = announceUnitInstalled(i);
+    }
     String responseJson;
     serializeJson(doc, responseJson);
-    server.send(200, "application/json", responseJson);
-    Serial.println(F("Sent scan history JSON."));
+    request->send(200, "application/json", responseJson);
+}
+
+// Handle request to reboot ESP. The restart happens in loop(), after the reply has gone out.
+void handleRebootESP(AsyncWebServerRequest* request) {
+    metricsTrackRequest(request, ROUTE_SETTINGS);
+    Serial.println(F("Received /rebootESP request. Restarting ESP..."));
+    request->send(200, "text/plain", "ESP is restarting...");
+    rebootRequested = true;
+}
+
+// Live data and scan history are serialized once per scan by response_cache.cpp;
+// these handlers only hand out the current buffer (or a 304).
+// Clients sending "Accept: application/cbor" get the compact binary encoding.
+// ?nocache=1 serializes the JSON afresh for the request instead, so tools/load_test.py
+// can compare the cost of both paths (http_handler_cpu_microseconds_total).
+
+static bool clientAcceptsCbor(AsyncWebServerRequest* request) {
+    return request->hasHeader("Accept") && request->header("Accept").indexOf("application/cbor") >= 0;
+}
+
+// GET /getLiveData[?since=N]: with 'since', only the aircraft added, changed or removed
+// after scan sequence N (JSON, cached per scan with its own ETag); falls back to the
+// full snapshot when N is too old.
+void handleGetLiveData(AsyncWebServerRequest* request) {
+    metricsTrackRequest(request, ROUTE_LIVE_DATA);
+    uint32_t start = micros();
+    CachedResponsePtr response;
+    if (request->hasParam("nocache")) {
+        response = buildUncachedResponse(PAYLOAD_LIVE_DATA);
+    } else if (request->hasParam("since")) {
+        response = getLiveDataDeltaResponse(strtoul(request->getParam("since")->value().c_str(), nullptr, 10));
+    }
+    if (!response) {
+        response = clientAcceptsCbor(request) ? getLiveDataCborResponse() : getLiveDataResponse();
+    }
+    sendCachedResponse(request, response);
+    metricsRecordHandlerTime(ROUTE_LIVE_DATA, micros() - start);
+}
+
+void handleGetScanHistory(AsyncWebServerRequest* request) {
+    metricsTrackRequest(request, ROUTE_SCAN_HISTORY);
+    uint32_t start = micros();
+    if (request->hasParam("nocache")) {
+        sendCachedResponse(request, buildUncachedResponse(PAYLOAD_SCAN_HISTORY));
+    } else {
+        sendCachedResponse(request, clientAcceptsCbor(request) ? getScanHistoryCborResponse() : getScanHistoryResponse());
+    }
+    metricsRecordHandlerTime(ROUTE_SCAN_HISTORY, micros() - start);
+}
+
+// Fallback: static web UI assets, otherwise 404
+void handleNotFound(AsyncWebServerRequest* request) {
+    if (request->method() == HTTP_GET && serveStaticAsset(request)) {
+        metricsTrackRequest(request, ROUTE_STATIC);
+        return;
+    }
+    metricsTrackRequest(request, ROUTE_OTHER);
+    Serial.print(F("404 Not Found: "));
+    Serial.println(request->url());
+    request->send(404, "text/plain", "404: Not Found on Server. (General fallback)");
 }
@@ -3,21 +3,30 @@
 #define WEB_SERVER_HANDLERS_H
 
 #include <Arduino.h>
-#include <ESP8266WebServer.h> // For server object
-#include <FS.h>               // For SPIFFS (if handlers use it directly)
-#include <ArduinoJson.h>      // For JSON parsing/serialization in handlers
-#include <Esp.h>              // For ESP.restart() in handleRebootESP
+#include <ESPAsyncWebServer.h> // For AsyncWebServerRequest
+#include <FS.h>                // For SPIFFS (if handlers use it directly)
+#include <ArduinoJson.h>       // For JSON parsing/serialization in handlers
+#include <Esp.h>               // For ESP.restart() in handleRebootESP
 
 // Function declarations for API handlers
-void handleGetSettings();
-void handleSaveSettings();
-void handleRestoreDefaults();
-void handleRebootESP();
-// Declare Live Data/Scan History handlers here when you implement them
-void handleGetLiveData();
-void handleGetScanHistory();
-
-// If you had a setupWebServer() function, its declaration would go here too:
-// void setupWebServer();
+// Handlers run in the network stack's context: they must not block or delay().
+void handleGetSettings(AsyncWebServerRequest* request);
+void handleSaveSettings(AsyncWebServerRequest* request);
+void handleSaveSettingsBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total);
+void handleRestoreDefaults(AsyncWebServerRequest* request);
+void handleRebootESP(AsyncWebServerRequest* request);
+void handleUploadZones(AsyncWebServerRequest* request);
+void handleUploadZonesBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total);
+void handleGetZones(AsyncWebServerRequest* request);
+void handleUploadClip(AsyncWebServerRequest* request);
+void handleUploadClipBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total);
+void serviceClipUpload();
+void handleDeleteClip(AsyncWebServerRequest* request);
+void handlePlayClip(AsyncWebServerRequest* request);
+void handleGetClips(AsyncWebServerRequest* request);
+void handleGetVoiceUnits(AsyncWebServerRequest* request);
+void handleGetLiveData(AsyncWebServerRequest* request);
+void handleGetScanHistory(AsyncWebServerRequest* request);
+void handleNotFound(AsyncWebServerRequest* request);
 
 #endif // WEB_SERVER_HANDLERS_H
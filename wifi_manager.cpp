@@ -1,60 +1,360 @@
 // wifi_manager.cpp
+// Non-blocking station connection. WiFi event callbacks only record what happened;
+// handleWifiConnection() runs a small state machine from loop():
+//
+//   CONNECTING --got IP--> CONNECTED --lost--> CONNECTING (at once)
+//       |                                          ^
+//       +--failed/timed out--> BACKOFF --expired---+
+//
+// Backoff doubles from WIFI_BACKOFF_MIN_MS to WIFI_BACKOFF_MAX_MS. After a successful
+// connection the access point's BSSID and channel and the DHCP lease are cached in RTC
+// memory (it survives resets and deep sleep), so the next attempt skips the channel scan
+// and DHCP. A cached attempt that fails falls back to a full one at once.
+//
+// A cached attempt sets the leased address statically, and nothing renews a static
+// address. The cache therefore also records how much of the lease is left, rewritten
+// every WIFI_CACHE_REFRESH_MS while connected. Once less than WIFI_LEASE_MARGIN_S is
+// left, attempts go back to DHCP, and a connection still on the cached address
+// reconnects with DHCP.
+//
+// Without a connection since boot, the setup access point opens after WIFI_AP_FALLBACK_MS
+// (at once if no SSID is configured); the station keeps retrying next to it and the AP
+// closes when it connects.
 #include "wifi_manager.h"
+#include "metrics.h"   // For connect times
+#include <coredecls.h> // For crc32
+#include <lwip/netif.h> // For the DHCP lease
+#include <lwip/dhcp.h>
+
+enum WifiState : uint8_t {
+    WIFI_STATE_IDLE,       // No SSID configured
+    WIFI_STATE_CONNECTING,
+    WIFI_STATE_CONNECTED,
+    WIFI_STATE_BACKOFF
+};
+
+// Connection cache in RTC user memory; a multiple of 4 bytes
+struct WifiRtcCache {
+    uint32_t crc;      // Over the rest of the record
+    uint32_t ssidCrc;  // The cache only applies to the SSID it was made for
+    uint32_t ip;
+    uint32_t gateway;
+    uint32_t subnet;
+    uint32_t dns;
+    uint32_t leaseLeftS; // Of the address lease, when the record was written
+    uint8_t bssid[6];
+    uint8_t channel;
+    uint8_t reserved;
+};
+
+static WifiState state = WIFI_STATE_IDLE;
+static WifiRtcCache cache;
+static bool cacheValid = false;
+static bool attemptCached = false;   // The attempt in progress (or the connection) uses the cache
+static uint32_t cacheWrittenMs = 0;
+static uint32_t lastCacheRefreshMs = 0;  // When leaseLeftS was current; time across a reset is not counted
+static uint32_t attemptStartMs = 0;
+static uint32_t backoffStartMs = 0;
+static uint32_t backoffMs = 0;
+static uint32_t outageStartMs = 0;   // Since boot or since the connection was lost
+static bool everConnected = false;
+static bool apActive = false;
+
+static uint32_t connectsCached = 0;
+static uint32_t connectsFull = 0;
+static uint32_t lastConnectMs = 0;
+
+// Set by the event callbacks (system context), consumed in loop()
+static volatile bool gotIpEvent = false;
+static volatile bool disconnectedEvent = false;
+static WiFiEventHandler gotIpHandler;
+static WiFiEventHandler disconnectedHandler;
+
+static uint32_t ssidCrc() {
+    return crc32(currentSettings.ssid.c_str(), currentSettings.ssid.length());
+}
+
+static uint32_t cacheCrc(const WifiRtcCache& record) {
+    return crc32((const uint8_t*)&record + sizeof(record.crc), sizeof(record) - sizeof(record.crc));
+}
 
 /**
- * @brief Connects to WiFi or starts AP if connection fails.
+ * @brief Seconds of the cached address lease left now.
  */
-void connectWiFi() {
-    Serial.print(F("Connecting to WiFi: "));
-    Serial.println(currentSettings.ssid);
-
-    WiFi.mode(WIFI_STA);
-    //WiFi.begin(currentSettings.ssid.c_str(), currentSettings.password.c_str());
-    WiFi.begin("OnePlus NordCE 5G","c67hu553");
+static uint32_t cachedLeaseLeftS() {
+    uint32_t elapsedS = (millis() - cacheWrittenMs) / 1000;
+    return cache.leaseLeftS > elapsedS ? cache.leaseLeftS - elapsedS : 0;
+}
 
-    int attempts = 0;
-    while (WiFi.status() != WL_CONNECTED && attempts < 40) { // Try for 20 seconds
-        delay(500);
-        Serial.print(".");
-        attempts++;
+/**
+ * @brief Lease time the DHCP server granted the station's current address.
+ * @return Seconds, or 0 if the address did not come from DHCP.
+ */
+static uint32_t dhcpLeaseS() {
+    for (netif* intf = netif_list; intf != nullptr; intf = intf->next) {
+        const dhcp* client = netif_dhcp_data(intf);
+        if (client != nullptr && ip4_addr_get_u32(netif_ip4_addr(intf)) == (uint32_t)WiFi.localIP()) {
+            return client->offered_t0_lease;
+        }
     }
+    return 0;
+}
 
-    if (WiFi.status() == WL_CONNECTED) {
-        Serial.println(F("\nWiFi connected."));
-        Serial.print(F("IP Address: "));
-        Serial.println(WiFi.localIP());
-        timeClient.begin(); // Start NTP client once connected
+/**
+ * @brief Reads the connection cache from RTC memory; garbage after a power cycle fails the CRC.
+ */
+static void loadCache() {
+    cacheWrittenMs = millis();
+    cacheValid = ESP.rtcUserMemoryRead(WIFI_RTC_CACHE_BLOCK, (uint32_t*)&cache, sizeof(cache)) &&
+                 cache.crc == cacheCrc(cache) && cache.ssidCrc == ssidCrc();
+}
+
+/**
+ * @brief Rewrites the cache record in RTC memory with the lease left now.
+ * @param leaseLeftS Seconds of the address lease left.
+ */
+static void writeCache(uint32_t leaseLeftS) {
+    cache.leaseLeftS = leaseLeftS;
+    cacheWrittenMs = millis();
+    cache.crc = cacheCrc(cache);
+    cacheValid = ESP.rtcUserMemoryWrite(WIFI_RTC_CACHE_BLOCK, (uint32_t*)&cache, sizeof(cache));
+}
+
+/**
+ * @brief Records the current connection's access point and address in RTC memory.
+ */
+static void saveCache() {
+    cache.ssidCrc = ssidCrc();
+    cache.ip = WiFi.localIP();
+    cache.gateway = WiFi.gatewayIP();
+    cache.subnet = WiFi.subnetMask();
+    cache.dns = WiFi.dnsIP();
+    memcpy(cache.bssid, WiFi.BSSID(), sizeof(cache.bssid));
+    cache.channel = WiFi.channel();
+    cache.reserved = 0;
+    writeCache(dhcpLeaseS());
+}
+
+/**
+ * @brief Drops the connection cache, e.g. after the access point or network changed.
+ */
+static void invalidateCache() {
+    cacheValid = false;
+    cache.crc = ~cacheCrc(cache);
+    ESP.rtcUserMemoryWrite(WIFI_RTC_CACHE_BLOCK, (uint32_t*)&cache, sizeof(cache));
+}
+
+/**
+ * @brief Starts one connection attempt; returns at once.
+ */
+static void startAttempt(uint32_t now) {
+    attemptCached = cacheValid && cachedLeaseLeftS() > WIFI_LEASE_MARGIN_S;
+    if (attemptCached) {
+        WiFi.config(IPAddress(cache.ip), IPAddress(cache.gateway), IPAddress(cache.subnet), IPAddress(cache.dns));
+        WiFi.begin(currentSettings.ssid.c_str(), currentSettings.password.c_str(), cache.channel, cache.bssid);
     } else {
-        Serial.println(F("\nFailed to connect to WiFi. Starting AP mode."));
+        WiFi.config(IPAddress(0U), IPAddress(0U), IPAddress(0U)); // Back to DHCP
+        WiFi.begin(currentSettings.ssid.c_str(), currentSettings.password.c_str());
+    }
+    Serial.printf("Connecting to WiFi: %s%s\n", currentSettings.ssid.c_str(), attemptCached ? " (cached access point)" : "");
+    state = WIFI_STATE_CONNECTING;
+    attemptStartMs = now;
+}
+
+/**
+ * @brief Ends a failed attempt: retries a cached one in full at once, else backs off.
+ */
+static void attemptFailed(uint32_t now) {
+    WiFi.disconnect();
+    if (attemptCached) {
+        Serial.println(F("Cached WiFi connection failed; retrying with a full scan."));
+        invalidateCache();
+        startAttempt(now);
+        return;
+    }
+    backoffMs = backoffMs == 0 ? WIFI_BACKOFF_MIN_MS : min(backoffMs * 2, WIFI_BACKOFF_MAX_MS);
+    backoffStartMs = now;
+    state = WIFI_STATE_BACKOFF;
+    Serial.printf("WiFi connection failed; retrying in %u s.\n", backoffMs / 1000);
+}
+
+/**
+ * @brief The station has an address: records the connect time and caches the connection.
+ */
+static void connected(uint32_t now) {
+    state = WIFI_STATE_CONNECTED;
+    backoffMs = 0;
+    lastConnectMs = now - outageStartMs;
+    (attemptCached ? connectsCached : connectsFull)++;
+    metricsRecordWifiConnect(lastConnectMs);
+    Serial.printf("WiFi connected in %u ms. IP Address: %s\n", lastConnectMs, WiFi.localIP().toString().c_str());
+    if (!attemptCached) {
+        saveCache();
+    }
+    lastCacheRefreshMs = now;
+    if (apActive) {
+        dnsServer.stop();
+        WiFi.softAPdisconnect(true);
+        WiFi.mode(WIFI_STA);
+        apActive = false;
+        Serial.println(F("Setup AP closed."));
+    }
+    everConnected = true;
+}
+
+/**
+ * @brief While connected: keeps the lease left in the cache current, and leaves a cached
+ * (static) address for DHCP before its lease runs out.
+ */
+static void refreshCache(uint32_t now) {
+    if (now - lastCacheRefreshMs < WIFI_CACHE_REFRESH_MS) {
+        return;
+    }
+    lastCacheRefreshMs = now;
+    if (!attemptCached) {
+        // The DHCP client renews at half the lease, so at least half of it is always left
+        writeCache(dhcpLeaseS() / 2);
+        return;
+    }
+    uint32_t leaseLeftS = cachedLeaseLeftS();
+    if (leaseLeftS > WIFI_LEASE_MARGIN_S) {
+        writeCache(leaseLeftS);
+        return;
+    }
+    Serial.println(F("Cached WiFi address lease is running out; reconnecting with DHCP."));
+    invalidateCache();
+    WiFi.disconnect();
+    outageStartMs = now;
+    startAttempt(now);
+}
+
+/**
+ * @brief Starts connecting to the configured network, without waiting for the result.
+ * Call once from setup(); handleWifiConnection() takes it from there.
+ */
+void connectWiFi() {
+    WiFi.persistent(false);      // Credentials come from the settings; no flash write per attempt
+    WiFi.setAutoReconnect(false); // Reconnects are paced by the state machine
+    WiFi.mode(WIFI_STA);
+    gotIpHandler = WiFi.onStationModeGotIP([](const WiFiEventStationModeGotIP&) { gotIpEvent = true; });
+    disconnectedHandler = WiFi.onStationModeDisconnected([](const WiFiEventStationModeDisconnected& event) {
+        if (event.reason != WIFI_DISCONNECT_REASON_ASSOC_LEAVE) { // Not our own WiFi.disconnect()
+            disconnectedEvent = true;
+        }
+    });
+    loadCache();
+    outageStartMs = millis();
+    if (currentSettings.ssid.length() == 0) {
+        Serial.println(F("No WiFi network configured."));
+        state = WIFI_STATE_IDLE;
         startAP();
+        return;
     }
+    startAttempt(outageStartMs);
 }
 
 /**
- * @brief Starts Access Point (AP) mode for configuration.
+ * @brief Starts Access Point (AP) mode for configuration, next to the station.
  */
 void startAP() {
-    WiFi.mode(WIFI_AP);
+    WiFi.mode(WIFI_AP_STA);
     WiFi.softAP(AP_SSID, AP_PASSWORD);
     Serial.print(F("AP Started. IP Address: "));
     Serial.println(WiFi.softAPIP());
 
     // DNS server for captive portal
     dnsServer.start(53, "*", WiFi.softAPIP());
+    apActive = true;
 }
 
 /**
- * @brief Handles WiFi connection status in the loop.
- * If in STA mode and disconnected, attempts to reconnect.
- * If in AP mode, processes DNS requests.
+ * @brief Advances the connection state machine and serves the captive portal DNS.
+ * Call from loop(); never blocks.
  */
 void handleWifiConnection() {
-    if (WiFi.status() != WL_CONNECTED && WiFi.getMode() == WIFI_STA) {
-        Serial.println(F("WiFi disconnected. Attempting to reconnect..."));
-        connectWiFi(); // Try reconnecting
+    uint32_t now = millis();
+    if (gotIpEvent) {
+        gotIpEvent = false;
+        disconnectedEvent = false;
+        if (state == WIFI_STATE_CONNECTING) {
+            connected(now);
+        }
+    }
+    if (disconnectedEvent) {
+        disconnectedEvent = false;
+        if (state == WIFI_STATE_CONNECTED) {
+            Serial.println(F("WiFi disconnected. Reconnecting..."));
+            outageStartMs = now;
+            startAttempt(now);
+        } else if (state == WIFI_STATE_CONNECTING) {
+            attemptFailed(now);
+        }
+    }
+    switch (state) {
+        case WIFI_STATE_CONNECTING:
+            if (now - attemptStartMs >= (attemptCached ? WIFI_CACHED_TIMEOUT_MS : WIFI_CONNECT_TIMEOUT_MS)) {
+                attemptFailed(now);
+            }
+            break;
+        case WIFI_STATE_BACKOFF:
+            if (now - backoffStartMs >= backoffMs) {
+                startAttempt(now);
+            }
+            break;
+        case WIFI_STATE_CONNECTED:
+            refreshCache(now);
+            break;
+        default:
+            break;
     }
-    // If in AP mode, handle DNS requests
-    if (WiFi.getMode() == WIFI_AP) {
+    if (!everConnected && !apActive && state != WIFI_STATE_IDLE && now - outageStartMs >= WIFI_AP_FALLBACK_MS) {
+        startAP();
+    }
+    if (apActive) {
         dnsServer.processNextRequest();
     }
 }
+
+/**
+ * @brief Reconnects with the new credentials if the SSID or password changed.
+ * Call after new settings have been applied.
+ */
+void wifiSettingsChanged() {
+    if (WiFi.SSID() == currentSettings.ssid && WiFi.psk() == currentSettings.password) {
+        return;
+    }
+    Serial.println(F("WiFi settings changed. Reconnecting..."));
+    WiFi.disconnect();
+    loadCache(); // Invalid unless it was made for the new SSID
+    backoffMs = 0;
+    outageStartMs = millis();
+    if (currentSettings.ssid.length() == 0) {
+        state = WIFI_STATE_IDLE;
+        if (!apActive) {
+            startAP();
+        }
+        return;
+    }
+    startAttempt(outageStartMs);
+}
+
+/**
+ * @brief Successful connections since boot, by whether they used the RTC cache.
+ */
+uint32_t wifiConnectCount(bool cached) {
+    return cached ? connectsCached : connectsFull;
+}
+
+/**
+ * @brief Time from the last outage (or boot) until the station had an address.
+ */
+uint32_t wifiLastConnectMs() {
+    return lastConnectMs;
+}
+
+/**
+ * @brief true while the station is connected and has an address.
+ */
+bool wifiStationReady() {
+    return state == WIFI_STATE_CONNECTED;
+}
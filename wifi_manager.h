@@ -4,11 +4,24 @@
 
 #include <Arduino.h>
 #include <ESP8266WiFi.h>
-#include "globals.h" // For AppSettings, server, dnsServer, timeClient
+#include "globals.h" // For AppSettings, server, dnsServer
+
+const uint32_t WIFI_CONNECT_TIMEOUT_MS = 15000;  // One attempt with scan and DHCP
+const uint32_t WIFI_CACHED_TIMEOUT_MS = 3000;    // One attempt on the cached BSSID/channel/address
+const uint32_t WIFI_BACKOFF_MIN_MS = 1000;       // Doubles after each failed attempt...
+const uint32_t WIFI_BACKOFF_MAX_MS = 30000;      // ...up to this
+const uint32_t WIFI_AP_FALLBACK_MS = 20000;      // Without a connection since boot, open the setup AP after this
+const uint32_t WIFI_LEASE_MARGIN_S = 300;        // Cached address only used with more of its DHCP lease left than this
+const uint32_t WIFI_CACHE_REFRESH_MS = 60000;    // While connected, rewrite the lease left in the cache this often
+const uint32_t WIFI_RTC_CACHE_BLOCK = 0;         // RTC user memory offset (4-byte blocks) of the connection cache
 
 // Function declarations
 void connectWiFi();
 void startAP();
 void handleWifiConnection();
+void wifiSettingsChanged();
+uint32_t wifiConnectCount(bool cached);
+uint32_t wifiLastConnectMs();
+bool wifiStationReady();
 
 #endif // WIFI_MANAGER_H